@@ -27,6 +27,7 @@
 #include <base/combined-update-render/combined-update-render-controller-debug.h>
 #include <base/environment-options.h>
 #include <base/time-service.h>
+#include <portable/scoped-trace.h>
 #include <base/interfaces/adaptor-internal-services.h>
 
 namespace Dali
@@ -85,6 +86,8 @@ const unsigned int MAXIMUM_UPDATE_REQUESTS = 2;
 CombinedUpdateRenderController::CombinedUpdateRenderController( AdaptorInternalServices& adaptorInterfaces, const EnvironmentOptions& environmentOptions )
 : mFpsTracker( environmentOptions ),
   mUpdateStatusLogger( environmentOptions ),
+  mFramePacer( DEFAULT_FRAME_DURATION_IN_NANOSECONDS ),
+  mFramePacingEnabled( environmentOptions.GetFramePacing() ),
   mRenderHelper( adaptorInterfaces ),
   mEventThreadSemaphore(),
   mUpdateRenderThreadWaitCondition(),
@@ -374,6 +377,22 @@ void CombinedUpdateRenderController::UpdateRenderThread()
   {
     LOG_UPDATE_RENDER_TRACE;
 
+    if( mFramePacingEnabled )
+    {
+      DALI_TRACE_SCOPE( Trace::UPDATE, "FramePacing" );
+
+      // Start the frame as late as it can and still make its vsync, so it includes as much input as possible
+      uint64_t timeNow = 0;
+      TimeService::GetNanoseconds( timeNow );
+      TimeService::SleepUntil( mFramePacer.PlanFrame( timeNow, mDefaultFrameDurationNanoseconds ) );
+
+      if( mFramePacer.IsMissPredicted() )
+      {
+        AddPerformanceMarker( PerformanceInterface::FRAME_DEADLINE_MISS_PREDICTED );
+        LOG_UPDATE_RENDER( "Frame expected to miss its vsync, predicted cost(%llu)", mFramePacer.GetPredictedCost() );
+      }
+    }
+
     // Performance statistics are logged upon a VSYNC tick so use this point for a VSync marker
     AddPerformanceMarker( PerformanceInterface::VSYNC );
 
@@ -408,7 +427,8 @@ void CombinedUpdateRenderController::UpdateRenderThread()
     //////////////////////////////
 
     const unsigned int currentTime = currentFrameStartTime / NANOSECONDS_PER_MILLISECOND;
-    const unsigned int nextFrameTime = currentTime + mDefaultFrameDurationMilliseconds;
+    const unsigned int nextFrameTime = mFramePacingEnabled ? mFramePacer.GetDeadline() / NANOSECONDS_PER_MILLISECOND // The frame is presented on its deadline
+                                                           : currentTime + mDefaultFrameDurationMilliseconds;
 
     uint64_t noOfFramesSinceLastUpdate = 1;
     float frameDelta = 0.0f;
@@ -452,8 +472,23 @@ void CombinedUpdateRenderController::UpdateRenderThread()
     mCore.Render( renderStatus );
     AddPerformanceMarker( PerformanceInterface::RENDER_END );
 
+    uint64_t renderEndTime = 0;
+    TimeService::GetNanoseconds( renderEndTime );
+
     mRenderHelper.PostRender();
 
+    if( mFramePacingEnabled )
+    {
+      uint64_t swapEndTime = 0;
+      TimeService::GetNanoseconds( swapEndTime );
+
+      if( mFramePacer.FrameRendered( currentFrameStartTime, renderEndTime, swapEndTime ) )
+      {
+        AddPerformanceMarker( PerformanceInterface::FRAME_DEADLINE_MISSED );
+        LOG_UPDATE_RENDER( "Frame missed its vsync by %llu ns, misses(%u/%u)", renderEndTime - mFramePacer.GetDeadline(), mFramePacer.GetMissCount(), mFramePacer.GetFrameCount() );
+      }
+    }
+
     // Trigger event thread to request Update/Render thread to sleep if update not required
     if( ( Integration::KeepUpdating::NOT_REQUESTED == keepUpdatingStatus ) &&
         ! renderStatus.NeedsUpdate() )
@@ -471,8 +506,11 @@ void CombinedUpdateRenderController::UpdateRenderThread()
     // FRAME TIME
     //////////////////////////////
 
-    // Sleep until at least the the default frame duration has elapsed. This will return immediately if the specified end-time has already passed.
-    TimeService::SleepUntil( currentFrameStartTime + mDefaultFrameDurationNanoseconds );
+    if( ! mFramePacingEnabled )
+    {
+      // Sleep until at least the the default frame duration has elapsed. This will return immediately if the specified end-time has already passed.
+      TimeService::SleepUntil( currentFrameStartTime + mDefaultFrameDurationNanoseconds );
+    }
   }
 
   // Inform core of context destruction & shutdown EGL
@@ -487,6 +525,8 @@ void CombinedUpdateRenderController::UpdateRenderThread()
 
 bool CombinedUpdateRenderController::UpdateRenderReady( bool& useElapsedTime, bool updateRequired )
 {
+  DALI_TRACE_SCOPE( Trace::UPDATE, "WaitForUpdateRender" );
+
   useElapsedTime = true;
 
   ConditionalWait::ScopedLock updateLock( mUpdateRenderThreadWaitCondition );
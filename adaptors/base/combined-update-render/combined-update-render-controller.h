@@ -28,6 +28,7 @@
 #include <integration-api/thread-synchronization-interface.h>
 #include <base/interfaces/performance-interface.h>
 #include <base/fps-tracker.h>
+#include <base/frame-pacer.h>
 #include <base/render-helper.h>
 #include <base/thread-controller-interface.h>
 #include <base/update-status-logger.h>
@@ -69,6 +70,9 @@ class EnvironmentOptions;
  *  5. When we resume from paused, elapsed time is used for the animations, i.e. the could have finished while we were paused.
  *     However, FinishedSignal emission will only happen upon resumption.
  *  6. Elapsed time is NOT used while if we are waking up from a sleep state or doing an UpdateOnce.
+ *  7. If frame pacing is enabled, instead of sleeping after Render, we sleep before Update until the latest time at which
+ *     the frame is predicted to still make the next vsync (see FramePacer). Late frames are reported to the
+ *     PerformanceInterface.
  */
 class CombinedUpdateRenderController : public ThreadControllerInterface,
                                        public ThreadSynchronizationInterface
@@ -272,6 +276,8 @@ private:
 
   FpsTracker                        mFpsTracker;                       ///< Object that tracks the FPS
   UpdateStatusLogger                mUpdateStatusLogger;               ///< Object that logs the update-status as required.
+  FramePacer                        mFramePacer;                       ///< Chooses when to start each frame if frame pacing is enabled. Only used by the update-render thread.
+  const bool                        mFramePacingEnabled;               ///< Whether frames are paced. Set on construction only.
 
   RenderHelper                      mRenderHelper;                     ///< Helper class for EGL, pre & post rendering
 
@@ -38,6 +38,7 @@ namespace Adaptor
 namespace
 {
 const unsigned int DEFAULT_STATISTICS_LOG_FREQUENCY = 2;
+const unsigned int DEFAULT_THUMBNAIL_CACHE_SIZE = 32; // megabytes
 
 unsigned int GetIntegerEnvironmentVariable( const char* variable, unsigned int defaultValue )
 {
@@ -84,6 +85,8 @@ const char * GetCharEnvironmentVariable( const char * variable )
 EnvironmentOptions::EnvironmentOptions()
 : mWindowName(),
   mWindowClassName(),
+  mThumbnailCacheDirectory(),
+  mTraceFile(),
   mNetworkControl(0),
   mFpsFrequency(0),
   mUpdateStatusFrequency(0),
@@ -106,7 +109,16 @@ EnvironmentOptions::EnvironmentOptions()
   mWindowHeight( 0 ),
   mThreadingMode( ThreadingMode::COMBINED_UPDATE_RENDER ),
   mRenderRefreshRate( 1 ),
+  mResourceThreadCount( 1 ),
+  mImageScalingThreadCount( 1 ),
+  mThumbnailCacheSize( DEFAULT_THUMBNAIL_CACHE_SIZE ),
   mGlesCallAccumulate( false ),
+  mProgressiveImageLoading( false ),
+  mFramePacing( false ),
+  mTimerSlack( 0 ),
+  mTraceBufferSize( 0 ),
+  mTraceCategories( 0 ),
+  mTextureUploadBudget( 0 ),
   mLogFunction( NULL )
 {
   ParseEnvironmentOptions();
@@ -253,6 +265,61 @@ unsigned int EnvironmentOptions::GetRenderRefreshRate() const
   return mRenderRefreshRate;
 }
 
+unsigned int EnvironmentOptions::GetResourceThreadCount() const
+{
+  return mResourceThreadCount;
+}
+
+unsigned int EnvironmentOptions::GetImageScalingThreadCount() const
+{
+  return mImageScalingThreadCount;
+}
+
+bool EnvironmentOptions::GetProgressiveImageLoading() const
+{
+  return mProgressiveImageLoading;
+}
+
+const std::string& EnvironmentOptions::GetThumbnailCacheDirectory() const
+{
+  return mThumbnailCacheDirectory;
+}
+
+unsigned int EnvironmentOptions::GetThumbnailCacheSize() const
+{
+  return mThumbnailCacheSize;
+}
+
+bool EnvironmentOptions::GetFramePacing() const
+{
+  return mFramePacing;
+}
+
+unsigned int EnvironmentOptions::GetTimerSlack() const
+{
+  return mTimerSlack;
+}
+
+unsigned int EnvironmentOptions::GetTraceBufferSize() const
+{
+  return mTraceBufferSize;
+}
+
+const std::string& EnvironmentOptions::GetTraceFile() const
+{
+  return mTraceFile;
+}
+
+unsigned int EnvironmentOptions::GetTraceCategories() const
+{
+  return mTraceCategories;
+}
+
+unsigned int EnvironmentOptions::GetTextureUploadBudget() const
+{
+  return mTextureUploadBudget;
+}
+
 bool EnvironmentOptions::PerformanceServerRequired() const
 {
   return ( ( GetPerformanceStatsLoggingOptions() > 0) ||
@@ -380,6 +447,7 @@ void EnvironmentOptions::ParseEnvironmentOptions()
       case ThreadingMode::SEPARATE_UPDATE_RENDER:
       case ThreadingMode::COMBINED_UPDATE_RENDER:
       case ThreadingMode::SINGLE_THREADED:
+      case ThreadingMode::PIPELINED_UPDATE_RENDER:
       {
         mThreadingMode = static_cast< ThreadingMode::Type >( threadingMode );
         break;
@@ -396,6 +464,96 @@ void EnvironmentOptions::ParseEnvironmentOptions()
       mRenderRefreshRate = renderRefreshRate;
     }
   }
+
+  int resourceThreadCount(0);
+  if ( GetIntegerEnvironmentVariable( DALI_RESOURCE_THREAD_COUNT, resourceThreadCount ) )
+  {
+    // Only change it if it's valid
+    if( resourceThreadCount > 0 )
+    {
+      mResourceThreadCount = resourceThreadCount;
+    }
+  }
+
+  int imageScalingThreadCount(0);
+  if ( GetIntegerEnvironmentVariable( DALI_IMAGE_SCALING_THREAD_COUNT, imageScalingThreadCount ) )
+  {
+    // Only change it if it's valid
+    if( imageScalingThreadCount > 0 )
+    {
+      mImageScalingThreadCount = imageScalingThreadCount;
+    }
+  }
+
+  int progressiveImageLoading(0);
+  if ( GetIntegerEnvironmentVariable( DALI_PROGRESSIVE_IMAGE_LOADING, progressiveImageLoading ) )
+  {
+    mProgressiveImageLoading = progressiveImageLoading != 0;
+  }
+
+  const char * thumbnailCacheDirectory = GetCharEnvironmentVariable( DALI_THUMBNAIL_CACHE_DIRECTORY );
+  if ( thumbnailCacheDirectory )
+  {
+    mThumbnailCacheDirectory = thumbnailCacheDirectory;
+  }
+
+  int thumbnailCacheSize(0);
+  if ( GetIntegerEnvironmentVariable( DALI_THUMBNAIL_CACHE_SIZE, thumbnailCacheSize ) )
+  {
+    // Only change it if it's valid
+    if( thumbnailCacheSize > 0 )
+    {
+      mThumbnailCacheSize = thumbnailCacheSize;
+    }
+  }
+
+  int framePacing(0);
+  if ( GetIntegerEnvironmentVariable( DALI_FRAME_PACING, framePacing ) )
+  {
+    mFramePacing = framePacing != 0;
+  }
+
+  int timerSlack(0);
+  if ( GetIntegerEnvironmentVariable( DALI_TIMER_SLACK, timerSlack ) )
+  {
+    if( timerSlack > 0 )
+    {
+      mTimerSlack = timerSlack;
+    }
+  }
+
+  int traceBufferSize(0);
+  if ( GetIntegerEnvironmentVariable( DALI_TRACE_BUFFER_SIZE, traceBufferSize ) )
+  {
+    if( traceBufferSize > 0 )
+    {
+      mTraceBufferSize = traceBufferSize;
+    }
+  }
+
+  int traceCategories(0);
+  if ( GetIntegerEnvironmentVariable( DALI_TRACE_CATEGORIES, traceCategories ) )
+  {
+    if( traceCategories > 0 )
+    {
+      mTraceCategories = traceCategories;
+    }
+  }
+
+  int textureUploadBudget(0);
+  if ( GetIntegerEnvironmentVariable( DALI_TEXTURE_UPLOAD_BUDGET, textureUploadBudget ) )
+  {
+    if( textureUploadBudget > 0 )
+    {
+      mTextureUploadBudget = static_cast< unsigned int >( textureUploadBudget ) * 1024u;
+    }
+  }
+
+  const char * traceFile = GetCharEnvironmentVariable( DALI_TRACE_FILE );
+  if ( traceFile )
+  {
+    mTraceFile = traceFile;
+  }
 }
 
 } // Adaptor
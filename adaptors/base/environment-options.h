@@ -203,6 +203,61 @@ public:
    */
   unsigned int GetRenderRefreshRate() const;
 
+  /**
+   * @return The number of worker threads used to decode local image files.
+   */
+  unsigned int GetResourceThreadCount() const;
+
+  /**
+   * @return The number of threads used to scale down large images after loading.
+   */
+  unsigned int GetImageScalingThreadCount() const;
+
+  /**
+   * @return Whether large images deliver a preview before they finish loading.
+   */
+  bool GetProgressiveImageLoading() const;
+
+  /**
+   * @return The directory scaled images are persisted in, or an empty string if they are not.
+   */
+  const std::string& GetThumbnailCacheDirectory() const;
+
+  /**
+   * @return The maximum size of the persisted scaled images in megabytes.
+   */
+  unsigned int GetThumbnailCacheSize() const;
+
+  /**
+   * @return Whether frames are started as late as possible while still meeting the next vsync.
+   */
+  bool GetFramePacing() const;
+
+  /**
+   * @return How late, in milliseconds, timers may fire so that they can share a wakeup, zero if they are not coalesced.
+   */
+  unsigned int GetTimerSlack() const;
+
+  /**
+   * @return The number of markers kept per thread for the Chrome trace, or zero for the default.
+   */
+  unsigned int GetTraceBufferSize() const;
+
+  /**
+   * @return The file the Chrome trace is written to, or an empty string for the default.
+   */
+  const std::string& GetTraceFile() const;
+
+  /**
+   * @return Bitmask of the scoped trace categories to record, or zero for all of them.
+   */
+  unsigned int GetTraceCategories() const;
+
+  /**
+   * @return The bytes of texture data uploaded per frame before further uploads are deferred, or zero for no limit.
+   */
+  unsigned int GetTextureUploadBudget() const;
+
 private: // Internal
 
   /**
@@ -215,6 +270,8 @@ private: // Data
 
   std::string mWindowName;                        ///< name of the window
   std::string mWindowClassName;                   ///< name of the class the window belongs to
+  std::string mThumbnailCacheDirectory;           ///< where scaled images are persisted, or empty if they are not
+  std::string mTraceFile;                         ///< where the Chrome trace is written, or empty for the default
   unsigned int mNetworkControl;                   ///< whether network control is enabled
   unsigned int mFpsFrequency;                     ///< how often fps is logged out in seconds
   unsigned int mUpdateStatusFrequency;            ///< how often update status is logged out in frames
@@ -237,7 +294,16 @@ private: // Data
   unsigned int mWindowHeight;                     ///< height of the window
   ThreadingMode::Type mThreadingMode;             ///< threading mode
   unsigned int mRenderRefreshRate;                ///< render refresh rate
+  unsigned int mResourceThreadCount;              ///< number of image loading worker threads
+  unsigned int mImageScalingThreadCount;          ///< number of threads used to scale down large images
+  unsigned int mThumbnailCacheSize;               ///< maximum size of the thumbnail cache in megabytes
   bool mGlesCallAccumulate;                       ///< Whether or not to accumulate gles call statistics
+  bool mProgressiveImageLoading;                  ///< Whether or not large images deliver a preview before they finish loading
+  bool mFramePacing;                              ///< Whether or not frames are started as late as possible to meet the next vsync
+  unsigned int mTimerSlack;                       ///< how late timers may fire in milliseconds, so that they share wakeups
+  unsigned int mTraceBufferSize;                  ///< number of markers kept per thread for the Chrome trace
+  unsigned int mTraceCategories;                  ///< scoped trace categories to record, zero for all
+  unsigned int mTextureUploadBudget;              ///< bytes of texture data uploaded per frame, zero for no limit
 
   Dali::Integration::Log::LogFunction mLogFunction;
 
@@ -93,6 +93,64 @@ namespace Adaptor
 
 #define DALI_REFRESH_RATE "DALI_REFRESH_RATE"
 
+/**
+ * The number of worker threads decoding local image files concurrently
+ */
+#define DALI_RESOURCE_THREAD_COUNT "DALI_RESOURCE_THREAD_COUNT"
+
+/**
+ * The number of threads large images are split across when being scaled down after loading
+ */
+#define DALI_IMAGE_SCALING_THREAD_COUNT "DALI_IMAGE_SCALING_THREAD_COUNT"
+
+/**
+ * Whether large progressive JPEG and interlaced PNG images deliver a preview before they finish loading
+ */
+#define DALI_PROGRESSIVE_IMAGE_LOADING "DALI_PROGRESSIVE_IMAGE_LOADING"
+
+/**
+ * Directory to persist scaled images in across runs, so they need not be decoded again
+ */
+#define DALI_THUMBNAIL_CACHE_DIRECTORY "DALI_THUMBNAIL_CACHE_DIRECTORY"
+
+/**
+ * Maximum size of the thumbnail cache in megabytes
+ */
+#define DALI_THUMBNAIL_CACHE_SIZE "DALI_THUMBNAIL_CACHE_SIZE"
+
+/**
+ * Whether the combined update/render thread starts each frame as late as it can and still meet the next vsync
+ */
+#define DALI_FRAME_PACING "DALI_FRAME_PACING"
+
+/**
+ * How late, in milliseconds, event loop timers may fire so that they wake the event thread together
+ */
+#define DALI_TIMER_SLACK "DALI_TIMER_SLACK"
+
+/**
+ * Number of markers kept per thread when recording them for a Chrome trace,
+ * see OUTPUT_TRACE_RECORDER in performance-interface.h
+ */
+#define DALI_TRACE_BUFFER_SIZE "DALI_TRACE_BUFFER_SIZE"
+
+/**
+ * File the recorded Chrome trace is written to when the process receives SIGUSR2
+ */
+#define DALI_TRACE_FILE "DALI_TRACE_FILE"
+
+/**
+ * Which categories of scoped traces are recorded along with the markers, zero or unset for all of them,
+ * see Trace::Category in portable/scoped-trace.h for values. Only used if the library is built with --enable-trace.
+ */
+#define DALI_TRACE_CATEGORIES "DALI_TRACE_CATEGORIES"
+
+/**
+ * Kilobytes of texture data uploaded per frame, beyond which image loads and native bitmap buffer updates wait
+ * for a later frame. Zero or unset for no limit. Half is given to image loads and half to native bitmap buffers.
+ */
+#define DALI_TEXTURE_UPLOAD_BUDGET "DALI_TEXTURE_UPLOAD_BUDGET"
+
 } // namespace Adaptor
 
 } // namespace Internal
@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include "frame-pacer.h"
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace Adaptor
+{
+
+namespace
+{
+const uint64_t SAFETY_MARGIN_NANOSECONDS( 1000000u ); ///< Added to the predicted cost to allow for GPU work and scheduling latency
+const uint64_t COST_SMOOTHING( 8u );                  ///< Each frame moves the smoothed cost an eighth of the way to the new cost
+const uint64_t DEVIATION_SMOOTHING( 4u );             ///< Each frame moves the smoothed deviation a quarter of the way to the new deviation
+const uint64_t DEVIATION_MULTIPLIER( 2u );            ///< How many smoothed deviations to allow above the smoothed cost
+const uint64_t PHASE_SMOOTHING( 4u );                 ///< Each blocked swap moves the vsync phase a quarter of the way to the time it returned
+const uint64_t BLOCKED_SWAP_NANOSECONDS( 250000u );   ///< A swap taking longer than this blocked on the display
+} // unnamed namespace
+
+FramePacer::FramePacer( uint64_t vsyncPeriod )
+: mVsyncPeriod( vsyncPeriod ),
+  mVsyncTime( 0u ),
+  mDeadline( 0u ),
+  mCost( vsyncPeriod ), // Until a frame has been timed, assume it takes a whole vsync period
+  mDeviation( 0u ),
+  mFrameCount( 0u ),
+  mMissCount( 0u ),
+  mPredictedMissCount( 0u ),
+  mMissPredicted( false )
+{
+}
+
+FramePacer::~FramePacer()
+{
+}
+
+uint64_t FramePacer::PlanFrame( uint64_t currentTime, uint64_t frameDuration )
+{
+  if( mVsyncTime == 0u )
+  {
+    // Until a swap blocks on the display, assume a vsync is happening now
+    mVsyncTime = currentTime;
+  }
+
+  const uint64_t cost = GetPredictedCost();
+  uint64_t deadline = GetVsyncAtOrAfter( currentTime + cost );
+
+  mMissPredicted = false;
+  if( mDeadline != 0u )
+  {
+    // The vsync a whole frame after the previous deadline; rounded by half a period as the phase may have moved since
+    const uint64_t nextSlot = mDeadline + frameDuration;
+    const uint64_t halfPeriod = mVsyncPeriod / 2u;
+
+    if( deadline + halfPeriod < nextSlot )
+    {
+      // Do not present frames sooner than the refresh rate asks for
+      deadline = GetVsyncAtOrAfter( nextSlot - halfPeriod );
+    }
+    else if( ( deadline > nextSlot + halfPeriod ) && ( currentTime < nextSlot ) )
+    {
+      // Rendering continuously, but this frame is expected to take too long to make its slot
+      mMissPredicted = true;
+      ++mPredictedMissCount;
+    }
+  }
+  mDeadline = deadline;
+
+  const uint64_t startTime = deadline - cost;
+  return startTime > currentTime ? startTime : currentTime;
+}
+
+uint64_t FramePacer::GetDeadline() const
+{
+  return mDeadline;
+}
+
+bool FramePacer::IsMissPredicted() const
+{
+  return mMissPredicted;
+}
+
+bool FramePacer::FrameRendered( uint64_t frameStartTime, uint64_t renderEndTime, uint64_t swapEndTime )
+{
+  const uint64_t cost = renderEndTime > frameStartTime ? renderEndTime - frameStartTime : 0u;
+
+  if( mFrameCount == 0u )
+  {
+    mCost = cost;
+    mDeviation = cost / 2u;
+  }
+  else
+  {
+    const uint64_t deviation = cost > mCost ? cost - mCost : mCost - cost;
+    if( cost > mCost )
+    {
+      mCost += deviation / COST_SMOOTHING;
+    }
+    else
+    {
+      mCost -= deviation / COST_SMOOTHING;
+    }
+
+    if( deviation > mDeviation )
+    {
+      mDeviation += ( deviation - mDeviation ) / DEVIATION_SMOOTHING;
+    }
+    else
+    {
+      mDeviation -= ( mDeviation - deviation ) / DEVIATION_SMOOTHING;
+    }
+  }
+  ++mFrameCount;
+
+  const bool missed = renderEndTime > mDeadline;
+  if( missed )
+  {
+    ++mMissCount;
+
+    // Do not wait for the average to catch up with a sudden rise in cost
+    mCost = cost > mCost ? cost : mCost;
+  }
+
+  // A swap which blocked returned just after a vsync, so nudge the phase towards it
+  if( ( swapEndTime > renderEndTime ) && ( swapEndTime - renderEndTime > BLOCKED_SWAP_NANOSECONDS ) )
+  {
+    uint64_t previousVsync = GetVsyncAtOrAfter( swapEndTime );
+    if( previousVsync > swapEndTime )
+    {
+      previousVsync -= mVsyncPeriod;
+    }
+
+    const uint64_t offset = swapEndTime - previousVsync;
+    if( offset < mVsyncPeriod / 2u )
+    {
+      mVsyncTime = previousVsync + offset / PHASE_SMOOTHING;
+    }
+    else
+    {
+      mVsyncTime = previousVsync + mVsyncPeriod - ( mVsyncPeriod - offset ) / PHASE_SMOOTHING;
+    }
+  }
+
+  return missed;
+}
+
+uint64_t FramePacer::GetPredictedCost() const
+{
+  return mCost + DEVIATION_MULTIPLIER * mDeviation + SAFETY_MARGIN_NANOSECONDS;
+}
+
+unsigned int FramePacer::GetFrameCount() const
+{
+  return mFrameCount;
+}
+
+unsigned int FramePacer::GetMissCount() const
+{
+  return mMissCount;
+}
+
+unsigned int FramePacer::GetPredictedMissCount() const
+{
+  return mPredictedMissCount;
+}
+
+uint64_t FramePacer::GetVsyncAtOrAfter( uint64_t time ) const
+{
+  if( time <= mVsyncTime )
+  {
+    return mVsyncTime - ( ( mVsyncTime - time ) / mVsyncPeriod ) * mVsyncPeriod;
+  }
+  return mVsyncTime + ( ( time - mVsyncTime + mVsyncPeriod - 1u ) / mVsyncPeriod ) * mVsyncPeriod;
+}
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
@@ -0,0 +1,145 @@
+#ifndef __DALI_INTERNAL_FRAME_PACER_H__
+#define __DALI_INTERNAL_FRAME_PACER_H__
+
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <stdint.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace Adaptor
+{
+
+/**
+ * Decides when to start each frame so that it is ready just before the vsync it is
+ * presented on, rather than a fixed frame period after the previous frame started.
+ *
+ * Starting the frame as late as possible means input which arrives while waiting is
+ * still included in it, so it reaches the display up to a frame sooner.
+ *
+ * It keeps a rolling estimate of how long update and render take, as a smoothed mean
+ * plus a multiple of the smoothed deviation, and of the phase of the display's vsync.
+ * The phase is learnt from the times at which buffer swaps return after blocking on
+ * the display. When swaps never block the pacer runs on the nominal vsync period from
+ * the first frame.
+ *
+ * All times are in nanoseconds on the monotonic clock used by TimeService.
+ */
+class FramePacer
+{
+public:
+
+  /**
+   * Constructor.
+   * @param[in] vsyncPeriod The time between vsyncs of the display
+   */
+  FramePacer( uint64_t vsyncPeriod );
+
+  /**
+   * Non-virtual destructor; not intended as a base class.
+   */
+  ~FramePacer();
+
+  /**
+   * Choose the deadline of the next frame and the time to start it.
+   *
+   * The deadline is the first vsync a whole frame duration after the previous deadline
+   * which the frame can still make if started now.
+   * @param[in] currentTime The current time
+   * @param[in] frameDuration The time between frames, a multiple of the vsync period
+   * @return The time to start the frame, no earlier than currentTime
+   */
+  uint64_t PlanFrame( uint64_t currentTime, uint64_t frameDuration );
+
+  /**
+   * @return The vsync the frame planned last is to be presented on.
+   */
+  uint64_t GetDeadline() const;
+
+  /**
+   * @return Whether, when the last frame was planned, it was already too late to make the vsync due after the previous frame.
+   */
+  bool IsMissPredicted() const;
+
+  /**
+   * Record how long the frame planned last took, and whether it made its deadline.
+   * @param[in] frameStartTime When update started
+   * @param[in] renderEndTime When render finished, before the buffers were swapped
+   * @param[in] swapEndTime When the buffer swap returned
+   * @return true if render finished after the deadline
+   */
+  bool FrameRendered( uint64_t frameStartTime, uint64_t renderEndTime, uint64_t swapEndTime );
+
+  /**
+   * @return The time update and render are expected to take, including the safety margin.
+   */
+  uint64_t GetPredictedCost() const;
+
+  /**
+   * @return The number of frames recorded.
+   */
+  unsigned int GetFrameCount() const;
+
+  /**
+   * @return The number of frames which finished rendering after their deadline.
+   */
+  unsigned int GetMissCount() const;
+
+  /**
+   * @return The number of frames which were known to be late when they were planned.
+   */
+  unsigned int GetPredictedMissCount() const;
+
+private:
+
+  /**
+   * @return The first vsync at or after the given time.
+   */
+  uint64_t GetVsyncAtOrAfter( uint64_t time ) const;
+
+  // Undefined
+  FramePacer( const FramePacer& framePacer );
+
+  // Undefined
+  FramePacer& operator=( const FramePacer& framePacer );
+
+private: // Data
+
+  const uint64_t mVsyncPeriod;      ///< The time between vsyncs
+  uint64_t mVsyncTime;              ///< The time of a recent vsync, zero until the first frame is planned
+  uint64_t mDeadline;               ///< The vsync the frame planned last is to be presented on
+  uint64_t mCost;                   ///< Smoothed time from the start of update to the end of render
+  uint64_t mDeviation;              ///< Smoothed deviation of the cost from mCost
+  unsigned int mFrameCount;         ///< How many frames have been recorded
+  unsigned int mMissCount;          ///< How many frames finished after their deadline
+  unsigned int mPredictedMissCount; ///< How many frames were planned already late
+  bool mMissPredicted;              ///< Whether the frame planned last was planned already late
+};
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // __DALI_INTERNAL_FRAME_PACER_H__
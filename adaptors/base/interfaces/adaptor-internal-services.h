@@ -30,6 +30,7 @@
 #include <base/interfaces/performance-interface.h>
 #include <base/interfaces/vsync-monitor-interface.h>
 #include <base/interfaces/trace-interface.h>
+#include <portable/texture-upload-budget.h>
 #include <render-surface.h>
 
 
@@ -114,6 +115,11 @@ public:
    */
   virtual TraceInterface& GetSystemTraceInterface()  = 0;
 
+  /**
+   * @return the budget of texture data uploaded per frame by the render thread
+   */
+  virtual TextureUploadBudget& GetTextureUploadBudget() = 0;
+
 
 protected:
 
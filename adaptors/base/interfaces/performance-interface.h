@@ -77,6 +77,7 @@ public:
     OUTPUT_KERNEL_TRACE          = 1 << 1, ///< Bit 1 (2), log makers to kernel trace
     OUTPUT_SYSTEM_TRACE          = 1 << 2, ///< Bit 2 (4), log markers to system trace
     OUTPUT_NETWORK               = 1 << 3, ///< Bit 3 (8), log markers to network client
+    OUTPUT_TRACE_RECORDER        = 1 << 4, ///< Bit 4 (16), record markers in memory, to be dumped as a Chrome trace on request
   };
 
   /**
@@ -97,6 +98,8 @@ public:
     PROCESS_EVENTS_END,   ///< Process events end
     PAUSED       ,        ///< Pause start
     RESUME       ,        ///< Resume start
+    FRAME_DEADLINE_MISSED,         ///< A paced frame finished rendering after the vsync it was meant for
+    FRAME_DEADLINE_MISS_PREDICTED, ///< A paced frame was expected to be late when it was started
     START        ,        ///< The start of custom tracking
     END                   ///< The end of custom tracking
   };
@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include "frame-time-histogram.h"
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace Adaptor
+{
+
+FrameTimeHistogram::FrameTimeHistogram( unsigned int budget )
+: mCount( 0u ),
+  mOverBudgetCount( 0u ),
+  mMaximum( 0u ),
+  mBudget( budget )
+{
+  Reset();
+}
+
+FrameTimeHistogram::~FrameTimeHistogram()
+{
+}
+
+void FrameTimeHistogram::Record( unsigned int microseconds )
+{
+  __sync_fetch_and_add( &mBuckets[ GetBucketIndex( microseconds ) ], 1u );
+  __sync_fetch_and_add( &mCount, 1u );
+
+  if( microseconds > mBudget )
+  {
+    __sync_fetch_and_add( &mOverBudgetCount, 1u );
+  }
+
+  unsigned int maximum = mMaximum;
+  while( microseconds > maximum )
+  {
+    // Another thread may have raised the maximum in the meantime, in which case try again with its value
+    maximum = __sync_val_compare_and_swap( &mMaximum, maximum, microseconds );
+  }
+}
+
+void FrameTimeHistogram::Reset()
+{
+  for( unsigned int i = 0; i < BUCKET_COUNT; ++i )
+  {
+    mBuckets[i] = 0u;
+  }
+  mCount = 0u;
+  mOverBudgetCount = 0u;
+  mMaximum = 0u;
+
+  __sync_synchronize();
+}
+
+unsigned int FrameTimeHistogram::GetCount() const
+{
+  return mCount;
+}
+
+unsigned int FrameTimeHistogram::GetOverBudgetCount() const
+{
+  return mOverBudgetCount;
+}
+
+unsigned int FrameTimeHistogram::GetBudget() const
+{
+  return mBudget;
+}
+
+unsigned int FrameTimeHistogram::GetMaximum() const
+{
+  return mMaximum;
+}
+
+unsigned int FrameTimeHistogram::GetPercentile( float percentile ) const
+{
+  // Sum the buckets rather than use mCount, which may already include a duration still being counted
+  unsigned int count = 0u;
+  for( unsigned int i = 0; i < BUCKET_COUNT; ++i )
+  {
+    count += mBuckets[i];
+  }
+
+  if( count == 0u )
+  {
+    return 0u;
+  }
+
+  // The rank of the duration wanted, rounded up so that e.g. the 99th percentile of 10 durations is the longest
+  const double exactRank = static_cast< double >( count ) * percentile / 100.0;
+  unsigned int rank = static_cast< unsigned int >( exactRank );
+  if( rank < exactRank || rank == 0u )
+  {
+    ++rank;
+  }
+
+  const unsigned int maximum = mMaximum;
+  unsigned int total = 0u;
+  for( unsigned int i = 0; i < BUCKET_COUNT; ++i )
+  {
+    total += mBuckets[i];
+    if( total >= rank )
+    {
+      const unsigned int upperBound = GetBucketUpperBound( i );
+      return ( upperBound < maximum ) && ( i + 1u < BUCKET_COUNT ) ? upperBound : maximum;
+    }
+  }
+
+  return maximum;
+}
+
+unsigned int FrameTimeHistogram::GetBucketIndex( unsigned int microseconds )
+{
+  if( microseconds < SUB_BUCKET_COUNT )
+  {
+    // Short durations are counted exactly
+    return microseconds;
+  }
+
+  // Position of the highest set bit, which is at least SUB_BUCKET_BITS
+  const unsigned int exponent = ( sizeof( unsigned int ) * 8u - 1u ) - __builtin_clz( microseconds );
+  if( exponent > MAXIMUM_EXPONENT )
+  {
+    return BUCKET_COUNT - 1u;
+  }
+
+  // The next SUB_BUCKET_BITS bits after the highest choose the bucket within the power of two
+  const unsigned int subBucket = ( microseconds >> ( exponent - SUB_BUCKET_BITS ) ) - SUB_BUCKET_COUNT;
+  return ( exponent - SUB_BUCKET_BITS + 1u ) * SUB_BUCKET_COUNT + subBucket;
+}
+
+unsigned int FrameTimeHistogram::GetBucketUpperBound( unsigned int index )
+{
+  if( index < SUB_BUCKET_COUNT )
+  {
+    return index;
+  }
+
+  const unsigned int shift = index / SUB_BUCKET_COUNT - 1u;
+  const unsigned int subBucket = index % SUB_BUCKET_COUNT;
+  return ( ( SUB_BUCKET_COUNT + subBucket + 1u ) << shift ) - 1u;
+}
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
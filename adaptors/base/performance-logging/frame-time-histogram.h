@@ -0,0 +1,136 @@
+#ifndef __DALI_INTERNAL_ADAPTOR_FRAME_TIME_HISTOGRAM_H__
+#define __DALI_INTERNAL_ADAPTOR_FRAME_TIME_HISTOGRAM_H__
+
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace Adaptor
+{
+
+/**
+ * Histogram of durations in microseconds, used to report percentiles of frame times.
+ *
+ * Durations are counted in log-linear buckets: each power of two is split into 16 equal buckets, so a percentile is
+ * reported to within 1/16 (6.25%) of the true duration, however long the durations are. Durations from one
+ * microsecond up to about a minute are counted separately; longer ones are counted with the longest.
+ *
+ * The buckets are a fixed size array, so memory use is constant however many durations are recorded.
+ * Durations may be recorded from any thread without a lock, while another thread reads the histogram.
+ */
+class FrameTimeHistogram
+{
+public:
+
+  static const unsigned int DEFAULT_BUDGET = 16667u; ///< One frame at 60 frames per second, in microseconds
+
+  /**
+   * Constructor
+   * @param[in] budget Durations longer than this, in microseconds, are counted as over budget
+   */
+  FrameTimeHistogram( unsigned int budget = DEFAULT_BUDGET );
+
+  /**
+   * Destructor, not intended as a base class
+   */
+  ~FrameTimeHistogram();
+
+  /**
+   * Records a duration. Can be called from any thread.
+   * @param[in] microseconds The duration
+   */
+  void Record( unsigned int microseconds );
+
+  /**
+   * Clears all the recorded durations.
+   * Durations recorded by other threads while this is called may or may not be kept.
+   */
+  void Reset();
+
+  /**
+   * @return The number of durations recorded
+   */
+  unsigned int GetCount() const;
+
+  /**
+   * @return The number of durations recorded which were longer than the budget
+   */
+  unsigned int GetOverBudgetCount() const;
+
+  /**
+   * @return The budget in microseconds
+   */
+  unsigned int GetBudget() const;
+
+  /**
+   * @return The longest duration recorded in microseconds
+   */
+  unsigned int GetMaximum() const;
+
+  /**
+   * Gets the duration which the given percentage of recorded durations are no longer than.
+   * @param[in] percentile The percentage, e.g. 99.9f
+   * @return The duration in microseconds, or zero if nothing has been recorded
+   */
+  unsigned int GetPercentile( float percentile ) const;
+
+private:
+
+  /**
+   * @param[in] microseconds A duration
+   * @return The index of the bucket the duration is counted in
+   */
+  static unsigned int GetBucketIndex( unsigned int microseconds );
+
+  /**
+   * @param[in] index A bucket index
+   * @return The longest duration counted in the bucket
+   */
+  static unsigned int GetBucketUpperBound( unsigned int index );
+
+  // Undefined copy constructor.
+  FrameTimeHistogram( const FrameTimeHistogram& );
+
+  // Undefined assignment operator.
+  FrameTimeHistogram& operator=( const FrameTimeHistogram& );
+
+private:
+
+  static const unsigned int SUB_BUCKET_BITS = 4u;                                 ///< Each power of two is split into 2^4 buckets
+  static const unsigned int SUB_BUCKET_COUNT = 1u << SUB_BUCKET_BITS;             ///< Number of buckets per power of two
+  static const unsigned int MAXIMUM_EXPONENT = 25u;                               ///< Durations of 2^26 microseconds (67 seconds) or more are counted with the longest
+  static const unsigned int BUCKET_COUNT = ( MAXIMUM_EXPONENT - SUB_BUCKET_BITS + 2u ) * SUB_BUCKET_COUNT; ///< Total number of buckets
+
+  volatile unsigned int mBuckets[ BUCKET_COUNT ]; ///< Number of durations counted in each bucket
+  volatile unsigned int mCount;                   ///< Number of durations recorded
+  volatile unsigned int mOverBudgetCount;         ///< Number of durations recorded which were longer than the budget
+  volatile unsigned int mMaximum;                 ///< Longest duration recorded
+  const unsigned int mBudget;                     ///< Durations longer than this are over budget
+};
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // __DALI_INTERNAL_ADAPTOR_FRAME_TIME_HISTOGRAM_H__
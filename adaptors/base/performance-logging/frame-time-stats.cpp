@@ -39,8 +39,6 @@ const float ONE_OVER_MICROSECONDS_TO_SECONDS = 1.f / 1000000.f; ///< microsecond
 FrameTimeStats::FrameTimeStats()
 : mTotal( 0.f)
 {
-  mSamples.Reserve( 16 );   // Fill out a little to avoid early reallocations
-
   Reset();
 }
 
@@ -74,7 +72,10 @@ void FrameTimeStats::EndTime( const FrameTimeStamp& timeStamp )
   // frame time in seconds
   unsigned int elapsedTime = FrameTimeStamp::MicrosecondDiff( mStart, timeStamp);
 
-  mSamples.PushBack( elapsedTime );
+  mSum += elapsedTime;
+  mSumOfSquares += static_cast< uint64_t >( elapsedTime ) * elapsedTime;
+  mHistogram.Record( elapsedTime );
+  mPeriodHistogram.Record( elapsedTime );
 
   // if the min and max times haven't been set, do that now.
   if( !mMinMaxTimeSet )
@@ -98,6 +99,19 @@ void FrameTimeStats::EndTime( const FrameTimeStamp& timeStamp )
   mTotal += elapsedTime;
 }
 
+void FrameTimeStats::LapTime( const FrameTimeStamp& timeStamp, unsigned int maximumLapTime )
+{
+  if( ( mTimeState == WAITING_FOR_END_TIME ) &&
+      ( FrameTimeStamp::MicrosecondDiff( mStart, timeStamp ) <= maximumLapTime ) )
+  {
+    EndTime( timeStamp );
+  }
+
+  // the next lap starts now, whether or not the last one was recorded
+  mStart = timeStamp;
+  mTimeState = WAITING_FOR_END_TIME;
+}
+
 void FrameTimeStats::Reset()
 {
   mTimeState = WAITING_FOR_START_TIME;
@@ -105,7 +119,9 @@ void FrameTimeStats::Reset()
   mMin = 0.f;
   mMax = 0.f;
   mRunCount = 0;
-  mSamples.Clear();
+  mSum = 0u;
+  mSumOfSquares = 0u;
+  mPeriodHistogram.Reset();
 }
 
 float FrameTimeStats::GetMaxTime() const
@@ -130,37 +146,19 @@ unsigned int FrameTimeStats::GetRunCount() const
 
 void FrameTimeStats::CalculateMean( float& meanOut, float& standardDeviationOut ) const
 {
-  if( mSamples.Size() > 0 )
+  if( mRunCount > 0 )
   {
-    // Mean
-    unsigned int sum = 0;
-    for( Samples::ConstIterator it = mSamples.Begin(), itEnd = mSamples.End(); it != itEnd; ++it )
-    {
-      unsigned int value = *it;
-
-      sum += value;
-    }
+    const double mean = static_cast<double>( mSum ) / mRunCount;
 
-    meanOut = static_cast<float>(sum) / mSamples.Size();
-
-    // Variance
-    float variance = 0.0f;
-    for( Samples::ConstIterator it = mSamples.Begin(), itEnd = mSamples.End(); it != itEnd; ++it )
+    // Variance is the mean of the squares minus the square of the mean
+    double variance = static_cast<double>( mSumOfSquares ) / mRunCount - mean * mean;
+    if( variance < 0.0 )
     {
-      unsigned int value = *it;
-
-      float difference = static_cast<float>(value) - meanOut;
-
-      variance += difference * difference;
+      variance = 0.0; // rounding
     }
 
-    variance /= mSamples.Size();
-
-    // Standard deviation
-    standardDeviationOut = sqrtf( variance );
-
-    meanOut *= ONE_OVER_MICROSECONDS_TO_SECONDS;
-    standardDeviationOut *= ONE_OVER_MICROSECONDS_TO_SECONDS;
+    meanOut = static_cast<float>( mean ) * ONE_OVER_MICROSECONDS_TO_SECONDS;
+    standardDeviationOut = sqrtf( static_cast<float>( variance ) ) * ONE_OVER_MICROSECONDS_TO_SECONDS;
   }
   else
   {
@@ -169,6 +167,16 @@ void FrameTimeStats::CalculateMean( float& meanOut, float& standardDeviationOut
   }
 }
 
+const FrameTimeHistogram& FrameTimeStats::GetHistogram() const
+{
+  return mHistogram;
+}
+
+const FrameTimeHistogram& FrameTimeStats::GetPeriodHistogram() const
+{
+  return mPeriodHistogram;
+}
+
 
 } // namespace Adaptor
 
@@ -18,9 +18,12 @@
  *
  */
 
+// EXTERNAL INCLUDES
+#include <stdint.h>
+
 // INTERNAL INCLUDES
 #include <base/performance-logging/frame-time-stamp.h>
-#include <dali/public-api/common/dali-vector.h>
+#include <base/performance-logging/frame-time-histogram.h>
 
 
 namespace Dali
@@ -36,6 +39,9 @@ namespace Adaptor
  * Used to get statistics about time stamps over a period of time.
  * E.g. the min, max, total and average time spent inside two markers,
  * such as UPDATE_START and UPDATE_END
+ *
+ * Histograms of the times recorded are also kept, to report percentiles: one since the last reset, and one of
+ * every time recorded which, like the total time, is not reset. Memory use is constant however many times are recorded.
  */
 struct FrameTimeStats
 {
@@ -61,6 +67,14 @@ struct FrameTimeStats
     */
    void EndTime( const FrameTimeStamp& timeStamp );
 
+   /**
+    * Timer lap time, ending one period and starting the next at the same time stamp, e.g. from one v-sync to the next.
+    * A lap longer than the maximum is not recorded, as the thread slept rather than worked through it.
+    * @param timeStamp time stamp
+    * @param maximumLapTime the longest lap recorded, in microseconds
+    */
+   void LapTime( const FrameTimeStamp& timeStamp, unsigned int maximumLapTime );
+
    /**
     * Reset all internal counters / state except total time.
     */
@@ -94,6 +108,16 @@ struct FrameTimeStats
     */
    void CalculateMean( float& meanOut, float& standardDeviationOut ) const;
 
+   /**
+    * @return the histogram of all the times recorded, which is not reset
+    */
+   const FrameTimeHistogram& GetHistogram() const;
+
+   /**
+    * @return the histogram of the times recorded since the last reset
+    */
+   const FrameTimeHistogram& GetPeriodHistogram() const;
+
 private:
 
    /**
@@ -105,9 +129,11 @@ private:
      WAITING_FOR_END_TIME       ///< waiting for end time marker
    };
 
-   typedef Dali::Vector< unsigned int > Samples;
-   Samples mSamples;
+   FrameTimeHistogram mHistogram;      ///< histogram of all the times recorded
+   FrameTimeHistogram mPeriodHistogram; ///< histogram of the times recorded since the last reset
 
+   uint64_t mSum;                      ///< sum of the times since the last reset, in microseconds
+   uint64_t mSumOfSquares;             ///< sum of the squares of the times since the last reset
    unsigned int mMin;                  ///< current minimum value in microseconds
    unsigned int mMax;                  ///< current maximum value in microseconds
    unsigned int mTotal;                ///< current total in in microseconds
@@ -26,6 +26,9 @@
 #include <dali/public-api/dali-core.h>
 #include <dali/integration-api/debug.h>
 
+// INTERNAL INCLUDES
+#include <gl-statistics.h>
+
 
 namespace  // un-named namespace
 {
@@ -331,6 +334,34 @@ void DumpScene( unsigned int clientId, ClientSendDataInterface* sendData )
   sendData->SendData( json.c_str(), json.length(), clientId );
 }
 
+void DumpGlStatistics( unsigned int clientId, ClientSendDataInterface* sendData )
+{
+  std::ostringstream json;
+  GlStatistics::Frame frame;
+  if( GlStatistics::GetLastFrame( frame ) )
+  {
+    json << "{\"frame\":" << frame.frameNumber
+         << ",\"drawCalls\":" << frame.drawCalls
+         << ",\"stateChanges\":" << frame.stateChanges
+         << ",\"uniformCalls\":" << frame.uniformCalls
+         << ",\"textureUploads\":" << frame.textureUploads
+         << ",\"textureUploadBytes\":" << frame.textureUploadBytes
+         << ",\"bufferUploads\":" << frame.bufferUploads
+         << ",\"bufferUploadBytes\":" << frame.bufferUploadBytes
+         << ",\"buffers\":" << frame.bufferCount
+         << ",\"textures\":" << frame.textureCount
+         << ",\"programs\":" << frame.programCount
+         << ",\"deferredUploads\":" << frame.deferredUploads
+         << "}\n";
+  }
+  else
+  {
+    json << "GL statistics are not available\n";
+  }
+  const std::string response( json.str() );
+  sendData->SendData( response.c_str(), response.length(), clientId );
+}
+
 } // namespace Automation
 
 } // namespace Internal
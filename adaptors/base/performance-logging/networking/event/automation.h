@@ -65,6 +65,13 @@ void SetProperty( const std::string& message );
  */
 void DumpScene( unsigned int clientId, ClientSendDataInterface* sendData );
 
+/**
+ * @brief Sends the OpenGL ES calls made to render the most recent frame to the client, as a JSON object
+ * @param[in] clientId unique network client id
+ * @param[in] sendData interface to transmit data to the client
+ */
+void DumpGlStatistics( unsigned int clientId, ClientSendDataInterface* sendData );
+
 
 } // namespace Automation
 
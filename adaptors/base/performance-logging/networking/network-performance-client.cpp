@@ -58,7 +58,8 @@ public:
   {
     UNKNOWN_COMMAND,
     SET_PROPERTY,
-    DUMP_SCENE
+    DUMP_SCENE,
+    DUMP_GL_STATISTICS
   };
 
   AutomationCallback(  unsigned int clientId, ClientSendDataInterface& sendDataInterface )
@@ -79,6 +80,10 @@ public:
   {
      mCommandId = DUMP_SCENE;
   }
+  void AssignDumpGlStatisticsCommand()
+  {
+     mCommandId = DUMP_GL_STATISTICS;
+  }
 
   void RunCallback()
   {
@@ -94,6 +99,11 @@ public:
         Automation::DumpScene( mClientId, &mSendDataInterface);
         break;
       }
+      case DUMP_GL_STATISTICS:
+      {
+        Automation::DumpGlStatistics( mClientId, &mSendDataInterface );
+        break;
+      }
       default:
       {
         DALI_ASSERT_DEBUG( 0 && "Unknown command");
@@ -122,13 +132,17 @@ NetworkPerformanceClient::NetworkPerformanceClient(  pthread_t* thread,
                                                      unsigned int clientId,
                                                      TriggerEventFactoryInterface& triggerEventFactory,
                                                      ClientSendDataInterface& sendDataInterface,
-                                                     SocketFactoryInterface& socketFactory )
+                                                     SocketFactoryInterface& socketFactory,
+                                                     StatContextManager& statContextManager,
+                                                     TraceRecorder& traceRecorder )
 : mThread( thread ),
   mSocket( socket ),
   mMarkerBitmask( PerformanceMarker::FILTERING_DISABLED ),
   mTriggerEventFactory( triggerEventFactory ),
   mSendDataInterface( sendDataInterface ),
   mSocketFactoryInterface( socketFactory ),
+  mStatContextManager( statContextManager ),
+  mTraceRecorder( traceRecorder ),
   mClientId( clientId ),
   mConsoleClient(false)
 {
@@ -255,6 +269,31 @@ void NetworkPerformanceClient::ProcessCommand( char* buffer, unsigned int buffer
       break;
     }
 
+    case PerformanceProtocol::DUMP_FRAME_TIMES:
+    {
+      // the statistics are thread safe, so this can be run on the client thread
+      mStatContextManager.GetHistogramReport( response );
+      break;
+    }
+
+    case PerformanceProtocol::DUMP_TRACE:
+    {
+      // the recorder can be read while markers are being recorded, so this can be run on the client thread
+      mTraceRecorder.DumpChromeTrace( response );
+      break;
+    }
+
+    case PerformanceProtocol::DUMP_GL_STATISTICS:
+    {
+      // the adaptor can only be accessed from the main thread, use the trigger event....
+      AutomationCallback* callback = new AutomationCallback( mClientId, mSendDataInterface );
+      callback->AssignDumpGlStatisticsCommand();
+
+      TriggerEventInterface *interface = mTriggerEventFactory.CreateTriggerEvent( callback, TriggerEventInterface::DELETE_AFTER_TRIGGER );
+      interface->Trigger();
+      break;
+    }
+
     case PerformanceProtocol::LIST_METRICS_AVAILABLE:
     case PerformanceProtocol::ENABLE_METRIC:
     case PerformanceProtocol::DISABLE_METRIC:
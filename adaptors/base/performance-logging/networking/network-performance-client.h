@@ -26,6 +26,8 @@
 #include <trigger-event-factory-interface.h>
 #include <base/performance-logging/networking/client-send-data-interface.h>
 #include <base/interfaces/socket-factory-interface.h>
+#include <base/performance-logging/statistics/stat-context-manager.h>
+#include <base/performance-logging/trace-recorder.h>
 
 
 namespace Dali
@@ -67,13 +69,17 @@ public:
    * @param triggerEventFactory used to create trigger events
    * @param sendDataInterface used to send data to the socket from main thread
    * @param SocketFactoryInterface used to delete the socket when the client is destroyed
+   * @param statContextManager used to report the frame time percentiles
+   * @param traceRecorder used to dump the recorded markers
    */
   NetworkPerformanceClient( pthread_t* thread,
                             SocketInterface *socket,
                             unsigned int clientId,
                             TriggerEventFactoryInterface& triggerEventFactory,
                             ClientSendDataInterface& sendDataInterface,
-                            SocketFactoryInterface& socketFactory );
+                            SocketFactoryInterface& socketFactory,
+                            StatContextManager& statContextManager,
+                            TraceRecorder& traceRecorder );
 
   /**
    * @brief Destructor
@@ -129,6 +135,8 @@ private:
   TriggerEventFactoryInterface& mTriggerEventFactory;   ///< Trigger event factory
   ClientSendDataInterface& mSendDataInterface;          ///< used to send data to a client from the main event thread
   SocketFactoryInterface& mSocketFactoryInterface;      ///< used to delete the socket
+  StatContextManager& mStatContextManager;              ///< used to report the frame time percentiles
+  TraceRecorder& mTraceRecorder;                        ///< used to dump the recorded markers
   unsigned int mClientId;                               ///< unique client id
   bool mConsoleClient;                                  ///< if connected via a console then all responses are in ASCII, not binary packed data.
 
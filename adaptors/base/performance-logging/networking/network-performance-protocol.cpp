@@ -65,6 +65,9 @@ CommandInfo CommandLookup[]=
   {  LIST_METRICS_AVAILABLE     , "list_metrics"       ,NO_PARAMS     },
   {  ENABLE_TIME_MARKER_BIT_MASK, "set_marker",         UNSIGNED_INT  },
   {  DUMP_SCENE_GRAPH           , "dump_scene"         ,NO_PARAMS     },
+  {  DUMP_FRAME_TIMES           , "dump_frame_times"   ,NO_PARAMS     },
+  {  DUMP_TRACE                 , "dump_trace"         ,NO_PARAMS     },
+  {  DUMP_GL_STATISTICS         , "dump_gl_stats"      ,NO_PARAMS     },
   {  SET_PROPERTIES             , "set_properties"     ,STRING        },
   {  UNKNOWN_COMMAND            , "unknown"            ,NO_PARAMS     }
 };
@@ -96,7 +99,10 @@ const char* const helpMsg =
     GREEN" set_properties "PARAM"|ActorIndex;Property;Value|" NORMAL ", e.g: \n"
     GREEN" set_properties " PARAM "|178;Size;[ 144.0, 144.0, 144.0 ]|178;Color;[ 1.0, 1,0, 1.0 ]|\n"
     "\n"
-    GREEN " dump_scene" NORMAL " - dump the current scene in json format\n";
+    GREEN " dump_scene" NORMAL " - dump the current scene in json format\n"
+    GREEN " dump_frame_times" NORMAL " - dump the percentiles of event, update, render and frame times\n"
+    GREEN " dump_trace" NORMAL " - dump the recorded markers in Chrome trace format (needs DALI_PERFORMANCE_TIMESTAMP_OUTPUT bit 4)\n"
+    GREEN " dump_gl_stats" NORMAL " - dump the OpenGL ES calls of the most recent frame in json format\n";
 
 } // un-named namespace
 
@@ -41,6 +41,9 @@ enum CommandId
   ENABLE_TIME_MARKER_BIT_MASK = 4, ///< bit mask of time markers to enable
   SET_PROPERTIES            = 5, ///< set property
   DUMP_SCENE_GRAPH          = 6, ///< dump the scene graph
+  DUMP_FRAME_TIMES          = 7, ///< dump the frame time percentiles
+  DUMP_TRACE                = 8, ///< dump the recorded markers as a Chrome trace
+  DUMP_GL_STATISTICS        = 9, ///< dump the OpenGL ES calls of the most recent frame
   UNKNOWN_COMMAND           = 4096
 };
 
@@ -50,10 +50,14 @@ struct ClientThreadInfo
 }
 
 NetworkPerformanceServer::NetworkPerformanceServer( AdaptorInternalServices& adaptorServices,
-                                                    const EnvironmentOptions& logOptions )
+                                                    const EnvironmentOptions& logOptions,
+                                                    StatContextManager& statContextManager,
+                                                    TraceRecorder& traceRecorder )
 : mTriggerEventFactory( adaptorServices.GetTriggerEventFactoryInterface() ),
   mSocketFactory( adaptorServices.GetSocketFactoryInterface() ),
   mLogOptions( logOptions ),
+  mStatContextManager( statContextManager ),
+  mTraceRecorder( traceRecorder ),
   mServerThread( 0 ),
   mListeningSocket( NULL ),
   mClientUniqueId( 0 ),
@@ -245,7 +249,9 @@ NetworkPerformanceClient* NetworkPerformanceServer::AddClient( SocketInterface*
                                                                   mClientUniqueId++,
                                                                   mTriggerEventFactory,
                                                                   *this,
-                                                                  mSocketFactory);
+                                                                  mSocketFactory,
+                                                                  mStatContextManager,
+                                                                  mTraceRecorder );
 
   // protect the mClients list which can be accessed from multiple threads.
   Mutex::ScopedLock lock( mClientListMutex );
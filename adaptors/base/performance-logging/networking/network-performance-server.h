@@ -67,8 +67,13 @@ public:
    * @brief Constructor
    * @param[in] adaptorServices adaptor internal services
    * @param[in] logOptions log options
+   * @param[in] statContextManager statistics to report to clients
+   * @param[in] traceRecorder recorded markers to dump to clients
    */
-  NetworkPerformanceServer( AdaptorInternalServices& adaptorServices, const EnvironmentOptions& logOptions );
+  NetworkPerformanceServer( AdaptorInternalServices& adaptorServices,
+                            const EnvironmentOptions& logOptions,
+                            StatContextManager& statContextManager,
+                            TraceRecorder& traceRecorder );
 
 
   /**
@@ -164,6 +169,8 @@ private:
   TriggerEventFactoryInterface& mTriggerEventFactory;     ///< used to create trigger events
   SocketFactoryInterface& mSocketFactory;                 ///< used to create sockets
   const EnvironmentOptions& mLogOptions;                  ///< log options
+  StatContextManager& mStatContextManager;                ///< statistics to report to clients
+  TraceRecorder& mTraceRecorder;                          ///< recorded markers to dump to clients
   Dali::Vector< NetworkPerformanceClient* > mClients;     ///< list of connected clients
   pthread_t mServerThread;                                ///< thread that listens for new connections
   SocketInterface* mListeningSocket;                      ///< socket used to listen for new connections
@@ -59,6 +59,8 @@ const NamePair MARKER_LOOKUP[] =
     { PerformanceInterface::PROCESS_EVENTS_END,   "PROCESS_EVENT_END"    , PerformanceMarker::EVENT_PROCESS, PerformanceMarker::END_TIMED_EVENT   },
     { PerformanceInterface::PAUSED       ,        "PAUSED"               , PerformanceMarker::LIFE_CYCLE_EVENTS, PerformanceMarker::SINGLE_EVENT  },
     { PerformanceInterface::RESUME       ,        "RESUMED"              , PerformanceMarker::LIFE_CYCLE_EVENTS, PerformanceMarker::SINGLE_EVENT  },
+    { PerformanceInterface::FRAME_DEADLINE_MISSED, "FRAME_DEADLINE_MISSED", PerformanceMarker::FRAME_PACING_EVENTS, PerformanceMarker::SINGLE_EVENT  },
+    { PerformanceInterface::FRAME_DEADLINE_MISS_PREDICTED, "FRAME_DEADLINE_MISS_PREDICTED", PerformanceMarker::FRAME_PACING_EVENTS, PerformanceMarker::SINGLE_EVENT  },
     { PerformanceInterface::START        ,        "START"                , PerformanceMarker::CUSTOM_EVENTS, PerformanceMarker::START_TIMED_EVENT  },
     { PerformanceInterface::END          ,        "END"                  , PerformanceMarker::CUSTOM_EVENTS, PerformanceMarker::END_TIMED_EVENT  }
 };
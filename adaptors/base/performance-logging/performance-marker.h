@@ -53,7 +53,8 @@ public:
     SWAP_BUFFERS         = 1 << 4, ///< swap buffers start / end
     LIFE_CYCLE_EVENTS    = 1 << 5, ///< pause / resume
     RESOURCE_EVENTS      = 1 << 6, ///< resource events
-    CUSTOM_EVENTS        = 1 << 7
+    CUSTOM_EVENTS        = 1 << 7, ///< custom start / end
+    FRAME_PACING_EVENTS  = 1 << 8  ///< frame deadline misses
   };
 
   /**
@@ -19,11 +19,16 @@
 #include "performance-server.h"
 
 // EXTERNAL INCLUDES
+#include <csignal>
+#include <cstdio>
+#include <unistd.h>
 #include <dali/integration-api/platform-abstraction.h>
+#include <dali/integration-api/debug.h>
 
 // INTERNAL INCLUDES
 #include <base/environment-options.h>
 #include <base/time-service.h>
+#include <portable/scoped-trace.h>
 
 namespace Dali
 {
@@ -38,6 +43,10 @@ namespace
 {
 const unsigned int NANOSECONDS_PER_MICROSECOND = 1000u;
 const float        MICROSECONDS_TO_SECOND = 1e-6;
+const unsigned int TRACE_FILE_NAME_LENGTH = 64u;
+const char* const  DEFAULT_TRACE_FILE = "/tmp/dali-trace-%d.json"; ///< %d is replaced with the process id
+
+TriggerEventInterface* gTraceFileTrigger = NULL; ///< Used by the signal handler, which has no other way to reach the server
 } // unnamed namespace
 
 PerformanceServer::PerformanceServer( AdaptorInternalServices& adaptorServices,
@@ -46,13 +55,19 @@ PerformanceServer::PerformanceServer( AdaptorInternalServices& adaptorServices,
   mKernelTrace( adaptorServices.GetKernelTraceInterface() ),
   mSystemTrace( adaptorServices.GetSystemTraceInterface() ),
 #if defined(NETWORK_LOGGING_ENABLED)
-  mNetworkServer( adaptorServices, environmentOptions ),
+  mNetworkServer( adaptorServices, environmentOptions, mStatContextManager, mTraceRecorder ), // only stores the references, so they can be constructed later
   mNetworkControlEnabled( mEnvironmentOptions.GetNetworkControlMode()),
 #endif
   mStatContextManager( *this ),
+  mTraceRecorder( mEnvironmentOptions.GetTraceBufferSize() ),
+  mTriggerEventFactory( adaptorServices.GetTriggerEventFactoryInterface() ),
+  mTraceFileTrigger( NULL ),
+  mTraceFile( mEnvironmentOptions.GetTraceFile() ),
   mStatisticsLogBitmask( 0 ),
   mLoggingEnabled( false ),
-  mLogFunctionInstalled( false )
+  mLogFunctionInstalled( false ),
+  mStatisticsEnabled( false ),
+  mMarkerLoggingEnabled( false )
 {
   SetLogging( mEnvironmentOptions.GetPerformanceStatsLoggingOptions(),
               mEnvironmentOptions.GetPerformanceTimeStampOutput(),
@@ -62,9 +77,31 @@ PerformanceServer::PerformanceServer( AdaptorInternalServices& adaptorServices,
   if( mNetworkControlEnabled )
   {
     mLoggingEnabled  = true;
+    mStatisticsEnabled = true;
+    mMarkerLoggingEnabled = true;
     mNetworkServer.Start();
   }
 #endif
+
+  if( ( mPerformanceOutputBitmask & OUTPUT_TRACE_RECORDER ) && ( gTraceFileTrigger == NULL ) )
+  {
+    if( mTraceFile.empty() )
+    {
+      char traceFile[ TRACE_FILE_NAME_LENGTH ];
+      snprintf( traceFile, sizeof( traceFile ), DEFAULT_TRACE_FILE, getpid() );
+      mTraceFile = traceFile;
+    }
+
+    // kill -USR2 <pid> writes the trace, so a hitch can be captured when it is seen
+    mTraceFileTrigger = mTriggerEventFactory.CreateTriggerEvent( MakeCallback( this, &PerformanceServer::WriteTraceFile ),
+                                                                 TriggerEventInterface::KEEP_ALIVE_AFTER_TRIGGER );
+    gTraceFileTrigger = mTraceFileTrigger;
+    signal( SIGUSR2, &PerformanceServer::TraceSignalHandler );
+
+    // Scoped traces are recorded along with the markers
+    const unsigned int traceCategories = mEnvironmentOptions.GetTraceCategories();
+    Trace::Enable( mTraceRecorder, traceCategories ? traceCategories : Trace::ALL_CATEGORIES );
+  }
 }
 
 PerformanceServer::~PerformanceServer()
@@ -80,6 +117,14 @@ PerformanceServer::~PerformanceServer()
   {
     mEnvironmentOptions.UnInstallLogFunction();
   }
+
+  if( mTraceFileTrigger )
+  {
+    Trace::Disable();
+    signal( SIGUSR2, SIG_DFL );
+    gTraceFileTrigger = NULL;
+    mTriggerEventFactory.DestroyTriggerEvent( mTraceFileTrigger );
+  }
 }
 
 void PerformanceServer::SetLogging( unsigned int statisticsLogOptions,
@@ -99,6 +144,14 @@ void PerformanceServer::SetLogging( unsigned int statisticsLogOptions,
   {
     mLoggingEnabled = true;
   }
+
+  // Only the trace recorder may be wanted, in which case markers need not be formatted, nor the stat contexts locked
+  mStatisticsEnabled = ( mStatisticsLogBitmask != 0 );
+  mMarkerLoggingEnabled = ( ( mPerformanceOutputBitmask & ~OUTPUT_TRACE_RECORDER ) != 0 );
+#if defined(NETWORK_LOGGING_ENABLED)
+  mStatisticsEnabled = mStatisticsEnabled || mNetworkControlEnabled;
+  mMarkerLoggingEnabled = mMarkerLoggingEnabled || mNetworkControlEnabled;
+#endif
 }
 
 void PerformanceServer::SetLoggingFrequency( unsigned int logFrequency, ContextId contextId )
@@ -114,7 +167,9 @@ void PerformanceServer::EnableLogging( bool enable, ContextId contextId )
 PerformanceInterface::ContextId PerformanceServer::AddContext( const char* name )
 {
   // for adding custom contexts
-  return mStatContextManager.AddContext( name, PerformanceMarker::CUSTOM_EVENTS );
+  ContextId contextId = mStatContextManager.AddContext( name, PerformanceMarker::CUSTOM_EVENTS );
+  mTraceRecorder.SetContextName( contextId, name );
+  return contextId;
 }
 
 void PerformanceServer::RemoveContext( ContextId contextId )
@@ -136,17 +191,29 @@ void PerformanceServer::AddMarker( MarkerType markerType, ContextId contextId )
   TimeService::GetNanoseconds( timeStamp );
   timeStamp /= NANOSECONDS_PER_MICROSECOND; // Convert to microseconds
 
+  // record it without formatting it
+  if( mPerformanceOutputBitmask & OUTPUT_TRACE_RECORDER )
+  {
+    mTraceRecorder.Record( markerType, contextId, timeStamp );
+  }
+
   // Create a marker
   PerformanceMarker marker( markerType, FrameTimeStamp( 0, timeStamp ) );
 
-  // get the marker description for this context, e.g SIZE_NEGOTIATION_START
-  const char* const description = mStatContextManager.GetMarkerDescription( markerType, contextId );
+  if( mMarkerLoggingEnabled )
+  {
+    // get the marker description for this context, e.g SIZE_NEGOTIATION_START
+    const char* const description = mStatContextManager.GetMarkerDescription( markerType, contextId );
 
-  // log it
-  LogMarker( marker, description );
+    // log it
+    LogMarker( marker, description );
+  }
 
   // Add custom marker to statistics context manager
-  mStatContextManager.AddCustomMarker( marker, contextId );
+  if( mStatisticsEnabled )
+  {
+    mStatContextManager.AddCustomMarker( marker, contextId );
+  }
 }
 
 void PerformanceServer::AddMarker( MarkerType markerType )
@@ -174,15 +241,26 @@ void PerformanceServer::AddMarker( MarkerType markerType )
   TimeService::GetNanoseconds( timeStamp );
   timeStamp /= NANOSECONDS_PER_MICROSECOND; // Convert to microseconds
 
+  // record it without formatting it
+  if( mPerformanceOutputBitmask & OUTPUT_TRACE_RECORDER )
+  {
+    mTraceRecorder.Record( markerType, timeStamp );
+  }
+
   // Create a marker
   PerformanceMarker marker( markerType, FrameTimeStamp( 0, timeStamp ) );
 
   // log it
-  LogMarker(marker, marker.GetName() );
+  if( mMarkerLoggingEnabled )
+  {
+    LogMarker(marker, marker.GetName() );
+  }
 
   // Add internal marker to statistics context manager
-  mStatContextManager.AddInternalMarker( marker );
-
+  if( mStatisticsEnabled )
+  {
+    mStatContextManager.AddInternalMarker( marker );
+  }
 }
 
 void PerformanceServer::LogContextStatistics( const char* const text )
@@ -190,6 +268,27 @@ void PerformanceServer::LogContextStatistics( const char* const text )
   Integration::Log::LogMessage( Dali::Integration::Log::DebugInfo, text );
 }
 
+void PerformanceServer::WriteTraceFile()
+{
+  if( mTraceRecorder.WriteChromeTrace( mTraceFile.c_str() ) )
+  {
+    Integration::Log::LogMessage( Dali::Integration::Log::DebugInfo, "Trace written to %s\n", mTraceFile.c_str() );
+  }
+  else
+  {
+    DALI_LOG_ERROR( "Unable to write trace to %s\n", mTraceFile.c_str() );
+  }
+}
+
+void PerformanceServer::TraceSignalHandler( int signum )
+{
+  // Only the write to the trigger's file descriptor is safe in a signal handler
+  if( gTraceFileTrigger )
+  {
+    gTraceFileTrigger->Trigger();
+  }
+}
+
 void PerformanceServer::LogMarker( const PerformanceMarker& marker, const char* const description )
 {
 #if defined(NETWORK_LOGGING_ENABLED)
@@ -28,6 +28,8 @@
 #include <base/interfaces/adaptor-internal-services.h>
 #include <base/performance-logging/performance-marker.h>
 #include <base/performance-logging/statistics/stat-context-manager.h>
+#include <base/performance-logging/trace-recorder.h>
+#include <trigger-event-factory-interface.h>
 
 namespace Dali
 {
@@ -108,6 +110,17 @@ public: //StatLogInterface
 
 private:
 
+  /**
+   * @brief Writes the recorded markers to the trace file, called on the main thread after SIGUSR2
+   */
+  void WriteTraceFile();
+
+  /**
+   * @brief Handles SIGUSR2 by triggering WriteTraceFile() on the main thread
+   * @param[in] signum The signal number
+   */
+  static void TraceSignalHandler( int signum );
+
   /**
    * @brief log the marker out to kernel/ DALi log
    * @param[in] marker performance marker
@@ -128,11 +141,17 @@ private:
 #endif
 
   StatContextManager mStatContextManager;                 ///< Stat context manager
+  TraceRecorder mTraceRecorder;                           ///< markers recorded for the Chrome trace
+  TriggerEventFactoryInterface& mTriggerEventFactory;     ///< used to write the trace file on the main thread
+  TriggerEventInterface* mTraceFileTrigger;               ///< triggered by SIGUSR2 to write the trace file
+  std::string mTraceFile;                                 ///< where the trace is written
   unsigned int mStatisticsLogBitmask;                     ///< statistics log level
   unsigned int mPerformanceOutputBitmask;                 ///< performance marker output
 
   bool mLoggingEnabled:1;                                 ///< whether logging update / render to a log is enabled
   bool mLogFunctionInstalled:1;                           ///< whether the log function is installed
+  bool mStatisticsEnabled:1;                              ///< whether markers are added to the stat contexts
+  bool mMarkerLoggingEnabled:1;                           ///< whether markers are logged as text, or sent to the network
 };
 
 
@@ -35,6 +35,7 @@ namespace
 const char* const UPDATE_CONTEXT_NAME = "Update";
 const char* const RENDER_CONTEXT_NAME = "Render";
 const char* const EVENT_CONTEXT_NAME = "Event";
+const char* const FRAME_CONTEXT_NAME = "Frame";
 const unsigned int DEFAULT_LOG_FREQUENCY = 2;
 }
 
@@ -45,12 +46,13 @@ StatContextManager::StatContextManager( StatContextLogInterface& logInterface )
   mLogFrequency( DEFAULT_LOG_FREQUENCY )
 {
 
-  mStatContexts.Reserve(4); // intially reserve enough for 3 internal + 1 custom
+  mStatContexts.Reserve(5); // intially reserve enough for 4 internal + 1 custom
 
   // Add defaults
   mUpdateStats = AddContext( UPDATE_CONTEXT_NAME, PerformanceMarker::UPDATE );
   mRenderStats = AddContext( RENDER_CONTEXT_NAME, PerformanceMarker::RENDER );
   mEventStats = AddContext( EVENT_CONTEXT_NAME,   PerformanceMarker::EVENT_PROCESS );
+  mFrameStats = AddContext( FRAME_CONTEXT_NAME,   PerformanceMarker::V_SYNC_EVENTS );
 
 }
 
@@ -153,6 +155,7 @@ void StatContextManager::SetLoggingLevel(  unsigned int statisticsLogOptions, un
   EnableLogging( mStatisticsLogBitmask & PerformanceInterface::LOG_UPDATE_RENDER, mUpdateStats );
   EnableLogging( mStatisticsLogBitmask & PerformanceInterface::LOG_UPDATE_RENDER, mRenderStats );
   EnableLogging( mStatisticsLogBitmask & PerformanceInterface::LOG_EVENT_PROCESS, mEventStats );
+  EnableLogging( mStatisticsLogBitmask & PerformanceInterface::LOG_UPDATE_RENDER, mFrameStats );
 
   for( StatContexts::Iterator it = mStatContexts.Begin(), itEnd = mStatContexts.End(); it != itEnd; ++it )
   {
@@ -174,6 +177,19 @@ void StatContextManager::SetLoggingFrequency( unsigned int logFrequency,
     context->SetLogFrequency( logFrequency );
   }
 }
+void StatContextManager::GetHistogramReport( std::string& report )
+{
+  report.clear();
+
+  // the contexts are recorded to from multiple threads
+  Mutex::ScopedLock lock( mDataMutex );
+  for( StatContexts::Iterator it = mStatContexts.Begin(), itEnd = mStatContexts.End(); it != itEnd; ++it )
+  {
+    const StatContext* context = *it;
+    context->AppendHistogramReport( report );
+  }
+}
+
 const char* const StatContextManager::GetContextName(PerformanceInterface::ContextId contextId) const
 {
   StatContext* context = GetContext(contextId);
@@ -39,15 +39,18 @@ namespace Adaptor
 /**
  * Class to manage StatContext objects.
  *
- * Contains 3 built in contexts for event, update, render.
+ * Contains 4 built in contexts for event, update, render and the whole frame (v-sync to v-sync).
  * The application developer can add more using the PerformanceLogger public API
  *
- * Example output of 4 contexts ( event, update, render and a custom one):
+ * Example output of 5 contexts ( event, update, render, frame and a custom one):
  *
- * Event, min 0.04 ms, max 5.27 ms, total (0.1 secs), avg 0.28 ms, std dev 0.73 ms
- * Update, min 0.29 ms, max 0.91 ms, total (0.5 secs), avg 0.68 ms, std dev 0.15 ms
- * Render, min 0.33 ms, max 0.97 ms, total (0.6 secs), avg 0.73 ms, std dev 0.17 ms
- * MyAppTask, min 76.55 ms, max 76.55 ms, total (0.1 secs), avg 76.55 ms, std dev 0.00 ms  (CUSTOM CONTEXT)
+ * Event, min 0.04 ms, max 5.27 ms, total (0.1 secs), avg 0.28 ms, std dev 0.73 ms, p50 0.17 ms, p99 4.10 ms, over budget 0
+ * Update, min 0.29 ms, max 0.91 ms, total (0.5 secs), avg 0.68 ms, std dev 0.15 ms, p50 0.67 ms, p99 0.89 ms, over budget 0
+ * Render, min 0.33 ms, max 0.97 ms, total (0.6 secs), avg 0.73 ms, std dev 0.17 ms, p50 0.71 ms, p99 0.95 ms, over budget 0
+ * Frame, min 16.21 ms, max 33.49 ms, total (2.0 secs), avg 16.83 ms, std dev 1.52 ms, p50 16.64 ms, p99 33.28 ms, over budget 2
+ * MyAppTask, min 76.55 ms, max 76.55 ms, total (0.1 secs), avg 76.55 ms, std dev 0.00 ms, p50 76.29 ms, p99 76.29 ms, over budget 1  (CUSTOM CONTEXT)
+ *
+ * The percentiles and over budget counts cover the whole session; the other values cover the last logging period.
  *
  */
 class StatContextManager
@@ -130,6 +133,13 @@ public:
      */
     void SetLoggingFrequency( unsigned int logFrequency, PerformanceInterface::ContextId contextId  );
 
+    /**
+     * @brief Get the percentiles of all the times recorded by every context, one line per context.
+     * Can be called from any thread.
+     * @param[out] report The report
+     */
+    void GetHistogramReport( std::string& report );
+
   private:
 
     typedef Dali::Vector< StatContext* > StatContexts;
@@ -151,6 +161,7 @@ public:
     PerformanceInterface::ContextId mUpdateStats;    ///< update time statistics
     PerformanceInterface::ContextId mRenderStats;    ///< render time statistics
     PerformanceInterface::ContextId mEventStats;     ///< event time statistics
+    PerformanceInterface::ContextId mFrameStats;     ///< whole frame time statistics
 
     unsigned int mStatisticsLogBitmask;              ///< statistics log bitmask
     unsigned int mLogFrequency;                      ///< log frequency
@@ -42,7 +42,17 @@ namespace
 const unsigned int MILLISECONDS_PER_SECOND = 1000;    ///< 1000 milliseconds per second
 const char* const UNKNOWN_CONTEXT_NAME = "UNKNOWN_CONTEXT_NAME";
 const unsigned int MICROSECONDS_PER_SECOND = 1000000; ///< 1000000 microseconds per second
-const unsigned int CONTEXT_LOG_SIZE = 120;
+const unsigned int CONTEXT_LOG_SIZE = 256;
+const unsigned int REPORT_LINE_SIZE = 256;
+const unsigned int MAXIMUM_FRAME_BUDGETS = 4;         ///< A v-sync interval longer than 4 frame budgets is an idle sleep, not a frame
+
+/**
+ * @return the given percentile of the histogram in milliseconds
+ */
+float GetPercentile( const FrameTimeHistogram& histogram, float percentile )
+{
+  return static_cast< float >( histogram.GetPercentile( percentile ) ) / MILLISECONDS_PER_SECOND;
+}
 
 }
 
@@ -132,6 +142,11 @@ void StatContext::RecordMarker( const PerformanceMarker& marker )
   {
     mStats.EndTime( marker.GetTimeStamp() );
   }
+  else if( marker.GetType() == PerformanceInterface::VSYNC )
+  {
+    // the time from one v-sync to the next is the time of the whole frame, unless the update thread slept in between
+    mStats.LapTime( marker.GetTimeStamp(), MAXIMUM_FRAME_BUDGETS * mStats.GetHistogram().GetBudget() );
+  }
 }
 
 void StatContext::FrameTick( const PerformanceMarker& marker )
@@ -159,6 +174,12 @@ void StatContext::FrameTick( const PerformanceMarker& marker )
   mStats.Reset();             // reset data for statistics
   mInitialMarkerSet = false;  // need to restart the timer
 
+  if( mFilterType == PerformanceMarker::V_SYNC_EVENTS )
+  {
+    // this v-sync starts the next frame
+    mStats.StartTime( marker.GetTimeStamp() );
+  }
+
 }
 
 void StatContext::LogMarker()
@@ -166,18 +187,43 @@ void StatContext::LogMarker()
   float mean, standardDeviation;
   mStats.CalculateMean( mean, standardDeviation );
 
-  snprintf( mTempLogBuffer, CONTEXT_LOG_SIZE, "%s, min " TIME_FMT ", max " TIME_FMT ", total (" TOTAL_TIME_FMT "), avg " TIME_FMT ", std dev " TIME_FMT "\n",
+  // the percentiles are of this period, like the other figures logged
+  const FrameTimeHistogram& histogram = mStats.GetPeriodHistogram();
+
+  snprintf( mTempLogBuffer, CONTEXT_LOG_SIZE, "%s, min " TIME_FMT ", max " TIME_FMT ", total (" TOTAL_TIME_FMT "), avg " TIME_FMT ", std dev " TIME_FMT ", p50 " TIME_FMT ", p99 " TIME_FMT ", over budget %u\n",
      mName ? mName : UNKNOWN_CONTEXT_NAME,
      mStats.GetMinTime() * MILLISECONDS_PER_SECOND,
      mStats.GetMaxTime() * MILLISECONDS_PER_SECOND,
      mStats.GetTotalTime(),
      mean * MILLISECONDS_PER_SECOND,
-     standardDeviation * MILLISECONDS_PER_SECOND );
+     standardDeviation * MILLISECONDS_PER_SECOND,
+     GetPercentile( histogram, 50.0f ),
+     GetPercentile( histogram, 99.0f ),
+     histogram.GetOverBudgetCount() );
 
     mLogInterface.LogContextStatistics( mTempLogBuffer );
 
 }
 
+void StatContext::AppendHistogramReport( std::string& report ) const
+{
+  const FrameTimeHistogram& histogram = mStats.GetHistogram();
+
+  char line[ REPORT_LINE_SIZE ];
+  snprintf( line, REPORT_LINE_SIZE, "%s, count %u, p50 " TIME_FMT ", p90 " TIME_FMT ", p99 " TIME_FMT ", p99.9 " TIME_FMT ", max " TIME_FMT ", over " TIME_FMT " budget %u\n",
+     mName ? mName : UNKNOWN_CONTEXT_NAME,
+     histogram.GetCount(),
+     GetPercentile( histogram, 50.0f ),
+     GetPercentile( histogram, 90.0f ),
+     GetPercentile( histogram, 99.0f ),
+     GetPercentile( histogram, 99.9f ),
+     static_cast< float >( histogram.GetMaximum() ) / MILLISECONDS_PER_SECOND,
+     static_cast< float >( histogram.GetBudget() ) / MILLISECONDS_PER_SECOND,
+     histogram.GetOverBudgetCount() );
+
+  report += line;
+}
+
 
 
 } // namespace Internal
@@ -114,6 +114,13 @@ public:
      */
     void ProcessInternalMarker( const PerformanceMarker& marker );
 
+    /**
+     * @brief Append the percentiles of all the times recorded by this context
+     *
+     * @param[in,out] report The report to append a line to
+     */
+    void AppendHistogramReport( std::string& report ) const;
+
   private:
 
     /**
@@ -0,0 +1,354 @@
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include "trace-recorder.h"
+
+// EXTERNAL INCLUDES
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include <unistd.h>
+#include <sys/prctl.h>
+
+// INTERNAL INCLUDES
+#include <base/time-service.h>
+#include <base/performance-logging/performance-marker.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace Adaptor
+{
+
+namespace
+{
+const unsigned int INTERNAL_CONTEXT_ID = 0xFFFFu;        ///< Context id of internal markers
+const unsigned int NO_THREAD_BUFFER = 0xFFFFFFFFu;       ///< Buffer index of a thread which could not be given a buffer
+const char* const START_SUFFIX = "_START";
+const char* const END_SUFFIX = "_END";
+const unsigned int EVENT_TEXT_SIZE = 128u;               ///< Enough for the fixed part of one event in the trace
+const unsigned int NANOSECONDS_PER_MICROSECOND = 1000u;
+
+unsigned int gNextRecorderId = 0u;                       ///< Incremented for each recorder constructed
+
+__thread unsigned int gThreadRecorderId = 0u;            ///< The recorder the calling thread last recorded into
+__thread unsigned int gThreadBufferIndex = 0u;           ///< The calling thread's buffer in that recorder
+
+/**
+ * @return The smallest power of two no less than size
+ */
+unsigned int RoundUpToPowerOfTwo( unsigned int size )
+{
+  unsigned int powerOfTwo = 1u;
+  while( powerOfTwo < size )
+  {
+    powerOfTwo <<= 1;
+  }
+  return powerOfTwo;
+}
+
+/**
+ * Removes a suffix from a string if it ends with it
+ * @return true if the suffix was removed
+ */
+bool RemoveSuffix( std::string& name, const char* const suffix )
+{
+  const std::string::size_type length = strlen( suffix );
+  if( name.size() > length && name.compare( name.size() - length, length, suffix ) == 0 )
+  {
+    name.erase( name.size() - length );
+    return true;
+  }
+  return false;
+}
+
+/**
+ * Appends a string to the trace as a quoted JSON string
+ */
+void AppendJsonString( std::string& trace, const char* const text )
+{
+  trace += '"';
+  for( const char* character = text; *character; ++character )
+  {
+    const unsigned char value = static_cast< unsigned char >( *character );
+    if( value == '"' || value == '\\' )
+    {
+      trace += '\\';
+      trace += *character;
+    }
+    else if( value < 0x20u )
+    {
+      char escaped[ 8 ];
+      snprintf( escaped, sizeof( escaped ), "\\u%04x", value );
+      trace += escaped;
+    }
+    else
+    {
+      trace += *character;
+    }
+  }
+  trace += '"';
+}
+
+} // unnamed namespace
+
+TraceRecorder::TraceRecorder( unsigned int bufferSize )
+: mThreadCount( 0u ),
+  mBufferSize( RoundUpToPowerOfTwo( bufferSize ? bufferSize : DEFAULT_BUFFER_SIZE ) ),
+  mId( __sync_add_and_fetch( &gNextRecorderId, 1u ) ),
+  mContextNames(),
+  mContextNamesMutex()
+{
+  for( unsigned int i = 0; i < MAXIMUM_THREADS; ++i )
+  {
+    mThreadBuffers[i].events = NULL;
+    mThreadBuffers[i].writeCount = 0u;
+    mThreadBuffers[i].name[0] = '\0';
+  }
+}
+
+TraceRecorder::~TraceRecorder()
+{
+  for( unsigned int i = 0; i < MAXIMUM_THREADS; ++i )
+  {
+    delete [] mThreadBuffers[i].events;
+  }
+}
+
+void TraceRecorder::Record( PerformanceInterface::MarkerType type, uint64_t microseconds )
+{
+  RecordEvent( NULL, type, INTERNAL_CONTEXT_ID, microseconds );
+}
+
+void TraceRecorder::Record( PerformanceInterface::MarkerType type, PerformanceInterface::ContextId contextId, uint64_t microseconds )
+{
+  RecordEvent( NULL, type, contextId, microseconds );
+}
+
+void TraceRecorder::RecordScope( const char* const name, bool begin, uint64_t microseconds )
+{
+  // START and END give the phase; the name is used instead of a context
+  RecordEvent( name, begin ? PerformanceInterface::START : PerformanceInterface::END, INTERNAL_CONTEXT_ID, microseconds );
+}
+
+void TraceRecorder::RecordScope( const char* const name, bool begin )
+{
+  uint64_t timeStamp = 0;
+  TimeService::GetNanoseconds( timeStamp );
+  RecordScope( name, begin, timeStamp / NANOSECONDS_PER_MICROSECOND );
+}
+
+void TraceRecorder::SetContextName( PerformanceInterface::ContextId contextId, const char* const name )
+{
+  Mutex::ScopedLock lock( mContextNamesMutex );
+  mContextNames[ contextId ] = name ? name : "";
+}
+
+unsigned int TraceRecorder::GetBufferSize() const
+{
+  return mBufferSize;
+}
+
+unsigned int TraceRecorder::GetThreadCount() const
+{
+  const unsigned int threadCount = mThreadCount;
+  return threadCount < MAXIMUM_THREADS ? threadCount : MAXIMUM_THREADS;
+}
+
+void TraceRecorder::DumpChromeTrace( std::string& trace )
+{
+  const int processId = getpid();
+  char text[ EVENT_TEXT_SIZE ];
+
+  trace = "{\"traceEvents\":[";
+  bool firstEvent = true;
+
+  std::vector< Event > events;
+  events.reserve( mBufferSize );
+
+  const unsigned int threadCount = GetThreadCount();
+  for( unsigned int i = 0; i < threadCount; ++i )
+  {
+    const ThreadBuffer& buffer = mThreadBuffers[i];
+    const Event* const ringEvents = __atomic_load_n( &buffer.events, __ATOMIC_ACQUIRE );
+    if( ! ringEvents )
+    {
+      // The thread has claimed the buffer but not finished creating it
+      continue;
+    }
+
+    // Copy the events out first, as the thread may overwrite the oldest ones while they are formatted
+    const unsigned int writeCount = __atomic_load_n( &buffer.writeCount, __ATOMIC_ACQUIRE );
+    unsigned int firstIndex = writeCount > mBufferSize ? writeCount - mBufferSize : 0u;
+    events.clear();
+    for( unsigned int index = firstIndex; index != writeCount; ++index )
+    {
+      events.push_back( ringEvents[ index & ( mBufferSize - 1u ) ] );
+    }
+
+    // Drop any the thread overwrote while they were copied, and the one in the slot it may be writing now,
+    // which is the slot after the last event it published
+    const unsigned int overwrittenCount = __atomic_load_n( &buffer.writeCount, __ATOMIC_ACQUIRE ) - writeCount;
+    const unsigned int usedCount = writeCount + overwrittenCount + 1u - firstIndex;
+    const unsigned int unsafeCount = usedCount > mBufferSize ? usedCount - mBufferSize : 0u;
+    const unsigned int droppedCount = unsafeCount < events.size() ? unsafeCount : events.size();
+
+    const unsigned int threadId = i + 1u;
+    snprintf( text, sizeof( text ), "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%d,\"tid\":%u,\"args\":{\"name\":", firstEvent ? "" : ",", processId, threadId );
+    trace += text;
+    AppendJsonString( trace, buffer.name );
+    trace += "}}";
+    firstEvent = false;
+
+    for( std::vector< Event >::const_iterator iter = events.begin() + droppedCount, endIter = events.end(); iter != endIter; ++iter )
+    {
+      const PerformanceMarker marker( static_cast< PerformanceInterface::MarkerType >( iter->type ) );
+
+      const char* phase = "i";
+      switch( marker.GetEventType() )
+      {
+        case PerformanceMarker::START_TIMED_EVENT:
+        {
+          phase = "B";
+          break;
+        }
+        case PerformanceMarker::END_TIMED_EVENT:
+        {
+          phase = "E";
+          break;
+        }
+        case PerformanceMarker::SINGLE_EVENT:
+        {
+          break;
+        }
+      }
+
+      trace += ",{\"name\":";
+      AppendJsonString( trace, GetEventName( *iter ).c_str() );
+
+      // Vsyncs are frame boundaries, so they are drawn across every thread
+      snprintf( text, sizeof( text ), ",\"ph\":\"%s\",\"ts\":%llu,\"pid\":%d,\"tid\":%u%s}",
+                phase,
+                static_cast< unsigned long long >( iter->microseconds ),
+                processId,
+                threadId,
+                ( *phase != 'i' ) ? "" : ( iter->type == PerformanceInterface::VSYNC ) ? ",\"s\":\"g\"" : ",\"s\":\"t\"" );
+      trace += text;
+    }
+  }
+
+  trace += "],\"displayTimeUnit\":\"ms\"}\n";
+}
+
+bool TraceRecorder::WriteChromeTrace( const char* const fileName )
+{
+  std::string trace;
+  DumpChromeTrace( trace );
+
+  FILE* file = fopen( fileName, "w" );
+  if( ! file )
+  {
+    return false;
+  }
+
+  const bool written = fwrite( trace.c_str(), 1, trace.size(), file ) == trace.size();
+  return ( fclose( file ) == 0 ) && written;
+}
+
+void TraceRecorder::RecordEvent( const char* const name, unsigned int type, unsigned int contextId, uint64_t microseconds )
+{
+  ThreadBuffer* buffer = GetThreadBuffer();
+  if( ! buffer )
+  {
+    return;
+  }
+
+  // Only this thread writes to the buffer, so the count needs no atomic increment. It is published after the event,
+  // so a thread dumping the trace sees the event complete; once the ring has wrapped, the dump may copy the slot
+  // being written here as its oldest event, so it drops that slot
+  const unsigned int writeCount = buffer->writeCount;
+  Event& event = buffer->events[ writeCount & ( mBufferSize - 1u ) ];
+  event.microseconds = microseconds;
+  event.name = name;
+  event.type = type;
+  event.contextId = contextId;
+  __atomic_store_n( &buffer->writeCount, writeCount + 1u, __ATOMIC_RELEASE );
+}
+
+TraceRecorder::ThreadBuffer* TraceRecorder::GetThreadBuffer()
+{
+  if( gThreadRecorderId == mId )
+  {
+    return gThreadBufferIndex != NO_THREAD_BUFFER ? &mThreadBuffers[ gThreadBufferIndex ] : NULL;
+  }
+
+  // The thread's first marker in this recorder
+  gThreadRecorderId = mId;
+  gThreadBufferIndex = __sync_fetch_and_add( &mThreadCount, 1u );
+  if( gThreadBufferIndex >= MAXIMUM_THREADS )
+  {
+    gThreadBufferIndex = NO_THREAD_BUFFER;
+    return NULL;
+  }
+
+  ThreadBuffer& buffer = mThreadBuffers[ gThreadBufferIndex ];
+  prctl( PR_GET_NAME, buffer.name, 0, 0, 0 );
+  buffer.name[ sizeof( buffer.name ) - 1u ] = '\0';
+  __atomic_store_n( &buffer.events, new Event[ mBufferSize ], __ATOMIC_RELEASE );
+
+  return &buffer;
+}
+
+std::string TraceRecorder::GetEventName( const Event& event )
+{
+  if( event.name )
+  {
+    return event.name;
+  }
+
+  if( event.contextId == INTERNAL_CONTEXT_ID )
+  {
+    // e.g. UPDATE_START and UPDATE_END are the beginning and end of UPDATE
+    std::string name( PerformanceMarker( static_cast< PerformanceInterface::MarkerType >( event.type ) ).GetName() );
+    if( ! RemoveSuffix( name, START_SUFFIX ) )
+    {
+      RemoveSuffix( name, END_SUFFIX );
+    }
+    return name;
+  }
+
+  Mutex::ScopedLock lock( mContextNamesMutex );
+  ContextNames::const_iterator iter = mContextNames.find( event.contextId );
+  if( iter != mContextNames.end() )
+  {
+    return iter->second;
+  }
+
+  char name[ EVENT_TEXT_SIZE ];
+  snprintf( name, sizeof( name ), "CONTEXT_%u", static_cast< unsigned int >( event.contextId ) );
+  return name;
+}
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
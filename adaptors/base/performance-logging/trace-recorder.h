@@ -0,0 +1,196 @@
+#ifndef __DALI_INTERNAL_ADAPTOR_TRACE_RECORDER_H__
+#define __DALI_INTERNAL_ADAPTOR_TRACE_RECORDER_H__
+
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <stdint.h>
+#include <map>
+#include <string>
+#include <dali/devel-api/threading/mutex.h>
+
+// INTERNAL INCLUDES
+#include <base/interfaces/performance-interface.h>
+#include <portable/scoped-trace.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace Adaptor
+{
+
+/**
+ * Records performance markers in memory, so that they can be dumped in the Chrome trace event format
+ * (which chrome://tracing and Perfetto can open) after a hitch has been seen.
+ *
+ * Each thread records into its own ring buffer, which keeps the most recent markers and overwrites the oldest.
+ * Recording a marker copies a few bytes into the buffer, without a lock, a system call or any text formatting;
+ * the names are only looked up when the trace is dumped. The trace can be dumped from any thread while markers
+ * are being recorded.
+ *
+ * It is also where scoped traces are recorded, see Trace::Enable().
+ */
+class TraceRecorder : public Trace::Recorder
+{
+public:
+
+  static const unsigned int DEFAULT_BUFFER_SIZE = 8192u; ///< Default number of markers kept per thread
+  static const unsigned int MAXIMUM_THREADS = 16u;       ///< Markers from any further threads are not recorded
+
+  /**
+   * Constructor. The buffers are only allocated when a thread first records a marker.
+   * @param[in] bufferSize The number of markers kept per thread, rounded up to a power of two, or zero for the default
+   */
+  TraceRecorder( unsigned int bufferSize = DEFAULT_BUFFER_SIZE );
+
+  /**
+   * Destructor, not intended as a base class
+   */
+  virtual ~TraceRecorder();
+
+  /**
+   * Records an internal marker, e.g. UPDATE_START or V_SYNC. Can be called from any thread.
+   * @param[in] type The marker type
+   * @param[in] microseconds The time stamp of the marker
+   */
+  void Record( PerformanceInterface::MarkerType type, uint64_t microseconds );
+
+  /**
+   * Records the START or END of a custom context. Can be called from any thread.
+   * @param[in] type The marker type
+   * @param[in] contextId The custom context
+   * @param[in] microseconds The time stamp of the marker
+   */
+  void Record( PerformanceInterface::MarkerType type, PerformanceInterface::ContextId contextId, uint64_t microseconds );
+
+  /**
+   * Records the beginning or end of a scoped trace. Can be called from any thread.
+   * @param[in] name The name of the scope, which must stay valid until the recorder is destroyed, e.g. a string literal
+   * @param[in] begin true at the beginning of the scope, false at its end
+   * @param[in] microseconds The time stamp
+   */
+  void RecordScope( const char* const name, bool begin, uint64_t microseconds );
+
+  /**
+   * @copydoc Dali::Internal::Trace::Recorder::RecordScope()
+   */
+  virtual void RecordScope( const char* const name, bool begin );
+
+  /**
+   * Sets the name a custom context's markers are given in the trace.
+   * The name is kept when the context is removed, as its markers may still be in the buffers.
+   * @param[in] contextId The custom context
+   * @param[in] name The name
+   */
+  void SetContextName( PerformanceInterface::ContextId contextId, const char* const name );
+
+  /**
+   * @return The number of markers kept per thread
+   */
+  unsigned int GetBufferSize() const;
+
+  /**
+   * @return The number of threads which have recorded a marker
+   */
+  unsigned int GetThreadCount() const;
+
+  /**
+   * Formats the recorded markers as a Chrome trace.
+   * Once a thread's buffer is full, its oldest marker is left out, as the thread may be overwriting it.
+   * @param[out] trace The JSON trace
+   */
+  void DumpChromeTrace( std::string& trace );
+
+  /**
+   * Writes the recorded markers to a file as a Chrome trace.
+   * @param[in] fileName The file to write, replacing it if it exists
+   * @return true if the file was written
+   */
+  bool WriteChromeTrace( const char* const fileName );
+
+private:
+
+  /**
+   * A recorded marker, with nothing which needs formatting
+   */
+  struct Event
+  {
+    uint64_t microseconds;       ///< time stamp
+    const char* name;            ///< name of a scoped trace, or NULL for a marker
+    unsigned short type;         ///< PerformanceInterface::MarkerType
+    unsigned short contextId;    ///< custom context, or INTERNAL_CONTEXT_ID for an internal marker
+  };
+
+  /**
+   * The ring buffer of one thread. Only that thread writes to it.
+   */
+  struct ThreadBuffer
+  {
+    Event* events;                       ///< mBufferSize events, or NULL until the thread records its first marker
+    volatile unsigned int writeCount;    ///< number of events written; the next is written at writeCount modulo the size
+    char name[ 16 ];                     ///< thread name when the buffer was created
+  };
+
+  /**
+   * Records an event into the calling thread's buffer
+   * @param[in] name The scope name, or NULL for a marker
+   * @param[in] type The marker type
+   * @param[in] contextId The custom context, or INTERNAL_CONTEXT_ID
+   * @param[in] microseconds The time stamp
+   */
+  void RecordEvent( const char* const name, unsigned int type, unsigned int contextId, uint64_t microseconds );
+
+  /**
+   * @return The calling thread's buffer, creating it if this is the thread's first marker, or NULL if too many threads have recorded markers
+   */
+  ThreadBuffer* GetThreadBuffer();
+
+  /**
+   * @param[in] event A recorded event
+   * @return The name of the event in the trace
+   */
+  std::string GetEventName( const Event& event );
+
+  // Undefined copy constructor.
+  TraceRecorder( const TraceRecorder& );
+
+  // Undefined assignment operator.
+  TraceRecorder& operator=( const TraceRecorder& );
+
+private:
+
+  typedef std::map< PerformanceInterface::ContextId, std::string > ContextNames;
+
+  ThreadBuffer mThreadBuffers[ MAXIMUM_THREADS ];  ///< one ring buffer per recording thread
+  volatile unsigned int mThreadCount;             ///< number of buffers claimed, may exceed MAXIMUM_THREADS
+  const unsigned int mBufferSize;                 ///< number of events per buffer, a power of two
+  const unsigned int mId;                         ///< identifies this recorder to the threads which have cached their buffer index
+  ContextNames mContextNames;                     ///< names of the custom contexts
+  Dali::Mutex mContextNamesMutex;                 ///< protects mContextNames
+};
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // __DALI_INTERNAL_ADAPTOR_TRACE_RECORDER_H__
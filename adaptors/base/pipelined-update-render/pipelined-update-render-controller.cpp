@@ -0,0 +1,825 @@
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include "pipelined-update-render-controller.h"
+
+// EXTERNAL INCLUDES
+#include <errno.h>
+#include <dali/integration-api/platform-abstraction.h>
+
+// INTERNAL INCLUDES
+#include <trigger-event-factory.h>
+#include <base/pipelined-update-render/pipelined-update-render-controller-debug.h>
+#include <base/environment-options.h>
+#include <base/time-service.h>
+#include <portable/scoped-trace.h>
+#include <base/interfaces/adaptor-internal-services.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace Adaptor
+{
+
+namespace
+{
+const unsigned int CREATED_THREAD_COUNT = 2u;
+
+const int CONTINUOUS = -1;
+const int ONCE = 1;
+
+const unsigned int TRUE = 1u;
+const unsigned int FALSE = 0u;
+
+const unsigned int MILLISECONDS_PER_SECOND( 1e+3 );
+const float        NANOSECONDS_TO_SECOND( 1e-9f );
+const unsigned int NANOSECONDS_PER_SECOND( 1e+9 );
+const unsigned int NANOSECONDS_PER_MILLISECOND( 1e+6 );
+const unsigned int NANOSECONDS_PER_MICROSECOND( 1e+3 );
+const unsigned int MICROSECONDS_PER_SECOND( 1e+6 );
+
+// The following values will get calculated at compile time
+const float        DEFAULT_FRAME_DURATION_IN_SECONDS( 1.0f / 60.0f );
+const unsigned int DEFAULT_FRAME_DURATION_IN_MILLISECONDS( DEFAULT_FRAME_DURATION_IN_SECONDS * MILLISECONDS_PER_SECOND );
+const unsigned int DEFAULT_FRAME_DURATION_IN_NANOSECONDS( DEFAULT_FRAME_DURATION_IN_SECONDS * NANOSECONDS_PER_SECOND );
+
+const unsigned int DEFAULT_FRAME_STATS_LOG_FREQUENCY = 2u; ///< Seconds between logs of the frame statistics, if the performance statistics frequency is not set
+
+/**
+ * Handles the use case when an update-request is received JUST before we process a sleep-request.
+ * See CombinedUpdateRenderController for the details.
+ */
+const unsigned int MAXIMUM_UPDATE_REQUESTS = 2;
+
+/**
+ * Reads a frame count written by another thread, with a full memory barrier so that the frame slot contents written
+ * before it was incremented are visible too.
+ */
+inline unsigned int ReadFrameCount( volatile unsigned int& frameCount )
+{
+  return __sync_fetch_and_add( &frameCount, 0u );
+}
+
+/**
+ * Wakes a thread which may be waiting on the semaphore.
+ *
+ * The waiting thread checks the frame counts again whenever it wakes, so a single pending post is all it needs. Not
+ * posting again while one is pending stops the count growing when the waiting thread is busy.
+ */
+inline void WakeThread( sem_t& semaphore )
+{
+  int value = 0;
+  sem_getvalue( &semaphore, &value );
+  if( value < 1 )
+  {
+    sem_post( &semaphore );
+  }
+}
+
+void LogFrameTimeStats( const char* const name, const FrameTimeStats& stats )
+{
+  float mean, standardDeviation;
+  stats.CalculateMean( mean, standardDeviation );
+
+  Integration::Log::LogMessage( Integration::Log::DebugInfo, "%s, min %0.2f ms, max %0.2f ms, avg %0.2f ms, std dev %0.2f ms, frames %u\n",
+                                name,
+                                stats.GetMinTime() * MILLISECONDS_PER_SECOND,
+                                stats.GetMaxTime() * MILLISECONDS_PER_SECOND,
+                                mean * MILLISECONDS_PER_SECOND,
+                                standardDeviation * MILLISECONDS_PER_SECOND,
+                                stats.GetRunCount() );
+}
+
+unsigned int GetFrameStatsLogFrequency( const EnvironmentOptions& environmentOptions )
+{
+  if( ! ( environmentOptions.GetPerformanceStatsLoggingOptions() & ( PerformanceInterface::LOG_EVERYTHING | PerformanceInterface::LOG_UPDATE_RENDER ) ) )
+  {
+    return 0u;
+  }
+
+  const unsigned int frequency = environmentOptions.GetPerformanceStatsLoggingFrequency();
+  return frequency ? frequency : DEFAULT_FRAME_STATS_LOG_FREQUENCY;
+}
+
+} // unnamed namespace
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// EVENT THREAD
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+PipelinedUpdateRenderController::PipelinedUpdateRenderController( AdaptorInternalServices& adaptorInterfaces, const EnvironmentOptions& environmentOptions )
+: mFpsTracker( environmentOptions ),
+  mUpdateStatusLogger( environmentOptions ),
+  mRenderHelper( adaptorInterfaces ),
+  mEventThreadSemaphore(),
+  mUpdateThreadWaitCondition(),
+  mRenderThreadWaitCondition(),
+  mFrameUpdatedSemaphore(),
+  mFrameRenderedSemaphore(),
+  mAdaptorInterfaces( adaptorInterfaces ),
+  mPerformanceInterface( adaptorInterfaces.GetPerformanceInterface() ),
+  mCore( adaptorInterfaces.GetCore() ),
+  mEnvironmentOptions( environmentOptions ),
+  mNotificationTrigger( adaptorInterfaces.GetProcessCoreEventsTrigger() ),
+  mSleepTrigger( NULL ),
+  mUpdateThread( NULL ),
+  mRenderThread( NULL ),
+  mMaximumUpdatesAhead( adaptorInterfaces.GetCore().GetMaximumUpdateCount() < NUMBER_OF_FRAME_SLOTS ? adaptorInterfaces.GetCore().GetMaximumUpdateCount() : NUMBER_OF_FRAME_SLOTS ),
+  mFrameIntervalStats(),
+  mFrameLatencyStats(),
+  mFrameStatsLogTime( 0u ),
+  mFrameStatsLogFrequency( GetFrameStatsLogFrequency( environmentOptions ) ),
+  mDefaultFrameDelta( 0.0f ),
+  mDefaultFrameDurationMilliseconds( 0u ),
+  mDefaultFrameDurationNanoseconds( 0u ),
+  mDefaultHalfFrameNanoseconds( 0u ),
+  mUpdateRequestCount( 0u ),
+  mRunning( FALSE ),
+  mUpdatedFrameCount( 0u ),
+  mRenderedFrameCount( 0u ),
+  mUpdateRunCount( 0 ),
+  mDestroyThreads( FALSE ),
+  mUpdateThreadCanSleep( FALSE ),
+  mPendingRequestUpdate( FALSE ),
+  mUseElapsedTimeAfterWait( FALSE ),
+  mNewSurface( NULL ),
+  mPostRendering( FALSE )
+{
+  LOG_EVENT_TRACE;
+
+  // Initialise frame delta/duration variables first
+  SetRenderRefreshRate( environmentOptions.GetRenderRefreshRate() );
+
+  // Set the thread-synchronization interface on the render-surface
+  RenderSurface* currentSurface = mAdaptorInterfaces.GetRenderSurfaceInterface();
+  if( currentSurface )
+  {
+    currentSurface->SetThreadSynchronization( *this );
+  }
+
+  TriggerEventFactoryInterface& triggerFactory = mAdaptorInterfaces.GetTriggerEventFactoryInterface();
+  mSleepTrigger = triggerFactory.CreateTriggerEvent( MakeCallback( this, &PipelinedUpdateRenderController::ProcessSleepRequest ), TriggerEventInterface::KEEP_ALIVE_AFTER_TRIGGER );
+
+  sem_init( &mEventThreadSemaphore, 0, 0 ); // Initialize to 0 so that it just waits if sem_post has not been called
+  sem_init( &mFrameUpdatedSemaphore, 0, 0 );
+  sem_init( &mFrameRenderedSemaphore, 0, 0 );
+}
+
+PipelinedUpdateRenderController::~PipelinedUpdateRenderController()
+{
+  LOG_EVENT_TRACE;
+
+  Stop();
+
+  delete mSleepTrigger;
+
+  sem_destroy( &mFrameRenderedSemaphore );
+  sem_destroy( &mFrameUpdatedSemaphore );
+  sem_destroy( &mEventThreadSemaphore );
+}
+
+void PipelinedUpdateRenderController::Initialize()
+{
+  LOG_EVENT_TRACE;
+
+  // Ensure Update & Render Threads not already created
+  DALI_ASSERT_ALWAYS( ! mUpdateThread && ! mRenderThread );
+
+  // Create Render Thread
+  mRenderThread = new pthread_t();
+  int error = pthread_create( mRenderThread, NULL, InternalRenderThreadEntryFunc, this );
+  DALI_ASSERT_ALWAYS( !error && "Return code from pthread_create() when creating RenderThread" );
+
+  // Create Update Thread
+  mUpdateThread = new pthread_t();
+  error = pthread_create( mUpdateThread, NULL, InternalUpdateThreadEntryFunc, this );
+  DALI_ASSERT_ALWAYS( !error && "Return code from pthread_create() when creating UpdateThread" );
+
+  // The Render thread will now run and initialise EGL etc. and both threads will then wait for Start to be called
+  // When this function returns, the application initialisation on the event thread should occur
+}
+
+void PipelinedUpdateRenderController::Start()
+{
+  LOG_EVENT_TRACE;
+
+  DALI_ASSERT_ALWAYS( !mRunning && mUpdateThread && mRenderThread );
+
+  // Wait until all threads created in Initialise are up and running
+  for( unsigned int i = 0; i < CREATED_THREAD_COUNT; ++i )
+  {
+    sem_wait( &mEventThreadSemaphore );
+  }
+
+  mRenderHelper.Start();
+
+  mRunning = TRUE;
+
+  LOG_EVENT( "Startup Complete, starting Update Thread" );
+
+  RunUpdateThread( CONTINUOUS, false /* No animation progression */ );
+}
+
+void PipelinedUpdateRenderController::Pause()
+{
+  LOG_EVENT_TRACE;
+
+  mRunning = FALSE;
+
+  PauseUpdateThread();
+
+  AddPerformanceMarker( PerformanceInterface::PAUSED );
+}
+
+void PipelinedUpdateRenderController::Resume()
+{
+  LOG_EVENT_TRACE;
+
+  if( !mRunning && IsUpdateThreadPaused() )
+  {
+    LOG_EVENT( "Resuming" );
+
+    RunUpdateThread( CONTINUOUS, true /* Animation progression required while we were paused */ );
+
+    AddPerformanceMarker( PerformanceInterface::RESUME );
+
+    mRunning = TRUE;
+  }
+}
+
+void PipelinedUpdateRenderController::Stop()
+{
+  LOG_EVENT_TRACE;
+
+  // Stop Rendering and the Update & Render Threads
+  mRenderHelper.Stop();
+
+  StopThreads();
+
+  if( mUpdateThread )
+  {
+    LOG_EVENT( "Destroying UpdateThread" );
+
+    // wait for the thread to finish
+    pthread_join( *mUpdateThread, NULL );
+
+    delete mUpdateThread;
+    mUpdateThread = NULL;
+  }
+
+  if( mRenderThread )
+  {
+    LOG_EVENT( "Destroying RenderThread" );
+
+    // wait for the thread to finish
+    pthread_join( *mRenderThread, NULL );
+
+    delete mRenderThread;
+    mRenderThread = NULL;
+  }
+
+  mRunning = FALSE;
+}
+
+void PipelinedUpdateRenderController::RequestUpdate()
+{
+  LOG_EVENT_TRACE;
+
+  // Increment the update-request count to the maximum
+  if( mUpdateRequestCount < MAXIMUM_UPDATE_REQUESTS )
+  {
+    ++mUpdateRequestCount;
+  }
+
+  if( mRunning && IsUpdateThreadPaused() )
+  {
+    LOG_EVENT( "Processing" );
+
+    RunUpdateThread( CONTINUOUS, false /* No animation progression */ );
+  }
+
+  ConditionalWait::ScopedLock updateLock( mUpdateThreadWaitCondition );
+  mPendingRequestUpdate = TRUE;
+}
+
+void PipelinedUpdateRenderController::RequestUpdateOnce()
+{
+  if( IsUpdateThreadPaused() )
+  {
+    LOG_EVENT_TRACE;
+
+    // Run Update/Render once
+    RunUpdateThread( ONCE, false /* No animation progression */ );
+  }
+}
+
+void PipelinedUpdateRenderController::ReplaceSurface( RenderSurface* newSurface )
+{
+  LOG_EVENT_TRACE;
+
+  // Set the ThreadSyncronizationInterface on the new surface
+  newSurface->SetThreadSynchronization( *this );
+
+  LOG_EVENT( "Starting to replace the surface, event-thread blocked" );
+
+  // Start replacing the surface.
+  {
+    ConditionalWait::ScopedLock lock( mRenderThreadWaitCondition );
+    mPostRendering = FALSE; // Clear the post-rendering flag as Render thread will replace the surface now
+    mNewSurface = newSurface;
+    mRenderThreadWaitCondition.Notify( lock );
+  }
+
+  // The render-thread may be waiting for a frame
+  WakeThread( mFrameUpdatedSemaphore );
+
+  // Wait until the surface has been replaced
+  sem_wait( &mEventThreadSemaphore );
+
+  LOG_EVENT( "Surface replaced, event-thread continuing" );
+}
+
+void PipelinedUpdateRenderController::SetRenderRefreshRate( unsigned int numberOfFramesPerRender )
+{
+  // Not protected by lock, but written to rarely so not worth adding a lock when reading
+  mDefaultFrameDelta                  = numberOfFramesPerRender * DEFAULT_FRAME_DURATION_IN_SECONDS;
+  mDefaultFrameDurationMilliseconds   = (uint64_t)numberOfFramesPerRender * DEFAULT_FRAME_DURATION_IN_MILLISECONDS;
+  mDefaultFrameDurationNanoseconds    = (uint64_t)numberOfFramesPerRender * DEFAULT_FRAME_DURATION_IN_NANOSECONDS;
+  mDefaultHalfFrameNanoseconds        = mDefaultFrameDurationNanoseconds / 2;
+
+  LOG_EVENT( "mDefaultFrameDelta(%.6f), mDefaultFrameDurationMilliseconds(%lld), mDefaultFrameDurationNanoseconds(%lld)", mDefaultFrameDelta, mDefaultFrameDurationMilliseconds, mDefaultFrameDurationNanoseconds );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// EVENT THREAD
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+void PipelinedUpdateRenderController::RunUpdateThread( int numberOfCycles, bool useElapsedTime )
+{
+  ConditionalWait::ScopedLock lock( mUpdateThreadWaitCondition );
+  mUpdateRunCount = numberOfCycles;
+  mUpdateThreadCanSleep = FALSE;
+  mUseElapsedTimeAfterWait = useElapsedTime;
+  LOG_COUNTER_EVENT( "mUpdateRunCount: %d, mUseElapsedTimeAfterWait: %d", mUpdateRunCount, mUseElapsedTimeAfterWait );
+  mUpdateThreadWaitCondition.Notify( lock );
+}
+
+void PipelinedUpdateRenderController::PauseUpdateThread()
+{
+  ConditionalWait::ScopedLock lock( mUpdateThreadWaitCondition );
+  mUpdateRunCount = 0;
+}
+
+void PipelinedUpdateRenderController::StopThreads()
+{
+  {
+    ConditionalWait::ScopedLock lock( mUpdateThreadWaitCondition );
+    mDestroyThreads = TRUE;
+    mUpdateThreadWaitCondition.Notify( lock );
+  }
+
+  {
+    // The render-thread may be waiting for post-rendering to complete
+    ConditionalWait::ScopedLock lock( mRenderThreadWaitCondition );
+    mRenderThreadWaitCondition.Notify( lock );
+  }
+
+  // Either thread may be waiting for the other to hand over a frame
+  WakeThread( mFrameUpdatedSemaphore );
+  WakeThread( mFrameRenderedSemaphore );
+}
+
+bool PipelinedUpdateRenderController::IsUpdateThreadPaused()
+{
+  ConditionalWait::ScopedLock lock( mUpdateThreadWaitCondition );
+  return ( mUpdateRunCount != CONTINUOUS ) || // Report paused if NOT continuously running
+         mUpdateThreadCanSleep;               // Report paused if sleeping
+}
+
+void PipelinedUpdateRenderController::ProcessSleepRequest()
+{
+  LOG_EVENT_TRACE;
+
+  // Decrement Update request count
+  if( mUpdateRequestCount > 0 )
+  {
+    --mUpdateRequestCount;
+  }
+
+  // Can sleep if our update-request count is 0
+  // Update thread can choose to carry on updating if it determines more updates are required
+  if( mUpdateRequestCount == 0 )
+  {
+    LOG_EVENT( "Going to sleep" );
+
+    ConditionalWait::ScopedLock lock( mUpdateThreadWaitCondition );
+    mUpdateThreadCanSleep = TRUE;
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// UPDATE THREAD
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+void PipelinedUpdateRenderController::UpdateThread()
+{
+  // Install a function for logging
+  mEnvironmentOptions.InstallLogFunction();
+
+  LOG_UPDATE( "THREAD CREATED" );
+
+  NotifyThreadInitialised();
+
+  // Update time
+  uint64_t lastFrameTime;
+  TimeService::GetNanoseconds( lastFrameTime );
+
+  LOG_UPDATE( "THREAD INITIALISED" );
+
+  bool useElapsedTime = true;
+  bool updateRequired = true;
+
+  while( UpdateReady( useElapsedTime, updateRequired ) &&
+         WaitForFreeFrameSlot() )
+  {
+    LOG_UPDATE_TRACE;
+
+    // Performance statistics are logged upon a VSYNC tick so use this point for a VSync marker
+    AddPerformanceMarker( PerformanceInterface::VSYNC );
+
+    uint64_t currentFrameStartTime = 0;
+    TimeService::GetNanoseconds( currentFrameStartTime );
+
+    const uint64_t timeSinceLastFrame = currentFrameStartTime - lastFrameTime;
+
+    // Optional FPS Tracking when continuously rendering
+    if( useElapsedTime && mFpsTracker.Enabled() )
+    {
+      float absoluteTimeSinceLastRender = timeSinceLastFrame * NANOSECONDS_TO_SECOND;
+      mFpsTracker.Track( absoluteTimeSinceLastRender );
+    }
+
+    lastFrameTime = currentFrameStartTime; // Store frame start time
+
+    //////////////////////////////
+    // UPDATE
+    //////////////////////////////
+
+    const unsigned int currentTime = currentFrameStartTime / NANOSECONDS_PER_MILLISECOND;
+    const unsigned int nextFrameTime = currentTime + mDefaultFrameDurationMilliseconds;
+
+    uint64_t noOfFramesSinceLastUpdate = 1;
+    float frameDelta = 0.0f;
+    if( useElapsedTime )
+    {
+      // If using the elapsed time, then calculate frameDelta as a multiple of mDefaultFrameDelta
+      // Round up if remainder is more than half the default frame time
+      noOfFramesSinceLastUpdate = ( timeSinceLastFrame + mDefaultHalfFrameNanoseconds) / mDefaultFrameDurationNanoseconds;
+      frameDelta = mDefaultFrameDelta * noOfFramesSinceLastUpdate;
+    }
+    LOG_UPDATE( "timeSinceLastFrame(%llu) noOfFramesSinceLastUpdate(%u) frameDelta(%.6f)", timeSinceLastFrame, noOfFramesSinceLastUpdate, frameDelta );
+
+    Integration::UpdateStatus updateStatus;
+
+    AddPerformanceMarker( PerformanceInterface::UPDATE_START );
+    mCore.Update( frameDelta, currentTime, nextFrameTime, updateStatus );
+    AddPerformanceMarker( PerformanceInterface::UPDATE_END );
+
+    unsigned int keepUpdatingStatus = updateStatus.KeepUpdating();
+
+    // Tell the event-thread to wake up (if asleep) and send a notification event to Core if required
+    if( updateStatus.NeedsNotification() )
+    {
+      mNotificationTrigger.Trigger();
+      LOG_UPDATE( "Notification Triggered" );
+    }
+
+    // Optional logging of update/render status
+    mUpdateStatusLogger.Log( keepUpdatingStatus );
+
+    //////////////////////////////
+    // HAND OVER TO RENDER
+    //////////////////////////////
+
+    FrameSlot& frameSlot = mFrameSlots[ mUpdatedFrameCount % NUMBER_OF_FRAME_SLOTS ];
+    frameSlot.updateStartTime = currentFrameStartTime;
+
+    // The increment is a full memory barrier, so the render-thread sees the slot contents before the new count
+    __sync_fetch_and_add( &mUpdatedFrameCount, 1u );
+    WakeThread( mFrameUpdatedSemaphore );
+
+    LOG_COUNTER_UPDATE( "mUpdatedFrameCount(%u)", mUpdatedFrameCount );
+
+    // Trigger event thread to request Update thread to sleep if update not required
+    // If a Render still needs another Update, the render-thread will request one
+    if( Integration::KeepUpdating::NOT_REQUESTED == keepUpdatingStatus )
+    {
+      mSleepTrigger->Trigger();
+      updateRequired = false;
+      LOG_UPDATE( "Sleep Triggered" );
+    }
+    else
+    {
+      updateRequired = true;
+    }
+
+    //////////////////////////////
+    // FRAME TIME
+    //////////////////////////////
+
+    // Sleep until at least the the default frame duration has elapsed. This will return immediately if the specified end-time has already passed.
+    TimeService::SleepUntil( currentFrameStartTime + mDefaultFrameDurationNanoseconds );
+  }
+
+  LOG_UPDATE( "THREAD DESTROYED" );
+
+  // Uninstall the logging function
+  mEnvironmentOptions.UnInstallLogFunction();
+}
+
+bool PipelinedUpdateRenderController::UpdateReady( bool& useElapsedTime, bool updateRequired )
+{
+  DALI_TRACE_SCOPE( Trace::UPDATE, "WaitForUpdate" );
+
+  useElapsedTime = true;
+
+  ConditionalWait::ScopedLock updateLock( mUpdateThreadWaitCondition );
+  while( ( ! mUpdateRunCount || // Should try to wait if event-thread has paused the Update thread
+           ( mUpdateThreadCanSleep && ! updateRequired && ! mPendingRequestUpdate ) ) && // Ensure we wait if we're supposed to be sleeping AND do not require another update
+         ! mDestroyThreads ) // Ensure we don't wait if the update-thread is supposed to be destroyed
+  {
+    LOG_UPDATE( "WAIT: mUpdateRunCount:       %d", mUpdateRunCount );
+    LOG_UPDATE( "      mUpdateThreadCanSleep: %d, updateRequired: %d, mPendingRequestUpdate: %d", mUpdateThreadCanSleep, updateRequired, mPendingRequestUpdate );
+    LOG_UPDATE( "      mDestroyThreads:       %d", mDestroyThreads );
+
+    mUpdateThreadWaitCondition.Wait( updateLock );
+
+    if( ! mUseElapsedTimeAfterWait )
+    {
+      useElapsedTime = false;
+    }
+  }
+
+  LOG_COUNTER_UPDATE( "mUpdateRunCount:       %d", mUpdateRunCount );
+  LOG_COUNTER_UPDATE( "mUpdateThreadCanSleep: %d, updateRequired: %d, mPendingRequestUpdate: %d", mUpdateThreadCanSleep, updateRequired, mPendingRequestUpdate );
+  LOG_COUNTER_UPDATE( "mDestroyThreads:       %d", mDestroyThreads );
+
+  mUseElapsedTimeAfterWait = FALSE;
+  mUpdateThreadCanSleep = FALSE;
+  mPendingRequestUpdate = FALSE;
+
+  // If we've been asked to run Update cycles a finite number of times then decrement so we wait after the
+  // requested number of cycles
+  if( mUpdateRunCount > 0 )
+  {
+    --mUpdateRunCount;
+  }
+
+  // Keep the update-thread alive if this thread is NOT to be destroyed
+  return ! mDestroyThreads;
+}
+
+bool PipelinedUpdateRenderController::WaitForFreeFrameSlot()
+{
+  DALI_TRACE_SCOPE( Trace::UPDATE, "WaitForFreeFrameSlot" );
+
+  // Only this thread writes mUpdatedFrameCount so it does not need an atomic read
+  while( ( mUpdatedFrameCount - ReadFrameCount( mRenderedFrameCount ) >= mMaximumUpdatesAhead ) &&
+         ! mDestroyThreads )
+  {
+    LOG_COUNTER_UPDATE( "Maximum Update Ahead of Render: WAIT" );
+    sem_wait( &mFrameRenderedSemaphore );
+  }
+
+  return ! mDestroyThreads;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// RENDER THREAD
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+void PipelinedUpdateRenderController::RenderThread()
+{
+  // Install a function for logging
+  mEnvironmentOptions.InstallLogFunction();
+
+  LOG_RENDER( "THREAD CREATED" );
+
+  mRenderHelper.InitializeEgl();
+
+  // tell core it has a context
+  mCore.ContextCreated();
+
+  NotifyThreadInitialised();
+
+  LOG_RENDER( "THREAD INITIALISED" );
+
+  while( RenderReady() )
+  {
+    LOG_RENDER_TRACE;
+
+    //////////////////////////////
+    // REPLACE SURFACE
+    //////////////////////////////
+
+    RenderSurface* newSurface = ShouldSurfaceBeReplaced();
+    if( DALI_UNLIKELY( newSurface ) )
+    {
+      LOG_RENDER_TRACE_FMT( "Replacing Surface" );
+      mRenderHelper.ReplaceSurface( newSurface );
+      SurfaceReplaced();
+    }
+
+    // Only this thread writes mRenderedFrameCount so it does not need an atomic read
+    const unsigned int renderedFrameCount = mRenderedFrameCount;
+    if( ReadFrameCount( mUpdatedFrameCount ) == renderedFrameCount )
+    {
+      // Woken to replace the surface only
+      continue;
+    }
+
+    const uint64_t updateStartTime = mFrameSlots[ renderedFrameCount % NUMBER_OF_FRAME_SLOTS ].updateStartTime;
+
+    //////////////////////////////
+    // RENDER
+    //////////////////////////////
+
+    mRenderHelper.ConsumeEvents();
+    mRenderHelper.PreRender();
+
+    Integration::RenderStatus renderStatus;
+
+    AddPerformanceMarker( PerformanceInterface::RENDER_START );
+    mCore.Render( renderStatus );
+    AddPerformanceMarker( PerformanceInterface::RENDER_END );
+
+    mRenderHelper.PostRender();
+
+    //////////////////////////////
+    // HAND BACK TO UPDATE
+    //////////////////////////////
+
+    __sync_fetch_and_add( &mRenderedFrameCount, 1u );
+    WakeThread( mFrameRenderedSemaphore );
+
+    LOG_COUNTER_RENDER( "mRenderedFrameCount(%u)", mRenderedFrameCount );
+
+    if( renderStatus.NeedsUpdate() )
+    {
+      // The update-thread may already have decided to sleep, so ask for another Update
+      ConditionalWait::ScopedLock updateLock( mUpdateThreadWaitCondition );
+      mPendingRequestUpdate = TRUE;
+      mUpdateThreadWaitCondition.Notify( updateLock );
+      LOG_RENDER( "Update Requested" );
+    }
+
+    if( mFrameStatsLogFrequency )
+    {
+      uint64_t swapEndTime = 0;
+      TimeService::GetNanoseconds( swapEndTime );
+      RecordFrameTimes( updateStartTime, swapEndTime );
+    }
+  }
+
+  // Inform core of context destruction & shutdown EGL
+  mCore.ContextDestroyed();
+  mRenderHelper.ShutdownEgl();
+
+  LOG_RENDER( "THREAD DESTROYED" );
+
+  // Uninstall the logging function
+  mEnvironmentOptions.UnInstallLogFunction();
+}
+
+bool PipelinedUpdateRenderController::RenderReady()
+{
+  DALI_TRACE_SCOPE( Trace::RENDER, "WaitForRender" );
+
+  // Only this thread writes mRenderedFrameCount so it does not need an atomic read
+  while( ( ReadFrameCount( mUpdatedFrameCount ) == mRenderedFrameCount ) &&
+         ! mDestroyThreads && // Ensure we don't wait if the render-thread is supposed to be destroyed
+         ! mNewSurface )      // Ensure we don't wait if we need to replace the surface
+  {
+    LOG_COUNTER_RENDER( "No frame to render: WAIT" );
+    sem_wait( &mFrameUpdatedSemaphore );
+  }
+
+  // Keep the render-thread alive if this thread is NOT to be destroyed
+  return ! mDestroyThreads;
+}
+
+RenderSurface* PipelinedUpdateRenderController::ShouldSurfaceBeReplaced()
+{
+  ConditionalWait::ScopedLock lock( mRenderThreadWaitCondition );
+
+  RenderSurface* newSurface = mNewSurface;
+  mNewSurface = NULL;
+
+  return newSurface;
+}
+
+void PipelinedUpdateRenderController::SurfaceReplaced()
+{
+  // Just increment the semaphore
+  sem_post( &mEventThreadSemaphore );
+}
+
+void PipelinedUpdateRenderController::RecordFrameTimes( uint64_t updateStartTime, uint64_t swapEndTime )
+{
+  const FrameTimeStamp swapTimeStamp( 0, swapEndTime / NANOSECONDS_PER_MICROSECOND );
+
+  // The time between frames; the first swap after a reset only starts the timer
+  mFrameIntervalStats.EndTime( swapTimeStamp );
+  mFrameIntervalStats.StartTime( swapTimeStamp );
+
+  mFrameLatencyStats.StartTime( FrameTimeStamp( 0, updateStartTime / NANOSECONDS_PER_MICROSECOND ) );
+  mFrameLatencyStats.EndTime( swapTimeStamp );
+
+  if( mFrameStatsLogTime == 0u )
+  {
+    mFrameStatsLogTime = swapTimeStamp.microseconds;
+  }
+  else if( swapTimeStamp.microseconds - mFrameStatsLogTime >= static_cast< uint64_t >( mFrameStatsLogFrequency ) * MICROSECONDS_PER_SECOND )
+  {
+    LogFrameTimeStats( "Frame", mFrameIntervalStats );
+    LogFrameTimeStats( "UpdateToSwap", mFrameLatencyStats );
+
+    mFrameIntervalStats.Reset();
+    mFrameLatencyStats.Reset();
+    mFrameStatsLogTime = swapTimeStamp.microseconds;
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// ALL THREADS
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+void PipelinedUpdateRenderController::NotifyThreadInitialised()
+{
+  // Just increment the semaphore
+  sem_post( &mEventThreadSemaphore );
+}
+
+void PipelinedUpdateRenderController::AddPerformanceMarker( PerformanceInterface::MarkerType type )
+{
+  if( mPerformanceInterface )
+  {
+    mPerformanceInterface->AddMarker( type );
+  }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+// POST RENDERING: EVENT THREAD
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+void PipelinedUpdateRenderController::PostRenderComplete()
+{
+  ConditionalWait::ScopedLock lock( mRenderThreadWaitCondition );
+  mPostRendering = FALSE;
+  mRenderThreadWaitCondition.Notify( lock );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// POST RENDERING: RENDER THREAD
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+void PipelinedUpdateRenderController::PostRenderStarted()
+{
+  ConditionalWait::ScopedLock lock( mRenderThreadWaitCondition );
+  mPostRendering = TRUE;
+}
+
+void PipelinedUpdateRenderController::PostRenderWaitForCompletion()
+{
+  ConditionalWait::ScopedLock lock( mRenderThreadWaitCondition );
+  while( mPostRendering &&
+         ! mNewSurface &&                // We should NOT wait if we're replacing the surface
+         ! mDestroyThreads )
+  {
+    mRenderThreadWaitCondition.Wait( lock );
+  }
+}
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
@@ -0,0 +1,392 @@
+#ifndef __DALI_INTERNAL_PIPELINED_UPDATE_RENDER_CONTROLLER_H__
+#define __DALI_INTERNAL_PIPELINED_UPDATE_RENDER_CONTROLLER_H__
+
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <pthread.h>
+#include <semaphore.h>
+#include <stdint.h>
+#include <dali/integration-api/core.h>
+#include <dali/devel-api/threading/conditional-wait.h>
+
+// INTERNAL INCLUDES
+#include <integration-api/thread-synchronization-interface.h>
+#include <base/interfaces/performance-interface.h>
+#include <base/fps-tracker.h>
+#include <base/render-helper.h>
+#include <base/thread-controller-interface.h>
+#include <base/update-status-logger.h>
+#include <base/performance-logging/frame-time-stats.h>
+
+namespace Dali
+{
+
+class RenderSurface;
+class TriggerEventInterface;
+
+namespace Internal
+{
+
+namespace Adaptor
+{
+
+class AdaptorInternalServices;
+class EnvironmentOptions;
+
+/**
+ * @brief Three threads where events/application interaction is handled on the main/event thread, Update on the
+ * update-thread and Render on the render-thread, so that Update of one frame overlaps the Render of the previous one.
+ *
+ * Key Points:
+ *  1. Three Threads:
+ *    a. Main/Event Thread.
+ *    b. Update Thread.
+ *    c. Render Thread.
+ *  2. There is NO VSync thread; the update-thread paces itself as the combined update/render thread does:
+ *    a. We retrieve the time before Update.
+ *    b. Then retrieve the time after Update.
+ *    c. If the difference is less than the default frame time, we sleep.
+ *  3. The update and render threads hand frames to each other through a double-buffered ring of frame slots:
+ *    a. The update-thread fills a slot and publishes it by atomically incrementing the updated-frame count.
+ *    b. The render-thread renders the oldest published slot and frees it by atomically incrementing the
+ *       rendered-frame count.
+ *    c. The update-thread may only run ahead of the render-thread by as many frames as there are slots (and as
+ *       Core allows), so Update of frame N+1 runs while frame N is rendered and swapped.
+ *    d. No locks are taken on this path; a thread only blocks, on a semaphore, when it has nothing to do.
+ *  4. The update-thread decides whether to sleep as the combined update/render thread does. If a Render finds it
+ *     needs another Update after the update-thread has decided to sleep, it requests one.
+ *  5. The render-thread owns the GL context, so it replaces the surface while the main thread is blocked.
+ *  6. When we resume from paused, elapsed time is used for the animations; it is NOT used when waking up from a sleep
+ *     state or doing an UpdateOnce.
+ *  7. If update & render statistics are logged, the time between frames and from the start of Update until the
+ *     buffers are swapped is logged at the same frequency, using FrameTimeStats.
+ */
+class PipelinedUpdateRenderController : public ThreadControllerInterface,
+                                        public ThreadSynchronizationInterface
+{
+public:
+
+  /**
+   * Constructor
+   */
+  PipelinedUpdateRenderController( AdaptorInternalServices& adaptorInterfaces, const EnvironmentOptions& environmentOptions );
+
+  /**
+   * Non virtual destructor. Not intended as base class.
+   */
+  ~PipelinedUpdateRenderController();
+
+  /**
+   * @copydoc ThreadControllerInterface::Initialize()
+   */
+  virtual void Initialize();
+
+  /**
+   * @copydoc ThreadControllerInterface::Start()
+   */
+  virtual void Start();
+
+  /**
+   * @copydoc ThreadControllerInterface::Pause()
+   */
+  virtual void Pause();
+
+  /**
+   * @copydoc ThreadControllerInterface::Resume()
+   */
+  virtual void Resume();
+
+  /**
+   * @copydoc ThreadControllerInterface::Stop()
+   */
+  virtual void Stop();
+
+  /**
+   * @copydoc ThreadControllerInterface::RequestUpdate()
+   */
+  virtual void RequestUpdate();
+
+  /**
+   * @copydoc ThreadControllerInterface::RequestUpdateOnce()
+   */
+  virtual void RequestUpdateOnce();
+
+  /**
+   * @copydoc ThreadControllerInterface::ReplaceSurface()
+   */
+  virtual void ReplaceSurface( RenderSurface* surface );
+
+  /**
+   * @copydoc ThreadControllerInterface::SetRenderRefreshRate()
+   */
+  virtual void SetRenderRefreshRate( unsigned int numberOfFramesPerRender );
+
+private:
+
+  // Undefined copy constructor.
+  PipelinedUpdateRenderController( const PipelinedUpdateRenderController& );
+
+  // Undefined assignment operator.
+  PipelinedUpdateRenderController& operator=( const PipelinedUpdateRenderController& );
+
+  /////////////////////////////////////////////////////////////////////////////////////////////////
+  // EventThread
+  /////////////////////////////////////////////////////////////////////////////////////////////////
+
+  /**
+   * Runs the Update Thread.
+   * This will lock the mutex in mUpdateThreadWaitCondition.
+   *
+   * @param[in]  numberOfCycles           The number of times the update cycle should run. If -1, then it will run continuously.
+   * @param[in]  useElapsedTimeAfterWait  If true, then the elapsed time during wait is used for animations, otherwise no animation progression is made.
+   */
+  inline void RunUpdateThread( int numberOfCycles, bool useElapsedTimeAfterWait );
+
+  /**
+   * Pauses the Update Thread.
+   * This will lock the mutex in mUpdateThreadWaitCondition.
+   */
+  inline void PauseUpdateThread();
+
+  /**
+   * Stops the Update & Render Threads.
+   * This will lock the mutexes in mUpdateThreadWaitCondition & mRenderThreadWaitCondition.
+   *
+   * @note Should only be called in Stop as calling this will kill both threads.
+   */
+  inline void StopThreads();
+
+  /**
+   * Checks if the the Update Thread is paused.
+   * This will lock the mutex in mUpdateThreadWaitCondition.
+   *
+   * @return true if paused, false otherwise
+   */
+  inline bool IsUpdateThreadPaused();
+
+  /**
+   * Used as the callback for the sleep-trigger.
+   *
+   * Will sleep when enough requests are made without any requests.
+   */
+  void ProcessSleepRequest();
+
+  /////////////////////////////////////////////////////////////////////////////////////////////////
+  // UpdateThread
+  /////////////////////////////////////////////////////////////////////////////////////////////////
+
+  /**
+   * The Update thread loop. This thread will be destroyed on exit from this function.
+   */
+  void UpdateThread();
+
+  /**
+   * Called by the Update Thread which ensures a wait if required.
+   *
+   * @param[out] useElapsedTime  If true when returned, then the actual elapsed time will be used for animation.
+   *                             If false when returned, then there should NOT be any animation progression in the next Update.
+   * @param[in]  updateRequired  Whether another update is required.
+   * @return false, if the thread should stop.
+   */
+  bool UpdateReady( bool& useElapsedTime, bool updateRequired );
+
+  /**
+   * Called by the Update Thread to wait until there is a free frame slot to update into.
+   *
+   * @return false, if the thread should stop.
+   */
+  bool WaitForFreeFrameSlot();
+
+  /**
+   * Helper for the thread calling the entry function
+   * @param[in] This A pointer to the current object
+   */
+  static void* InternalUpdateThreadEntryFunc( void* This )
+  {
+    ( static_cast<PipelinedUpdateRenderController*>( This ) )->UpdateThread();
+    return NULL;
+  }
+
+  /////////////////////////////////////////////////////////////////////////////////////////////////
+  // RenderThread
+  /////////////////////////////////////////////////////////////////////////////////////////////////
+
+  /**
+   * The Render thread loop. This thread will be destroyed on exit from this function.
+   */
+  void RenderThread();
+
+  /**
+   * Called by the Render Thread to wait until a frame has been updated or the surface needs replacing.
+   *
+   * @return false, if the thread should stop.
+   */
+  bool RenderReady();
+
+  /**
+   * Checks to see if the surface needs to be replaced.
+   * This will lock the mutex in mRenderThreadWaitCondition.
+   *
+   * @return Pointer to the new surface, NULL otherwise
+   */
+  RenderSurface* ShouldSurfaceBeReplaced();
+
+  /**
+   * Called by the Render thread after a surface has been replaced.
+   */
+  void SurfaceReplaced();
+
+  /**
+   * Called by the Render thread after a frame is swapped to record and periodically log its timings.
+   *
+   * @param[in]  updateStartTime  When the Update of the frame started, in nanoseconds
+   * @param[in]  swapEndTime      When the buffers were swapped, in nanoseconds
+   */
+  void RecordFrameTimes( uint64_t updateStartTime, uint64_t swapEndTime );
+
+  /**
+   * Helper for the thread calling the entry function
+   * @param[in] This A pointer to the current object
+   */
+  static void* InternalRenderThreadEntryFunc( void* This )
+  {
+    ( static_cast<PipelinedUpdateRenderController*>( This ) )->RenderThread();
+    return NULL;
+  }
+
+  /////////////////////////////////////////////////////////////////////////////////////////////////
+  // ALL Threads
+  /////////////////////////////////////////////////////////////////////////////////////////////////
+
+  /**
+   * Called by the update & render threads when they up and running.
+   */
+  void NotifyThreadInitialised();
+
+  /**
+   * Helper to add a performance marker to the performance server (if it's active)
+   * @param[in]  type  performance marker type
+   */
+  void AddPerformanceMarker( PerformanceInterface::MarkerType type );
+
+  /////////////////////////////////////////////////////////////////////////////////////////////////
+  // POST RENDERING - ThreadSynchronizationInterface overrides
+  /////////////////////////////////////////////////////////////////////////////////////////////////
+
+  /////////////////////////////////////////////////////////////////////////////////////////////////
+  //// Called by the Event Thread if post-rendering is required
+  /////////////////////////////////////////////////////////////////////////////////////////////////
+
+  /**
+   * @copydoc ThreadSynchronizationInterface::PostRenderComplete()
+   */
+  virtual void PostRenderComplete();
+
+  /////////////////////////////////////////////////////////////////////////////////////////////////
+  //// Called by the Render Thread if post-rendering is required
+  /////////////////////////////////////////////////////////////////////////////////////////////////
+
+  /**
+   * @copydoc ThreadSynchronizationInterface::PostRenderStarted()
+   */
+  virtual void PostRenderStarted();
+
+  /**
+   * @copydoc ThreadSynchronizationInterface::PostRenderStarted()
+   */
+  virtual void PostRenderWaitForCompletion();
+
+private:
+
+  /**
+   * What the update-thread hands to the render-thread with each frame.
+   */
+  struct FrameSlot
+  {
+    uint64_t updateStartTime; ///< When the Update of this frame started, in nanoseconds
+  };
+
+  static const unsigned int NUMBER_OF_FRAME_SLOTS = 2u; ///< Double-buffered
+
+  FpsTracker                        mFpsTracker;                       ///< Object that tracks the FPS
+  UpdateStatusLogger                mUpdateStatusLogger;               ///< Object that logs the update-status as required.
+
+  RenderHelper                      mRenderHelper;                     ///< Helper class for EGL, pre & post rendering
+
+  sem_t                             mEventThreadSemaphore;             ///< Used by the event thread to ensure all threads have been initialised, and when replacing the surface.
+
+  ConditionalWait                   mUpdateThreadWaitCondition;        ///< The wait condition for the update-thread.
+  ConditionalWait                   mRenderThreadWaitCondition;        ///< The wait condition for the render-thread while post-rendering or replacing the surface.
+
+  sem_t                             mFrameUpdatedSemaphore;            ///< Posted by the update-thread when a frame slot is published, and to wake the render-thread.
+  sem_t                             mFrameRenderedSemaphore;           ///< Posted by the render-thread when a frame slot is freed, and to wake the update-thread.
+
+  AdaptorInternalServices&          mAdaptorInterfaces;                ///< The adaptor internal interface
+  PerformanceInterface*             mPerformanceInterface;             ///< The performance logging interface
+  Integration::Core&                mCore;                             ///< Dali core reference
+  const EnvironmentOptions&         mEnvironmentOptions;               ///< Environment options
+  TriggerEventInterface&            mNotificationTrigger;              ///< Reference to notification event trigger
+  TriggerEventInterface*            mSleepTrigger;                     ///< Used by the update-thread to trigger the event thread when it no longer needs to do any updates
+
+  pthread_t*                        mUpdateThread;                     ///< The Update Thread.
+  pthread_t*                        mRenderThread;                     ///< The Render Thread.
+
+  FrameSlot                         mFrameSlots[ NUMBER_OF_FRAME_SLOTS ]; ///< Written by the update-thread before publishing, read by the render-thread before freeing.
+  const unsigned int                mMaximumUpdatesAhead;              ///< How many published frames may be waiting for, or in, Render.
+
+  FrameTimeStats                    mFrameIntervalStats;               ///< Time between buffer swaps. Only used by the render-thread.
+  FrameTimeStats                    mFrameLatencyStats;                ///< Time from the start of Update to the buffer swap. Only used by the render-thread.
+  uint64_t                          mFrameStatsLogTime;                ///< When the frame statistics were last logged, in microseconds. Only used by the render-thread.
+  const unsigned int                mFrameStatsLogFrequency;           ///< How often the frame statistics are logged in seconds, zero if they are not.
+
+  float                             mDefaultFrameDelta;                ///< Default time delta between each frame (used for animations). Not protected by lock, but written to rarely so not worth adding a lock when reading.
+  uint64_t                          mDefaultFrameDurationMilliseconds; ///< Default duration of a frame (used for predicting the time of the next frame). Not protected by lock, but written to rarely so not worth adding a lock when reading.
+  uint64_t                          mDefaultFrameDurationNanoseconds;  ///< Default duration of a frame (used for sleeping if not enough time elapsed). Not protected by lock, but written to rarely so not worth adding a lock when reading.
+  uint64_t                          mDefaultHalfFrameNanoseconds;      ///< Is half of mDefaultFrameDurationNanoseconds. Using a member variable avoids having to do the calculation every frame. Not protected by lock, but written to rarely so not worth adding a lock when reading.
+
+  unsigned int                      mUpdateRequestCount;               ///< Count of update-requests we have received to ensure we do not go to sleep too early.
+  unsigned int                      mRunning;                          ///< Read and set on the event-thread only to state whether we are running.
+
+  //
+  // NOTE: cannot use booleans as these are used from multiple threads, must use variable with machine word size for atomic read/write
+  //
+
+  volatile unsigned int             mUpdatedFrameCount;                ///< How many frame slots have been published (incremented atomically by the update-thread).
+  volatile unsigned int             mRenderedFrameCount;               ///< How many frame slots have been freed (incremented atomically by the render-thread).
+
+  volatile int                      mUpdateRunCount;                   ///< The number of times the Update cycle should run. If -1, then will run continuously (set by the event-thread, read by the update-thread).
+  volatile unsigned int             mDestroyThreads;                   ///< Whether the Update & Render threads should be destroyed (set by the event-thread, read by the update & render threads).
+  volatile unsigned int             mUpdateThreadCanSleep;             ///< Whether the Update thread can sleep (set by the event-thread, read by the update-thread).
+  volatile unsigned int             mPendingRequestUpdate;             ///< Is set as soon as an RequestUpdate is made and unset when the next update happens (set by the event, update & render threads, read by the update-thread).
+                                                                       ///< Ensures we do not go to sleep if we have not processed the most recent update-request.
+
+  volatile unsigned int             mUseElapsedTimeAfterWait;          ///< Whether we should use the elapsed time after waiting (set by the event-thread, read by the update-thread).
+
+  RenderSurface* volatile           mNewSurface;                       ///< Will be set to the new-surface if requested (set by the event-thread, read & cleared by the render-thread).
+
+  volatile unsigned int             mPostRendering;                    ///< Whether post-rendering is taking place (set by the event & render threads, read by the render-thread).
+};
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // __DALI_INTERNAL_PIPELINED_UPDATE_RENDER_CONTROLLER_H__
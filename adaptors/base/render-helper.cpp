@@ -24,6 +24,7 @@
 // INTERNAL INCLUDES
 #include <base/interfaces/adaptor-internal-services.h>
 #include <base/display-connection.h>
+#include <portable/scoped-trace.h>
 
 namespace Dali
 {
@@ -38,6 +39,7 @@ RenderHelper::RenderHelper( AdaptorInternalServices& adaptorInterfaces )
 : mGLES( adaptorInterfaces.GetGlesInterface() ),
   mEglFactory( &adaptorInterfaces.GetEGLFactoryInterface()),
   mEGL( NULL ),
+  mTextureUploadBudget( adaptorInterfaces.GetTextureUploadBudget() ),
   mSurfaceReplaced( false )
 {
   // set the initial values before render thread starts
@@ -79,6 +81,8 @@ void RenderHelper::Stop()
 
 void RenderHelper::ConsumeEvents()
 {
+  DALI_TRACE_SCOPE( Trace::RENDER, "ConsumeEvents" );
+
   mDisplayConnection->ConsumeEvents();
 }
 
@@ -104,6 +108,8 @@ void RenderHelper::InitializeEgl()
 
 void RenderHelper::ReplaceSurface( RenderSurface* newSurface )
 {
+  DALI_TRACE_SCOPE( Trace::RENDER, "ReplaceSurface" );
+
   mSurface->DestroyEglSurface(*mEGL);
 
   // This is designed for replacing pixmap surfaces, but should work for window as well
@@ -135,6 +141,8 @@ void RenderHelper::ShutdownEgl()
 
 bool RenderHelper::PreRender()
 {
+  DALI_TRACE_SCOPE( Trace::RENDER, "PreRender" );
+
   if( mSurface )
   {
     mSurface->PreRender( *mEGL, mGLES );
@@ -145,9 +153,14 @@ bool RenderHelper::PreRender()
 
 void RenderHelper::PostRender()
 {
+  DALI_TRACE_SCOPE( Trace::RENDER, "PostRender" );
+
   // Inform the gl implementation that rendering has finished before informing the surface
   mGLES.PostRender();
 
+  // Uploads deferred this frame may go ahead in the next one
+  mTextureUploadBudget.NextFrame();
+
   if( mSurface )
   {
     // Inform the surface that rendering this frame has finished.
@@ -35,6 +35,8 @@ class GlAbstraction;
 
 namespace Internal
 {
+class TextureUploadBudget;
+
 namespace Adaptor
 {
 
@@ -138,6 +140,7 @@ private: // Data
   EglFactoryInterface*          mEglFactory;             ///< Factory class to create EGL implementation
   EglInterface*                 mEGL;                    ///< Interface to EGL implementation
   RenderSurface*                mSurface;                ///< Current surface
+  TextureUploadBudget&          mTextureUploadBudget;    ///< Texture data uploaded per frame, restarted after each frame
   Dali::DisplayConnection*      mDisplayConnection;      ///< Display connection
   bool                          mSurfaceReplaced;        ///< True when new surface has been initialized.
 };
@@ -25,6 +25,7 @@
 #include <base/interfaces/adaptor-internal-services.h>
 #include <base/separate-update-render/thread-synchronization.h>
 #include <base/environment-options.h>
+#include <portable/scoped-trace.h>
 
 namespace Dali
 {
@@ -159,6 +160,8 @@ bool RenderThread::Run()
 
 void RenderThread::ProcessRequest( RenderRequest* request )
 {
+  DALI_TRACE_SCOPE( Trace::RENDER, "ProcessRenderRequest" );
+
   if( request != NULL )
   {
     switch(request->GetType())
@@ -21,6 +21,7 @@
 // INTERNAL INCLUDES
 #include <base/interfaces/adaptor-internal-services.h>
 #include <base/separate-update-render/thread-synchronization-debug.h>
+#include <portable/scoped-trace.h>
 
 namespace Dali
 {
@@ -307,6 +308,8 @@ void ThreadSynchronization::SetRenderRefreshRate( unsigned int numberOfVSyncsPer
 
 bool ThreadSynchronization::UpdateReady( bool notifyEvent, bool runUpdate, float& lastFrameDeltaSeconds, unsigned int& lastSyncTimeMilliseconds, unsigned int& nextSyncTimeMilliseconds )
 {
+  DALI_TRACE_SCOPE( Trace::UPDATE, "WaitForUpdate" );
+
   LOG_UPDATE_TRACE;
 
   State::Type state = State::STOPPED;
@@ -445,6 +448,8 @@ bool ThreadSynchronization::UpdateReady( bool notifyEvent, bool runUpdate, float
 
 bool ThreadSynchronization::RenderReady( RenderRequest*& requestPtr )
 {
+  DALI_TRACE_SCOPE( Trace::RENDER, "WaitForRender" );
+
   LOG_RENDER_TRACE;
 
   if( ! IsRenderThreadReplacingSurface() ) // Call to this function locks so should not be called if we have a scoped-lock
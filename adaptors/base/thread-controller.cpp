@@ -22,6 +22,7 @@
 #include <base/environment-options.h>
 #include <base/thread-controller-interface.h>
 #include <base/combined-update-render/combined-update-render-controller.h>
+#include <base/pipelined-update-render/pipelined-update-render-controller.h>
 #include <base/separate-update-render/separate-update-render-controller.h>
 #include <base/single-threaded/single-thread-controller.h>
 
@@ -56,6 +57,12 @@ ThreadController::ThreadController( AdaptorInternalServices& adaptorInterfaces,
       mThreadControllerInterface = new SingleThreadController( adaptorInterfaces, environmentOptions );
       break;
     }
+
+    case ThreadingMode::PIPELINED_UPDATE_RENDER:
+    {
+      mThreadControllerInterface = new PipelinedUpdateRenderController( adaptorInterfaces, environmentOptions );
+      break;
+    }
   }
 }
 
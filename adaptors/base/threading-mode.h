@@ -34,6 +34,7 @@ struct ThreadingMode
     SEPARATE_UPDATE_RENDER = 0,  ///< Event, V-Sync, Update & Render on Separate threads.
     COMBINED_UPDATE_RENDER,      ///< Three threads: Event, V-Sync & a Joint Update/Render thread.
     SINGLE_THREADED,             ///< ALL functionality on the SAME thread.
+    PIPELINED_UPDATE_RENDER,     ///< Three threads: Event, Update & Render, where Update of the next frame overlaps Render of the current one.
   };
 };
 
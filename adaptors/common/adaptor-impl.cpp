@@ -49,6 +49,7 @@
 #include <clipboard-impl.h>
 #include <vsync-monitor.h>
 #include <object-profiler.h>
+#include <timer-coalescer.h>
 #include <base/display-connection.h>
 #include <window-impl.h>
 
@@ -103,6 +104,16 @@ void Adaptor::Initialize( Dali::Configuration::ContextLoss configuration )
   std::string path;
   GetDataStoragePath( path );
   mPlatformAbstraction->SetDataStoragePath( path );
+  mPlatformAbstraction->SetResourceThreadCount( mEnvironmentOptions->GetResourceThreadCount() );
+  mPlatformAbstraction->SetImageScalingThreadCount( mEnvironmentOptions->GetImageScalingThreadCount() );
+  mPlatformAbstraction->SetProgressiveImageLoading( mEnvironmentOptions->GetProgressiveImageLoading() );
+  mPlatformAbstraction->SetThumbnailCache( mEnvironmentOptions->GetThumbnailCacheDirectory(), mEnvironmentOptions->GetThumbnailCacheSize() );
+
+  // The resource loader limits the images it hands to core, on the update thread, and the render thread limits
+  // the native bitmap buffers it uploads, so each has half the budget. Each still lets its first upload of a frame through.
+  const unsigned int halfTextureUploadBudget = ( mEnvironmentOptions->GetTextureUploadBudget() + 1u ) / 2u;
+  mPlatformAbstraction->SetTextureUploadBudget( halfTextureUploadBudget );
+  mTextureUploadBudget.SetBytesPerFrame( halfTextureUploadBudget );
 
   ResourcePolicy::DataRetention dataRetentionPolicy = ResourcePolicy::DALI_DISCARDS_ALL_DATA;
   if( configuration == Dali::Configuration::APPLICATION_DOES_NOT_HANDLE_CONTEXT_LOSS )
@@ -119,18 +130,14 @@ void Adaptor::Initialize( Dali::Configuration::ContextLoss configuration )
 
   mCallbackManager = CallbackManager::New();
 
+  TimerCoalescer::Get().SetSlack( mEnvironmentOptions->GetTimerSlack() );
+
   PositionSize size = mSurface->GetPositionSize();
 
   mGestureManager = new GestureManager(*this, Vector2(size.width, size.height), mCallbackManager, *mEnvironmentOptions);
 
-  if( mEnvironmentOptions->GetGlesCallTime() > 0 )
-  {
-    mGLES = new GlProxyImplementation( *mEnvironmentOptions );
-  }
-  else
-  {
-    mGLES = new GlImplementation();
-  }
+  // The proxy always records the calls of each frame for GlStatistics, and logs them when DALI_GLES_CALL_TIME is set
+  mGLES = new GlProxyImplementation( *mEnvironmentOptions );
 
   mEglFactory = new EglFactory();
 
@@ -561,6 +568,11 @@ TraceInterface& Adaptor::GetSystemTraceInterface()
   return mSystemTracer;
 }
 
+TextureUploadBudget& Adaptor::GetTextureUploadBudget()
+{
+  return mTextureUploadBudget;
+}
+
 PerformanceInterface* Adaptor::GetPerformanceInterface()
 {
   return mPerformanceInterface;
@@ -787,6 +799,7 @@ Adaptor::Adaptor(Any nativeWindow, Dali::Adaptor& adaptor, RenderSurface* surfac
   mTriggerEventFactory(),
   mObjectProfiler( NULL ),
   mSocketFactory(),
+  mTextureUploadBudget(),
   mEnvironmentOptionsOwned( environmentOptions ? false : true /* If not provided then we own the object */ )
 {
   DALI_ASSERT_ALWAYS( !IsAvailable() && "Cannot create more than one Adaptor per thread" );
@@ -381,6 +381,11 @@ public:  //AdaptorInternalServices
    */
   virtual TraceInterface& GetSystemTraceInterface();
 
+  /**
+   * @copydoc Dali::Internal::Adaptor::AdaptorInternalServices::GetTextureUploadBudget()
+   */
+  virtual TextureUploadBudget& GetTextureUploadBudget();
+
 public: // Stereoscopy
 
   /**
@@ -557,6 +562,7 @@ private: // Data
   TriggerEventFactory                   mTriggerEventFactory;         ///< Trigger event factory
   ObjectProfiler*                       mObjectProfiler;              ///< Tracks object lifetime for profiling
   SocketFactory                         mSocketFactory;               ///< Socket factory
+  TextureUploadBudget                   mTextureUploadBudget;         ///< Texture data uploaded per frame by the render thread
   const bool                            mEnvironmentOptionsOwned:1;   ///< Whether we own the EnvironmentOptions (and thus, need to delete it)
 public:
   inline static Adaptor& GetImplementation(Dali::Adaptor& adaptor) {return *adaptor.mImpl;}
@@ -24,6 +24,7 @@
 #include <dali/integration-api/debug.h>
 
 // INTERNAL INCLUDES
+#include <timer-coalescer.h>
 
 
 namespace Dali
@@ -74,6 +75,8 @@ Eina_Bool IdleCallback(void *data)
 {
   CallbackData *callbackData = static_cast< CallbackData * >( data );
 
+  TimerCoalescer::Get().RecordWakeup( static_cast< uint64_t >( ecore_loop_time_get() * 1000.0 ) );
+
   // remove callback data from the container
   CallbackBase::Execute( *callbackData->mRemoveFromContainerFunction, callbackData );
 
@@ -21,6 +21,9 @@
 // EXTERNAL INCLUDES
 #include <Ecore.h>
 
+// INTERNAL INCLUDES
+#include <timer-coalescer.h>
+
 namespace Dali
 {
 
@@ -33,13 +36,12 @@ namespace Adaptor
 // LOCAL STUFF
 namespace
 {
-Eina_Bool TimerSourceFunc (void *data)
+/**
+ * @return The time of the current main loop iteration in milliseconds
+ */
+uint64_t GetLoopTime()
 {
-  Timer* timer = static_cast<Timer*>(data);
-
-  bool keepRunning = timer->Tick();
-
-  return keepRunning ? EINA_TRUE : EINA_FALSE;
+  return static_cast< uint64_t >( ecore_loop_time_get() * 1000.0 );
 }
 } // unnamed namespace
 
@@ -48,14 +50,66 @@ Eina_Bool TimerSourceFunc (void *data)
  */
 struct Timer::Impl
 {
-  Impl( unsigned int milliSec )
-  : mId(NULL),
-    mInterval(milliSec)
+  Impl( Timer& timer, unsigned int milliSec )
+  : mTimer( timer ),
+    mId(NULL),
+    mInterval(milliSec),
+    mExpiryTime( 0u ),
+    mFireTime( 0u )
   {
   }
 
+  /**
+   * Adds the ecore timer to fire one interval from now, or a little later if it can share a wakeup with other timers.
+   */
+  void Add()
+  {
+    // Ecore counts the delay from now, not from the loop time, which is stale by however much of the loop
+    // iteration has already run; measure from now so that the timer fires exactly on its slot.
+    const double now = ecore_time_get();
+    mExpiryTime = static_cast< uint64_t >( now * 1000.0 ) + mInterval;
+    mFireTime = TimerCoalescer::Get().Coalesce( mExpiryTime, mInterval );
+
+    mId = ecore_timer_add( static_cast< double >( mFireTime ) / 1000.0 - now, (Ecore_Task_Cb)TimerSourceFunc, this );
+  }
+
+  static Eina_Bool TimerSourceFunc( void *data )
+  {
+    Impl* impl = static_cast<Impl*>(data);
+
+    const uint64_t loopTime = GetLoopTime();
+    TimerCoalescer::Get().RecordWakeup( loopTime );
+
+    // Keep the timer alive until it has been rescheduled
+    Dali::Timer handle( &impl->mTimer );
+    Ecore_Timer* const id = impl->mId;
+
+    bool keepRunning = impl->mTimer.Tick();
+
+    // Do not reschedule if the timer was restarted during the tick
+    if( keepRunning && ( impl->mId == id ) )
+    {
+      // Due one interval after it was last due, unless the main loop has fallen behind
+      impl->mExpiryTime += impl->mInterval;
+      if( impl->mExpiryTime <= loopTime )
+      {
+        impl->mExpiryTime = loopTime + impl->mInterval;
+      }
+      const uint64_t fireTime = TimerCoalescer::Get().Coalesce( impl->mExpiryTime, impl->mInterval );
+
+      // Ecore schedules the next tick this long after the time the current one was due
+      ecore_timer_interval_set( impl->mId, static_cast< double >( fireTime - impl->mFireTime ) / 1000.0 );
+      impl->mFireTime = fireTime;
+    }
+
+    return keepRunning ? EINA_TRUE : EINA_FALSE;
+  }
+
+  Timer& mTimer;
   Ecore_Timer * mId;
   unsigned int mInterval;
+  uint64_t mExpiryTime; ///< When the timer is next due, in milliseconds of main loop time
+  uint64_t mFireTime;   ///< When the timer will next fire, which may be later than it is due so that it shares a wakeup
 };
 
 TimerPtr Timer::New( unsigned int milliSec )
@@ -65,7 +119,7 @@ TimerPtr Timer::New( unsigned int milliSec )
 }
 
 Timer::Timer( unsigned int milliSec )
-: mImpl(new Impl(milliSec))
+: mImpl(new Impl(*this, milliSec))
 {
 }
 
@@ -83,7 +137,7 @@ void Timer::Start()
   {
     Stop();
   }
-  mImpl->mId = ecore_timer_add( (double)mImpl->mInterval/1000.0f, (Ecore_Task_Cb)TimerSourceFunc, this );
+  mImpl->Add();
 }
 
 void Timer::Stop()
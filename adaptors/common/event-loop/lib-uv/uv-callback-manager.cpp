@@ -23,6 +23,7 @@
 #include <dali/integration-api/debug.h>
 
 // INTERNAL INCLUDES
+#include <timer-coalescer.h>
 
 
 namespace Dali
@@ -108,6 +109,8 @@ void IdleCallback( uv_idle_t* handle )
 {
   CallbackData *callbackData = static_cast<CallbackData *>(handle->data);
 
+  TimerCoalescer::Get().RecordWakeup( uv_now( uv_default_loop() ) );
+
   // remove callback data from the container first in case our callback tries to modify the container
   CallbackBase::Execute( *callbackData->mRemoveFromContainerFunction, callbackData );
 
@@ -22,6 +22,9 @@
 // EXTERNAL INCLUDES
 #include <uv.h>
 
+// INTERNAL INCLUDES
+#include <timer-coalescer.h>
+
 namespace Dali
 {
 
@@ -33,16 +36,6 @@ namespace Adaptor
 
 namespace
 {
-void TimerSourceFunc (uv_timer_t* handle)
-{
-  Timer* timer = static_cast<Timer*>(handle->data);
-
-  bool keepRunning = timer->Tick();
-  if( !keepRunning )
-  {
-    timer->Stop();
-  }
-}
 void FreeHandleCallback(uv_handle_t* handle )
 {
   delete handle;
@@ -55,9 +48,12 @@ void FreeHandleCallback(uv_handle_t* handle )
  */
 struct Timer::Impl
 {
-  Impl( unsigned int milliSec )
-  : mTimerHandle( NULL ),
+  Impl( Timer& timer, unsigned int milliSec )
+  : mTimer( timer ),
+    mTimerHandle( NULL ),
     mInterval( milliSec ),
+    mExpiryTime( 0u ),
+    mFireTime( 0u ),
     mRunning( false )
   {
   }
@@ -76,7 +72,7 @@ struct Timer::Impl
     return mRunning;
   }
 
-  void Start( void* internalTimerPtr )
+  void Start()
   {
     Stop(); // make sure we stop first if its currently running
 
@@ -91,9 +87,15 @@ struct Timer::Impl
 
     mRunning = true;
 
-    mTimerHandle->data = internalTimerPtr;
+    mTimerHandle->data = this;
+
+    // Fire one interval from now, or a little later if it can share a wakeup with other timers
+    const uint64_t loopTime = uv_now( uv_default_loop() );
+    mExpiryTime = loopTime + mInterval;
+    mFireTime = TimerCoalescer::Get().Coalesce( mExpiryTime, mInterval );
 
-    uv_timer_start( mTimerHandle, TimerSourceFunc, mInterval, mInterval);
+    // Each tick is scheduled separately, so that it can be coalesced
+    uv_timer_start( mTimerHandle, TimerSourceFunc, mFireTime - loopTime, 0 );
   }
 
   void Stop()
@@ -106,8 +108,41 @@ struct Timer::Impl
     }
   }
 
+  static void TimerSourceFunc( uv_timer_t* handle )
+  {
+    Impl* impl = static_cast<Impl*>(handle->data);
+
+    const uint64_t loopTime = uv_now( uv_default_loop() );
+    TimerCoalescer::Get().RecordWakeup( loopTime );
+
+    // Keep the timer alive until it has been rescheduled
+    Dali::Timer timerHandle( &impl->mTimer );
+    const uint64_t fireTime = impl->mFireTime;
+
+    bool keepRunning = impl->mTimer.Tick();
+    if( !keepRunning )
+    {
+      impl->Stop();
+    }
+    else if( impl->mRunning && ( impl->mFireTime == fireTime ) ) // Do not reschedule if the timer was stopped or restarted during the tick
+    {
+      // Due one interval after it was last due, unless the main loop has fallen behind
+      impl->mExpiryTime += impl->mInterval;
+      if( impl->mExpiryTime <= loopTime )
+      {
+        impl->mExpiryTime = loopTime + impl->mInterval;
+      }
+      impl->mFireTime = TimerCoalescer::Get().Coalesce( impl->mExpiryTime, impl->mInterval );
+
+      uv_timer_start( handle, TimerSourceFunc, impl->mFireTime - loopTime, 0 );
+    }
+  }
+
+  Timer& mTimer;
   uv_timer_t* mTimerHandle;
   unsigned int mInterval;
+  uint64_t mExpiryTime; ///< When the timer is next due, in milliseconds of main loop time
+  uint64_t mFireTime;   ///< When the timer will next fire, which may be later than it is due so that it shares a wakeup
   bool      mRunning;
 };
 
@@ -119,7 +154,7 @@ TimerPtr Timer::New( unsigned int milliSec )
 }
 
 Timer::Timer( unsigned int milliSec )
-: mImpl(new Impl(milliSec))
+: mImpl(new Impl(*this, milliSec))
 {
 }
 
@@ -133,7 +168,7 @@ Timer::~Timer()
 
 void Timer::Start()
 {
-  mImpl->Start( this );
+  mImpl->Start();
 }
 
 void Timer::Stop()
@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include "gl-frame-recorder.h"
+
+// EXTERNAL INCLUDES
+#include <dali/integration-api/gl-defines.h>
+
+namespace Dali
+{
+namespace Internal
+{
+namespace Adaptor
+{
+
+namespace
+{
+/**
+ * @return The number of components in a pixel format
+ */
+unsigned int GetComponentCount( GLenum format )
+{
+  switch( format )
+  {
+    case GL_ALPHA:
+    case GL_LUMINANCE:
+    {
+      return 1u;
+    }
+    case GL_LUMINANCE_ALPHA:
+    {
+      return 2u;
+    }
+    case GL_RGB:
+    {
+      return 3u;
+    }
+    default:
+    {
+      // RGBA and the BGRA extensions
+      return 4u;
+    }
+  }
+}
+
+} // unnamed namespace
+
+GlFrameRecorder::GlFrameRecorder()
+: mCurrentFrame(),
+  mLastFrame(),
+  mLastFrameMutex()
+{
+}
+
+void GlFrameRecorder::DrawCall()
+{
+  ++mCurrentFrame.drawCalls;
+}
+
+void GlFrameRecorder::StateChange()
+{
+  ++mCurrentFrame.stateChanges;
+}
+
+void GlFrameRecorder::UniformCall()
+{
+  ++mCurrentFrame.uniformCalls;
+}
+
+void GlFrameRecorder::TextureUpload( GLsizei width, GLsizei height, GLenum format, GLenum type )
+{
+  ++mCurrentFrame.textureUploads;
+  mCurrentFrame.textureUploadBytes += GetPixelDataSize( width, height, format, type );
+}
+
+void GlFrameRecorder::CompressedTextureUpload( GLsizei imageSize )
+{
+  ++mCurrentFrame.textureUploads;
+  mCurrentFrame.textureUploadBytes += imageSize > 0 ? imageSize : 0;
+}
+
+void GlFrameRecorder::BufferUpload( GLsizeiptr size )
+{
+  ++mCurrentFrame.bufferUploads;
+  mCurrentFrame.bufferUploadBytes += size > 0 ? size : 0;
+}
+
+void GlFrameRecorder::EndFrame( unsigned int bufferCount, unsigned int textureCount, unsigned int programCount )
+{
+  mCurrentFrame.bufferCount = bufferCount;
+  mCurrentFrame.textureCount = textureCount;
+  mCurrentFrame.programCount = programCount;
+
+  {
+    Mutex::ScopedLock lock( mLastFrameMutex );
+    mLastFrame = mCurrentFrame;
+  }
+
+  const unsigned int frameNumber = mCurrentFrame.frameNumber + 1u;
+  mCurrentFrame = GlStatistics::Frame();
+  mCurrentFrame.frameNumber = frameNumber;
+}
+
+void GlFrameRecorder::GetLastFrame( GlStatistics::Frame& frame ) const
+{
+  Mutex::ScopedLock lock( mLastFrameMutex );
+  frame = mLastFrame;
+}
+
+uint64_t GlFrameRecorder::GetPixelDataSize( GLsizei width, GLsizei height, GLenum format, GLenum type )
+{
+  if( width <= 0 || height <= 0 )
+  {
+    return 0u;
+  }
+
+  unsigned int bytesPerPixel = 0u;
+  switch( type )
+  {
+    case GL_UNSIGNED_SHORT_5_6_5:
+    case GL_UNSIGNED_SHORT_4_4_4_4:
+    case GL_UNSIGNED_SHORT_5_5_5_1:
+    {
+      // Packed, whatever the format
+      bytesPerPixel = 2u;
+      break;
+    }
+    case GL_FLOAT:
+    {
+      bytesPerPixel = 4u * GetComponentCount( format );
+      break;
+    }
+    default:
+    {
+      // GL_UNSIGNED_BYTE
+      bytesPerPixel = GetComponentCount( format );
+      break;
+    }
+  }
+
+  return static_cast< uint64_t >( width ) * static_cast< uint64_t >( height ) * bytesPerPixel;
+}
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
@@ -0,0 +1,132 @@
+#ifndef __DALI_INTERNAL_GL_FRAME_RECORDER_H__
+#define __DALI_INTERNAL_GL_FRAME_RECORDER_H__
+
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <stdint.h>
+#include <dali/integration-api/gl-abstraction.h>
+#include <dali/devel-api/threading/mutex.h>
+
+// INTERNAL INCLUDES
+#include <gl-statistics.h>
+
+namespace Dali
+{
+namespace Internal
+{
+namespace Adaptor
+{
+
+/**
+ * Counts the OpenGL ES calls made to render each frame, and keeps the counts of the most recent frame
+ * so that they can be read programmatically.
+ *
+ * The calls are counted on the render thread; the most recent frame can be read from any thread.
+ * Nothing here makes a GL call, so the counts can be checked without a GPU.
+ */
+class GlFrameRecorder
+{
+public:
+
+  /**
+   * Constructor
+   */
+  GlFrameRecorder();
+
+  /**
+   * Count a draw call
+   */
+  void DrawCall();
+
+  /**
+   * Count a call which changes the GL state
+   */
+  void StateChange();
+
+  /**
+   * Count a uniform call
+   */
+  void UniformCall();
+
+  /**
+   * Count an upload of uncompressed pixel data
+   * @param[in] width The width of the uploaded area
+   * @param[in] height The height of the uploaded area
+   * @param[in] format The pixel format, e.g. GL_RGBA
+   * @param[in] type The pixel type, e.g. GL_UNSIGNED_BYTE
+   */
+  void TextureUpload( GLsizei width, GLsizei height, GLenum format, GLenum type );
+
+  /**
+   * Count an upload of compressed pixel data
+   * @param[in] imageSize The size of the compressed data in bytes
+   */
+  void CompressedTextureUpload( GLsizei imageSize );
+
+  /**
+   * Count an upload of buffer data
+   * @param[in] size The size of the data in bytes
+   */
+  void BufferUpload( GLsizeiptr size );
+
+  /**
+   * Called after each frame is rendered, to make its counts the most recent frame and start counting the next
+   * @param[in] bufferCount The number of buffer objects
+   * @param[in] textureCount The number of texture objects
+   * @param[in] programCount The number of programs
+   */
+  void EndFrame( unsigned int bufferCount, unsigned int textureCount, unsigned int programCount );
+
+  /**
+   * Retrieves the counts of the most recent frame. Can be called from any thread while frames are rendered.
+   * @param[out] frame The counts
+   */
+  void GetLastFrame( GlStatistics::Frame& frame ) const;
+
+  /**
+   * @param[in] width The width of an area of pixels
+   * @param[in] height The height of an area of pixels
+   * @param[in] format The pixel format
+   * @param[in] type The pixel type
+   * @return The size of the pixel data in bytes, without any row padding
+   */
+  static uint64_t GetPixelDataSize( GLsizei width, GLsizei height, GLenum format, GLenum type );
+
+private:
+
+  // Undefined copy constructor.
+  GlFrameRecorder( const GlFrameRecorder& );
+
+  // Undefined assignment operator.
+  GlFrameRecorder& operator=( const GlFrameRecorder& );
+
+private:
+
+  GlStatistics::Frame mCurrentFrame;      ///< counts of the frame being rendered, only used by the render thread
+  GlStatistics::Frame mLastFrame;         ///< counts of the most recently rendered frame
+  mutable Dali::Mutex mLastFrameMutex;    ///< protects mLastFrame
+};
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // __DALI_INTERNAL_GL_FRAME_RECORDER_H__
@@ -173,9 +173,13 @@ GlProxyImplementation::GlProxyImplementation( EnvironmentOptions& environmentOpt
   mDrawSampler( "Draw calls" ),
   mUniformSampler( "Uniform sets" ),
   mUseProgramSampler( "Used programs" ),
+  mStateChangeSampler( "Other state changes" ),
+  mTextureUploadSampler( "Texture uploads" ),
+  mBufferUploadSampler( "Buffer uploads" ),
   mBufferCount( "Buffer Count" ),
   mTextureCount( "Texture Count" ),
   mProgramCount( "Program Count" ),
+  mFrameRecorder(),
   mCurrentFrameCount( 0 ),
   mTotalFrameCount( 0 )
 {
@@ -191,6 +195,15 @@ void GlProxyImplementation::PreRender()
 
 void GlProxyImplementation::PostRender()
 {
+  // Make the calls of this frame available as the most recent frame
+  mFrameRecorder.EndFrame( mBufferCount.GetCount(), mTextureCount.GetCount(), mProgramCount.GetCount() );
+
+  // The samplers are only logged when DALI_GLES_CALL_TIME is set
+  if( mEnvironmentOptions.GetGlesCallTime() <= 0 )
+  {
+    return;
+  }
+
   // Accumulate counts in each sampler
   AccumulateSamples();
 
@@ -216,6 +229,78 @@ void GlProxyImplementation::Clear( GLbitfield mask )
   GlImplementation::Clear(mask);
 }
 
+void GlProxyImplementation::BindFramebuffer( GLenum target, GLuint framebuffer )
+{
+  CountStateChange();
+  GlImplementation::BindFramebuffer( target, framebuffer );
+}
+
+void GlProxyImplementation::BlendEquation( GLenum mode )
+{
+  CountStateChange();
+  GlImplementation::BlendEquation( mode );
+}
+
+void GlProxyImplementation::BlendEquationSeparate( GLenum modeRGB, GLenum modeAlpha )
+{
+  CountStateChange();
+  GlImplementation::BlendEquationSeparate( modeRGB, modeAlpha );
+}
+
+void GlProxyImplementation::BlendFunc( GLenum sfactor, GLenum dfactor )
+{
+  CountStateChange();
+  GlImplementation::BlendFunc( sfactor, dfactor );
+}
+
+void GlProxyImplementation::BlendFuncSeparate( GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha )
+{
+  CountStateChange();
+  GlImplementation::BlendFuncSeparate( srcRGB, dstRGB, srcAlpha, dstAlpha );
+}
+
+void GlProxyImplementation::CullFace( GLenum mode )
+{
+  CountStateChange();
+  GlImplementation::CullFace( mode );
+}
+
+void GlProxyImplementation::DepthFunc( GLenum func )
+{
+  CountStateChange();
+  GlImplementation::DepthFunc( func );
+}
+
+void GlProxyImplementation::DepthMask( GLboolean flag )
+{
+  CountStateChange();
+  GlImplementation::DepthMask( flag );
+}
+
+void GlProxyImplementation::Disable( GLenum cap )
+{
+  CountStateChange();
+  GlImplementation::Disable( cap );
+}
+
+void GlProxyImplementation::Enable( GLenum cap )
+{
+  CountStateChange();
+  GlImplementation::Enable( cap );
+}
+
+void GlProxyImplementation::Scissor( GLint x, GLint y, GLsizei width, GLsizei height )
+{
+  CountStateChange();
+  GlImplementation::Scissor( x, y, width, height );
+}
+
+void GlProxyImplementation::Viewport( GLint x, GLint y, GLsizei width, GLsizei height )
+{
+  CountStateChange();
+  GlImplementation::Viewport( x, y, width, height );
+}
+
 void GlProxyImplementation::GenBuffers(GLsizei n, GLuint* buffers)
 {
   mBufferCount.Increment();
@@ -231,9 +316,27 @@ void GlProxyImplementation::DeleteBuffers( GLsizei n, const GLuint* buffers )
 void GlProxyImplementation::BindBuffer( GLenum target, GLuint buffer )
 {
   mBindBufferSampler.Increment();
+  mFrameRecorder.StateChange();
   GlImplementation::BindBuffer( target, buffer );
 }
 
+void GlProxyImplementation::BufferData( GLenum target, GLsizeiptr size, const void* data, GLenum usage )
+{
+  if( data )
+  {
+    mBufferUploadSampler.Increment();
+    mFrameRecorder.BufferUpload( size );
+  }
+  GlImplementation::BufferData( target, size, data, usage );
+}
+
+void GlProxyImplementation::BufferSubData( GLenum target, GLintptr offset, GLsizeiptr size, const void* data )
+{
+  mBufferUploadSampler.Increment();
+  mFrameRecorder.BufferUpload( size );
+  GlImplementation::BufferSubData( target, offset, size, data );
+}
+
 void GlProxyImplementation::GenTextures( GLsizei n, GLuint* textures )
 {
   mTextureCount.Increment();
@@ -249,138 +352,196 @@ void GlProxyImplementation::DeleteTextures( GLsizei n, const GLuint* textures )
 void GlProxyImplementation::ActiveTexture( GLenum texture )
 {
   mActiveTextureSampler.Increment();
+  mFrameRecorder.StateChange();
   GlImplementation::ActiveTexture( texture );
 }
 
 void GlProxyImplementation::BindTexture( GLenum target, GLuint texture )
 {
   mBindTextureSampler.Increment();
+  mFrameRecorder.StateChange();
   GlImplementation::BindTexture(target,texture);
 }
 
+void GlProxyImplementation::TexImage2D( GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void* pixels )
+{
+  // Without pixels, the texture is only allocated
+  if( pixels )
+  {
+    mTextureUploadSampler.Increment();
+    mFrameRecorder.TextureUpload( width, height, format, type );
+  }
+  GlImplementation::TexImage2D( target, level, internalformat, width, height, border, format, type, pixels );
+}
+
+void GlProxyImplementation::TexSubImage2D( GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void* pixels )
+{
+  mTextureUploadSampler.Increment();
+  mFrameRecorder.TextureUpload( width, height, format, type );
+  GlImplementation::TexSubImage2D( target, level, xoffset, yoffset, width, height, format, type, pixels );
+}
+
+void GlProxyImplementation::CompressedTexImage2D( GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void* data )
+{
+  if( data )
+  {
+    mTextureUploadSampler.Increment();
+    mFrameRecorder.CompressedTextureUpload( imageSize );
+  }
+  GlImplementation::CompressedTexImage2D( target, level, internalformat, width, height, border, imageSize, data );
+}
+
+void GlProxyImplementation::CompressedTexSubImage2D( GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void* data )
+{
+  mTextureUploadSampler.Increment();
+  mFrameRecorder.CompressedTextureUpload( imageSize );
+  GlImplementation::CompressedTexSubImage2D( target, level, xoffset, yoffset, width, height, format, imageSize, data );
+}
+
 void GlProxyImplementation::DrawArrays( GLenum mode, GLint first, GLsizei count )
 {
   mDrawSampler.Increment();
+  mFrameRecorder.DrawCall();
   GlImplementation::DrawArrays( mode, first, count );
 }
 
 void GlProxyImplementation::DrawElements( GLenum mode, GLsizei count, GLenum type, const void* indices )
 {
   mDrawSampler.Increment();
+  mFrameRecorder.DrawCall();
   GlImplementation::DrawElements( mode, count, type, indices );
 }
 
 void GlProxyImplementation::Uniform1f( GLint location, GLfloat x )
 {
   mUniformSampler.Increment();
+  mFrameRecorder.UniformCall();
   GlImplementation::Uniform1f( location, x );
 }
 
 void GlProxyImplementation::Uniform1fv( GLint location, GLsizei count, const GLfloat* v )
 {
   mUniformSampler.Increment();
+  mFrameRecorder.UniformCall();
   GlImplementation::Uniform1fv( location, count, v );
 }
 
 void GlProxyImplementation::Uniform1i( GLint location, GLint x )
 {
   mUniformSampler.Increment();
+  mFrameRecorder.UniformCall();
   GlImplementation::Uniform1i( location, x );
 }
 
 void GlProxyImplementation::Uniform1iv( GLint location, GLsizei count, const GLint* v )
 {
   mUniformSampler.Increment();
+  mFrameRecorder.UniformCall();
   GlImplementation::Uniform1iv( location, count, v );
 }
 
 void GlProxyImplementation::Uniform2f( GLint location, GLfloat x, GLfloat y)
 {
   mUniformSampler.Increment();
+  mFrameRecorder.UniformCall();
   GlImplementation::Uniform2f( location, x, y );
 }
 
 void GlProxyImplementation::Uniform2fv( GLint location, GLsizei count, const GLfloat* v )
 {
   mUniformSampler.Increment();
+  mFrameRecorder.UniformCall();
   GlImplementation::Uniform2fv( location, count, v );
 }
 
 void GlProxyImplementation::Uniform2i( GLint location, GLint x, GLint y )
 {
   mUniformSampler.Increment();
+  mFrameRecorder.UniformCall();
   GlImplementation::Uniform2i( location, x, y );
 }
 
 void GlProxyImplementation::Uniform2iv( GLint location, GLsizei count, const GLint* v )
 {
   mUniformSampler.Increment();
+  mFrameRecorder.UniformCall();
   GlImplementation::Uniform2iv( location, count, v );
 }
 
 void GlProxyImplementation::Uniform3f( GLint location, GLfloat x, GLfloat y, GLfloat z )
 {
   mUniformSampler.Increment();
+  mFrameRecorder.UniformCall();
   GlImplementation::Uniform3f( location, x, y, z );
 }
 
 void GlProxyImplementation::Uniform3fv( GLint location, GLsizei count, const GLfloat* v )
 {
   mUniformSampler.Increment();
+  mFrameRecorder.UniformCall();
   GlImplementation::Uniform3fv( location, count, v );
 }
 
 void GlProxyImplementation::Uniform3i( GLint location, GLint x, GLint y, GLint z )
 {
   mUniformSampler.Increment();
+  mFrameRecorder.UniformCall();
   GlImplementation::Uniform3i( location, x, y, z );
 }
 
 void GlProxyImplementation::Uniform3iv( GLint location, GLsizei count, const GLint* v )
 {
   mUniformSampler.Increment();
+  mFrameRecorder.UniformCall();
   GlImplementation::Uniform3iv( location, count, v );
 }
 
 void GlProxyImplementation::Uniform4f( GLint location, GLfloat x, GLfloat y, GLfloat z, GLfloat w )
 {
   mUniformSampler.Increment();
+  mFrameRecorder.UniformCall();
   GlImplementation::Uniform4f( location, x, y, z, w );
 }
 
 void GlProxyImplementation::Uniform4fv( GLint location, GLsizei count, const GLfloat* v )
 {
   mUniformSampler.Increment();
+  mFrameRecorder.UniformCall();
   GlImplementation::Uniform4fv( location, count, v );
 }
 
 void GlProxyImplementation::Uniform4i( GLint location, GLint x, GLint y, GLint z, GLint w )
 {
   mUniformSampler.Increment();
+  mFrameRecorder.UniformCall();
   GlImplementation::Uniform4i( location, x, y, z, w );
 }
 
 void GlProxyImplementation::Uniform4iv( GLint location, GLsizei count, const GLint* v )
 {
   mUniformSampler.Increment();
+  mFrameRecorder.UniformCall();
   GlImplementation::Uniform4iv( location, count, v );
 }
 
 void GlProxyImplementation::UniformMatrix2fv( GLint location, GLsizei count, GLboolean transpose, const GLfloat* value )
 {
   mUniformSampler.Increment();
+  mFrameRecorder.UniformCall();
   GlImplementation::UniformMatrix2fv( location, count, transpose, value );
 }
 
 void GlProxyImplementation::UniformMatrix3fv( GLint location, GLsizei count, GLboolean transpose, const GLfloat* value )
 {
   mUniformSampler.Increment();
+  mFrameRecorder.UniformCall();
   GlImplementation::UniformMatrix3fv( location, count, transpose, value );
 }
 
 void GlProxyImplementation::UniformMatrix4fv( GLint location, GLsizei count, GLboolean transpose, const GLfloat* value )
 {
   mUniformSampler.Increment();
+  mFrameRecorder.UniformCall();
   GlImplementation::UniformMatrix4fv( location, count, transpose, value);
 }
 
@@ -399,9 +560,21 @@ void GlProxyImplementation::DeleteProgram( GLuint program )
 void GlProxyImplementation::UseProgram( GLuint program )
 {
   mUseProgramSampler.Increment();
+  mFrameRecorder.StateChange();
   GlImplementation::UseProgram( program );
 }
 
+const GlFrameRecorder& GlProxyImplementation::GetFrameRecorder() const
+{
+  return mFrameRecorder;
+}
+
+void GlProxyImplementation::CountStateChange()
+{
+  mStateChangeSampler.Increment();
+  mFrameRecorder.StateChange();
+}
+
 void GlProxyImplementation::AccumulateSamples()
 {
   // Accumulate counts in each sampler
@@ -412,6 +585,9 @@ void GlProxyImplementation::AccumulateSamples()
   mDrawSampler.Accumulate();
   mUniformSampler.Accumulate();
   mUseProgramSampler.Accumulate();
+  mStateChangeSampler.Accumulate();
+  mTextureUploadSampler.Accumulate();
+  mBufferUploadSampler.Accumulate();
 }
 
 void GlProxyImplementation::LogResults()
@@ -424,6 +600,9 @@ void GlProxyImplementation::LogResults()
   LogCalls( mDrawSampler );
   LogCalls( mUniformSampler );
   LogCalls( mUseProgramSampler );
+  LogCalls( mStateChangeSampler );
+  LogCalls( mTextureUploadSampler );
+  LogCalls( mBufferUploadSampler );
   Debug::LogMessage( Debug::DebugInfo, "OpenGL ES Object Count:\n" );
   LogObjectCounter( mBufferCount );
   LogObjectCounter( mTextureCount );
@@ -456,6 +635,9 @@ void GlProxyImplementation::ResetSamplers()
   mDrawSampler.Reset();
   mUniformSampler.Reset();
   mUseProgramSampler.Reset();
+  mStateChangeSampler.Reset();
+  mTextureUploadSampler.Reset();
+  mBufferUploadSampler.Reset();
   mTotalFrameCount = 0;
 }
 
@@ -20,6 +20,7 @@
 
 // INTERNAL INCLUDES
 #include <gl/gl-implementation.h>
+#include <gl/gl-frame-recorder.h>
 
 namespace Dali
 {
@@ -141,6 +142,9 @@ private:
 /**
  * GlProxyImplementation is a wrapper for the concrete implementation
  * of GlAbstraction that also gathers statistical information.
+ *
+ * The calls of the most recent frame are always recorded, for GlStatistics.
+ * The running averages are only logged when DALI_GLES_CALL_TIME is set.
  */
 class GlProxyImplementation : public GlImplementation
 {
@@ -167,17 +171,41 @@ public:
    */
   virtual void PostRender();
 
+  /**
+   * @return The counts of the calls made to render the most recent frame
+   */
+  const GlFrameRecorder& GetFrameRecorder() const;
+
   /* OpenGL ES 2.0 API */
   virtual void Clear( GLbitfield mask );
 
+  virtual void BindFramebuffer( GLenum target, GLuint framebuffer );
+  virtual void BlendEquation( GLenum mode );
+  virtual void BlendEquationSeparate( GLenum modeRGB, GLenum modeAlpha );
+  virtual void BlendFunc( GLenum sfactor, GLenum dfactor );
+  virtual void BlendFuncSeparate( GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha );
+  virtual void CullFace( GLenum mode );
+  virtual void DepthFunc( GLenum func );
+  virtual void DepthMask( GLboolean flag );
+  virtual void Disable( GLenum cap );
+  virtual void Enable( GLenum cap );
+  virtual void Scissor( GLint x, GLint y, GLsizei width, GLsizei height );
+  virtual void Viewport( GLint x, GLint y, GLsizei width, GLsizei height );
+
   virtual void GenBuffers( GLsizei n, GLuint* buffers );
   virtual void DeleteBuffers( GLsizei n, const GLuint* buffers );
   virtual void BindBuffer( GLenum target, GLuint buffer );
+  virtual void BufferData( GLenum target, GLsizeiptr size, const void* data, GLenum usage );
+  virtual void BufferSubData( GLenum target, GLintptr offset, GLsizeiptr size, const void* data );
 
   virtual void GenTextures( GLsizei n, GLuint* textures );
   virtual void DeleteTextures( GLsizei n, const GLuint* textures );
   virtual void ActiveTexture( GLenum texture );
   virtual void BindTexture( GLenum target, GLuint texture );
+  virtual void TexImage2D( GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void* pixels );
+  virtual void TexSubImage2D( GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void* pixels );
+  virtual void CompressedTexImage2D( GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void* data );
+  virtual void CompressedTexSubImage2D( GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void* data );
 
   virtual void DrawArrays( GLenum mode, GLint first, GLsizei count );
   virtual void DrawElements( GLenum mode, GLsizei count, GLenum type, const void* indices );
@@ -208,6 +236,7 @@ public:
 
 private: // Helpers
 
+  void CountStateChange();
   void AccumulateSamples();
   void LogResults();
   void LogCalls( const Sampler& sampler );
@@ -224,9 +253,13 @@ private: // Data
   Sampler mDrawSampler;
   Sampler mUniformSampler;
   Sampler mUseProgramSampler;
+  Sampler mStateChangeSampler;
+  Sampler mTextureUploadSampler;
+  Sampler mBufferUploadSampler;
   ObjectCounter mBufferCount;
   ObjectCounter mTextureCount;
   ObjectCounter mProgramCount;
+  GlFrameRecorder mFrameRecorder;
 
   int mCurrentFrameCount;
   int mTotalFrameCount;
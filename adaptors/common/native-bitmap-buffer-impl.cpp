@@ -38,11 +38,25 @@ NativeBitmapBuffer::NativeBitmapBuffer( Adaptor* adaptor, unsigned int width, un
 : mWidth(width),
   mHeight(height),
   mPixelFormat(pFormat),
-  mLastReadBuffer(NULL)
+  mPendingArea(),
+  mTextureAllocated(false)
 {
   DALI_ASSERT_ALWAYS( adaptor );
-  mBuffer = new Integration::LocklessBuffer( width * height * Pixel::GetBytesPerPixel(pFormat) );
+  mBuffer = new PartialUpdateBuffer( width, height, Pixel::GetBytesPerPixel(pFormat) );
   mGlAbstraction = &(adaptor->GetGlAbstraction());
+  mUploadBudget = &(adaptor->GetTextureUploadBudget());
+}
+
+NativeBitmapBuffer::NativeBitmapBuffer( Integration::GlAbstraction& glAbstraction, TextureUploadBudget& uploadBudget, unsigned int width, unsigned int height, Pixel::Format pFormat )
+: mGlAbstraction(&glAbstraction),
+  mUploadBudget(&uploadBudget),
+  mWidth(width),
+  mHeight(height),
+  mPixelFormat(pFormat),
+  mPendingArea(),
+  mTextureAllocated(false)
+{
+  mBuffer = new PartialUpdateBuffer( width, height, Pixel::GetBytesPerPixel(pFormat) );
 }
 
 NativeBitmapBuffer::~NativeBitmapBuffer()
@@ -58,24 +72,57 @@ void NativeBitmapBuffer::PrepareTexture()
 
   Integration::ConvertToGlFormat( mPixelFormat, pixelDataType, pixelFormat );
 
-  const unsigned char* buf = mBuffer->Read();
+  Rect< int > updatedArea;
+  const unsigned char* buf = mBuffer->Read( updatedArea );
+
+  // Areas not uploaded yet because of the budget are still out of date in the texture
+  mPendingArea = PartialUpdateBuffer::Merge( mPendingArea, updatedArea );
+  if( mTextureAllocated && ( mPendingArea.width <= 0 || mPendingArea.height <= 0 ) )
+  {
+    // Prevent same buffer being uploaded multiple times
+    return;
+  }
+
+  // GLES 2 cannot upload part of a row from a larger image, so the rows of the pending area are uploaded in full
+  const unsigned int stride = mBuffer->GetStride();
+  const unsigned int uploadSize = mTextureAllocated ? mPendingArea.height * stride : mHeight * stride;
 
-  if( buf && buf != mLastReadBuffer ) // Prevent same buffer being uploaded multiple times
+  // If the frame's budget has been used, keep the previous contents and try again next frame
+  if( ! mUploadBudget->Upload( uploadSize ) )
   {
-    mLastReadBuffer = buf;
+    return;
+  }
 
-    // The active texture has already been set to a sampler and bound.
+  // The active texture has already been set to a sampler and bound.
+  if( mTextureAllocated )
+  {
+    // Replace the changed rows without reallocating the texture storage
+    mGlAbstraction->TexSubImage2D( GL_TEXTURE_2D, 0, 0, mPendingArea.y, mWidth, mPendingArea.height, pixelFormat, pixelDataType, buf + mPendingArea.y * stride );
+  }
+  else
+  {
     mGlAbstraction->TexImage2D( GL_TEXTURE_2D, 0, pixelFormat, mWidth, mHeight, 0, pixelFormat, pixelDataType, buf );
+    mTextureAllocated = true;
   }
+  mPendingArea = Rect< int >();
 }
 
 void NativeBitmapBuffer::Write( const unsigned char *src, size_t size )
 {
-  mBuffer->Write( src, size ); // Write will cause LocklessBuffer to switch to the other buffer
+  DALI_ASSERT_DEBUG( size == mBuffer->GetStride() * mHeight && "Size does not match the image" );
+  Write( src, Rect< int >( 0, 0, mWidth, mHeight ) );
+}
+
+void NativeBitmapBuffer::Write( const unsigned char *src, const Rect< int >& area )
+{
+  mBuffer->Write( src, area ); // Write will cause the buffer to switch to the other buffer
 }
 
 bool NativeBitmapBuffer::GlExtensionCreate()
 {
+  // A new texture has no storage, so the next upload must be complete
+  mTextureAllocated = false;
+  mPendingArea = Rect< int >();
   return true;
 }
 
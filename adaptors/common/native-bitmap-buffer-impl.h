@@ -22,11 +22,11 @@
 #include <dali/public-api/images/native-image-interface.h>
 #include <dali/public-api/images/pixel.h>
 #include <dali/integration-api/gl-abstraction.h>
-#include <dali/integration-api/lockless-buffer.h>
 #include <dali/public-api/common/dali-vector.h>
 
 // INTERNAL HEADERS
 #include <adaptor-impl.h>
+#include <partial-update-buffer.h>
 
 namespace Dali
 {
@@ -56,6 +56,16 @@ public:
    */
   NativeBitmapBuffer( Adaptor* adaptor, unsigned int width, unsigned int height, Pixel::Format pixelFormat );
 
+  /**
+   * Constructor, uploading through the given GL abstraction and budget rather than the adaptor's.
+   * @param glAbstraction GlAbstraction used to upload the texture
+   * @param uploadBudget budget of the texture data uploaded per frame
+   * @param width width of image
+   * @param height height of image
+   * @param pixelFormat pixel format for image
+   */
+  NativeBitmapBuffer( Integration::GlAbstraction& glAbstraction, TextureUploadBudget& uploadBudget, unsigned int width, unsigned int height, Pixel::Format pixelFormat );
+
   /**
    * virtual destructor
    */
@@ -69,6 +79,14 @@ public:
    */
   void Write( const unsigned char* src, size_t size );
 
+  /**
+   * Write an area of the image to the buffer, copying only the rows of that area. Does not block.
+   * Only the rows of the areas written since the texture was last updated are uploaded.
+   * @param[in] src  the whole image, of the same size and format as the buffer
+   * @param[in] area the area of the image which has changed
+   */
+  void Write( const unsigned char* src, const Rect< int >& area );
+
 public:
   /**
    * @copydoc Dali::NativeImageInterface::GlExtensionCreate()
@@ -112,12 +130,14 @@ private:
 
 private:
   Integration::GlAbstraction*  mGlAbstraction; ///< GlAbstraction used
+  TextureUploadBudget*         mUploadBudget;  ///< Texture data uploaded per frame by the render thread
 
-  Integration::LocklessBuffer* mBuffer;        ///< bitmap data double buffered
+  PartialUpdateBuffer*         mBuffer;        ///< bitmap data double buffered
   unsigned int                 mWidth;         ///< Image width
   unsigned int                 mHeight;        ///< Image height
   Pixel::Format                mPixelFormat;   ///< Image pixelformat
-  const unsigned char*         mLastReadBuffer; ///< last buffer that was read
+  Rect< int >                  mPendingArea;   ///< area changed since the texture was last updated
+  bool                         mTextureAllocated; ///< whether the texture storage has been created by a full upload
 };
 
 } // namespace Adaptor
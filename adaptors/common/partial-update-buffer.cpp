@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include "partial-update-buffer.h"
+
+// EXTERNAL INCLUDES
+#include <cstring>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace Adaptor
+{
+
+namespace
+{
+const unsigned int WRITE_BUFFER_INDEX = 1u << 0; ///< The buffer being written, the other one is being read
+const unsigned int WRITING = 1u << 1;            ///< Set while the writer is copying, so the reader does not swap
+const unsigned int UPDATED = 1u << 2;            ///< Set when the write buffer holds a newer image than the read buffer
+
+/**
+ * @return Whether an area has no pixels
+ */
+bool IsEmpty( const Rect< int >& area )
+{
+  return area.width <= 0 || area.height <= 0;
+}
+
+} // unnamed namespace
+
+PartialUpdateBuffer::PartialUpdateBuffer( unsigned int width, unsigned int height, unsigned int bytesPerPixel )
+: mWidth( width ),
+  mHeight( height ),
+  mBytesPerPixel( bytesPerPixel ),
+  mStride( width * bytesPerPixel ),
+  mState( 0u )
+{
+  for( unsigned int i = 0; i < 2u; ++i )
+  {
+    mBuffers[i] = new unsigned char[ mStride * height ];
+    memset( mBuffers[i], 0, mStride * height );
+  }
+}
+
+PartialUpdateBuffer::~PartialUpdateBuffer()
+{
+  delete [] mBuffers[0];
+  delete [] mBuffers[1];
+}
+
+void PartialUpdateBuffer::Write( const unsigned char* src, const Rect< int >& area )
+{
+  Rect< int > clipped( area );
+  if( clipped.x < 0 )
+  {
+    clipped.width += clipped.x;
+    clipped.x = 0;
+  }
+  if( clipped.y < 0 )
+  {
+    clipped.height += clipped.y;
+    clipped.y = 0;
+  }
+  clipped.width = clipped.x + clipped.width > mWidth ? mWidth - clipped.x : clipped.width;
+  clipped.height = clipped.y + clipped.height > mHeight ? mHeight - clipped.y : clipped.height;
+  if( IsEmpty( clipped ) )
+  {
+    return;
+  }
+
+  // Stop the reader swapping to the write buffer while it is written
+  const unsigned int state = __sync_fetch_and_or( &mState, WRITING );
+  const unsigned int writeIndex = state & WRITE_BUFFER_INDEX;
+  const unsigned int otherIndex = writeIndex ^ WRITE_BUFFER_INDEX;
+
+  // Catch up with the areas written to the other buffer since this one was last written. The other buffer
+  // only changes when the writer writes it, so it can be copied from while the reader reads it.
+  CopyArea( mBuffers[ otherIndex ], mBuffers[ writeIndex ], mStaleAreas[ writeIndex ] );
+  mStaleAreas[ writeIndex ] = Rect< int >();
+
+  CopyArea( src, mBuffers[ writeIndex ], clipped );
+  mStaleAreas[ otherIndex ] = Merge( mStaleAreas[ otherIndex ], clipped );
+  mUpdatedAreas[ writeIndex ] = Merge( mUpdatedAreas[ writeIndex ], clipped );
+
+  // Nothing else changes the state while WRITING is set, so this publishes the copy and lets the reader swap
+  __atomic_store_n( &mState, writeIndex | UPDATED, __ATOMIC_RELEASE );
+}
+
+const unsigned char* PartialUpdateBuffer::Read( Rect< int >& updatedArea )
+{
+  const unsigned int state = __atomic_load_n( &mState, __ATOMIC_ACQUIRE );
+  const unsigned int writeIndex = state & WRITE_BUFFER_INDEX;
+
+  // Swap, unless the writer has started writing since the state was read
+  if( ( state & UPDATED ) && !( state & WRITING ) &&
+      __sync_bool_compare_and_swap( &mState, state, writeIndex ^ WRITE_BUFFER_INDEX ) )
+  {
+    // The writer now writes the other buffer, so this one's updated area belongs to the reader until the next swap
+    updatedArea = mUpdatedAreas[ writeIndex ];
+    mUpdatedAreas[ writeIndex ] = Rect< int >();
+    return mBuffers[ writeIndex ];
+  }
+
+  updatedArea = Rect< int >();
+  return mBuffers[ writeIndex ^ WRITE_BUFFER_INDEX ];
+}
+
+unsigned int PartialUpdateBuffer::GetStride() const
+{
+  return mStride;
+}
+
+Rect< int > PartialUpdateBuffer::Merge( const Rect< int >& first, const Rect< int >& second )
+{
+  if( IsEmpty( first ) )
+  {
+    return second;
+  }
+  if( IsEmpty( second ) )
+  {
+    return first;
+  }
+
+  const int left = first.x < second.x ? first.x : second.x;
+  const int top = first.y < second.y ? first.y : second.y;
+  const int right = first.x + first.width > second.x + second.width ? first.x + first.width : second.x + second.width;
+  const int bottom = first.y + first.height > second.y + second.height ? first.y + first.height : second.y + second.height;
+  return Rect< int >( left, top, right - left, bottom - top );
+}
+
+void PartialUpdateBuffer::CopyArea( const unsigned char* source, unsigned char* destination, const Rect< int >& area ) const
+{
+  if( IsEmpty( area ) )
+  {
+    return;
+  }
+
+  const unsigned int offset = area.y * mStride + area.x * mBytesPerPixel;
+  if( area.width == mWidth )
+  {
+    // Whole rows are contiguous
+    memcpy( destination + offset, source + offset, area.height * mStride );
+    return;
+  }
+
+  const unsigned int rowSize = area.width * mBytesPerPixel;
+  for( int row = 0; row < area.height; ++row )
+  {
+    memcpy( destination + offset + row * mStride, source + offset + row * mStride, rowSize );
+  }
+}
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
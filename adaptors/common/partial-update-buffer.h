@@ -0,0 +1,122 @@
+#ifndef __DALI_INTERNAL_PARTIAL_UPDATE_BUFFER_H__
+#define __DALI_INTERNAL_PARTIAL_UPDATE_BUFFER_H__
+
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/public-api/math/rect.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace Adaptor
+{
+
+/**
+ * A double buffered image which one thread writes areas of while another thread reads the whole image,
+ * without either of them waiting for the other.
+ *
+ * Unlike Integration::LocklessBuffer, a write only copies the rows of the area which changed. Each buffer
+ * remembers the areas written to the other buffer since it was last written, and catches up with those
+ * before its next write. The reader is told the union of the areas written since its previous swap, so
+ * only that needs to be uploaded.
+ */
+class PartialUpdateBuffer
+{
+public:
+
+  /**
+   * Constructor. Both buffers start cleared to zero.
+   * @param[in] width The image width in pixels
+   * @param[in] height The image height in pixels
+   * @param[in] bytesPerPixel The size of a pixel
+   */
+  PartialUpdateBuffer( unsigned int width, unsigned int height, unsigned int bytesPerPixel );
+
+  /**
+   * Non-virtual destructor; not intended as a base class.
+   */
+  ~PartialUpdateBuffer();
+
+  /**
+   * Copies an area of an image into the buffer not being read, and lets the reader swap to it. Does not block.
+   * Only called from one thread.
+   * @param[in] src The whole image, with the same size and pixel layout as the buffer
+   * @param[in] area The area of the image which changed, clipped to the image
+   */
+  void Write( const unsigned char* src, const Rect< int >& area );
+
+  /**
+   * Swaps to the most recently written buffer, unless it is being written or has already been read.
+   * Only called from one thread, other than the writer.
+   * @param[out] updatedArea The union of the areas written since the previous swap, empty if there was no swap
+   * @return The buffer to read, which stays unchanged until the next call
+   */
+  const unsigned char* Read( Rect< int >& updatedArea );
+
+  /**
+   * @return The number of bytes in a row of the image
+   */
+  unsigned int GetStride() const;
+
+  /**
+   * Merges two areas.
+   * @param[in] first An area, which may be empty
+   * @param[in] second Another area, which may be empty
+   * @return The smallest area containing both
+   */
+  static Rect< int > Merge( const Rect< int >& first, const Rect< int >& second );
+
+private:
+
+  /**
+   * Copies an area from one image to another of this size.
+   * @param[in] source The image to copy from
+   * @param[in] destination The image to copy to
+   * @param[in] area The area to copy, already clipped to the image
+   */
+  void CopyArea( const unsigned char* source, unsigned char* destination, const Rect< int >& area ) const;
+
+  // Undefined
+  PartialUpdateBuffer( const PartialUpdateBuffer& partialUpdateBuffer );
+
+  // Undefined
+  PartialUpdateBuffer& operator=( const PartialUpdateBuffer& partialUpdateBuffer );
+
+private: // Data
+
+  const int mWidth;                   ///< Image width in pixels
+  const int mHeight;                  ///< Image height in pixels
+  const unsigned int mBytesPerPixel;  ///< Size of a pixel
+  const unsigned int mStride;         ///< Size of a row
+  unsigned char* mBuffers[ 2 ];       ///< The two copies of the image
+  Rect< int > mStaleAreas[ 2 ];       ///< Per buffer, the areas written to the other buffer since it was last written; only used by the writer
+  Rect< int > mUpdatedAreas[ 2 ];     ///< Per buffer, the areas written to it since the reader last swapped to it
+  volatile unsigned int mState;       ///< The write buffer index and the WRITING and UPDATED flags
+};
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // __DALI_INTERNAL_PARTIAL_UPDATE_BUFFER_H__
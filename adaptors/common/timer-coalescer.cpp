@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include "timer-coalescer.h"
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace Adaptor
+{
+
+namespace
+{
+const unsigned int MAXIMUM_DELAY_DIVISOR = 4u;          ///< A timer may be delayed by at most this fraction of its interval
+const unsigned int MILLISECONDS_PER_SECOND = 1000u;
+} // unnamed namespace
+
+TimerCoalescer& TimerCoalescer::Get()
+{
+  static TimerCoalescer coalescer;
+  return coalescer;
+}
+
+TimerCoalescer::TimerCoalescer()
+: mSlack( 0u ),
+  mLastWakeupTime( 0u ),
+  mWakeupCount( 0u ),
+  mPeriodStartTime( 0u ),
+  mPeriodWakeupCount( 0u ),
+  mWakeupsPerSecond( 0.0f )
+{
+}
+
+TimerCoalescer::~TimerCoalescer()
+{
+}
+
+void TimerCoalescer::SetSlack( unsigned int slack )
+{
+  mSlack = slack;
+}
+
+unsigned int TimerCoalescer::GetSlack() const
+{
+  return mSlack;
+}
+
+uint64_t TimerCoalescer::Coalesce( uint64_t expiryTime, unsigned int interval ) const
+{
+  if( mSlack == 0u )
+  {
+    return expiryTime;
+  }
+
+  // The end of the slot the timer is due in; every timer due in the same slot fires together
+  const uint64_t slotEndTime = ( ( expiryTime + mSlack - 1u ) / mSlack ) * mSlack;
+
+  if( ( slotEndTime - expiryTime ) * MAXIMUM_DELAY_DIVISOR > interval )
+  {
+    // Too long a delay for a timer this frequent
+    return expiryTime;
+  }
+
+  return slotEndTime;
+}
+
+void TimerCoalescer::RecordWakeup( uint64_t loopTime )
+{
+  if( mWakeupCount == 0u )
+  {
+    mPeriodStartTime = loopTime;
+  }
+  else if( loopTime == mLastWakeupTime )
+  {
+    // Run in the same loop iteration as the previous timer or callback
+    return;
+  }
+
+  if( loopTime - mPeriodStartTime >= MILLISECONDS_PER_SECOND )
+  {
+    mWakeupsPerSecond = static_cast< float >( mPeriodWakeupCount * MILLISECONDS_PER_SECOND ) / static_cast< float >( loopTime - mPeriodStartTime );
+    mPeriodStartTime = loopTime;
+    mPeriodWakeupCount = 0u;
+  }
+
+  mLastWakeupTime = loopTime;
+  ++mWakeupCount;
+  ++mPeriodWakeupCount;
+}
+
+unsigned int TimerCoalescer::GetWakeupCount() const
+{
+  return mWakeupCount;
+}
+
+float TimerCoalescer::GetWakeupsPerSecond() const
+{
+  return mWakeupsPerSecond;
+}
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
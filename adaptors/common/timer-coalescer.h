@@ -0,0 +1,124 @@
+#ifndef __DALI_INTERNAL_TIMER_COALESCER_H__
+#define __DALI_INTERNAL_TIMER_COALESCER_H__
+
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <stdint.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace Adaptor
+{
+
+/**
+ * @brief Lines up the expiry times of event loop timers so that they wake the event thread together, and counts how
+ * often the event thread is woken.
+ *
+ * Time is divided into slots the length of the slack window. A timer which is due inside a slot fires at the end of
+ * it, along with every other timer due inside the same slot. A timer is never delayed by more than a quarter of its
+ * interval, so frequent timers are left alone.
+ *
+ * All times are in milliseconds on the event loop's clock, which is read once per loop iteration. Every callback
+ * run in the same iteration therefore sees the same time, which is how wakeups are told apart.
+ *
+ * Only to be used on the event thread.
+ */
+class TimerCoalescer
+{
+public:
+
+  /**
+   * @brief The instance used by the event loop's timers and callbacks.
+   */
+  static TimerCoalescer& Get();
+
+  /**
+   * Constructor. Timers are not coalesced until a slack window is set.
+   */
+  TimerCoalescer();
+
+  /**
+   * Destructor.
+   */
+  ~TimerCoalescer();
+
+  /**
+   * @brief Sets how late a timer may fire so that it can share a wakeup with other timers.
+   * @param[in] slack The slack window in milliseconds, zero to fire timers on time
+   */
+  void SetSlack( unsigned int slack );
+
+  /**
+   * @return The slack window in milliseconds.
+   */
+  unsigned int GetSlack() const;
+
+  /**
+   * @brief Moves a timer's expiry time later so that it coincides with the expiry of other timers.
+   * @param[in] expiryTime When the timer is due
+   * @param[in] interval The timer's interval
+   * @return When the timer should fire, which is never before expiryTime
+   */
+  uint64_t Coalesce( uint64_t expiryTime, unsigned int interval ) const;
+
+  /**
+   * @brief Records that a timer or callback has run.
+   * @param[in] loopTime The event loop's time for the current iteration
+   */
+  void RecordWakeup( uint64_t loopTime );
+
+  /**
+   * @return How many times the event thread has been woken.
+   */
+  unsigned int GetWakeupCount() const;
+
+  /**
+   * @return How many times a second the event thread was woken, measured over the last complete second.
+   */
+  float GetWakeupsPerSecond() const;
+
+private:
+
+  // Undefined copy constructor.
+  TimerCoalescer( const TimerCoalescer& );
+
+  // Undefined assignment operator.
+  TimerCoalescer& operator=( const TimerCoalescer& );
+
+private:
+
+  unsigned int mSlack;                ///< The slack window in milliseconds
+  uint64_t     mLastWakeupTime;       ///< The loop time of the last wakeup
+  unsigned int mWakeupCount;          ///< Total number of wakeups
+  uint64_t     mPeriodStartTime;      ///< When the current measuring period started
+  unsigned int mPeriodWakeupCount;    ///< Number of wakeups in the current measuring period
+  float        mWakeupsPerSecond;     ///< Wakeup rate over the last complete measuring period
+};
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // __DALI_INTERNAL_TIMER_COALESCER_H__
@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include "trigger-event-queue.h"
+
+// EXTERNAL INCLUDES
+#include <stdint.h>
+#include <cstddef>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#include <dali/integration-api/debug.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace Adaptor
+{
+
+TriggerEventQueue::Entry::Entry()
+: mNext( NULL ),
+  mQueued( 0 )
+{
+}
+
+TriggerEventQueue::Entry::~Entry()
+{
+}
+
+TriggerEventQueue::TriggerEventQueue()
+: mHead( NULL ),
+  mDispatching( NULL ),
+  mFileDescriptor( eventfd( 0, EFD_NONBLOCK ) )
+{
+  if( mFileDescriptor < 0 )
+  {
+    DALI_LOG_ERROR( "Unable to create TriggerEvent File descriptor\n" );
+  }
+}
+
+TriggerEventQueue::~TriggerEventQueue()
+{
+  if( mFileDescriptor >= 0 )
+  {
+    close( mFileDescriptor );
+  }
+}
+
+int TriggerEventQueue::GetFileDescriptor() const
+{
+  return mFileDescriptor;
+}
+
+void TriggerEventQueue::Push( Entry& entry )
+{
+  // An entry already waiting will be dispatched once, however many times it is triggered
+  if( __sync_bool_compare_and_swap( &entry.mQueued, 0, 1 ) )
+  {
+    PushQueued( entry );
+  }
+}
+
+void TriggerEventQueue::Dispatch()
+{
+  // Reading from the file descriptor resets the event counter; entries pushed after this wake it again
+  uint64_t receivedData;
+  if( read( mFileDescriptor, &receivedData, sizeof( uint64_t ) ) != sizeof( uint64_t ) )
+  {
+    DALI_LOG_WARNING( "Unable to read to UpdateEvent File descriptor\n" );
+  }
+
+  mDispatching = TakeAll();
+  while( mDispatching )
+  {
+    // Unlink the entry before it is dispatched, as it may be pushed again or deleted
+    Entry* const entry = mDispatching;
+    mDispatching = entry->mNext;
+    entry->mNext = NULL;
+    __sync_lock_release( &entry->mQueued );
+
+    entry->Dispatch();
+  }
+}
+
+void TriggerEventQueue::Remove( Entry& entry )
+{
+  if( ! __atomic_load_n( &entry.mQueued, __ATOMIC_ACQUIRE ) )
+  {
+    return;
+  }
+
+  // The rest of the current batch may include it, if an earlier entry deletes it
+  for( Entry** link = &mDispatching; *link; link = &(*link)->mNext )
+  {
+    if( *link == &entry )
+    {
+      *link = entry.mNext;
+      entry.mNext = NULL;
+      __sync_lock_release( &entry.mQueued );
+      return;
+    }
+  }
+
+  // Entries cannot be unlinked while other threads push, so take them all and push back all but this one
+  Entry* queued = TakeAll();
+  while( queued )
+  {
+    Entry* const next = queued->mNext;
+    if( queued != &entry )
+    {
+      PushQueued( *queued );
+    }
+    queued = next;
+  }
+  entry.mNext = NULL;
+  __sync_lock_release( &entry.mQueued );
+}
+
+void TriggerEventQueue::PushQueued( Entry& entry )
+{
+  Entry* head;
+  do
+  {
+    head = __atomic_load_n( &mHead, __ATOMIC_RELAXED );
+    entry.mNext = head;
+  }
+  while( ! __sync_bool_compare_and_swap( &mHead, head, &entry ) );
+
+  // Only the push onto an empty queue wakes the dispatching thread; the others are dispatched in the same batch
+  if( ! head && mFileDescriptor >= 0 )
+  {
+    // Writing to the file descriptor triggers the Dispatch() method in the other thread.
+    // Nothing is logged if it fails, as this may be called from a signal handler.
+    uint64_t data = 1;
+    const ssize_t size = write( mFileDescriptor, &data, sizeof( uint64_t ) );
+    (void)size;
+  }
+}
+
+TriggerEventQueue::Entry* TriggerEventQueue::TakeAll()
+{
+  // The list is pushed at its head, so it is reversed to dispatch in the order entries were pushed
+  Entry* newestFirst = __sync_lock_test_and_set( &mHead, static_cast< Entry* >( NULL ) );
+
+  Entry* oldestFirst = NULL;
+  while( newestFirst )
+  {
+    Entry* const next = newestFirst->mNext;
+    newestFirst->mNext = oldestFirst;
+    oldestFirst = newestFirst;
+    newestFirst = next;
+  }
+  return oldestFirst;
+}
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
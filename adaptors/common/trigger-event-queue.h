@@ -0,0 +1,154 @@
+#ifndef __DALI_INTERNAL_TRIGGER_EVENT_QUEUE_H__
+#define __DALI_INTERNAL_TRIGGER_EVENT_QUEUE_H__
+
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace Adaptor
+{
+
+/**
+ * A queue of events triggered from any thread, which are dispatched in batches on the thread
+ * monitoring its event file descriptor.
+ *
+ * Triggering an event pushes it onto a lock-free list, without allocating. Only the push which finds
+ * the list empty writes to the file descriptor, so a burst of triggers costs one system call and one
+ * wakeup of the dispatching thread, however many events it contains.
+ *
+ * An event which is triggered again before it is dispatched is only dispatched once, as with the
+ * counter of an event file descriptor.
+ */
+class TriggerEventQueue
+{
+public:
+
+  /**
+   * An event which can be queued. Its links are kept in the event itself.
+   */
+  class Entry
+  {
+  public:
+
+    /**
+     * Constructor
+     */
+    Entry();
+
+    /**
+     * Called on the dispatching thread when the event is dispatched. The entry may be triggered again,
+     * or deleted, from within this call.
+     */
+    virtual void Dispatch() = 0;
+
+  protected:
+
+    /**
+     * Virtual destructor. The entry must have been removed from any queue.
+     */
+    virtual ~Entry();
+
+  private:
+
+    // Undefined
+    Entry( const Entry& entry );
+
+    // Undefined
+    Entry& operator=( const Entry& entry );
+
+  private:
+
+    friend class TriggerEventQueue;
+
+    Entry* mNext;               ///< The next entry in the queue
+    volatile int mQueued;       ///< Non zero from when the entry is pushed until just before it is dispatched
+  };
+
+  /**
+   * Constructor. Creates the event file descriptor.
+   */
+  TriggerEventQueue();
+
+  /**
+   * Non-virtual destructor; not intended as a base class. Closes the event file descriptor.
+   * Any entries still queued are not dispatched.
+   */
+  ~TriggerEventQueue();
+
+  /**
+   * @return The file descriptor which becomes readable when entries are queued, or -1 if it could not be created
+   */
+  int GetFileDescriptor() const;
+
+  /**
+   * Queues an entry to be dispatched, unless it is already queued. Can be called from any thread,
+   * and from a signal handler, as it neither blocks nor allocates.
+   * @param[in] entry The entry
+   */
+  void Push( Entry& entry );
+
+  /**
+   * Dispatches every entry queued, in the order they were pushed. Called on the dispatching thread
+   * when the file descriptor is readable. Entries pushed during the dispatch are left for the next one.
+   */
+  void Dispatch();
+
+  /**
+   * Removes an entry if it is queued, so that it can be deleted. Only called on the dispatching thread.
+   * @param[in] entry The entry
+   */
+  void Remove( Entry& entry );
+
+private:
+
+  /**
+   * Pushes an entry which has already been marked as queued.
+   * @param[in] entry The entry
+   */
+  void PushQueued( Entry& entry );
+
+  /**
+   * Takes every entry queued, leaving the queue empty.
+   * @return The entries in the order they were pushed
+   */
+  Entry* TakeAll();
+
+  // Undefined
+  TriggerEventQueue( const TriggerEventQueue& triggerEventQueue );
+
+  // Undefined
+  TriggerEventQueue& operator=( const TriggerEventQueue& triggerEventQueue );
+
+private: // Data
+
+  Entry* volatile mHead;        ///< The most recently pushed entry, or NULL if the queue is empty
+  Entry* mDispatching;          ///< The entries of the current batch yet to be dispatched; only used by the dispatching thread
+  int mFileDescriptor;          ///< Event file descriptor written when the queue becomes non-empty
+};
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // __DALI_INTERNAL_TRIGGER_EVENT_QUEUE_H__
@@ -19,13 +19,10 @@
 #include "trigger-event.h"
 
 // EXTERNAL INCLUDES
-#include <sys/eventfd.h>
-#include <unistd.h>
-
 #include <dali/integration-api/debug.h>
+#include <dali/devel-api/threading/mutex.h>
 
 // INTERNAL INCLUDES
-
 #include <file-descriptor-monitor.h>
 
 namespace Dali
@@ -37,60 +34,74 @@ namespace Internal
 namespace Adaptor
 {
 
-TriggerEvent::TriggerEvent( CallbackBase* callback, TriggerEventInterface::Options options )
-: mFileDescriptorMonitor( NULL ),
-  mCallback( callback ),
-  mFileDescriptor( -1 ),
-  mOptions( options )
+namespace
 {
-  // Create accompanying file descriptor.
-  mFileDescriptor = eventfd(0, EFD_NONBLOCK);
-  if (mFileDescriptor >= 0)
+
+/**
+ * The queue shared by all trigger events, and the monitor of its file descriptor.
+ */
+class SharedQueue
+{
+public:
+
+  SharedQueue()
+  : mQueue(),
+    mFileDescriptorMonitor( NULL ),
+    mReferenceCount( 0u )
   {
-    // Now Monitor the created event file descriptor
-    mFileDescriptorMonitor = new FileDescriptorMonitor( mFileDescriptor, MakeCallback( this, &TriggerEvent::Triggered ), FileDescriptorMonitor::FD_READABLE );
+    if( mQueue.GetFileDescriptor() >= 0 )
+    {
+      mFileDescriptorMonitor = new FileDescriptorMonitor( mQueue.GetFileDescriptor(), MakeCallback( this, &SharedQueue::Triggered ), FileDescriptorMonitor::FD_READABLE );
+    }
   }
-  else
+
+  ~SharedQueue()
   {
-    DALI_LOG_ERROR("Unable to create TriggerEvent File descriptor\n");
+    delete mFileDescriptorMonitor;
   }
-}
 
-TriggerEvent::~TriggerEvent()
-{
-  delete mFileDescriptorMonitor;
-  delete mCallback;
+  /**
+   * @brief Called when the queue's file descriptor has been written to.
+   * @param[in] eventBitMask bit mask of events that occured on the file descriptor
+   */
+  void Triggered( FileDescriptorMonitor::EventType eventBitMask );
 
-  if (mFileDescriptor >= 0)
+  TriggerEventQueue mQueue;                         ///< The queue
+  FileDescriptorMonitor* mFileDescriptorMonitor;    ///< Dispatches the queue when its file descriptor is written
+  unsigned int mReferenceCount;                     ///< Trigger events using the queue, and any dispatch in progress
+};
+
+Dali::Mutex gSharedQueueMutex;                      ///< Protects gSharedQueue, as trigger events may be created on other threads
+SharedQueue* gSharedQueue = NULL;                   ///< Created with the first trigger event, destroyed with the last
+
+/**
+ * Takes a reference to the shared queue, creating it if need be
+ */
+SharedQueue* AcquireSharedQueue()
+{
+  Mutex::ScopedLock lock( gSharedQueueMutex );
+  if( ! gSharedQueue )
   {
-    close(mFileDescriptor);
-    mFileDescriptor = 0;
+    gSharedQueue = new SharedQueue;
   }
+  ++gSharedQueue->mReferenceCount;
+  return gSharedQueue;
 }
 
-void TriggerEvent::Trigger()
+/**
+ * Releases a reference to the shared queue, destroying it once nothing uses it
+ */
+void ReleaseSharedQueue()
 {
-  if (mFileDescriptor >= 0)
+  Mutex::ScopedLock lock( gSharedQueueMutex );
+  if( --gSharedQueue->mReferenceCount == 0u )
   {
-    // Increment event counter by 1.
-    // Writing to the file descriptor triggers the Dispatch() method in the other thread
-    // (if in multi-threaded environment).
-
-    uint64_t data = 1;
-    int size = write(mFileDescriptor, &data, sizeof(uint64_t));
-
-    if (size != sizeof(uint64_t))
-    {
-      DALI_LOG_ERROR("Unable to write to UpdateEvent File descriptor\n");
-    }
-  }
-  else
-  {
-    DALI_LOG_WARNING("Attempting to write to an invalid file descriptor\n");
+    delete gSharedQueue;
+    gSharedQueue = NULL;
   }
 }
 
-void TriggerEvent::Triggered( FileDescriptorMonitor::EventType eventBitMask )
+void SharedQueue::Triggered( FileDescriptorMonitor::EventType eventBitMask )
 {
   if( !( eventBitMask & FileDescriptorMonitor::FD_READABLE ) )
   {
@@ -98,15 +109,38 @@ void TriggerEvent::Triggered( FileDescriptorMonitor::EventType eventBitMask )
     return;
   }
 
-  // Reading from the file descriptor resets the event counter, we can ignore the count.
-  uint64_t receivedData;
-  size_t size;
-  size = read(mFileDescriptor, &receivedData, sizeof(uint64_t));
-  if (size != sizeof(uint64_t))
-  {
-    DALI_LOG_WARNING("Unable to read to UpdateEvent File descriptor\n");
-  }
+  // Keep the queue while the events it dispatches delete themselves
+  AcquireSharedQueue();
+  mQueue.Dispatch();
+  ReleaseSharedQueue();
+}
+
+} // unnamed namespace
+
+TriggerEvent::TriggerEvent( CallbackBase* callback, TriggerEventInterface::Options options )
+: mQueue( &AcquireSharedQueue()->mQueue ),
+  mCallback( callback ),
+  mOptions( options )
+{
+}
+
+TriggerEvent::~TriggerEvent()
+{
+  mQueue->Remove( *this );
+  delete mCallback;
+
+  ReleaseSharedQueue();
+}
+
+void TriggerEvent::Trigger()
+{
+  // Pushing onto an empty queue writes to its file descriptor, which triggers the Dispatch() method
+  // in the other thread (if in multi-threaded environment).
+  mQueue->Push( *this );
+}
 
+void TriggerEvent::Dispatch()
+{
   // Call the connected callback
   CallbackBase::Execute( *mCallback );
 
@@ -21,10 +21,10 @@
 // EXTERNAL INCLUDES
 #include <dali/public-api/common/dali-common.h>
 #include <dali/public-api/signals/callback.h>
-#include <file-descriptor-monitor.h>
 
 // INTERNAL INCLUDES
 #include <trigger-event-interface.h>
+#include <trigger-event-queue.h>
 
 namespace Dali
 {
@@ -44,16 +44,17 @@ namespace Adaptor
  *
  * The observer will be informed whenever the event is triggered.
  *
- * The implementation of TriggerEvent uses an event file descriptor.
+ * All trigger events share one TriggerEventQueue, and so one event file descriptor, which is
+ * monitored on the thread which created the first of them. Events triggered close together are
+ * dispatched in one batch.
  */
-class TriggerEvent : public TriggerEventInterface
+class TriggerEvent : public TriggerEventInterface, public TriggerEventQueue::Entry
 {
 public:
 
   /**
    * Constructor
-   * Creates an event file descriptor and starts a GSource which reads from the file
-   * descriptor when there is data.
+   * Creates the shared queue and starts monitoring its file descriptor if this is the first trigger event.
    *
    * @param[in] callback The callback to call
    * @param[in] options Trigger event options.
@@ -63,6 +64,7 @@ public:
 
   /**
    * Destructor
+   * Removes the event from the queue if it is waiting, and destroys the queue if this is the last trigger event.
    */
   ~TriggerEvent();
 
@@ -72,26 +74,21 @@ public:
    * Triggers the event.
    *
    * This can be called from one thread in order to wake up another thread.
+   * It does not block or allocate, so it can also be called from a signal handler.
    */
   void Trigger();
 
 private:
 
   /**
-   * @brief Called when our event file descriptor has been written to.
-   * @param[in] eventBitMask bit mask of events that occured on the file descriptor
+   * @brief Called when the event is dispatched by the queue.
    */
-  void Triggered( FileDescriptorMonitor::EventType eventBitMask );
+  virtual void Dispatch();
 
 private:
 
-  struct Source;
-
-private:
-
-  FileDescriptorMonitor* mFileDescriptorMonitor;
+  TriggerEventQueue* mQueue;
   CallbackBase* mCallback;
-  int mFileDescriptor;
   TriggerEventInterface::Options mOptions;
 };
 
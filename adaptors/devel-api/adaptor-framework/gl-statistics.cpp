@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <gl-statistics.h>
+
+// INTERNAL INCLUDES
+#include <adaptor-impl.h>
+#include <gl/gl-proxy-implementation.h>
+
+namespace Dali
+{
+
+namespace GlStatistics
+{
+
+Frame::Frame()
+: frameNumber( 0u ),
+  drawCalls( 0u ),
+  stateChanges( 0u ),
+  uniformCalls( 0u ),
+  textureUploads( 0u ),
+  textureUploadBytes( 0u ),
+  bufferUploads( 0u ),
+  bufferUploadBytes( 0u ),
+  bufferCount( 0u ),
+  textureCount( 0u ),
+  programCount( 0u ),
+  deferredUploads( 0u )
+{
+}
+
+bool GetLastFrame( Frame& frame )
+{
+  if( Internal::Adaptor::Adaptor::IsAvailable() )
+  {
+    // The adaptor always renders through the proxy, which counts the calls
+    Internal::Adaptor::Adaptor& adaptor = Internal::Adaptor::Adaptor::GetImplementation( Internal::Adaptor::Adaptor::Get() );
+    Internal::Adaptor::GlProxyImplementation* glProxy = dynamic_cast< Internal::Adaptor::GlProxyImplementation* >( &adaptor.GetGlesInterface() );
+    if( glProxy )
+    {
+      glProxy->GetFrameRecorder().GetLastFrame( frame );
+      frame.deferredUploads = adaptor.GetTextureUploadBudget().GetDeferredCount();
+      return true;
+    }
+  }
+
+  return false;
+}
+
+} // namespace GlStatistics
+
+} // namespace Dali
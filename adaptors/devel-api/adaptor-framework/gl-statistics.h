@@ -0,0 +1,70 @@
+#ifndef __DALI_GL_STATISTICS_H__
+#define __DALI_GL_STATISTICS_H__
+
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <stdint.h>
+#include <dali/public-api/common/dali-common.h>
+
+namespace Dali
+{
+
+namespace GlStatistics
+{
+
+/**
+ * @brief The OpenGL ES calls made to render one frame.
+ *
+ * The calls are always counted; DALI_GLES_CALL_TIME only controls the periodic log of their averages.
+ */
+struct DALI_IMPORT_API Frame
+{
+  /**
+   * @brief Constructor, all counts are zero.
+   */
+  Frame();
+
+  unsigned int frameNumber;         ///< The number of frames rendered before this one since the calls started being counted
+  unsigned int drawCalls;           ///< DrawArrays and DrawElements calls
+  unsigned int stateChanges;        ///< Calls which bind an object or a texture unit, or change the blend, depth, cull, scissor or viewport state
+  unsigned int uniformCalls;        ///< Uniform calls
+  unsigned int textureUploads;      ///< TexImage2D, TexSubImage2D and compressed texture calls which upload pixel data
+  uint64_t     textureUploadBytes;  ///< The size of the pixel data uploaded, not including row padding
+  unsigned int bufferUploads;       ///< BufferData and BufferSubData calls which upload data
+  uint64_t     bufferUploadBytes;   ///< The size of the buffer data uploaded
+  unsigned int bufferCount;         ///< The number of buffer objects at the end of the frame
+  unsigned int textureCount;        ///< The number of texture objects at the end of the frame
+  unsigned int programCount;        ///< The number of shader programs at the end of the frame
+  unsigned int deferredUploads;     ///< Native image uploads deferred to a later frame by DALI_TEXTURE_UPLOAD_BUDGET
+};
+
+/**
+ * @brief Retrieves the calls made to render the most recent frame.
+ *
+ * Must be called from the main thread, e.g. to check that a screen stays within its draw call and upload budgets.
+ * @param[out] frame The calls made to render the most recent frame
+ * @return true if the calls are being counted, false if there is no adaptor
+ */
+DALI_IMPORT_API bool GetLastFrame( Frame& frame );
+
+} // namespace GlStatistics
+
+} // namespace Dali
+
+#endif // __DALI_GL_STATISTICS_H__
@@ -17,6 +17,8 @@
 
 #include "image-loaders.h"
 #include <dali-test-suite-utils.h>
+#include <cstring>
+#include "platform-abstractions/portable/file-mapper.h"
 
 
 class StubImageLoaderClient : public Dali::TizenPlatform::ResourceLoadingClient
@@ -182,6 +184,34 @@ void CompareLoadedImageData( const ImageDetails& image, const LoadFunctions& fun
   }
 }
 
+void CompareMappedAndStreamedLoads( const char * const filename, const LoadFunctions& functions, Dali::Integration::Bitmap::Profile bitmapProfile )
+{
+  FILE* filePointer = fopen( filename, "rb" );
+  AutoCloseFile autoClose( filePointer );
+  DALI_TEST_CHECK( filePointer != NULL );
+
+  // Load through the FILE*:
+  Dali::Integration::Bitmap* streamedBitmap = Dali::Integration::Bitmap::New( bitmapProfile, ResourcePolicy::OWNED_RETAIN );
+  Dali::Integration::BitmapPtr streamedBitmapPtr( streamedBitmap );
+  const Dali::TizenPlatform::ImageLoader::Input streamedInput( filePointer );
+  DALI_TEST_CHECK( functions.loader( StubImageLoaderClient(), streamedInput, *streamedBitmap ) );
+
+  // Load out of a mapping of the whole file, however small it is:
+  fseek( filePointer, 0, SEEK_SET );
+  const Dali::Internal::Platform::FileMapper fileMapper( filePointer, 0 );
+  DALI_TEST_CHECK( fileMapper.GetData() != NULL );
+
+  Dali::Integration::Bitmap* mappedBitmap = Dali::Integration::Bitmap::New( bitmapProfile, ResourcePolicy::OWNED_RETAIN );
+  Dali::Integration::BitmapPtr mappedBitmapPtr( mappedBitmap );
+  const Dali::TizenPlatform::ImageLoader::Input mappedInput( filePointer, fileMapper.GetData(), fileMapper.GetSize() );
+  DALI_TEST_CHECK( functions.loader( StubImageLoaderClient(), mappedInput, *mappedBitmap ) );
+
+  DALI_TEST_EQUALS( mappedBitmap->GetImageWidth(),  streamedBitmap->GetImageWidth(),  TEST_LOCATION );
+  DALI_TEST_EQUALS( mappedBitmap->GetImageHeight(), streamedBitmap->GetImageHeight(), TEST_LOCATION );
+  DALI_TEST_EQUALS( mappedBitmap->GetBufferSize(),  streamedBitmap->GetBufferSize(),  TEST_LOCATION );
+  DALI_TEST_CHECK( memcmp( mappedBitmap->GetBuffer(), streamedBitmap->GetBuffer(), streamedBitmap->GetBufferSize() ) == 0 );
+}
+
 void DumpImageBufferToTempFile( std::string filename, std::string targetFilename, const LoadFunctions& functions )
 {
   FILE* fp = fopen( filename.c_str() , "rb" );
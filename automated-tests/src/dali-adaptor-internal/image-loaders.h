@@ -111,6 +111,16 @@ void TestImageLoading( const ImageDetails& image, const LoadFunctions& functions
  */
 void CompareLoadedImageData( const ImageDetails& image, const LoadFunctions& functions, const uint32_t* master );
 
+/**
+ * Helper method to check an image decoded out of a memory mapping of its file
+ * is identical to the same image decoded by reading through its FILE*.
+ *
+ * @param[in] filename      The path of the image file.
+ * @param[in] functions     The loader functions to call.
+ * @param[in] bitmapProfile The profile of bitmap to load into.
+ */
+void CompareMappedAndStreamedLoads( const char * const filename, const LoadFunctions& functions, Dali::Integration::Bitmap::Profile bitmapProfile = Dali::Integration::Bitmap::BITMAP_2D_PACKED_PIXELS );
+
 /**
  * Helper function which should be used when first creating a reference buffer file.
  * Set output file to a file in the /tmp/ directory e.g:
@@ -0,0 +1,28 @@
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef __DALI_ADAPTOR_TET_TEST_TIMING_H_
+#define __DALI_ADAPTOR_TET_TEST_TIMING_H_
+
+#include <stdint.h>
+
+/**
+ * @brief The monotonic time in nanoseconds, for timing benchmarks.
+ */
+uint64_t GetNanoseconds();
+
+#endif // __DALI_ADAPTOR_TET_TEST_TIMING_H_
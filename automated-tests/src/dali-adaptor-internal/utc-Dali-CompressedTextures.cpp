@@ -195,3 +195,12 @@ int UtcDaliAstcLoader(void)
   END_TEST;
 }
 
+// Compressed textures decoded out of a mapping of the file must match those read through the FILE*:
+int UtcDaliCompressedTextureMappedLoad(void)
+{
+  CompareMappedAndStreamedLoads( TEST_IMAGE_DIR "/fractal-compressed-ETC1_RGB8_OES-45x80.ktx", KtxLoaders, Integration::Bitmap::BITMAP_COMPRESSED );
+  CompareMappedAndStreamedLoads( TEST_IMAGE_DIR "/fractal-compressed-RGBA_ASTC_4x4_KHR-32x64.ktx", KtxLoaders, Integration::Bitmap::BITMAP_COMPRESSED );
+  CompareMappedAndStreamedLoads( TEST_IMAGE_DIR "/fractal-compressed-RGBA_ASTC_4x4_KHR-32x64.astc", AstcLoaders, Integration::Bitmap::BITMAP_COMPRESSED );
+
+  END_TEST;
+}
@@ -19,12 +19,49 @@
 
 #include <stdlib.h>
 #include <stdint.h>
+#include <vector>
 #include <dali/dali.h>
 #include <dali-test-suite-utils.h>
+#include <dali/devel-api/text-abstraction/font-client.h>
+#include <dali/devel-api/text-abstraction/glyph-info.h>
 #include <dali/internal/text-abstraction/font-client-helper.h>
+#include <dali/internal/text-abstraction/font-client-plugin-impl.h>
+
+#include "test-timing.h"
 
 using namespace Dali;
 
+namespace
+{
+
+const unsigned int DPI = 96u; ///< The resolution the font client plugins are created with.
+
+/**
+ * @brief Clears the glyph metrics cached by a font client plugin, by changing its resolution and back.
+ */
+void ClearGlyphMetricsCache( TextAbstraction::Internal::FontClient::Plugin& plugin )
+{
+  plugin.SetDpi( DPI + 1u, DPI + 1u );
+  plugin.SetDpi( DPI, DPI );
+}
+
+/**
+ * @brief Checks the metrics of the glyphs laid out against those of the same characters of the paragraph.
+ */
+void CheckGlyphMetrics( const std::vector< TextAbstraction::GlyphInfo >& layout, const std::vector< TextAbstraction::GlyphInfo >& paragraphMetrics )
+{
+  for( unsigned int index = 0u; index < layout.size(); ++index )
+  {
+    const TextAbstraction::GlyphInfo& metrics = paragraphMetrics[index % paragraphMetrics.size()];
+    DALI_TEST_EQUALS( layout[index].width, metrics.width, TEST_LOCATION );
+    DALI_TEST_EQUALS( layout[index].height, metrics.height, TEST_LOCATION );
+    DALI_TEST_EQUALS( layout[index].xBearing, metrics.xBearing, TEST_LOCATION );
+    DALI_TEST_EQUALS( layout[index].yBearing, metrics.yBearing, TEST_LOCATION );
+  }
+}
+
+} // anon namespace
+
 int UtcDaliFontClient(void)
 {
   const int ORDERED_VALUES[] = { 50, 63, 75, 87, 100, 113, 125, 150, 200 };
@@ -66,3 +103,123 @@ int UtcDaliFontClient(void)
 }
 
 
+
+int UtcDaliFontClientFindDefaultFontCached(void)
+{
+  // Mixed Latin, CJK and emoji text, as in a chat message
+  const TextAbstraction::Character TEXT[] =
+  {
+    0x48, 0x65, 0x6c, 0x6c, 0x6f, 0x20, 0x4e16, 0x754c, 0x20, 0x1f600, 0x20, 0x3053, 0x3093, 0x306b, 0x3061, 0x306f, 0x20, 0x1f44d, 0x21
+  };
+  const unsigned int NUMBER_OF_CHARACTERS = sizeof( TEXT ) / sizeof( TextAbstraction::Character );
+  const unsigned int PASSES = 100u;
+  const TextAbstraction::PointSize26Dot6 POINT_SIZE = TextAbstraction::FontClient::DEFAULT_POINT_SIZE;
+
+  TestApplication application;
+  TextAbstraction::Internal::FontClient::Plugin plugin( DPI, DPI );
+
+  tet_infoline("UtcDaliFontClientFindDefaultFontCached first pass");
+  std::vector< TextAbstraction::FontId > fontIds;
+  uint64_t start = GetNanoseconds();
+  for( unsigned int index = 0u; index < NUMBER_OF_CHARACTERS; ++index )
+  {
+    fontIds.push_back( plugin.FindDefaultFont( TEXT[index], POINT_SIZE, ( TEXT[index] > 0xffff ) ) );
+  }
+  const uint64_t firstPassTime = GetNanoseconds() - start;
+
+  tet_infoline("UtcDaliFontClientFindDefaultFontCached following passes");
+  start = GetNanoseconds();
+  for( unsigned int pass = 0u; pass < PASSES; ++pass )
+  {
+    for( unsigned int index = 0u; index < NUMBER_OF_CHARACTERS; ++index )
+    {
+      fontIds[index] = plugin.FindDefaultFont( TEXT[index], POINT_SIZE, ( TEXT[index] > 0xffff ) );
+    }
+  }
+  const uint64_t passesTime = GetNanoseconds() - start;
+
+  tet_infoline("UtcDaliFontClientFindDefaultFontCached finds the fonts a walk of the default fonts finds, with and without preferring color");
+  TextAbstraction::FontList defaultFonts;
+  plugin.GetDefaultFonts( defaultFonts );
+  for( unsigned int index = 0u; index < NUMBER_OF_CHARACTERS; ++index )
+  {
+    // The list given is walked with no characters cached
+    DALI_TEST_EQUALS( fontIds[index], plugin.FindFontForCharacter( defaultFonts, TEXT[index], POINT_SIZE, ( TEXT[index] > 0xffff ) ), TEST_LOCATION );
+    DALI_TEST_EQUALS( plugin.FindDefaultFont( TEXT[index], POINT_SIZE, false ), plugin.FindFontForCharacter( defaultFonts, TEXT[index], POINT_SIZE, false ), TEST_LOCATION );
+    DALI_TEST_EQUALS( plugin.FindDefaultFont( TEXT[index], POINT_SIZE, true ), plugin.FindFontForCharacter( defaultFonts, TEXT[index], POINT_SIZE, true ), TEST_LOCATION );
+  }
+
+  tet_printf( "FindDefaultFont: first pass %.1f us per character, then %.3f us per character\n",
+              static_cast< double >( firstPassTime ) / ( 1e3 * NUMBER_OF_CHARACTERS ),
+              static_cast< double >( passesTime ) / ( 1e3 * NUMBER_OF_CHARACTERS * PASSES ) );
+
+  END_TEST;
+}
+
+int UtcDaliFontClientGetGlyphMetricsCached(void)
+{
+  // A 10k character document, relaid out as when it's edited or resized
+  const char* const PARAGRAPH = "The quick brown fox jumps over the lazy dog. Pack my box with five dozen liquor jugs! 0123456789 ";
+  const unsigned int NUMBER_OF_CHARACTERS = 10000u;
+  const unsigned int RELAYOUTS = 20u;
+
+  TestApplication application;
+  TextAbstraction::Internal::FontClient::Plugin plugin( DPI, DPI );
+
+  const std::string paragraph( PARAGRAPH );
+  std::vector< TextAbstraction::GlyphInfo > glyphs;
+  glyphs.reserve( NUMBER_OF_CHARACTERS );
+  for( unsigned int index = 0u; index < NUMBER_OF_CHARACTERS; ++index )
+  {
+    const TextAbstraction::Character character = static_cast< unsigned char >( paragraph[index % paragraph.size()] );
+    const TextAbstraction::FontId fontId = plugin.FindDefaultFont( character, TextAbstraction::FontClient::DEFAULT_POINT_SIZE, false );
+    glyphs.push_back( TextAbstraction::GlyphInfo( fontId, plugin.GetGlyphIndex( fontId, character ) ) );
+  }
+
+  tet_infoline("UtcDaliFontClientGetGlyphMetricsCached metrics of each glyph loaded with nothing cached");
+  std::vector< TextAbstraction::GlyphInfo > horizontalMetrics;
+  std::vector< TextAbstraction::GlyphInfo > verticalMetrics;
+  for( unsigned int index = 0u; index < paragraph.size(); ++index )
+  {
+    TextAbstraction::GlyphInfo glyph( glyphs[index] );
+    ClearGlyphMetricsCache( plugin );
+    DALI_TEST_CHECK( plugin.GetGlyphMetrics( &glyph, 1u, TextAbstraction::BITMAP_GLYPH, true ) );
+    horizontalMetrics.push_back( glyph );
+
+    glyph = glyphs[index];
+    ClearGlyphMetricsCache( plugin );
+    DALI_TEST_CHECK( plugin.GetGlyphMetrics( &glyph, 1u, TextAbstraction::BITMAP_GLYPH, false ) );
+    verticalMetrics.push_back( glyph );
+  }
+
+  tet_infoline("UtcDaliFontClientGetGlyphMetricsCached first layout");
+  ClearGlyphMetricsCache( plugin );
+  std::vector< TextAbstraction::GlyphInfo > layout( glyphs );
+  uint64_t start = GetNanoseconds();
+  DALI_TEST_CHECK( plugin.GetGlyphMetrics( &layout[0], NUMBER_OF_CHARACTERS, TextAbstraction::BITMAP_GLYPH, true ) );
+  const uint64_t firstLayoutTime = GetNanoseconds() - start;
+  CheckGlyphMetrics( layout, horizontalMetrics );
+
+  tet_infoline("UtcDaliFontClientGetGlyphMetricsCached relayouts get the metrics loaded with nothing cached");
+  uint64_t relayoutsTime = 0u;
+  for( unsigned int relayout = 0u; relayout < RELAYOUTS; ++relayout )
+  {
+    layout = glyphs;
+    start = GetNanoseconds();
+    DALI_TEST_CHECK( plugin.GetGlyphMetrics( &layout[0], NUMBER_OF_CHARACTERS, TextAbstraction::BITMAP_GLYPH, true ) );
+    relayoutsTime += GetNanoseconds() - start;
+    CheckGlyphMetrics( layout, horizontalMetrics );
+  }
+
+  tet_infoline("UtcDaliFontClientGetGlyphMetricsCached vertical relayout gets the vertical bearings");
+  layout = glyphs;
+  DALI_TEST_CHECK( plugin.GetGlyphMetrics( &layout[0], NUMBER_OF_CHARACTERS, TextAbstraction::BITMAP_GLYPH, false ) );
+  CheckGlyphMetrics( layout, verticalMetrics );
+
+  tet_printf( "GetGlyphMetrics: first layout of %u characters %.3f ms, then %.3f ms per relayout\n",
+              NUMBER_OF_CHARACTERS,
+              static_cast< double >( firstLayoutTime ) / 1e6,
+              static_cast< double >( relayoutsTime ) / ( 1e6 * RELAYOUTS ) );
+
+  END_TEST;
+}
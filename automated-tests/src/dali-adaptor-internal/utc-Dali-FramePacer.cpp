@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <stdint.h>
+#include <dali-test-suite-utils.h>
+
+#include "adaptors/base/frame-pacer.h"
+
+using namespace Dali;
+using namespace Dali::Internal::Adaptor;
+
+namespace
+{
+
+const uint64_t MILLISECOND = 1000000u;
+const uint64_t VSYNC_PERIOD = 16666666u;
+
+/**
+ * @brief Simulate a frame: wait until the pacer says to start, spend the cost rendering, then swap.
+ * @param[in,out] time The simulated clock, left at the end of the swap
+ * @return Whether the frame missed its deadline
+ */
+bool RunFrame( FramePacer& pacer, uint64_t& time, uint64_t cost, uint64_t swapCost = 0u )
+{
+  const uint64_t startTime = pacer.PlanFrame( time, VSYNC_PERIOD );
+  DALI_TEST_CHECK( startTime >= time );
+
+  time = startTime + cost;
+  const uint64_t renderEndTime = time;
+  time += swapCost;
+  return pacer.FrameRendered( startTime, renderEndTime, time );
+}
+
+} // anon namespace
+
+void utc_dali_frame_pacer_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_frame_pacer_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+/**
+ * @brief Cheap frames should start late but still present on every vsync.
+ */
+int UtcDaliFramePacerStartsFramesLate(void)
+{
+  FramePacer pacer( VSYNC_PERIOD );
+  uint64_t time = VSYNC_PERIOD;
+
+  for( unsigned int frame = 0; frame < 10u; ++frame )
+  {
+    RunFrame( pacer, time, 4 * MILLISECOND );
+  }
+
+  uint64_t previousDeadline = pacer.GetDeadline();
+  for( unsigned int frame = 0; frame < 60u; ++frame )
+  {
+    const uint64_t currentTime = time;
+    const uint64_t startTime = pacer.PlanFrame( currentTime, VSYNC_PERIOD );
+
+    // One frame per vsync, started well after the previous one finished:
+    DALI_TEST_EQUALS( pacer.GetDeadline() - previousDeadline, VSYNC_PERIOD, TEST_LOCATION );
+    DALI_TEST_CHECK( startTime > currentTime + 4 * MILLISECOND );
+    DALI_TEST_CHECK( startTime + pacer.GetPredictedCost() <= pacer.GetDeadline() );
+    previousDeadline = pacer.GetDeadline();
+
+    time = startTime + 4 * MILLISECOND;
+    DALI_TEST_CHECK( ! pacer.FrameRendered( startTime, time, time ) );
+  }
+
+  DALI_TEST_EQUALS( pacer.GetMissCount(), 0u, TEST_LOCATION );
+  DALI_TEST_EQUALS( pacer.GetPredictedMissCount(), 0u, TEST_LOCATION );
+  DALI_TEST_EQUALS( pacer.GetFrameCount(), 70u, TEST_LOCATION );
+
+  END_TEST;
+}
+
+/**
+ * @brief With a lower refresh rate, frames should be presented on every other vsync.
+ */
+int UtcDaliFramePacerHonoursRefreshRate(void)
+{
+  FramePacer pacer( VSYNC_PERIOD );
+  uint64_t time = VSYNC_PERIOD;
+
+  uint64_t previousDeadline = 0u;
+  for( unsigned int frame = 0; frame < 20u; ++frame )
+  {
+    const uint64_t startTime = pacer.PlanFrame( time, 2u * VSYNC_PERIOD );
+    if( frame > 0u )
+    {
+      DALI_TEST_EQUALS( pacer.GetDeadline() - previousDeadline, 2u * VSYNC_PERIOD, TEST_LOCATION );
+    }
+    previousDeadline = pacer.GetDeadline();
+
+    time = startTime + 4 * MILLISECOND;
+    pacer.FrameRendered( startTime, time, time );
+  }
+
+  END_TEST;
+}
+
+/**
+ * @brief A sudden rise in cost is a miss, after which the pacer starts frames earlier.
+ */
+int UtcDaliFramePacerReportsMisses(void)
+{
+  FramePacer pacer( VSYNC_PERIOD );
+  uint64_t time = VSYNC_PERIOD;
+
+  for( unsigned int frame = 0; frame < 30u; ++frame )
+  {
+    RunFrame( pacer, time, 2 * MILLISECOND );
+  }
+  const uint64_t cheapCost = pacer.GetPredictedCost();
+
+  DALI_TEST_CHECK( RunFrame( pacer, time, 10 * MILLISECOND ) );
+  DALI_TEST_EQUALS( pacer.GetMissCount(), 1u, TEST_LOCATION );
+  DALI_TEST_CHECK( pacer.GetPredictedCost() > 10 * MILLISECOND );
+  DALI_TEST_CHECK( pacer.GetPredictedCost() > cheapCost );
+
+  // The same cost again should now be allowed for:
+  for( unsigned int frame = 0; frame < 10u; ++frame )
+  {
+    DALI_TEST_CHECK( ! RunFrame( pacer, time, 10 * MILLISECOND ) );
+  }
+  DALI_TEST_EQUALS( pacer.GetMissCount(), 1u, TEST_LOCATION );
+
+  END_TEST;
+}
+
+/**
+ * @brief Frames which are known to take longer than a vsync period are predicted to miss.
+ */
+int UtcDaliFramePacerPredictsMisses(void)
+{
+  FramePacer pacer( VSYNC_PERIOD );
+  uint64_t time = VSYNC_PERIOD;
+
+  for( unsigned int frame = 0; frame < 10u; ++frame )
+  {
+    RunFrame( pacer, time, 25 * MILLISECOND );
+  }
+
+  DALI_TEST_CHECK( pacer.GetPredictedMissCount() > 0u );
+  DALI_TEST_CHECK( pacer.IsMissPredicted() );
+
+  // Waking up after being idle is not a miss:
+  time += 100 * VSYNC_PERIOD;
+  pacer.PlanFrame( time, VSYNC_PERIOD );
+  DALI_TEST_CHECK( ! pacer.IsMissPredicted() );
+
+  END_TEST;
+}
+
+/**
+ * @brief Swaps which block on the display should move the deadlines onto the display's vsync.
+ */
+int UtcDaliFramePacerLearnsVsyncPhase(void)
+{
+  FramePacer pacer( VSYNC_PERIOD );
+  uint64_t time = VSYNC_PERIOD;
+
+  // The display's vsyncs are 5ms after the pacer's initial guess:
+  const uint64_t displayPhase = VSYNC_PERIOD + 5 * MILLISECOND;
+  for( unsigned int frame = 0; frame < 60u; ++frame )
+  {
+    const uint64_t startTime = pacer.PlanFrame( time, VSYNC_PERIOD );
+    const uint64_t renderEndTime = startTime + 2 * MILLISECOND;
+
+    // The swap blocks until the next vsync of the display:
+    const uint64_t swapEndTime = displayPhase + ( ( renderEndTime - displayPhase ) / VSYNC_PERIOD + 1u ) * VSYNC_PERIOD;
+    pacer.FrameRendered( startTime, renderEndTime, swapEndTime );
+    time = swapEndTime;
+  }
+
+  pacer.PlanFrame( time, VSYNC_PERIOD );
+  const uint64_t phaseError = ( pacer.GetDeadline() - displayPhase ) % VSYNC_PERIOD;
+  DALI_TEST_CHECK( phaseError < MILLISECOND / 10u || phaseError > VSYNC_PERIOD - MILLISECOND / 10u );
+
+  END_TEST;
+}
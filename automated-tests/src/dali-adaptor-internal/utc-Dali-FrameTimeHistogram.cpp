@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <stdint.h>
+#include <dali-test-suite-utils.h>
+
+#include "adaptors/base/performance-logging/frame-time-histogram.h"
+#include "adaptors/base/performance-logging/frame-time-stats.h"
+
+using namespace Dali;
+using namespace Dali::Internal::Adaptor;
+
+namespace
+{
+
+/**
+ * @brief Check a percentile is no shorter than the exact value, and within the histogram's precision of it.
+ */
+bool IsCloseTo( unsigned int percentile, unsigned int exact )
+{
+  return ( percentile >= exact ) && ( percentile - exact <= exact / 16u );
+}
+
+} // anon namespace
+
+void utc_dali_frame_time_histogram_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_frame_time_histogram_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+/**
+ * @brief An empty histogram reports zero.
+ */
+int UtcDaliFrameTimeHistogramEmpty(void)
+{
+  FrameTimeHistogram histogram;
+
+  DALI_TEST_EQUALS( histogram.GetCount(), 0u, TEST_LOCATION );
+  DALI_TEST_EQUALS( histogram.GetOverBudgetCount(), 0u, TEST_LOCATION );
+  DALI_TEST_EQUALS( histogram.GetMaximum(), 0u, TEST_LOCATION );
+  DALI_TEST_EQUALS( histogram.GetPercentile( 50.0f ), 0u, TEST_LOCATION );
+  DALI_TEST_EQUALS( histogram.GetBudget(), FrameTimeHistogram::DEFAULT_BUDGET, TEST_LOCATION );
+
+  END_TEST;
+}
+
+/**
+ * @brief Percentiles of a uniform spread of durations are reported to within the bucket precision.
+ */
+int UtcDaliFrameTimeHistogramPercentiles(void)
+{
+  FrameTimeHistogram histogram;
+
+  // 1ms to 10ms in 1 microsecond steps
+  for( unsigned int microseconds = 1001u; microseconds <= 11000u; ++microseconds )
+  {
+    histogram.Record( microseconds );
+  }
+
+  DALI_TEST_EQUALS( histogram.GetCount(), 10000u, TEST_LOCATION );
+  DALI_TEST_EQUALS( histogram.GetMaximum(), 11000u, TEST_LOCATION );
+
+  DALI_TEST_CHECK( IsCloseTo( histogram.GetPercentile( 50.0f ), 6000u ) );
+  DALI_TEST_CHECK( IsCloseTo( histogram.GetPercentile( 90.0f ), 10000u ) );
+  DALI_TEST_CHECK( IsCloseTo( histogram.GetPercentile( 99.0f ), 10900u ) );
+  DALI_TEST_EQUALS( histogram.GetPercentile( 100.0f ), 11000u, TEST_LOCATION );
+
+  // Short durations are exact
+  FrameTimeHistogram shortHistogram;
+  for( unsigned int microseconds = 1u; microseconds <= 10u; ++microseconds )
+  {
+    shortHistogram.Record( microseconds );
+  }
+  DALI_TEST_EQUALS( shortHistogram.GetPercentile( 50.0f ), 5u, TEST_LOCATION );
+  DALI_TEST_EQUALS( shortHistogram.GetPercentile( 99.0f ), 10u, TEST_LOCATION );
+
+  END_TEST;
+}
+
+/**
+ * @brief A few janky frames show up in the tail percentiles and the over budget count, but not the median.
+ */
+int UtcDaliFrameTimeHistogramJank(void)
+{
+  FrameTimeHistogram histogram;
+
+  for( unsigned int frame = 0u; frame < 1000u; ++frame )
+  {
+    histogram.Record( frame % 100u == 0u ? 50000u : 8000u );
+  }
+
+  DALI_TEST_EQUALS( histogram.GetOverBudgetCount(), 10u, TEST_LOCATION );
+  DALI_TEST_CHECK( IsCloseTo( histogram.GetPercentile( 50.0f ), 8000u ) );
+  DALI_TEST_CHECK( IsCloseTo( histogram.GetPercentile( 98.0f ), 8000u ) );
+  DALI_TEST_CHECK( IsCloseTo( histogram.GetPercentile( 99.9f ), 50000u ) );
+
+  // A very long duration is counted with the longest, and reported exactly as the maximum
+  histogram.Record( 1000000000u );
+  DALI_TEST_EQUALS( histogram.GetPercentile( 100.0f ), 1000000000u, TEST_LOCATION );
+
+  histogram.Reset();
+  DALI_TEST_EQUALS( histogram.GetCount(), 0u, TEST_LOCATION );
+  DALI_TEST_EQUALS( histogram.GetOverBudgetCount(), 0u, TEST_LOCATION );
+  DALI_TEST_EQUALS( histogram.GetPercentile( 99.0f ), 0u, TEST_LOCATION );
+
+  END_TEST;
+}
+
+/**
+ * @brief FrameTimeStats calculates the mean and standard deviation without storing the times, and records them in its histogram.
+ */
+int UtcDaliFrameTimeStatsMeanAndHistogram(void)
+{
+  FrameTimeStats stats;
+
+  // Alternate 10ms and 20ms
+  uint64_t time = 1000000u;
+  for( unsigned int i = 0u; i < 10u; ++i )
+  {
+    stats.StartTime( FrameTimeStamp( 0, time ) );
+    time += ( i % 2u ) ? 20000u : 10000u;
+    stats.EndTime( FrameTimeStamp( 0, time ) );
+  }
+
+  float mean, standardDeviation;
+  stats.CalculateMean( mean, standardDeviation );
+  DALI_TEST_EQUALS( mean, 0.015f, 0.00001f, TEST_LOCATION );
+  DALI_TEST_EQUALS( standardDeviation, 0.005f, 0.00001f, TEST_LOCATION );
+  DALI_TEST_EQUALS( stats.GetRunCount(), 10u, TEST_LOCATION );
+
+  DALI_TEST_EQUALS( stats.GetPeriodHistogram().GetCount(), 10u, TEST_LOCATION );
+
+  // The histogram of all the times is kept after a reset, the histogram of the period is not
+  stats.Reset();
+  stats.CalculateMean( mean, standardDeviation );
+  DALI_TEST_EQUALS( mean, 0.0f, TEST_LOCATION );
+  DALI_TEST_EQUALS( stats.GetHistogram().GetCount(), 10u, TEST_LOCATION );
+  DALI_TEST_EQUALS( stats.GetHistogram().GetOverBudgetCount(), 5u, TEST_LOCATION );
+  DALI_TEST_EQUALS( stats.GetPeriodHistogram().GetCount(), 0u, TEST_LOCATION );
+  DALI_TEST_EQUALS( stats.GetPeriodHistogram().GetOverBudgetCount(), 0u, TEST_LOCATION );
+
+  END_TEST;
+}
+
+/**
+ * @brief Laps from one time stamp to the next are recorded, except those longer than the maximum, as when the thread sleeps.
+ */
+int UtcDaliFrameTimeStatsLapTime(void)
+{
+  FrameTimeStats stats;
+  const unsigned int MAXIMUM_LAP_TIME = 4u * FrameTimeHistogram::DEFAULT_BUDGET;
+
+  // The first time stamp only starts a lap
+  uint64_t time = 1000000u;
+  stats.LapTime( FrameTimeStamp( 0, time ), MAXIMUM_LAP_TIME );
+  DALI_TEST_EQUALS( stats.GetRunCount(), 0u, TEST_LOCATION );
+
+  for( unsigned int i = 0u; i < 5u; ++i )
+  {
+    time += 16000u;
+    stats.LapTime( FrameTimeStamp( 0, time ), MAXIMUM_LAP_TIME );
+  }
+  DALI_TEST_EQUALS( stats.GetRunCount(), 5u, TEST_LOCATION );
+
+  // Two seconds asleep is not a frame, but the next lap starts when it ends
+  time += 2000000u;
+  stats.LapTime( FrameTimeStamp( 0, time ), MAXIMUM_LAP_TIME );
+  time += 16000u;
+  stats.LapTime( FrameTimeStamp( 0, time ), MAXIMUM_LAP_TIME );
+
+  DALI_TEST_EQUALS( stats.GetRunCount(), 6u, TEST_LOCATION );
+  DALI_TEST_EQUALS( stats.GetMaxTime(), 0.016f, 0.00001f, TEST_LOCATION );
+  DALI_TEST_EQUALS( stats.GetHistogram().GetOverBudgetCount(), 0u, TEST_LOCATION );
+  DALI_TEST_CHECK( IsCloseTo( stats.GetHistogram().GetMaximum(), 16000u ) );
+
+  END_TEST;
+}
@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <stdint.h>
+#include <dali-test-suite-utils.h>
+#include <dali/integration-api/gl-defines.h>
+
+#include "adaptors/common/gl/gl-frame-recorder.h"
+
+using namespace Dali;
+using namespace Dali::Internal::Adaptor;
+
+namespace
+{
+
+/**
+ * @brief The calls a simple screen might make to render a frame.
+ */
+void RenderScreen( GlFrameRecorder& recorder, unsigned int actorCount )
+{
+  for( unsigned int i = 0; i < actorCount; ++i )
+  {
+    recorder.StateChange();   // UseProgram
+    recorder.StateChange();   // BindTexture
+    recorder.UniformCall();
+    recorder.UniformCall();
+    recorder.DrawCall();
+  }
+}
+
+} // anon namespace
+
+void utc_dali_gl_frame_recorder_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_gl_frame_recorder_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+/**
+ * @brief Nothing is counted until the first frame ends.
+ */
+int UtcDaliGlFrameRecorderNoFrame(void)
+{
+  GlFrameRecorder recorder;
+  recorder.DrawCall();
+
+  GlStatistics::Frame frame;
+  recorder.GetLastFrame( frame );
+  DALI_TEST_EQUALS( frame.frameNumber, 0u, TEST_LOCATION );
+  DALI_TEST_EQUALS( frame.drawCalls, 0u, TEST_LOCATION );
+
+  END_TEST;
+}
+
+/**
+ * @brief The counts are per frame, and only change when a frame ends.
+ */
+int UtcDaliGlFrameRecorderPerFrame(void)
+{
+  GlFrameRecorder recorder;
+
+  RenderScreen( recorder, 10u );
+  recorder.EndFrame( 2u, 5u, 1u );
+
+  GlStatistics::Frame frame;
+  recorder.GetLastFrame( frame );
+  DALI_TEST_EQUALS( frame.frameNumber, 0u, TEST_LOCATION );
+  DALI_TEST_EQUALS( frame.drawCalls, 10u, TEST_LOCATION );
+  DALI_TEST_EQUALS( frame.stateChanges, 20u, TEST_LOCATION );
+  DALI_TEST_EQUALS( frame.uniformCalls, 20u, TEST_LOCATION );
+  DALI_TEST_EQUALS( frame.bufferCount, 2u, TEST_LOCATION );
+  DALI_TEST_EQUALS( frame.textureCount, 5u, TEST_LOCATION );
+  DALI_TEST_EQUALS( frame.programCount, 1u, TEST_LOCATION );
+
+  // The next frame is counted from zero, and is not visible until it ends
+  RenderScreen( recorder, 3u );
+  recorder.GetLastFrame( frame );
+  DALI_TEST_EQUALS( frame.drawCalls, 10u, TEST_LOCATION );
+
+  recorder.EndFrame( 2u, 5u, 1u );
+  recorder.GetLastFrame( frame );
+  DALI_TEST_EQUALS( frame.frameNumber, 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( frame.drawCalls, 3u, TEST_LOCATION );
+  DALI_TEST_EQUALS( frame.stateChanges, 6u, TEST_LOCATION );
+  DALI_TEST_EQUALS( frame.textureUploads, 0u, TEST_LOCATION );
+
+  END_TEST;
+}
+
+/**
+ * @brief Texture and buffer uploads are counted along with their size.
+ */
+int UtcDaliGlFrameRecorderUploads(void)
+{
+  GlFrameRecorder recorder;
+
+  recorder.TextureUpload( 64, 32, GL_RGBA, GL_UNSIGNED_BYTE );
+  recorder.TextureUpload( 10, 10, GL_RGB, GL_UNSIGNED_SHORT_5_6_5 );
+  recorder.CompressedTextureUpload( 1000 );
+  recorder.BufferUpload( 256 );
+  recorder.BufferUpload( 64 );
+  recorder.EndFrame( 0u, 0u, 0u );
+
+  GlStatistics::Frame frame;
+  recorder.GetLastFrame( frame );
+  DALI_TEST_EQUALS( frame.textureUploads, 3u, TEST_LOCATION );
+  DALI_TEST_EQUALS( frame.textureUploadBytes, uint64_t( 64 * 32 * 4 + 10 * 10 * 2 + 1000 ), TEST_LOCATION );
+  DALI_TEST_EQUALS( frame.bufferUploads, 2u, TEST_LOCATION );
+  DALI_TEST_EQUALS( frame.bufferUploadBytes, uint64_t( 320 ), TEST_LOCATION );
+
+  END_TEST;
+}
+
+/**
+ * @brief The size of uncompressed pixel data depends on the format and type.
+ */
+int UtcDaliGlFrameRecorderPixelDataSize(void)
+{
+  DALI_TEST_EQUALS( GlFrameRecorder::GetPixelDataSize( 4, 4, GL_ALPHA, GL_UNSIGNED_BYTE ), uint64_t( 16 ), TEST_LOCATION );
+  DALI_TEST_EQUALS( GlFrameRecorder::GetPixelDataSize( 4, 4, GL_LUMINANCE_ALPHA, GL_UNSIGNED_BYTE ), uint64_t( 32 ), TEST_LOCATION );
+  DALI_TEST_EQUALS( GlFrameRecorder::GetPixelDataSize( 4, 4, GL_RGB, GL_UNSIGNED_BYTE ), uint64_t( 48 ), TEST_LOCATION );
+  DALI_TEST_EQUALS( GlFrameRecorder::GetPixelDataSize( 4, 4, GL_RGBA, GL_UNSIGNED_SHORT_4_4_4_4 ), uint64_t( 32 ), TEST_LOCATION );
+  DALI_TEST_EQUALS( GlFrameRecorder::GetPixelDataSize( 4, 4, GL_RGBA, GL_FLOAT ), uint64_t( 256 ), TEST_LOCATION );
+  DALI_TEST_EQUALS( GlFrameRecorder::GetPixelDataSize( 0, 4, GL_RGBA, GL_UNSIGNED_BYTE ), uint64_t( 0 ), TEST_LOCATION );
+
+  END_TEST;
+}
+
+/**
+ * @brief The test GL abstraction counts a TestApplication's calls as the adaptor's GL proxy does.
+ */
+int UtcDaliGlFrameRecorderTestApplication(void)
+{
+  TestApplication application;
+  TestGlAbstraction& gl = application.GetGlAbstraction();
+
+  const unsigned int ACTOR_COUNT = 5u;
+  for( unsigned int i = 0; i < ACTOR_COUNT; ++i )
+  {
+    Actor actor = CreateRenderableActor();
+    actor.SetSize( 10.0f, 10.0f );
+    Stage::GetCurrent().Add( actor );
+  }
+
+  application.SendNotification();
+  application.Render();
+
+  // Count the draw calls of the next frame only
+  gl.EnableDrawCallTrace( true );
+  gl.ResetDrawCallStack();
+  application.SendNotification();
+  application.Render();
+
+  GlStatistics::Frame frame;
+  gl.GetFrameRecorder().GetLastFrame( frame );
+  const unsigned int drawCalls = gl.GetDrawTrace().CountMethod( "DrawElements" ) + gl.GetDrawTrace().CountMethod( "DrawArrays" );
+  DALI_TEST_CHECK( frame.frameNumber > 0u );
+  DALI_TEST_EQUALS( frame.drawCalls, drawCalls, TEST_LOCATION );
+  DALI_TEST_CHECK( frame.drawCalls >= ACTOR_COUNT );
+  DALI_TEST_CHECK( frame.stateChanges > 0u );
+  DALI_TEST_CHECK( frame.uniformCalls > 0u );
+  DALI_TEST_CHECK( frame.programCount > 0u );
+
+  END_TEST;
+}
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <stdint.h>
+#include <dali-test-suite-utils.h>
+#include <dali/internal/text-abstraction/glyph-metrics-cache.h>
+
+using Dali::TextAbstraction::Internal::GlyphMetricsCache;
+
+namespace
+{
+
+/**
+ * @brief Metrics which differ for each glyph.
+ */
+GlyphMetricsCache::Metrics GetMetrics( uint32_t fontId, uint32_t glyphIndex )
+{
+  const float value = static_cast< float >( fontId * 1000u + glyphIndex );
+
+  GlyphMetricsCache::Metrics metrics;
+  metrics.width = value;
+  metrics.height = value + 0.1f;
+  metrics.horizontalXBearing = value + 0.2f;
+  metrics.horizontalYBearing = value + 0.3f;
+  metrics.verticalXBearing = value + 0.4f;
+  metrics.verticalYBearing = value + 0.5f;
+  metrics.advance = value + 0.6f;
+  metrics.scaleFactor = value + 0.7f;
+  return metrics;
+}
+
+} // anon namespace
+
+void utc_dali_glyph_metrics_cache_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_glyph_metrics_cache_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+int UtcDaliGlyphMetricsCacheFind(void)
+{
+  GlyphMetricsCache cache;
+  GlyphMetricsCache::Metrics metrics;
+  DALI_TEST_CHECK( !cache.Find( 1u, 1u, metrics ) );
+
+  // The same glyph indices in several fonts
+  for( uint32_t fontId = 1u; fontId <= 4u; ++fontId )
+  {
+    for( uint32_t glyphIndex = 0u; glyphIndex < 200u; ++glyphIndex )
+    {
+      cache.Add( fontId, glyphIndex, GetMetrics( fontId, glyphIndex ) );
+    }
+  }
+  DALI_TEST_EQUALS( cache.GetCount(), 800u, TEST_LOCATION );
+
+  for( uint32_t fontId = 1u; fontId <= 4u; ++fontId )
+  {
+    for( uint32_t glyphIndex = 0u; glyphIndex < 200u; ++glyphIndex )
+    {
+      const GlyphMetricsCache::Metrics expected = GetMetrics( fontId, glyphIndex );
+      DALI_TEST_CHECK( cache.Find( fontId, glyphIndex, metrics ) );
+      DALI_TEST_EQUALS( metrics.width, expected.width, TEST_LOCATION );
+      DALI_TEST_EQUALS( metrics.height, expected.height, TEST_LOCATION );
+      DALI_TEST_EQUALS( metrics.horizontalXBearing, expected.horizontalXBearing, TEST_LOCATION );
+      DALI_TEST_EQUALS( metrics.horizontalYBearing, expected.horizontalYBearing, TEST_LOCATION );
+      DALI_TEST_EQUALS( metrics.verticalXBearing, expected.verticalXBearing, TEST_LOCATION );
+      DALI_TEST_EQUALS( metrics.verticalYBearing, expected.verticalYBearing, TEST_LOCATION );
+      DALI_TEST_EQUALS( metrics.advance, expected.advance, TEST_LOCATION );
+      DALI_TEST_EQUALS( metrics.scaleFactor, expected.scaleFactor, TEST_LOCATION );
+    }
+  }
+
+  DALI_TEST_CHECK( !cache.Find( 5u, 0u, metrics ) );
+  DALI_TEST_CHECK( !cache.Find( 1u, 200u, metrics ) );
+
+  END_TEST;
+}
+
+int UtcDaliGlyphMetricsCacheClear(void)
+{
+  GlyphMetricsCache cache;
+  cache.Add( 1u, 42u, GetMetrics( 1u, 42u ) );
+
+  GlyphMetricsCache::Metrics metrics;
+  DALI_TEST_CHECK( cache.Find( 1u, 42u, metrics ) );
+
+  cache.Clear();
+  DALI_TEST_EQUALS( cache.GetCount(), 0u, TEST_LOCATION );
+  DALI_TEST_CHECK( !cache.Find( 1u, 42u, metrics ) );
+
+  // The cache is filled again after being cleared
+  cache.Add( 1u, 42u, GetMetrics( 1u, 43u ) );
+  DALI_TEST_CHECK( cache.Find( 1u, 42u, metrics ) );
+  DALI_TEST_EQUALS( metrics.width, GetMetrics( 1u, 43u ).width, TEST_LOCATION );
+
+  END_TEST;
+}
@@ -0,0 +1,288 @@
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+#include <dali-test-suite-utils.h>
+#include <dali/internal/text-abstraction/font-client-plugin-impl.h>
+#include <dali/internal/text-abstraction/hash-index.h>
+#include <dali/internal/text-abstraction/interned-strings.h>
+
+#include "test-timing.h"
+
+using namespace Dali;
+using Dali::TextAbstraction::Internal::HashIndex;
+using Dali::TextAbstraction::Internal::InternedStrings;
+
+namespace
+{
+
+/**
+ * @brief Collect every index added with a hash.
+ */
+std::vector< uint32_t > FindAll( const HashIndex& hashIndex, uint32_t hash )
+{
+  std::vector< uint32_t > indices;
+  uint32_t slot = HashIndex::START;
+  uint32_t index = 0u;
+  while( hashIndex.Find( hash, slot, index ) )
+  {
+    indices.push_back( index );
+  }
+  return indices;
+}
+
+typedef TextAbstraction::Internal::FontClient::Plugin FontClientPlugin;
+
+const unsigned int DPI = 96u; ///< The resolution the font client plugins are created with.
+
+/**
+ * @brief A font cached by the font client, with the keys it's looked up by.
+ */
+struct CachedFont
+{
+  TextAbstraction::FontDescription description; ///< The description the font was created from.
+  TextAbstraction::FontPath path;               ///< The path to the font file, as described by the font client.
+  TextAbstraction::PointSize26Dot6 pointSize;   ///< The requested point size.
+  TextAbstraction::FontId fontId;               ///< The font id.
+};
+
+/**
+ * @brief Caches the system fonts at increasing point sizes until there are @p cacheSize, or the attempts run out.
+ *
+ * @param[in] plugin The font client plugin.
+ * @param[in] systemFonts The fonts of the system.
+ * @param[in] cacheSize The number of fonts to cache.
+ * @param[in,out] attempt The number of fonts tried so far.
+ * @param[in,out] fonts The fonts cached so far.
+ */
+void CacheFonts( FontClientPlugin& plugin,
+                 const TextAbstraction::FontList& systemFonts,
+                 std::size_t cacheSize,
+                 unsigned int& attempt,
+                 std::vector< CachedFont >& fonts )
+{
+  // Some system fonts only have fixed sizes and aren't created at others
+  const unsigned int maximumAttempts = 4u * cacheSize;
+
+  for( ; ( fonts.size() < cacheSize ) && ( attempt < maximumAttempts ); ++attempt )
+  {
+    CachedFont font;
+    font.description = systemFonts[attempt % systemFonts.size()];
+    font.pointSize = 640u + 64u * ( attempt / systemFonts.size() );
+    font.fontId = plugin.GetFontId( font.description, font.pointSize, font.pointSize, 0u );
+    if( 0u != font.fontId )
+    {
+      TextAbstraction::FontDescription description;
+      plugin.GetDescription( font.fontId, description );
+      font.path = description.path;
+      fonts.push_back( font );
+    }
+  }
+}
+
+} // anon namespace
+
+void utc_dali_hash_index_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_hash_index_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+/**
+ * @brief Every index added with a hash is found, including those sharing it with others, across the table growing.
+ */
+int UtcDaliHashIndexFind(void)
+{
+  HashIndex hashIndex;
+  std::vector< uint32_t > indices = FindAll( hashIndex, 7u );
+  DALI_TEST_EQUALS( indices.size(), std::size_t( 0u ), TEST_LOCATION );
+
+  // Enough to grow the table several times
+  for( uint32_t index = 0u; index < 1000u; ++index )
+  {
+    hashIndex.Add( index % 100u, index );
+  }
+  DALI_TEST_EQUALS( hashIndex.GetCount(), 1000u, TEST_LOCATION );
+
+  for( uint32_t hash = 0u; hash < 100u; ++hash )
+  {
+    indices = FindAll( hashIndex, hash );
+    DALI_TEST_EQUALS( indices.size(), std::size_t( 10u ), TEST_LOCATION );
+    for( std::vector< uint32_t >::const_iterator it = indices.begin(); it != indices.end(); ++it )
+    {
+      DALI_TEST_EQUALS( *it % 100u, hash, TEST_LOCATION );
+    }
+  }
+  indices = FindAll( hashIndex, 100u );
+  DALI_TEST_EQUALS( indices.size(), std::size_t( 0u ), TEST_LOCATION );
+
+  hashIndex.Clear();
+  DALI_TEST_EQUALS( hashIndex.GetCount(), 0u, TEST_LOCATION );
+  indices = FindAll( hashIndex, 1u );
+  DALI_TEST_EQUALS( indices.size(), std::size_t( 0u ), TEST_LOCATION );
+
+  END_TEST;
+}
+
+/**
+ * @brief Each different string gets an id, and the same string the same id.
+ */
+int UtcDaliHashIndexInternedStrings(void)
+{
+  InternedStrings strings;
+
+  const uint32_t sans = strings.Intern( "Sans" );
+  const uint32_t serif = strings.Intern( "Serif" );
+  DALI_TEST_CHECK( sans != serif );
+  DALI_TEST_EQUALS( strings.Intern( std::string( "Sans" ) ), sans, TEST_LOCATION );
+  DALI_TEST_EQUALS( strings.GetCount(), 2u, TEST_LOCATION );
+  DALI_TEST_EQUALS( strings.Get( serif ), std::string( "Serif" ), TEST_LOCATION );
+
+  uint32_t id = 0u;
+  DALI_TEST_CHECK( strings.Find( "Serif", id ) );
+  DALI_TEST_EQUALS( id, serif, TEST_LOCATION );
+
+  // Finding doesn't add
+  DALI_TEST_CHECK( !strings.Find( "Mono", id ) );
+  DALI_TEST_EQUALS( strings.GetCount(), 2u, TEST_LOCATION );
+
+  END_TEST;
+}
+
+/**
+ * @brief Fonts cached by the font client are found again from their ids, their descriptions and their paths,
+ * as the caches and their indices grow.
+ */
+int UtcDaliHashIndexFontClientRoundTrip(void)
+{
+  const std::size_t CACHE_SIZE = 256u;
+
+  FontClientPlugin plugin( DPI, DPI );
+  TextAbstraction::FontList systemFonts;
+  plugin.GetSystemFonts( systemFonts );
+  DALI_TEST_CHECK( !systemFonts.empty() );
+
+  std::vector< CachedFont > fonts;
+  unsigned int attempt = 0u;
+  CacheFonts( plugin, systemFonts, CACHE_SIZE, attempt, fonts );
+  DALI_TEST_CHECK( !fonts.empty() );
+
+  // Checked once all are cached, so the first fonts are found through indices grown since they were added
+  for( std::vector< CachedFont >::const_iterator it = fonts.begin(); it != fonts.end(); ++it )
+  {
+    const CachedFont& font = *it;
+
+    DALI_TEST_EQUALS( plugin.GetPointSize( font.fontId ), font.pointSize, TEST_LOCATION );
+
+    TextAbstraction::FontDescription description;
+    plugin.GetDescription( font.fontId, description );
+    DALI_TEST_EQUALS( description.path, font.path, TEST_LOCATION );
+    DALI_TEST_CHECK( !description.path.empty() );
+
+    DALI_TEST_EQUALS( plugin.GetFontId( font.description, font.pointSize, font.pointSize, 0u ), font.fontId, TEST_LOCATION );
+    DALI_TEST_EQUALS( plugin.GetFontId( description.path, font.pointSize, font.pointSize, 0u ), font.fontId, TEST_LOCATION );
+  }
+
+  END_TEST;
+}
+
+/**
+ * @brief The time the font client takes to find a font by its path, by its description and to find
+ * the fallback font of a font, against the number of fonts cached.
+ */
+int UtcDaliHashIndexFontClientBenchmark(void)
+{
+  const std::size_t CACHE_SIZES[] = { 16u, 64u, 256u, 1024u };
+  const unsigned int NUMBER_OF_CACHE_SIZES = sizeof( CACHE_SIZES ) / sizeof( std::size_t );
+  const unsigned int LOOKUPS = 10000u;
+  const TextAbstraction::Character CHARACTER = 0x41;
+
+  FontClientPlugin plugin( DPI, DPI );
+  TextAbstraction::FontList systemFonts;
+  plugin.GetSystemFonts( systemFonts );
+  DALI_TEST_CHECK( !systemFonts.empty() );
+
+  std::vector< CachedFont > fonts;
+  unsigned int attempt = 0u;
+  for( unsigned int sizeIndex = 0u; sizeIndex < NUMBER_OF_CACHE_SIZES; ++sizeIndex )
+  {
+    CacheFonts( plugin, systemFonts, CACHE_SIZES[sizeIndex], attempt, fonts );
+    if( fonts.size() < CACHE_SIZES[sizeIndex] )
+    {
+      tet_printf( "Only %u fonts cached from %u system fonts\n", static_cast< unsigned int >( fonts.size() ), static_cast< unsigned int >( systemFonts.size() ) );
+      break;
+    }
+
+    // The fonts looked up spread over the cache
+    std::vector< unsigned int > keys( LOOKUPS );
+    for( unsigned int lookup = 0u; lookup < LOOKUPS; ++lookup )
+    {
+      keys[lookup] = ( lookup * 2654435761u ) % fonts.size();
+    }
+
+    // The first fallback font lookup of a description matches the system fonts, so isn't timed
+    std::vector< TextAbstraction::FontId > fallbackFontIds( fonts.size() );
+    for( unsigned int index = 0u; index < fonts.size(); ++index )
+    {
+      fallbackFontIds[index] = plugin.FindFallbackFont( fonts[index].fontId, CHARACTER, fonts[index].pointSize, false );
+    }
+
+    unsigned int found = 0u;
+    uint64_t start = GetNanoseconds();
+    for( unsigned int lookup = 0u; lookup < LOOKUPS; ++lookup )
+    {
+      const CachedFont& font = fonts[keys[lookup]];
+      found += ( plugin.GetFontId( font.path, font.pointSize, font.pointSize, 0u ) == font.fontId ) ? 1u : 0u;
+    }
+    const uint64_t pathTime = GetNanoseconds() - start;
+    DALI_TEST_EQUALS( found, LOOKUPS, TEST_LOCATION );
+
+    found = 0u;
+    start = GetNanoseconds();
+    for( unsigned int lookup = 0u; lookup < LOOKUPS; ++lookup )
+    {
+      const CachedFont& font = fonts[keys[lookup]];
+      found += ( plugin.GetFontId( font.description, font.pointSize, font.pointSize, 0u ) == font.fontId ) ? 1u : 0u;
+    }
+    const uint64_t descriptionTime = GetNanoseconds() - start;
+    DALI_TEST_EQUALS( found, LOOKUPS, TEST_LOCATION );
+
+    found = 0u;
+    start = GetNanoseconds();
+    for( unsigned int lookup = 0u; lookup < LOOKUPS; ++lookup )
+    {
+      const CachedFont& font = fonts[keys[lookup]];
+      found += ( plugin.FindFallbackFont( font.fontId, CHARACTER, font.pointSize, false ) == fallbackFontIds[keys[lookup]] ) ? 1u : 0u;
+    }
+    const uint64_t fallbackTime = GetNanoseconds() - start;
+    DALI_TEST_EQUALS( found, LOOKUPS, TEST_LOCATION );
+
+    tet_printf( "%5u fonts cached: by path %7.1f ns, by description %7.1f ns, fallback font %7.1f ns per lookup\n",
+                static_cast< unsigned int >( fonts.size() ),
+                static_cast< double >( pathTime ) / LOOKUPS,
+                static_cast< double >( descriptionTime ) / LOOKUPS,
+                static_cast< double >( fallbackTime ) / LOOKUPS );
+  }
+
+  END_TEST;
+}
@@ -17,6 +17,7 @@
 
 #include <dali-test-suite-utils.h>
 #include "platform-abstractions/portable/image-operations.h"
+#include "platform-abstractions/portable/image-operations-simd.h"
 #include <dali/devel-api/common/ref-counted-dali-vector.h>
 
 #include <sys/mman.h>
@@ -1522,3 +1523,230 @@ int UtcDaliImageOperationsBilinearFilter1BPP(void)
 
   END_TEST;
 }
+
+namespace
+{
+
+typedef void (*HalveScanlineFunction)( unsigned char * const pixels, const unsigned int width );
+typedef void (*AverageScanlinesFunction)( const unsigned char * const scanline1, const unsigned char * const __restrict__ scanline2, unsigned char * const outputScanline, const unsigned int width );
+typedef void (*LinearSampleScanlineFunction)( const unsigned char * __restrict__ inScanline1, const unsigned char * __restrict__ inScanline2, unsigned int inputYWeight,
+                                              const unsigned int * columns1, const unsigned int * columns2, const unsigned int * columnWeights,
+                                              unsigned char * __restrict__ outScanline, unsigned int desiredWidth );
+
+/**
+ * @brief Fill a buffer with random bytes, leaving it 4-byte aligned for the pixel kernels.
+ */
+void SetupRandomBytes( size_t numBytes, Dali::Vector<uint32_t>& buffer )
+{
+  buffer.Resize( numBytes / 4u + 1u );
+  for( size_t word = 0; word < buffer.Count(); ++word )
+  {
+    buffer[word] = RandomPixelRGBA8888();
+  }
+}
+
+/**
+ * @brief Check a vectorised scanline halving kernel matches the scalar one at many widths.
+ */
+void TestSimdHalveScanlineMatchesScalar( HalveScanlineFunction simdHalve, HalveScanlineFunction scalarHalve, unsigned int bytesPerPixel, const char * const location )
+{
+  for( unsigned int width = 2u; width < 131u; ++width )
+  {
+    Dali::Vector<uint32_t> simdScanline;
+    SetupRandomBytes( width * bytesPerPixel, simdScanline );
+    Dali::Vector<uint32_t> scalarScanline = simdScanline;
+
+    simdHalve( reinterpret_cast<unsigned char*>( &simdScanline[0] ), width );
+    scalarHalve( reinterpret_cast<unsigned char*>( &scalarScanline[0] ), width );
+
+    DALI_TEST_EQUALS( memcmp( &simdScanline[0], &scalarScanline[0], ( width / 2u ) * bytesPerPixel ), 0, location );
+  }
+}
+
+/**
+ * @brief Check a vectorised scanline averaging kernel matches the scalar one at many widths, both out of place and in place.
+ */
+void TestSimdAverageScanlinesMatchesScalar( AverageScanlinesFunction simdAverage, AverageScanlinesFunction scalarAverage, unsigned int bytesPerPixel, const char * const location )
+{
+  for( unsigned int width = 1u; width < 131u; ++width )
+  {
+    Dali::Vector<uint32_t> scanline1;
+    Dali::Vector<uint32_t> scanline2;
+    SetupRandomBytes( width * bytesPerPixel, scanline1 );
+    SetupRandomBytes( width * bytesPerPixel, scanline2 );
+    Dali::Vector<uint32_t> simdOutput;
+    Dali::Vector<uint32_t> scalarOutput;
+    simdOutput.Resize( scanline1.Count(), 0u );
+    scalarOutput.Resize( scanline1.Count(), 0u );
+
+    simdAverage( reinterpret_cast<const unsigned char*>( &scanline1[0] ), reinterpret_cast<const unsigned char*>( &scanline2[0] ), reinterpret_cast<unsigned char*>( &simdOutput[0] ), width );
+    scalarAverage( reinterpret_cast<const unsigned char*>( &scanline1[0] ), reinterpret_cast<const unsigned char*>( &scanline2[0] ), reinterpret_cast<unsigned char*>( &scalarOutput[0] ), width );
+    DALI_TEST_EQUALS( memcmp( &simdOutput[0], &scalarOutput[0], width * bytesPerPixel ), 0, location );
+
+    // The box filter averages into the first of the two scanlines:
+    simdOutput = scanline1;
+    scalarOutput = scanline1;
+    simdAverage( reinterpret_cast<const unsigned char*>( &simdOutput[0] ), reinterpret_cast<const unsigned char*>( &scanline2[0] ), reinterpret_cast<unsigned char*>( &simdOutput[0] ), width );
+    scalarAverage( reinterpret_cast<const unsigned char*>( &scalarOutput[0] ), reinterpret_cast<const unsigned char*>( &scanline2[0] ), reinterpret_cast<unsigned char*>( &scalarOutput[0] ), width );
+    DALI_TEST_EQUALS( memcmp( &simdOutput[0], &scalarOutput[0], width * bytesPerPixel ), 0, location );
+  }
+}
+
+/**
+ * @brief Check a vectorised bilinear scanline kernel matches BilinearFilter1Component() for every component.
+ */
+void TestSimdLinearSampleScanlineMatchesScalar( LinearSampleScanlineFunction simdSample, unsigned int bytesPerPixel, const char * const location )
+{
+  const unsigned int inputWidth = 37u;
+  const unsigned int desiredWidth = 67u;
+
+  Dali::Vector<uint32_t> inScanline1;
+  Dali::Vector<uint32_t> inScanline2;
+  SetupRandomBytes( inputWidth * bytesPerPixel, inScanline1 );
+  SetupRandomBytes( inputWidth * bytesPerPixel, inScanline2 );
+  const uint8_t* const in1 = reinterpret_cast<const uint8_t*>( &inScanline1[0] );
+  const uint8_t* const in2 = reinterpret_cast<const uint8_t*>( &inScanline2[0] );
+
+  Dali::Vector<unsigned int> columns1;
+  Dali::Vector<unsigned int> columns2;
+  Dali::Vector<unsigned int> columnWeights;
+  columns1.Resize( desiredWidth );
+  columns2.Resize( desiredWidth );
+  columnWeights.Resize( desiredWidth );
+
+  Dali::Vector<uint8_t> output;
+  output.Resize( desiredWidth * bytesPerPixel );
+
+  // Include the extreme weights along with random ones:
+  const unsigned int yWeights[] = { 0u, 65535u, 32768u, RandomInRange( 65535u ), RandomInRange( 65535u ) };
+  for( unsigned int y = 0; y < sizeof(yWeights) / sizeof(yWeights[0]); ++y )
+  {
+    for( unsigned int outX = 0; outX < desiredWidth; ++outX )
+    {
+      columns1[outX] = RandomInRange( inputWidth - 1u );
+      columns2[outX] = columns1[outX] + 1u < inputWidth ? columns1[outX] + 1u : columns1[outX];
+      columnWeights[outX] = outX < 2u ? outX * 65535u : RandomInRange( 65535u );
+    }
+
+    simdSample( in1, in2, yWeights[y], &columns1[0], &columns2[0], &columnWeights[0], &output[0], desiredWidth );
+
+    size_t numMatches = 0;
+    for( unsigned int outX = 0; outX < desiredWidth; ++outX )
+    {
+      for( unsigned int component = 0; component < bytesPerPixel; ++component )
+      {
+        const unsigned int left = columns1[outX] * bytesPerPixel + component;
+        const unsigned int right = columns2[outX] * bytesPerPixel + component;
+        const unsigned int expected = BilinearFilter1Component( in1[left], in1[right], in2[left], in2[right], columnWeights[outX], yWeights[y] );
+        numMatches += expected == output[outX * bytesPerPixel + component] ? 1u : 0u;
+      }
+    }
+    DALI_TEST_EQUALS( numMatches, size_t( desiredWidth * bytesPerPixel ), location );
+  }
+}
+
+} // namespace
+
+/**
+ * @brief Test the vectorised scanline halving kernels are bit-exact with the scalar ones.
+ */
+int UtcDaliImageOperationsSimdHalveScanlines(void)
+{
+  if( !Simd::IsAvailable() )
+  {
+    tet_printf( "No vector unit available, so only the scalar kernels are in use.\n" );
+    DALI_TEST_EQUALS( Simd::GetVectorUnit(), Simd::VECTOR_UNIT_NONE, TEST_LOCATION );
+    END_TEST;
+  }
+
+  TestSimdHalveScanlineMatchesScalar( Simd::HalveScanlineInPlaceRGB888, HalveScanlineInPlaceRGB888, 3u, TEST_LOCATION );
+  TestSimdHalveScanlineMatchesScalar( Simd::HalveScanlineInPlaceRGBA8888, HalveScanlineInPlaceRGBA8888, 4u, TEST_LOCATION );
+  TestSimdHalveScanlineMatchesScalar( Simd::HalveScanlineInPlaceRGB565, HalveScanlineInPlaceRGB565, 2u, TEST_LOCATION );
+  TestSimdHalveScanlineMatchesScalar( Simd::HalveScanlineInPlace2Bytes, HalveScanlineInPlace2Bytes, 2u, TEST_LOCATION );
+  TestSimdHalveScanlineMatchesScalar( Simd::HalveScanlineInPlace1Byte, HalveScanlineInPlace1Byte, 1u, TEST_LOCATION );
+
+  END_TEST;
+}
+
+/**
+ * @brief Test the vectorised scanline averaging kernels are bit-exact with the scalar ones.
+ */
+int UtcDaliImageOperationsSimdAverageScanlines(void)
+{
+  if( !Simd::IsAvailable() )
+  {
+    tet_printf( "No vector unit available, so only the scalar kernels are in use.\n" );
+    DALI_TEST_EQUALS( Simd::GetVectorUnit(), Simd::VECTOR_UNIT_NONE, TEST_LOCATION );
+    END_TEST;
+  }
+
+  TestSimdAverageScanlinesMatchesScalar( Simd::AverageScanlines1, AverageScanlines1, 1u, TEST_LOCATION );
+  TestSimdAverageScanlinesMatchesScalar( Simd::AverageScanlines2, AverageScanlines2, 2u, TEST_LOCATION );
+  TestSimdAverageScanlinesMatchesScalar( Simd::AverageScanlines3, AverageScanlines3, 3u, TEST_LOCATION );
+  TestSimdAverageScanlinesMatchesScalar( Simd::AverageScanlinesRGBA8888, AverageScanlinesRGBA8888, 4u, TEST_LOCATION );
+  TestSimdAverageScanlinesMatchesScalar( Simd::AverageScanlinesRGB565, AverageScanlinesRGB565, 2u, TEST_LOCATION );
+
+  END_TEST;
+}
+
+/**
+ * @brief Test the vectorised bilinear scanline kernels are bit-exact with the scalar four-tap filter.
+ */
+int UtcDaliImageOperationsSimdLinearSampleScanline(void)
+{
+  if( !Simd::IsAvailable() )
+  {
+    tet_printf( "No vector unit available, so only the scalar kernels are in use.\n" );
+    DALI_TEST_EQUALS( Simd::GetVectorUnit(), Simd::VECTOR_UNIT_NONE, TEST_LOCATION );
+    END_TEST;
+  }
+
+  TestSimdLinearSampleScanlineMatchesScalar( Simd::LinearSampleScanline3BPP, 3u, TEST_LOCATION );
+  TestSimdLinearSampleScanlineMatchesScalar( Simd::LinearSampleScanline4BPP, 4u, TEST_LOCATION );
+
+  END_TEST;
+}
+
+/**
+ * @brief Test box filtering scanlines as they arrive matches box filtering the whole image in place.
+ */
+int UtcDaliImageOperationsScanlineBoxFilter(void)
+{
+  const unsigned int width = 317u;
+  const unsigned int height = 203u;
+  Dali::Vector<uint32_t> source;
+  SetupRandomBytes( width * height * 3u, source );
+  const unsigned char * const sourcePixels = reinterpret_cast<const unsigned char*>( &source[0] );
+
+  for( unsigned int halvings = 0; halvings < 6u; ++halvings )
+  {
+    // Box filter the whole image in place:
+    Dali::Vector<uint32_t> reference;
+    reference.Resize( source.Count() );
+    unsigned char * const referencePixels = reinterpret_cast<unsigned char*>( &reference[0] );
+    memcpy( referencePixels, sourcePixels, width * height * 3u );
+    unsigned int referenceWidth = 0, referenceHeight = 0;
+    DownscaleInPlacePow2RGB888( referencePixels, width, height, width >> halvings, height >> halvings, BoxDimensionTestBoth, referenceWidth, referenceHeight );
+
+    DALI_TEST_EQUALS( CalculateBoxFilterHalvings( Pixel::RGB888, ImageDimensions( width, height ), ImageDimensions( width >> halvings, height >> halvings ), FittingMode::SCALE_TO_FILL, SamplingMode::BOX ), halvings, TEST_LOCATION );
+
+    // Box filter it again a scanline at a time:
+    const ImageDimensions outputDimensions = ScanlineBoxFilter::GetOutputDimensions( ImageDimensions( width, height ), halvings );
+    DALI_TEST_EQUALS( outputDimensions.GetWidth(), referenceWidth, TEST_LOCATION );
+    DALI_TEST_EQUALS( outputDimensions.GetHeight(), referenceHeight, TEST_LOCATION );
+
+    Dali::Vector<unsigned char> output;
+    output.Resize( referenceWidth * referenceHeight * 3u );
+    ScanlineBoxFilter filter;
+    DALI_TEST_CHECK( filter.Initialize( Pixel::RGB888, ImageDimensions( width, height ), halvings, &output[0] ) );
+    for( unsigned int y = 0; y < height; ++y )
+    {
+      memcpy( filter.GetInputScanline(), sourcePixels + y * width * 3u, width * 3u );
+      filter.CommitInputScanline();
+    }
+
+    DALI_TEST_EQUALS( memcmp( &output[0], referencePixels, output.Count() ), 0, TEST_LOCATION );
+  }
+
+  END_TEST;
+}
@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <dali-test-suite-utils.h>
+
+#include "platform-abstractions/portable/image-operations.h"
+
+using namespace Dali;
+using namespace Dali::Internal::Platform;
+
+namespace
+{
+
+/** The thread counts to benchmark, in increasing order. */
+const unsigned int THREAD_COUNTS[] = { 1u, 2u, 4u, 8u };
+const unsigned int NUM_THREAD_COUNTS = sizeof(THREAD_COUNTS) / sizeof(THREAD_COUNTS[0]);
+
+const FittingMode::Type FITTING_MODES[] = { FittingMode::SHRINK_TO_FIT, FittingMode::SCALE_TO_FILL, FittingMode::FIT_WIDTH, FittingMode::FIT_HEIGHT };
+const char * const FITTING_MODE_NAMES[] = { "SHRINK_TO_FIT", "SCALE_TO_FILL", "FIT_WIDTH", "FIT_HEIGHT" };
+const unsigned int NUM_FITTING_MODES = sizeof(FITTING_MODES) / sizeof(FITTING_MODES[0]);
+
+const SamplingMode::Type SAMPLING_MODES[] = { SamplingMode::BOX, SamplingMode::NEAREST, SamplingMode::LINEAR, SamplingMode::BOX_THEN_NEAREST, SamplingMode::BOX_THEN_LINEAR };
+const char * const SAMPLING_MODE_NAMES[] = { "BOX", "NEAREST", "LINEAR", "BOX_THEN_NEAREST", "BOX_THEN_LINEAR" };
+const unsigned int NUM_SAMPLING_MODES = sizeof(SAMPLING_MODES) / sizeof(SAMPLING_MODES[0]);
+
+/** A 24 megapixel photo, as a camera would produce. */
+const unsigned int PHOTO_WIDTH = 6000u;
+const unsigned int PHOTO_HEIGHT = 4000u;
+
+/** A full HD screen. */
+const ImageDimensions SCREEN_DIMENSIONS( 1920u, 1080u );
+
+double GetTimeMilliseconds()
+{
+  timespec time;
+  clock_gettime( CLOCK_MONOTONIC, &time );
+  return time.tv_sec * 1000.0 + time.tv_nsec / 1000000.0;
+}
+
+/**
+ * @brief Make a bitmap filled with a repeatable pseudo-random pattern.
+ */
+Integration::BitmapPtr MakeBitmap( Pixel::Format format, unsigned int width, unsigned int height )
+{
+  Integration::BitmapPtr bitmap = Integration::Bitmap::New( Integration::Bitmap::BITMAP_2D_PACKED_PIXELS, ResourcePolicy::OWNED_DISCARD );
+  unsigned char * const pixels = bitmap->GetPackedPixelsProfile()->ReserveBuffer( format, width, height, width, height );
+  const size_t numBytes = width * height * Pixel::GetBytesPerPixel( format );
+
+  srand48( width * height );
+  for( size_t byte = 0; byte < numBytes; ++byte )
+  {
+    pixels[byte] = lrand48();
+  }
+  return bitmap;
+}
+
+/**
+ * @brief Scale a bitmap with the given number of threads.
+ * @param[out] milliseconds The time taken to scale the bitmap.
+ * @return The scaled bitmap.
+ */
+Integration::BitmapPtr ScaleBitmap( unsigned int threadCount, Pixel::Format format, unsigned int width, unsigned int height, ImageDimensions desired, FittingMode::Type fittingMode, SamplingMode::Type samplingMode, double& milliseconds )
+{
+  Integration::BitmapPtr source = MakeBitmap( format, width, height );
+  SetScalingThreadCount( threadCount );
+
+  const double startTime = GetTimeMilliseconds();
+  Integration::BitmapPtr scaled = DownscaleBitmap( *source, desired, fittingMode, samplingMode );
+  milliseconds = GetTimeMilliseconds() - startTime;
+
+  SetScalingThreadCount( 1u );
+  return scaled;
+}
+
+/**
+ * @brief Check two bitmaps have identical dimensions and pixels.
+ */
+bool BitmapsMatch( Integration::Bitmap& a, Integration::Bitmap& b )
+{
+  return a.GetImageWidth() == b.GetImageWidth() &&
+         a.GetImageHeight() == b.GetImageHeight() &&
+         a.GetPixelFormat() == b.GetPixelFormat() &&
+         memcmp( a.GetBuffer(), b.GetBuffer(), a.GetImageWidth() * a.GetImageHeight() * Pixel::GetBytesPerPixel( a.GetPixelFormat() ) ) == 0;
+}
+
+} // anon namespace
+
+void utc_dali_image_scaling_startup(void)
+{
+  SetScalingThreadCount( 1u );
+}
+
+void utc_dali_image_scaling_cleanup(void)
+{
+  SetScalingThreadCount( 1u );
+}
+
+int UtcDaliImageScalingThreadCount(void)
+{
+  DALI_TEST_EQUALS( GetScalingThreadCount(), 1u, TEST_LOCATION );
+  SetScalingThreadCount( 4u );
+  DALI_TEST_EQUALS( GetScalingThreadCount(), 4u, TEST_LOCATION );
+  SetScalingThreadCount( 0u );
+  DALI_TEST_EQUALS( GetScalingThreadCount(), 1u, TEST_LOCATION );
+
+  END_TEST;
+}
+
+/**
+ * @brief Scaling across several threads must produce exactly the same pixels as
+ * scaling on one, for every pixel format and mode.
+ */
+int UtcDaliImageScalingBandsMatchSingleThread(void)
+{
+  const Pixel::Format formats[] = { Pixel::RGBA8888, Pixel::RGB888, Pixel::RGB565, Pixel::LA88, Pixel::L8 };
+  const unsigned int numFormats = sizeof(formats) / sizeof(formats[0]);
+
+  for( unsigned int format = 0; format < numFormats; ++format )
+  {
+    for( unsigned int fitting = 0; fitting < NUM_FITTING_MODES; ++fitting )
+    {
+      for( unsigned int sampling = 0; sampling < NUM_SAMPLING_MODES; ++sampling )
+      {
+        // Odd sizes so bands do not divide the rows evenly:
+        double milliseconds = 0.0;
+        Integration::BitmapPtr single = ScaleBitmap( 1u, formats[format], 1531u, 1117u, ImageDimensions( 347u, 251u ), FITTING_MODES[fitting], SAMPLING_MODES[sampling], milliseconds );
+        Integration::BitmapPtr banded = ScaleBitmap( 3u, formats[format], 1531u, 1117u, ImageDimensions( 347u, 251u ), FITTING_MODES[fitting], SAMPLING_MODES[sampling], milliseconds );
+
+        DALI_TEST_CHECK( BitmapsMatch( *single, *banded ) );
+      }
+    }
+  }
+
+  END_TEST;
+}
+
+/**
+ * @brief Benchmark of scaling a large photo to screen size against the number of
+ * scaling threads, for each of the fitting and sampling modes.
+ *
+ * Only the output is asserted as timings depend on the machine running the test.
+ */
+int UtcDaliImageScalingBenchmarkByThreadCount(void)
+{
+  tet_printf( "Running image scaling benchmark for a %ux%u RGBA8888 image.\n", PHOTO_WIDTH, PHOTO_HEIGHT );
+
+  for( unsigned int fitting = 0; fitting < NUM_FITTING_MODES; ++fitting )
+  {
+    for( unsigned int sampling = 0; sampling < NUM_SAMPLING_MODES; ++sampling )
+    {
+      double singleThreadMilliseconds = 0.0;
+      Integration::BitmapPtr reference = ScaleBitmap( THREAD_COUNTS[0], Pixel::RGBA8888, PHOTO_WIDTH, PHOTO_HEIGHT, SCREEN_DIMENSIONS, FITTING_MODES[fitting], SAMPLING_MODES[sampling], singleThreadMilliseconds );
+      tet_printf( "%s, %s, Threads: %u, Time: %.1f ms\n", FITTING_MODE_NAMES[fitting], SAMPLING_MODE_NAMES[sampling], THREAD_COUNTS[0], singleThreadMilliseconds );
+
+      for( unsigned int i = 1; i < NUM_THREAD_COUNTS; ++i )
+      {
+        double milliseconds = 0.0;
+        Integration::BitmapPtr scaled = ScaleBitmap( THREAD_COUNTS[i], Pixel::RGBA8888, PHOTO_WIDTH, PHOTO_HEIGHT, SCREEN_DIMENSIONS, FITTING_MODES[fitting], SAMPLING_MODES[sampling], milliseconds );
+        tet_printf( "%s, %s, Threads: %u, Time: %.1f ms, Speedup: %.2f\n", FITTING_MODE_NAMES[fitting], SAMPLING_MODE_NAMES[sampling], THREAD_COUNTS[i], milliseconds, milliseconds > 0.0 ? singleThreadMilliseconds / milliseconds : 0.0 );
+
+        DALI_TEST_CHECK( BitmapsMatch( *reference, *scaled ) );
+      }
+    }
+  }
+
+  END_TEST;
+}
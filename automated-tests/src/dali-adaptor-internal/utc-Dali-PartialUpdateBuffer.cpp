@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <cstring>
+#include <vector>
+#include <dali-test-suite-utils.h>
+
+#include "adaptors/common/partial-update-buffer.h"
+
+using namespace Dali;
+using namespace Dali::Internal::Adaptor;
+
+namespace
+{
+
+const unsigned int WIDTH = 16u;
+const unsigned int HEIGHT = 12u;
+const unsigned int BYTES_PER_PIXEL = 3u;
+const unsigned int IMAGE_SIZE = WIDTH * HEIGHT * BYTES_PER_PIXEL;
+
+/**
+ * @brief Check the position and size of an area.
+ */
+void CheckArea( const Rect< int >& area, int x, int y, int width, int height, const char* location )
+{
+  DALI_TEST_EQUALS( area.x, x, location );
+  DALI_TEST_EQUALS( area.y, y, location );
+  DALI_TEST_EQUALS( area.width, width, location );
+  DALI_TEST_EQUALS( area.height, height, location );
+}
+
+/**
+ * @brief Change the pixels of an area of an image to a value, as an application drawing into it would.
+ */
+void Fill( std::vector< unsigned char >& image, const Rect< int >& area, unsigned char value )
+{
+  for( int y = area.y; y < area.y + area.height; ++y )
+  {
+    memset( &image[ ( y * WIDTH + area.x ) * BYTES_PER_PIXEL ], value, area.width * BYTES_PER_PIXEL );
+  }
+}
+
+} // anon namespace
+
+void utc_dali_partial_update_buffer_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_partial_update_buffer_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+/**
+ * @brief Before anything is written, the buffer is clear and nothing has been updated.
+ */
+int UtcDaliPartialUpdateBufferInitialRead(void)
+{
+  PartialUpdateBuffer buffer( WIDTH, HEIGHT, BYTES_PER_PIXEL );
+  DALI_TEST_EQUALS( buffer.GetStride(), WIDTH * BYTES_PER_PIXEL, TEST_LOCATION );
+
+  Rect< int > updatedArea( 1, 2, 3, 4 );
+  const unsigned char* read = buffer.Read( updatedArea );
+  CheckArea( updatedArea, 0, 0, 0, 0, TEST_LOCATION );
+
+  const std::vector< unsigned char > clear( IMAGE_SIZE, 0u );
+  DALI_TEST_CHECK( memcmp( read, &clear[0], IMAGE_SIZE ) == 0 );
+
+  END_TEST;
+}
+
+/**
+ * @brief Only the written area is copied, and it is the area the reader is told about.
+ */
+int UtcDaliPartialUpdateBufferWriteArea(void)
+{
+  PartialUpdateBuffer buffer( WIDTH, HEIGHT, BYTES_PER_PIXEL );
+
+  // Pixels outside the area are not copied, even though the source has them
+  std::vector< unsigned char > image( IMAGE_SIZE, 0x11u );
+  std::vector< unsigned char > expected( IMAGE_SIZE, 0u );
+  const Rect< int > area( 2, 3, 4, 5 );
+  Fill( expected, area, 0x11u );
+
+  buffer.Write( &image[0], area );
+
+  Rect< int > updatedArea;
+  const unsigned char* read = buffer.Read( updatedArea );
+  CheckArea( updatedArea, 2, 3, 4, 5, TEST_LOCATION );
+  DALI_TEST_CHECK( memcmp( read, &expected[0], IMAGE_SIZE ) == 0 );
+
+  // Reading again does not swap, and reports nothing new
+  DALI_TEST_CHECK( buffer.Read( updatedArea ) == read );
+  CheckArea( updatedArea, 0, 0, 0, 0, TEST_LOCATION );
+
+  END_TEST;
+}
+
+/**
+ * @brief The areas of writes made between reads are merged.
+ */
+int UtcDaliPartialUpdateBufferMergesWrites(void)
+{
+  PartialUpdateBuffer buffer( WIDTH, HEIGHT, BYTES_PER_PIXEL );
+  std::vector< unsigned char > image( IMAGE_SIZE, 0u );
+
+  Fill( image, Rect< int >( 1, 1, 2, 2 ), 0x22u );
+  buffer.Write( &image[0], Rect< int >( 1, 1, 2, 2 ) );
+  Fill( image, Rect< int >( 6, 4, 3, 1 ), 0x33u );
+  buffer.Write( &image[0], Rect< int >( 6, 4, 3, 1 ) );
+
+  Rect< int > updatedArea;
+  const unsigned char* read = buffer.Read( updatedArea );
+  CheckArea( updatedArea, 1, 1, 8, 4, TEST_LOCATION );
+  DALI_TEST_CHECK( memcmp( read, &image[0], IMAGE_SIZE ) == 0 );
+
+  CheckArea( PartialUpdateBuffer::Merge( Rect< int >(), Rect< int >( 1, 2, 3, 4 ) ), 1, 2, 3, 4, TEST_LOCATION );
+  CheckArea( PartialUpdateBuffer::Merge( Rect< int >( 1, 2, 3, 4 ), Rect< int >() ), 1, 2, 3, 4, TEST_LOCATION );
+
+  END_TEST;
+}
+
+/**
+ * @brief Areas outside the image are clipped.
+ */
+int UtcDaliPartialUpdateBufferClipsArea(void)
+{
+  PartialUpdateBuffer buffer( WIDTH, HEIGHT, BYTES_PER_PIXEL );
+  std::vector< unsigned char > image( IMAGE_SIZE, 0x44u );
+
+  buffer.Write( &image[0], Rect< int >( -2, 10, 5, 100 ) );
+
+  Rect< int > updatedArea;
+  buffer.Read( updatedArea );
+  CheckArea( updatedArea, 0, 10, 3, 2, TEST_LOCATION );
+
+  // Entirely outside, so nothing is written and there is nothing to swap to
+  buffer.Write( &image[0], Rect< int >( WIDTH, 0, 4, 4 ) );
+  buffer.Read( updatedArea );
+  CheckArea( updatedArea, 0, 0, 0, 0, TEST_LOCATION );
+
+  END_TEST;
+}
+
+/**
+ * @brief Each buffer catches up with the areas written to the other one, so the reader always sees the whole latest image.
+ */
+int UtcDaliPartialUpdateBufferCatchesUp(void)
+{
+  PartialUpdateBuffer buffer( WIDTH, HEIGHT, BYTES_PER_PIXEL );
+  std::vector< unsigned char > image( IMAGE_SIZE, 0u );
+
+  unsigned int random = 12345u;
+  for( unsigned int frame = 0; frame < 200u; ++frame )
+  {
+    // One to three writes of small areas between reads
+    const unsigned int writes = 1u + frame % 3u;
+    for( unsigned int i = 0; i < writes; ++i )
+    {
+      random = random * 1103515245u + 12345u;
+      const int x = ( random >> 8 ) % WIDTH;
+      const int y = ( random >> 12 ) % HEIGHT;
+      const Rect< int > area( x, y, 1 + ( random >> 16 ) % ( WIDTH - x ), 1 + ( random >> 20 ) % ( HEIGHT - y ) );
+      Fill( image, area, static_cast< unsigned char >( frame * 3u + i ) );
+      buffer.Write( &image[0], area );
+    }
+
+    Rect< int > updatedArea;
+    const unsigned char* read = buffer.Read( updatedArea );
+    DALI_TEST_CHECK( updatedArea.width > 0 && updatedArea.height > 0 );
+    DALI_TEST_CHECK( memcmp( read, &image[0], IMAGE_SIZE ) == 0 );
+  }
+
+  END_TEST;
+}
@@ -0,0 +1,228 @@
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <stdint.h>
+#include <string>
+#include <dali-test-suite-utils.h>
+
+#include "platform-abstractions/portable/scoped-trace.h"
+#include "adaptors/base/performance-logging/trace-recorder.h"
+#include "test-timing.h"
+
+using namespace Dali;
+using namespace Dali::Internal;
+using namespace Dali::Internal::Adaptor;
+
+namespace
+{
+
+const unsigned int BENCHMARK_ITERATIONS = 10000000u;
+
+unsigned int gNameEvaluations = 0u;
+
+/**
+ * @brief Counts how many times a trace's arguments are evaluated; unused when traces are compiled out.
+ */
+__attribute__((unused)) const char* CountedName()
+{
+  ++gNameEvaluations;
+  return "Counted";
+}
+
+/**
+ * @brief Count the occurrences of some text in the trace.
+ */
+unsigned int CountOf( const std::string& trace, const char* const text )
+{
+  unsigned int count = 0u;
+  for( std::string::size_type position = trace.find( text ); position != std::string::npos; position = trace.find( text, position + 1u ) )
+  {
+    ++count;
+  }
+  return count;
+}
+
+// Each loop does the same work on a volatile counter, so that only the trace differs
+
+void __attribute__((noinline)) EmptyLoop( volatile unsigned int& counter )
+{
+  for( unsigned int i = 0; i < BENCHMARK_ITERATIONS; ++i )
+  {
+    ++counter;
+  }
+}
+
+void __attribute__((noinline)) CompiledOutLoop( volatile unsigned int& counter )
+{
+  for( unsigned int i = 0; i < BENCHMARK_ITERATIONS; ++i )
+  {
+    DALI_TRACE_SCOPE( Trace::UPDATE, "Benchmark" );
+    ++counter;
+  }
+}
+
+void __attribute__((noinline)) ScopedTraceLoop( volatile unsigned int& counter )
+{
+  for( unsigned int i = 0; i < BENCHMARK_ITERATIONS; ++i )
+  {
+    Trace::ScopedTrace trace( Trace::UPDATE, "Benchmark" );
+    ++counter;
+  }
+}
+
+} // anon namespace
+
+void utc_dali_scoped_trace_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_scoped_trace_cleanup(void)
+{
+  Trace::Disable();
+  test_return_value = TET_PASS;
+}
+
+/**
+ * @brief Unless the library is built with TRACE_ENABLED, a trace compiles to nothing and its arguments are not evaluated.
+ */
+int UtcDaliScopedTraceMacro(void)
+{
+  TraceRecorder recorder;
+  Trace::Enable( recorder, Trace::ALL_CATEGORIES );
+
+  gNameEvaluations = 0u;
+  {
+    DALI_TRACE_SCOPE( Trace::UPDATE, CountedName() );
+  }
+
+#ifdef TRACE_ENABLED
+  DALI_TEST_EQUALS( gNameEvaluations, 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( recorder.GetThreadCount(), 1u, TEST_LOCATION );
+#else
+  DALI_TEST_EQUALS( gNameEvaluations, 0u, TEST_LOCATION );
+  DALI_TEST_EQUALS( recorder.GetThreadCount(), 0u, TEST_LOCATION );
+#endif
+
+  END_TEST;
+}
+
+/**
+ * @brief A scope is the beginning and end of a named slice in the trace.
+ */
+int UtcDaliScopedTraceRecordsScope(void)
+{
+  TraceRecorder recorder;
+  Trace::Enable( recorder, Trace::RENDER );
+
+  {
+    Trace::ScopedTrace outer( Trace::RENDER, "Outer" );
+    Trace::ScopedTrace inner( Trace::RENDER, "Inner" );
+  }
+
+  std::string trace;
+  recorder.DumpChromeTrace( trace );
+  tet_printf( "%s", trace.c_str() );
+
+  DALI_TEST_EQUALS( CountOf( trace, "\"name\":\"Outer\",\"ph\":\"B\"" ), 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( CountOf( trace, "\"name\":\"Outer\",\"ph\":\"E\"" ), 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( CountOf( trace, "\"name\":\"Inner\",\"ph\":\"B\"" ), 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( CountOf( trace, "\"name\":\"Inner\",\"ph\":\"E\"" ), 1u, TEST_LOCATION );
+
+  // The inner scope ends first
+  DALI_TEST_CHECK( trace.find( "\"name\":\"Inner\",\"ph\":\"E\"" ) < trace.find( "\"name\":\"Outer\",\"ph\":\"E\"" ) );
+
+  END_TEST;
+}
+
+/**
+ * @brief Nothing is recorded for a disabled category, or once tracing is disabled.
+ */
+int UtcDaliScopedTraceDisabled(void)
+{
+  TraceRecorder recorder;
+  Trace::Enable( recorder, Trace::UPDATE | Trace::TEXT );
+  DALI_TEST_CHECK( Trace::IsEnabled( Trace::UPDATE ) );
+  DALI_TEST_CHECK( ! Trace::IsEnabled( Trace::RESOURCE ) );
+
+  {
+    Trace::ScopedTrace trace( Trace::RESOURCE, "Resource" );
+  }
+  DALI_TEST_EQUALS( recorder.GetThreadCount(), 0u, TEST_LOCATION );
+
+  Trace::Disable();
+  DALI_TEST_CHECK( ! Trace::IsEnabled( Trace::UPDATE ) );
+  {
+    Trace::ScopedTrace trace( Trace::UPDATE, "Update" );
+  }
+  DALI_TEST_EQUALS( recorder.GetThreadCount(), 0u, TEST_LOCATION );
+
+  // A scope which began while enabled does not end in a recorder which has gone
+  Trace::Enable( recorder, Trace::TEXT );
+  {
+    Trace::ScopedTrace trace( Trace::TEXT, "Text" );
+    Trace::Disable();
+  }
+
+  std::string trace;
+  recorder.DumpChromeTrace( trace );
+  DALI_TEST_EQUALS( CountOf( trace, "\"ph\":\"B\"" ), 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( CountOf( trace, "\"ph\":\"E\"" ), 0u, TEST_LOCATION );
+
+  END_TEST;
+}
+
+/**
+ * @brief Measures the cost of a trace when compiled out, built in but disabled, and recording.
+ *
+ * Timings are only printed, as they depend on the machine; the compiled out loop is the same code as the empty loop.
+ */
+int UtcDaliScopedTraceBenchmark(void)
+{
+  volatile unsigned int counter = 0u;
+
+  uint64_t start = GetNanoseconds();
+  EmptyLoop( counter );
+  const uint64_t emptyTime = GetNanoseconds() - start;
+
+  start = GetNanoseconds();
+  CompiledOutLoop( counter );
+  const uint64_t compiledOutTime = GetNanoseconds() - start;
+
+  start = GetNanoseconds();
+  ScopedTraceLoop( counter );
+  const uint64_t disabledTime = GetNanoseconds() - start;
+
+  TraceRecorder recorder;
+  Trace::Enable( recorder, Trace::UPDATE );
+  start = GetNanoseconds();
+  ScopedTraceLoop( counter );
+  const uint64_t enabledTime = GetNanoseconds() - start;
+  Trace::Disable();
+
+  const double iterations = static_cast< double >( BENCHMARK_ITERATIONS );
+  tet_printf( "Empty loop:              %.2f ns per iteration\n", static_cast< double >( emptyTime ) / iterations );
+  tet_printf( "Trace compiled out:      %.2f ns per iteration\n", static_cast< double >( compiledOutTime ) / iterations );
+  tet_printf( "Trace category disabled: %.2f ns per iteration\n", static_cast< double >( disabledTime ) / iterations );
+  tet_printf( "Trace recorded:          %.2f ns per iteration\n", static_cast< double >( enabledTime ) / iterations );
+
+  const unsigned int count = counter;
+  DALI_TEST_EQUALS( count, 4u * BENCHMARK_ITERATIONS, TEST_LOCATION );
+  DALI_TEST_EQUALS( recorder.GetThreadCount(), 1u, TEST_LOCATION );
+
+  END_TEST;
+}
@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <vector>
+#include <dali-test-suite-utils.h>
+#include <dali/internal/text-abstraction/shaped-run-cache.h>
+
+using namespace Dali;
+using namespace Dali::TextAbstraction;
+using Dali::TextAbstraction::Internal::ShapedRunCache;
+
+namespace
+{
+
+const std::size_t CACHE_SIZE = 64u * 1024u;
+
+/**
+ * @brief A text and the glyphs it is shaped to; one glyph per character, with indices and advances derived from them.
+ */
+struct ShapedText
+{
+  ShapedText( const char* const characters, FontId fontId )
+  : fontId( fontId )
+  {
+    for( const char* character = characters; *character; ++character )
+    {
+      const Length index = text.size();
+      text.push_back( static_cast< Character >( *character ) );
+      indices.push_back( fontId * 1000u + text.back() );
+      advance.push_back( static_cast< float >( index + 5u ) );
+      offset.push_back( 0.f );
+      offset.push_back( static_cast< float >( index ) );
+      characterMap.push_back( index );
+    }
+  }
+
+  void Add( ShapedRunCache& cache ) const
+  {
+    cache.Add( &text[0], text.size(), fontId, LATIN, false,
+               indices.size(), &indices[0], &advance[0], &offset[0], &characterMap[0] );
+  }
+
+  const ShapedRunCache::Run* Find( ShapedRunCache& cache ) const
+  {
+    return cache.Find( &text[0], text.size(), fontId, LATIN, false );
+  }
+
+  FontId fontId;
+  std::vector< Character > text;
+  std::vector< GlyphIndex > indices;
+  std::vector< float > advance;
+  std::vector< float > offset;
+  std::vector< CharacterIndex > characterMap;
+};
+
+} // anon namespace
+
+void utc_dali_shaped_run_cache_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_shaped_run_cache_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+/**
+ * @brief A run added is found with its glyphs, and counted as a hit.
+ */
+int UtcDaliShapedRunCacheFind(void)
+{
+  ShapedRunCache cache( CACHE_SIZE );
+  const ShapedText settings( "Settings", 1u );
+
+  DALI_TEST_CHECK( settings.Find( cache ) == NULL );
+  settings.Add( cache );
+
+  const ShapedRunCache::Run* run = settings.Find( cache );
+  DALI_TEST_CHECK( run != NULL );
+  DALI_TEST_CHECK( run->indices == settings.indices );
+  DALI_TEST_CHECK( run->advance == settings.advance );
+  DALI_TEST_CHECK( run->offset == settings.offset );
+  DALI_TEST_CHECK( run->characterMap == settings.characterMap );
+
+  DALI_TEST_EQUALS( cache.GetHitCount(), 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( cache.GetMissCount(), 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( cache.GetCount(), std::size_t( 1u ), TEST_LOCATION );
+  DALI_TEST_CHECK( cache.GetSize() > 0u );
+
+  END_TEST;
+}
+
+/**
+ * @brief The font, script and direction are all part of what a run is found by.
+ */
+int UtcDaliShapedRunCacheKey(void)
+{
+  ShapedRunCache cache( CACHE_SIZE );
+  const ShapedText settings( "Settings", 1u );
+  settings.Add( cache );
+
+  DALI_TEST_CHECK( cache.Find( &settings.text[0], settings.text.size(), 2u, LATIN, false ) == NULL );
+  DALI_TEST_CHECK( cache.Find( &settings.text[0], settings.text.size(), 1u, GREEK, false ) == NULL );
+  DALI_TEST_CHECK( cache.Find( &settings.text[0], settings.text.size(), 1u, LATIN, true ) == NULL );
+  DALI_TEST_CHECK( cache.Find( &settings.text[0], settings.text.size() - 1u, 1u, LATIN, false ) == NULL );
+
+  // A different text of the same length isn't found
+  const ShapedText settlings( "Settlings", 1u );
+  const ShapedText sittings( "Sittings", 1u );
+  DALI_TEST_CHECK( sittings.Find( cache ) == NULL );
+  DALI_TEST_CHECK( settlings.Find( cache ) == NULL );
+  DALI_TEST_EQUALS( cache.GetMissCount(), 6u, TEST_LOCATION );
+
+  DALI_TEST_CHECK( settings.Find( cache ) != NULL );
+
+  END_TEST;
+}
+
+/**
+ * @brief The least recently used runs are evicted to keep within the maximum size.
+ */
+int UtcDaliShapedRunCacheEviction(void)
+{
+  ShapedRunCache cache( CACHE_SIZE );
+  const ShapedText first( "First label", 1u );
+  const ShapedText second( "Second label", 1u );
+  const ShapedText third( "Third label", 1u );
+
+  first.Add( cache );
+  second.Add( cache );
+  third.Add( cache );
+  const std::size_t size = cache.GetSize();
+
+  // Use the first, so the second is the least recently used
+  DALI_TEST_CHECK( first.Find( cache ) != NULL );
+
+  cache.SetMaximumSize( size - 1u );
+  DALI_TEST_EQUALS( cache.GetCount(), std::size_t( 2u ), TEST_LOCATION );
+  DALI_TEST_EQUALS( cache.GetEvictionCount(), 1u, TEST_LOCATION );
+  DALI_TEST_CHECK( cache.GetSize() < size );
+  DALI_TEST_CHECK( second.Find( cache ) == NULL );
+  DALI_TEST_CHECK( first.Find( cache ) != NULL );
+  DALI_TEST_CHECK( third.Find( cache ) != NULL );
+
+  // Adding another evicts the least recently used again
+  second.Add( cache );
+  DALI_TEST_EQUALS( cache.GetCount(), std::size_t( 2u ), TEST_LOCATION );
+  DALI_TEST_CHECK( first.Find( cache ) == NULL );
+  DALI_TEST_CHECK( second.Find( cache ) != NULL );
+
+  // A run bigger than the maximum isn't added, and a zero maximum disables the cache
+  cache.SetMaximumSize( 1u );
+  DALI_TEST_EQUALS( cache.GetCount(), std::size_t( 0u ), TEST_LOCATION );
+  DALI_TEST_EQUALS( cache.GetSize(), std::size_t( 0u ), TEST_LOCATION );
+  first.Add( cache );
+  DALI_TEST_EQUALS( cache.GetCount(), std::size_t( 0u ), TEST_LOCATION );
+
+  END_TEST;
+}
+
+/**
+ * @brief Adding a run again replaces it, and clearing removes every run but keeps the counters.
+ */
+int UtcDaliShapedRunCacheClear(void)
+{
+  ShapedRunCache cache( CACHE_SIZE );
+  const ShapedText contact( "Jane Doe", 3u );
+
+  contact.Add( cache );
+  const std::size_t size = cache.GetSize();
+  contact.Add( cache );
+  DALI_TEST_EQUALS( cache.GetCount(), std::size_t( 1u ), TEST_LOCATION );
+  DALI_TEST_EQUALS( cache.GetSize(), size, TEST_LOCATION );
+
+  DALI_TEST_CHECK( contact.Find( cache ) != NULL );
+  cache.Clear();
+  DALI_TEST_EQUALS( cache.GetCount(), std::size_t( 0u ), TEST_LOCATION );
+  DALI_TEST_EQUALS( cache.GetSize(), std::size_t( 0u ), TEST_LOCATION );
+  DALI_TEST_CHECK( contact.Find( cache ) == NULL );
+  DALI_TEST_EQUALS( cache.GetHitCount(), 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( cache.GetMissCount(), 1u, TEST_LOCATION );
+
+  END_TEST;
+}
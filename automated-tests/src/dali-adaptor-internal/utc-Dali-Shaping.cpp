@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <stdint.h>
+#include <vector>
+#include <dali/dali.h>
+#include <dali-test-suite-utils.h>
+#include <singleton-service.h>
+#include <dali/devel-api/text-abstraction/font-client.h>
+#include <dali/devel-api/text-abstraction/shaping.h>
+
+#include "test-timing.h"
+
+using namespace Dali;
+using namespace Dali::TextAbstraction;
+
+namespace
+{
+
+const unsigned int SHAPED_RUNS = 2000u;
+const Length VARIATIONS = 16u; ///< The number of start and end positions of the different runs shaped from a paragraph.
+
+// "The quick brown fox jumps over the lazy dog. Pack my box with five dozen liquor jugs."
+const Character LATIN_PARAGRAPH[] =
+{
+  0x54, 0x68, 0x65, 0x20, 0x71, 0x75, 0x69, 0x63, 0x6b, 0x20, 0x62, 0x72, 0x6f, 0x77, 0x6e, 0x20,
+  0x66, 0x6f, 0x78, 0x20, 0x6a, 0x75, 0x6d, 0x70, 0x73, 0x20, 0x6f, 0x76, 0x65, 0x72, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x6c, 0x61, 0x7a, 0x79, 0x20, 0x64, 0x6f, 0x67, 0x2e, 0x20, 0x50, 0x61, 0x63,
+  0x6b, 0x20, 0x6d, 0x79, 0x20, 0x62, 0x6f, 0x78, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x66, 0x69,
+  0x76, 0x65, 0x20, 0x64, 0x6f, 0x7a, 0x65, 0x6e, 0x20, 0x6c, 0x69, 0x71, 0x75, 0x6f, 0x72, 0x20,
+  0x6a, 0x75, 0x67, 0x73, 0x2e
+};
+
+// "مرحبا بالعالم، هذه فقرة قصيرة لاختبار تشكيل النص العربي."
+const Character ARABIC_PARAGRAPH[] =
+{
+  0x645, 0x631, 0x62d, 0x628, 0x627, 0x20, 0x628, 0x627, 0x644, 0x639, 0x627, 0x644, 0x645, 0x60c, 0x20,
+  0x647, 0x630, 0x647, 0x20, 0x641, 0x642, 0x631, 0x629, 0x20, 0x642, 0x635, 0x64a, 0x631, 0x629, 0x20,
+  0x644, 0x627, 0x62e, 0x62a, 0x628, 0x627, 0x631, 0x20, 0x62a, 0x634, 0x643, 0x64a, 0x644, 0x20,
+  0x627, 0x644, 0x646, 0x635, 0x20, 0x627, 0x644, 0x639, 0x631, 0x628, 0x64a, 0x2e
+};
+
+// "नमस्ते दुनिया, यह हिन्दी पाठ के आकार देने की जाँच के लिए एक छोटा अनुच्छेद है।"
+const Character DEVANAGARI_PARAGRAPH[] =
+{
+  0x928, 0x92e, 0x938, 0x94d, 0x924, 0x947, 0x20, 0x926, 0x941, 0x928, 0x93f, 0x92f, 0x93e, 0x2c, 0x20,
+  0x92f, 0x939, 0x20, 0x939, 0x93f, 0x928, 0x94d, 0x926, 0x940, 0x20, 0x92a, 0x93e, 0x920, 0x20,
+  0x915, 0x947, 0x20, 0x906, 0x915, 0x93e, 0x930, 0x20, 0x926, 0x947, 0x928, 0x947, 0x20, 0x915, 0x940, 0x20,
+  0x91c, 0x93e, 0x901, 0x91a, 0x20, 0x915, 0x947, 0x20, 0x932, 0x93f, 0x90f, 0x20, 0x90f, 0x915, 0x20,
+  0x91b, 0x94b, 0x91f, 0x93e, 0x20, 0x905, 0x928, 0x941, 0x91a, 0x94d, 0x91b, 0x947, 0x926, 0x20,
+  0x939, 0x948, 0x964
+};
+
+/**
+ * @brief Shape a paragraph repeatedly and print how many shaped runs per second were achieved.
+ *
+ * The first run opens the font's face, so it is timed separately from the runs which reuse it. The same run
+ * shaped again is found in the shaped run cache, so runs starting and ending at different characters of the
+ * paragraph are timed too; there are more of them than the cache holds, so they go through HarfBuzz.
+ */
+void BenchmarkParagraph( const char* name, const Character* text, Length numberOfCharacters, Script script )
+{
+  FontClient fontClient = FontClient::Get();
+  Shaping shaping = Shaping::Get();
+
+  const FontId fontId = fontClient.FindDefaultFont( text[0] );
+  if( 0u == fontId )
+  {
+    tet_printf( "%-11s no font installed, skipped\n", name );
+    return;
+  }
+
+  uint64_t start = GetNanoseconds();
+  const Length numberOfGlyphs = shaping.Shape( text, numberOfCharacters, fontId, script );
+  const uint64_t firstRunTime = GetNanoseconds() - start;
+
+  DALI_TEST_CHECK( numberOfGlyphs > 0u );
+
+  std::vector< GlyphInfo > glyphs( numberOfGlyphs );
+  std::vector< CharacterIndex > glyphToCharacterMap( numberOfGlyphs );
+  shaping.GetGlyphs( &glyphs[0], &glyphToCharacterMap[0] );
+  const std::vector< GlyphInfo > firstGlyphs( glyphs );
+
+  start = GetNanoseconds();
+  for( unsigned int run = 0u; run < SHAPED_RUNS; ++run )
+  {
+    // Each run gives the same glyphs
+    DALI_TEST_EQUALS( shaping.Shape( text, numberOfCharacters, fontId, script ), numberOfGlyphs, TEST_LOCATION );
+  }
+  const uint64_t runsTime = GetNanoseconds() - start;
+
+  start = GetNanoseconds();
+  for( unsigned int run = 0u; run < SHAPED_RUNS; ++run )
+  {
+    const Length first = run % VARIATIONS;
+    const Length trimmed = ( run / VARIATIONS ) % VARIATIONS;
+    DALI_TEST_CHECK( shaping.Shape( text + first, numberOfCharacters - first - trimmed, fontId, script ) > 0u );
+  }
+  const uint64_t differentRunsTime = GetNanoseconds() - start;
+
+  // Shape the paragraph again to check its glyphs
+  shaping.Shape( text, numberOfCharacters, fontId, script );
+
+  shaping.GetGlyphs( &glyphs[0], &glyphToCharacterMap[0] );
+  for( Length index = 0u; index < numberOfGlyphs; ++index )
+  {
+    DALI_TEST_EQUALS( glyphs[index].fontId, fontId, TEST_LOCATION );
+    DALI_TEST_EQUALS( glyphs[index].index, firstGlyphs[index].index, TEST_LOCATION );
+    DALI_TEST_EQUALS( glyphs[index].advance, firstGlyphs[index].advance, TEST_LOCATION );
+    DALI_TEST_CHECK( glyphToCharacterMap[index] < numberOfCharacters );
+  }
+
+  tet_printf( "%-11s first run %8.1f us, then %8.0f same runs and %8.0f different runs shaped per second (%u characters, %u glyphs)\n",
+              name,
+              static_cast< double >( firstRunTime ) / 1e3,
+              SHAPED_RUNS * 1e9 / static_cast< double >( runsTime ),
+              SHAPED_RUNS * 1e9 / static_cast< double >( differentRunsTime ),
+              numberOfCharacters,
+              numberOfGlyphs );
+}
+
+} // anon namespace
+
+void utc_dali_shaping_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_shaping_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+/**
+ * @brief Shaped runs per second for Latin, Arabic and Devanagari paragraphs, with the font's face and
+ * HarfBuzz font created by the first run and reused by the others, and repeated runs taken from the shaped run cache.
+ */
+int UtcDaliShapingBenchmark(void)
+{
+  TestApplication application;
+  SingletonService service = SingletonService::New();
+
+  BenchmarkParagraph( "Latin", LATIN_PARAGRAPH, sizeof( LATIN_PARAGRAPH ) / sizeof( Character ), LATIN );
+  BenchmarkParagraph( "Arabic", ARABIC_PARAGRAPH, sizeof( ARABIC_PARAGRAPH ) / sizeof( Character ), ARABIC );
+  BenchmarkParagraph( "Devanagari", DEVANAGARI_PARAGRAPH, sizeof( DEVANAGARI_PARAGRAPH ) / sizeof( Character ), DEVANAGARI );
+
+  END_TEST;
+}
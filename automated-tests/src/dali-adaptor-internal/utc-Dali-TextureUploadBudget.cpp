@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <stdint.h>
+#include <vector>
+#include <dali-test-suite-utils.h>
+
+#include "platform-abstractions/portable/texture-upload-budget.h"
+#include "adaptors/common/native-bitmap-buffer-impl.h"
+
+using namespace Dali;
+using namespace Dali::Internal::Adaptor;
+using Dali::Internal::TextureUploadBudget;
+
+void utc_dali_texture_upload_budget_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_texture_upload_budget_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+/**
+ * @brief Without a limit every upload goes ahead.
+ */
+int UtcDaliTextureUploadBudgetUnlimited(void)
+{
+  TextureUploadBudget budget;
+  DALI_TEST_EQUALS( budget.GetBytesPerFrame(), 0u, TEST_LOCATION );
+
+  for( unsigned int i = 0; i < 100u; ++i )
+  {
+    DALI_TEST_CHECK( budget.Upload( 4096u * 4096u * 4u ) );
+  }
+  budget.NextFrame();
+
+  DALI_TEST_EQUALS( budget.GetBytesUploaded(), uint64_t( 100u ) * 4096u * 4096u * 4u, TEST_LOCATION );
+  DALI_TEST_EQUALS( budget.GetDeferredCount(), 0u, TEST_LOCATION );
+
+  END_TEST;
+}
+
+/**
+ * @brief Uploads beyond the limit are deferred until the next frame.
+ */
+int UtcDaliTextureUploadBudgetDefers(void)
+{
+  TextureUploadBudget budget;
+  budget.SetBytesPerFrame( 1000u );
+  DALI_TEST_EQUALS( budget.GetBytesPerFrame(), 1000u, TEST_LOCATION );
+
+  DALI_TEST_CHECK( budget.Upload( 400u ) );
+  DALI_TEST_CHECK( budget.Upload( 600u ) );
+  DALI_TEST_CHECK( ! budget.Upload( 1u ) );
+  DALI_TEST_CHECK( ! budget.Upload( 500u ) );
+  budget.NextFrame();
+
+  DALI_TEST_EQUALS( budget.GetBytesUploaded(), uint64_t( 1000u ), TEST_LOCATION );
+  DALI_TEST_EQUALS( budget.GetDeferredCount(), 2u, TEST_LOCATION );
+
+  // The whole budget is available again
+  DALI_TEST_CHECK( budget.Upload( 500u ) );
+  DALI_TEST_CHECK( budget.Upload( 1u ) );
+  budget.NextFrame();
+
+  DALI_TEST_EQUALS( budget.GetBytesUploaded(), uint64_t( 501u ), TEST_LOCATION );
+  DALI_TEST_EQUALS( budget.GetDeferredCount(), 0u, TEST_LOCATION );
+
+  END_TEST;
+}
+
+/**
+ * @brief An upload larger than the whole budget goes ahead as the first of a frame, so it is never deferred forever.
+ */
+int UtcDaliTextureUploadBudgetLargeUpload(void)
+{
+  TextureUploadBudget budget;
+  budget.SetBytesPerFrame( 1000u );
+
+  DALI_TEST_CHECK( budget.Upload( 10u ) );
+  DALI_TEST_CHECK( ! budget.Upload( 5000u ) );
+  budget.NextFrame();
+
+  DALI_TEST_CHECK( budget.Upload( 5000u ) );
+  DALI_TEST_CHECK( ! budget.Upload( 10u ) );
+  budget.NextFrame();
+
+  DALI_TEST_EQUALS( budget.GetBytesUploaded(), uint64_t( 5000u ), TEST_LOCATION );
+  DALI_TEST_EQUALS( budget.GetDeferredCount(), 1u, TEST_LOCATION );
+
+  END_TEST;
+}
+
+/**
+ * @brief Spreading a burst of uploads over frames keeps each frame within the budget.
+ */
+int UtcDaliTextureUploadBudgetBurst(void)
+{
+  const unsigned int imageSize = 512u * 512u * 4u;
+  TextureUploadBudget budget;
+  budget.SetBytesPerFrame( 2u * imageSize );
+
+  unsigned int pending = 9u;
+  unsigned int frames = 0u;
+  while( pending > 0u )
+  {
+    const unsigned int queued = pending;
+    for( unsigned int i = 0; i < queued; ++i )
+    {
+      if( budget.Upload( imageSize ) )
+      {
+        --pending;
+      }
+    }
+    budget.NextFrame();
+    ++frames;
+
+    DALI_TEST_CHECK( budget.GetBytesUploaded() <= uint64_t( 2u ) * imageSize );
+    DALI_TEST_EQUALS( budget.GetDeferredCount(), pending, TEST_LOCATION );
+  }
+
+  DALI_TEST_EQUALS( frames, 5u, TEST_LOCATION );
+
+  END_TEST;
+}
+
+/**
+ * @brief A native bitmap buffer allocates its texture with its first upload and then replaces only the rows written.
+ * An update the budget has no room for is uploaded in the next frame.
+ */
+int UtcDaliTextureUploadBudgetNativeBitmapBuffer(void)
+{
+  const unsigned int width = 16u;
+  const unsigned int height = 16u;
+  const unsigned int stride = width * 4u;
+  std::vector< unsigned char > image( stride * height, 0x80u );
+
+  TestGlAbstraction gl;
+  gl.EnableTextureCallTrace( true );
+  TextureUploadBudget budget;
+  budget.SetBytesPerFrame( 4u * stride );
+  NativeBitmapBufferPtr buffer = new NativeBitmapBuffer( gl, budget, width, height, Pixel::RGBA8888 );
+
+  // The first upload allocates the texture, although the image is larger than the budget
+  buffer->Write( &image[0], image.size() );
+  buffer->PrepareTexture();
+  DALI_TEST_CHECK( gl.GetTextureTrace().FindMethod( "TexImage2D" ) );
+  DALI_TEST_CHECK( !gl.GetTextureTrace().FindMethod( "TexSubImage2D" ) );
+  budget.NextFrame();
+  DALI_TEST_EQUALS( budget.GetBytesUploaded(), uint64_t( stride * height ), TEST_LOCATION );
+
+  // Only the rows of the area written are replaced, in full
+  gl.ResetTextureCallStack();
+  buffer->Write( &image[0], Rect< int >( 3, 2, 5, 3 ) );
+  buffer->PrepareTexture();
+  TraceCallStack::NamedParams rows;
+  rows["xoffset"] = "0";
+  rows["yoffset"] = "2";
+  rows["width"] = "16";
+  rows["height"] = "3";
+  DALI_TEST_CHECK( gl.GetTextureTrace().FindMethodAndParams( "TexSubImage2D", rows ) );
+  DALI_TEST_CHECK( !gl.GetTextureTrace().FindMethod( "TexImage2D" ) );
+  budget.NextFrame();
+  DALI_TEST_EQUALS( budget.GetBytesUploaded(), uint64_t( 3u * stride ), TEST_LOCATION );
+
+  // Nothing is uploaded again until more is written
+  gl.ResetTextureCallStack();
+  buffer->PrepareTexture();
+  DALI_TEST_CHECK( !gl.GetTextureTrace().FindMethod( "TexSubImage2D" ) );
+  DALI_TEST_CHECK( !gl.GetTextureTrace().FindMethod( "TexImage2D" ) );
+  budget.NextFrame();
+
+  // When another upload has used the frame's budget, the update waits
+  gl.ResetTextureCallStack();
+  DALI_TEST_CHECK( budget.Upload( 4u * stride ) );
+  buffer->Write( &image[0], Rect< int >( 0, 10, 16, 2 ) );
+  buffer->PrepareTexture();
+  DALI_TEST_CHECK( !gl.GetTextureTrace().FindMethod( "TexSubImage2D" ) );
+  budget.NextFrame();
+  DALI_TEST_EQUALS( budget.GetDeferredCount(), 1u, TEST_LOCATION );
+
+  // ...and goes ahead in the next frame, with the rows written since merged in
+  buffer->Write( &image[0], Rect< int >( 0, 12, 16, 1 ) );
+  buffer->PrepareTexture();
+  rows["yoffset"] = "10";
+  rows["height"] = "3";
+  DALI_TEST_CHECK( gl.GetTextureTrace().FindMethodAndParams( "TexSubImage2D", rows ) );
+  budget.NextFrame();
+  DALI_TEST_EQUALS( budget.GetDeferredCount(), 0u, TEST_LOCATION );
+
+  // A new texture is allocated by a complete upload again
+  gl.ResetTextureCallStack();
+  DALI_TEST_CHECK( buffer->GlExtensionCreate() );
+  buffer->PrepareTexture();
+  DALI_TEST_CHECK( gl.GetTextureTrace().FindMethod( "TexImage2D" ) );
+
+  END_TEST;
+}
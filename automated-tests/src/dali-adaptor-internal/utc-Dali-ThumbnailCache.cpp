@@ -0,0 +1,283 @@
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <stdint.h>
+#include <string>
+#include <dali-test-suite-utils.h>
+
+#include "platform-abstractions/tizen/data-cache/thumbnail-cache.h"
+
+using namespace Dali;
+using namespace Dali::TizenPlatform;
+
+namespace
+{
+
+/** Plenty of room for the small bitmaps used by the tests. */
+const std::size_t CACHE_CAPACITY = 1024u * 1024u;
+
+std::string gDirectory;
+
+/**
+ * @brief Make a bitmap filled with either a flat colour or a repeatable pseudo-random pattern.
+ */
+Integration::BitmapPtr MakeBitmap( Pixel::Format format, unsigned int width, unsigned int height, bool noisy )
+{
+  Integration::BitmapPtr bitmap = Integration::Bitmap::New( Integration::Bitmap::BITMAP_2D_PACKED_PIXELS, ResourcePolicy::OWNED_DISCARD );
+  unsigned char * const pixels = bitmap->GetPackedPixelsProfile()->ReserveBuffer( format, width, height, width, height );
+  const size_t numBytes = width * height * Pixel::GetBytesPerPixel( format );
+
+  srand48( width * height );
+  for( size_t byte = 0; byte < numBytes; ++byte )
+  {
+    pixels[byte] = noisy ? lrand48() : 0x7f;
+  }
+  return bitmap;
+}
+
+ThumbnailCache::Key MakeKey( const char * const path, long long modificationTime = 1000 )
+{
+  return ThumbnailCache::Key( path, modificationTime, 4096, ImageDimensions( 64, 64 ), FittingMode::SHRINK_TO_FIT, SamplingMode::BOX, true );
+}
+
+bool BitmapsMatch( Integration::Bitmap& a, Integration::Bitmap& b )
+{
+  return a.GetImageWidth() == b.GetImageWidth() &&
+         a.GetImageHeight() == b.GetImageHeight() &&
+         a.GetPixelFormat() == b.GetPixelFormat() &&
+         memcmp( a.GetBuffer(), b.GetBuffer(), a.GetImageWidth() * a.GetImageHeight() * Pixel::GetBytesPerPixel( a.GetPixelFormat() ) ) == 0;
+}
+
+/**
+ * @brief Find the path of the only file in the cache directory.
+ */
+std::string GetOnlyFilePath()
+{
+  std::string path;
+  DIR* const dir = opendir( gDirectory.c_str() );
+  for( struct dirent* entry = readdir( dir ); entry != NULL; entry = readdir( dir ) )
+  {
+    if( entry->d_name[0] != '.' )
+    {
+      path = gDirectory + '/' + entry->d_name;
+    }
+  }
+  closedir( dir );
+  return path;
+}
+
+/**
+ * @brief Overwrite the stored payload size in the header of the only entry in the cache directory.
+ */
+void SetOnlyEntryPayloadBytes( uint32_t payloadBytes )
+{
+  // The magic followed by six 32 bit fields come before the payload size:
+  const long PAYLOAD_BYTES_OFFSET = 8 + 6 * 4;
+
+  FILE* const fp = fopen( GetOnlyFilePath().c_str(), "r+b" );
+  fseek( fp, PAYLOAD_BYTES_OFFSET, SEEK_SET );
+  fwrite( &payloadBytes, sizeof( payloadBytes ), 1, fp );
+  fclose( fp );
+}
+
+} // anon namespace
+
+void utc_dali_thumbnail_cache_startup(void)
+{
+  char directory[] = "/tmp/dali-thumbnail-cache-XXXXXX";
+  gDirectory = mkdtemp( directory );
+}
+
+void utc_dali_thumbnail_cache_cleanup(void)
+{
+  ThumbnailCache cache;
+  cache.SetDirectory( gDirectory, CACHE_CAPACITY );
+  cache.Clear();
+  rmdir( gDirectory.c_str() );
+}
+
+int UtcDaliThumbnailCacheDisabled(void)
+{
+  ThumbnailCache cache;
+  DALI_TEST_CHECK( !cache.IsEnabled() );
+
+  Integration::BitmapPtr bitmap = MakeBitmap( Pixel::RGB888, 32, 32, true );
+  DALI_TEST_CHECK( !cache.Insert( MakeKey( "a.jpg" ), *bitmap ) );
+  DALI_TEST_CHECK( !cache.Find( MakeKey( "a.jpg" ) ) );
+  DALI_TEST_EQUALS( cache.GetCount(), 0u, TEST_LOCATION );
+
+  END_TEST;
+}
+
+/**
+ * @brief Both flat images, which are run length encoded, and noisy ones, which
+ * are stored raw, must come back exactly as they went in.
+ */
+int UtcDaliThumbnailCacheRoundTrip(void)
+{
+  ThumbnailCache cache;
+  DALI_TEST_CHECK( cache.SetDirectory( gDirectory, CACHE_CAPACITY ) );
+
+  const Pixel::Format formats[] = { Pixel::RGBA8888, Pixel::RGB888, Pixel::LA88, Pixel::L8 };
+  const unsigned int numFormats = sizeof(formats) / sizeof(formats[0]);
+  for( unsigned int format = 0; format < numFormats; ++format )
+  {
+    for( unsigned int noisy = 0; noisy < 2; ++noisy )
+    {
+      const ThumbnailCache::Key key( "image.jpg", 1000, 4096, ImageDimensions( 64, 48 + format ), FittingMode::SHRINK_TO_FIT, SamplingMode::BOX, noisy );
+      Integration::BitmapPtr bitmap = MakeBitmap( formats[format], 61, 47, noisy );
+
+      DALI_TEST_CHECK( !cache.Find( key ) );
+      DALI_TEST_CHECK( cache.Insert( key, *bitmap ) );
+      Integration::BitmapPtr cached = cache.Find( key );
+      DALI_TEST_CHECK( cached );
+      DALI_TEST_CHECK( cached && BitmapsMatch( *bitmap, *cached ) );
+    }
+  }
+  DALI_TEST_EQUALS( cache.GetHitCount(), numFormats * 2u, TEST_LOCATION );
+  DALI_TEST_EQUALS( cache.GetMissCount(), numFormats * 2u, TEST_LOCATION );
+
+  // A flat image takes much less space than its pixels:
+  cache.Clear();
+  Integration::BitmapPtr flat = MakeBitmap( Pixel::RGBA8888, 100, 100, false );
+  DALI_TEST_CHECK( cache.Insert( MakeKey( "flat.png" ), *flat ) );
+  DALI_TEST_CHECK( cache.GetSize() < 100u * 100u );
+
+  END_TEST;
+}
+
+/**
+ * @brief Modifying the source file changes the key, so it must miss.
+ */
+int UtcDaliThumbnailCacheModifiedFileMisses(void)
+{
+  ThumbnailCache cache;
+  cache.SetDirectory( gDirectory, CACHE_CAPACITY );
+
+  Integration::BitmapPtr bitmap = MakeBitmap( Pixel::RGB888, 32, 32, true );
+  DALI_TEST_CHECK( cache.Insert( MakeKey( "a.jpg", 1000 ), *bitmap ) );
+  DALI_TEST_CHECK( cache.Find( MakeKey( "a.jpg", 1000 ) ) );
+  DALI_TEST_CHECK( !cache.Find( MakeKey( "a.jpg", 2000 ) ) );
+  DALI_TEST_CHECK( !cache.Find( MakeKey( "b.jpg", 1000 ) ) );
+
+  END_TEST;
+}
+
+/**
+ * @brief Entries must survive a restart, with the least recently used evicted first.
+ */
+int UtcDaliThumbnailCacheLeastRecentlyUsedEviction(void)
+{
+  Integration::BitmapPtr bitmap = MakeBitmap( Pixel::RGB888, 32, 32, true );
+  const char * const paths[] = { "0.jpg", "1.jpg", "2.jpg" };
+  std::size_t entrySize = 0;
+  {
+    ThumbnailCache cache;
+    cache.SetDirectory( gDirectory, CACHE_CAPACITY );
+    for( unsigned int i = 0; i < 3u; ++i )
+    {
+      DALI_TEST_CHECK( cache.Insert( MakeKey( paths[i] ), *bitmap ) );
+      usleep( 10000 );
+    }
+    entrySize = cache.GetSize() / 3u;
+
+    // Make the oldest entry the most recently used:
+    DALI_TEST_CHECK( cache.Find( MakeKey( paths[0] ) ) );
+  }
+
+  // Restart with room for only two entries:
+  ThumbnailCache cache;
+  DALI_TEST_CHECK( cache.SetDirectory( gDirectory, entrySize * 2u ) );
+  DALI_TEST_EQUALS( cache.GetCount(), 2u, TEST_LOCATION );
+  DALI_TEST_CHECK( cache.Find( MakeKey( paths[0] ) ) );
+  DALI_TEST_CHECK( !cache.Find( MakeKey( paths[1] ) ) );
+  DALI_TEST_CHECK( cache.Find( MakeKey( paths[2] ) ) );
+
+  // Adding another evicts the least recently used:
+  DALI_TEST_CHECK( cache.Insert( MakeKey( paths[1] ), *bitmap ) );
+  DALI_TEST_EQUALS( cache.GetCount(), 2u, TEST_LOCATION );
+  DALI_TEST_CHECK( !cache.Find( MakeKey( paths[0] ) ) );
+
+  END_TEST;
+}
+
+/**
+ * @brief Damaged entries and the leftovers of interrupted writes must be discarded.
+ */
+int UtcDaliThumbnailCacheDamagedEntries(void)
+{
+  Integration::BitmapPtr bitmap = MakeBitmap( Pixel::RGB888, 32, 32, true );
+  {
+    ThumbnailCache cache;
+    cache.SetDirectory( gDirectory, CACHE_CAPACITY );
+    DALI_TEST_CHECK( cache.Insert( MakeKey( "a.jpg" ), *bitmap ) );
+  }
+
+  // Flip a byte of the pixels:
+  const std::string entryPath = GetOnlyFilePath();
+  FILE* fp = fopen( entryPath.c_str(), "r+b" );
+  fseek( fp, -1, SEEK_END );
+  const int lastByte = fgetc( fp );
+  fseek( fp, -1, SEEK_END );
+  fputc( lastByte ^ 0xff, fp );
+  fclose( fp );
+
+  // Leave a partly written entry behind:
+  const std::string temporaryPath = gDirectory + "/0123456789abcdef.thumb.tmpABCDEF";
+  fp = fopen( temporaryPath.c_str(), "wb" );
+  fputs( "DALI", fp );
+  fclose( fp );
+
+  ThumbnailCache cache;
+  cache.SetDirectory( gDirectory, CACHE_CAPACITY );
+  DALI_TEST_CHECK( access( temporaryPath.c_str(), F_OK ) != 0 );
+  DALI_TEST_EQUALS( cache.GetCount(), 1u, TEST_LOCATION );
+  DALI_TEST_CHECK( !cache.Find( MakeKey( "a.jpg" ) ) );
+  DALI_TEST_EQUALS( cache.GetCount(), 0u, TEST_LOCATION );
+  DALI_TEST_CHECK( access( entryPath.c_str(), F_OK ) != 0 );
+
+  END_TEST;
+}
+
+/**
+ * @brief Entries whose header claims an empty payload, or one longer than the file, must be discarded without reading it.
+ */
+int UtcDaliThumbnailCacheCorruptPayloadSize(void)
+{
+  // A flat bitmap is stored run length encoded, so its payload is much smaller than its pixels:
+  Integration::BitmapPtr bitmap = MakeBitmap( Pixel::RGB888, 32, 32, false );
+  const uint32_t PAYLOAD_SIZES[] = { 0u, 32u * 32u * 3u };
+
+  for( unsigned int i = 0; i < sizeof( PAYLOAD_SIZES ) / sizeof( PAYLOAD_SIZES[0] ); ++i )
+  {
+    ThumbnailCache cache;
+    cache.SetDirectory( gDirectory, CACHE_CAPACITY );
+    DALI_TEST_CHECK( cache.Insert( MakeKey( "a.jpg" ), *bitmap ) );
+    DALI_TEST_CHECK( cache.Find( MakeKey( "a.jpg" ) ) );
+
+    SetOnlyEntryPayloadBytes( PAYLOAD_SIZES[i] );
+    DALI_TEST_CHECK( !cache.Find( MakeKey( "a.jpg" ) ) );
+    DALI_TEST_EQUALS( cache.GetCount(), 0u, TEST_LOCATION );
+  }
+
+  END_TEST;
+}
@@ -0,0 +1,274 @@
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <stdint.h>
+#include <unistd.h>
+#include <cmath>
+#include <vector>
+#include <Ecore.h>
+#include <dali/public-api/adaptor-framework/timer.h>
+#include <dali/public-api/signals/connection-tracker.h>
+#include <dali-test-suite-utils.h>
+
+#include "adaptors/common/timer-coalescer.h"
+
+using namespace Dali;
+using namespace Dali::Internal::Adaptor;
+
+namespace
+{
+
+/**
+ * @brief A periodic timer driven the way the event loop drives it.
+ */
+struct SimulatedTimer
+{
+  SimulatedTimer( const TimerCoalescer& coalescer, uint64_t startTime, unsigned int interval )
+  : expiryTime( startTime + interval ),
+    fireTime( coalescer.Coalesce( expiryTime, interval ) ),
+    interval( interval )
+  {
+  }
+
+  void Fired( const TimerCoalescer& coalescer )
+  {
+    expiryTime += interval;
+    fireTime = coalescer.Coalesce( expiryTime, interval );
+  }
+
+  uint64_t expiryTime;
+  uint64_t fireTime;
+  unsigned int interval;
+};
+
+/**
+ * @brief Run a set of timers for a simulated ten seconds, recording a wakeup each time any of them fires.
+ * @return The number of wakeups
+ */
+unsigned int RunTimers( TimerCoalescer& coalescer, const unsigned int* intervals, unsigned int count )
+{
+  const uint64_t startTime = 1234u;
+  std::vector< SimulatedTimer > timers;
+  for( unsigned int i = 0; i < count; ++i )
+  {
+    timers.push_back( SimulatedTimer( coalescer, startTime + i * 37u, intervals[i] ) );
+  }
+
+  for( uint64_t loopTime = startTime; loopTime < startTime + 10000u; ++loopTime )
+  {
+    for( unsigned int i = 0; i < count; ++i )
+    {
+      if( timers[i].fireTime == loopTime )
+      {
+        DALI_TEST_CHECK( timers[i].fireTime >= timers[i].expiryTime );
+        DALI_TEST_CHECK( timers[i].fireTime - timers[i].expiryTime <= timers[i].interval / 4u );
+
+        coalescer.RecordWakeup( loopTime );
+        timers[i].Fired( coalescer );
+      }
+    }
+  }
+
+  // The rate is measured over whole seconds
+  DALI_TEST_CHECK( coalescer.GetWakeupsPerSecond() > 0.0f );
+
+  return coalescer.GetWakeupCount();
+}
+
+/**
+ * @brief Records the times an ecore driven timer ticks, and stops the main loop once every recorder has enough ticks.
+ */
+struct TickRecorder : public ConnectionTracker
+{
+  TickRecorder( unsigned int ticks, unsigned int& unfinishedRecorders )
+  : ticks( ticks ),
+    unfinishedRecorders( unfinishedRecorders )
+  {
+  }
+
+  bool Tick()
+  {
+    times.push_back( ecore_time_get() );
+    if( times.size() == ticks && --unfinishedRecorders == 0u )
+    {
+      ecore_main_loop_quit();
+    }
+    return true;
+  }
+
+  std::vector< double > times;      ///< The times of the ticks, in seconds
+  unsigned int ticks;               ///< The number of ticks to record
+  unsigned int& unfinishedRecorders; ///< The number of recorders which haven't recorded all their ticks
+};
+
+/**
+ * @brief Stops the main loop if the timers never finish.
+ */
+Eina_Bool QuitMainLoop( void* )
+{
+  ecore_main_loop_quit();
+  return EINA_FALSE;
+}
+
+} // anon namespace
+
+void utc_dali_timer_coalescer_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_timer_coalescer_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+/**
+ * @brief Without a slack window, timers fire when they are due.
+ */
+int UtcDaliTimerCoalescerNoSlack(void)
+{
+  TimerCoalescer coalescer;
+
+  DALI_TEST_EQUALS( coalescer.GetSlack(), 0u, TEST_LOCATION );
+  DALI_TEST_EQUALS( coalescer.Coalesce( 1001u, 1000u ), uint64_t( 1001u ), TEST_LOCATION );
+  DALI_TEST_EQUALS( coalescer.Coalesce( 12345u, 16u ), uint64_t( 12345u ), TEST_LOCATION );
+
+  END_TEST;
+}
+
+/**
+ * @brief Timers due in the same slack window fire together at its end, but frequent timers are not delayed much.
+ */
+int UtcDaliTimerCoalescerAlignsExpiryTimes(void)
+{
+  TimerCoalescer coalescer;
+  coalescer.SetSlack( 100u );
+  DALI_TEST_EQUALS( coalescer.GetSlack(), 100u, TEST_LOCATION );
+
+  DALI_TEST_EQUALS( coalescer.Coalesce( 1001u, 1000u ), uint64_t( 1100u ), TEST_LOCATION );
+  DALI_TEST_EQUALS( coalescer.Coalesce( 1099u, 500u ), uint64_t( 1100u ), TEST_LOCATION );
+  DALI_TEST_EQUALS( coalescer.Coalesce( 1100u, 1000u ), uint64_t( 1100u ), TEST_LOCATION );
+
+  // Delaying these by more than a quarter of their interval would slow them down noticeably
+  DALI_TEST_EQUALS( coalescer.Coalesce( 1001u, 16u ), uint64_t( 1001u ), TEST_LOCATION );
+  DALI_TEST_EQUALS( coalescer.Coalesce( 1001u, 200u ), uint64_t( 1001u ), TEST_LOCATION );
+  DALI_TEST_EQUALS( coalescer.Coalesce( 1080u, 200u ), uint64_t( 1100u ), TEST_LOCATION );
+
+  END_TEST;
+}
+
+/**
+ * @brief Callbacks run in the same loop iteration are one wakeup.
+ */
+int UtcDaliTimerCoalescerCountsWakeups(void)
+{
+  TimerCoalescer coalescer;
+  DALI_TEST_EQUALS( coalescer.GetWakeupCount(), 0u, TEST_LOCATION );
+
+  coalescer.RecordWakeup( 0u );
+  coalescer.RecordWakeup( 0u );
+  coalescer.RecordWakeup( 10u );
+  coalescer.RecordWakeup( 10u );
+  coalescer.RecordWakeup( 20u );
+  DALI_TEST_EQUALS( coalescer.GetWakeupCount(), 3u, TEST_LOCATION );
+
+  // No rate until a whole second has been measured
+  DALI_TEST_EQUALS( coalescer.GetWakeupsPerSecond(), 0.0f, TEST_LOCATION );
+
+  coalescer.RecordWakeup( 1000u );
+  DALI_TEST_EQUALS( coalescer.GetWakeupCount(), 4u, TEST_LOCATION );
+  DALI_TEST_EQUALS( coalescer.GetWakeupsPerSecond(), 3.0f, TEST_LOCATION );
+
+  END_TEST;
+}
+
+/**
+ * @brief Coalescing several unrelated periodic timers reduces the wakeups per second.
+ */
+int UtcDaliTimerCoalescerReducesWakeups(void)
+{
+  const unsigned int intervals[] = { 1000u, 1000u, 500u, 2000u };
+  const unsigned int count = sizeof( intervals ) / sizeof( intervals[0] );
+
+  TimerCoalescer uncoalesced;
+  const unsigned int uncoalescedWakeups = RunTimers( uncoalesced, intervals, count );
+
+  TimerCoalescer coalesced;
+  coalesced.SetSlack( 100u );
+  const unsigned int coalescedWakeups = RunTimers( coalesced, intervals, count );
+
+  tet_printf( "Wakeups in ten seconds: %u uncoalesced, %u coalesced\n", uncoalescedWakeups, coalescedWakeups );
+
+  DALI_TEST_CHECK( coalescedWakeups * 4u < uncoalescedWakeups * 3u );
+
+  END_TEST;
+}
+
+/**
+ * @brief Ecore timers started part way through a loop iteration fire on the end of their slot, rather than late by
+ * however much of the iteration had run, so timers due in the same slot share a wakeup.
+ */
+int UtcDaliTimerCoalescerEcoreTimersFireOnSlots(void)
+{
+  const unsigned int SLACK = 50u;
+  const unsigned int TICKS = 6u;
+  const double TOLERANCE = 0.005; // Seconds an ecore timer may wake after it is due
+
+  ecore_init();
+  TimerCoalescer::Get().SetSlack( SLACK );
+
+  unsigned int unfinishedRecorders = 2u;
+  TickRecorder fast( TICKS, unfinishedRecorders );
+  TickRecorder slow( TICKS, unfinishedRecorders );
+
+  // Let the loop time go stale, as it does while the loop iteration starting the timers runs
+  usleep( 20000 );
+
+  Dali::Timer fastTimer = Dali::Timer::New( 4u * SLACK );
+  fastTimer.TickSignal().Connect( &fast, &TickRecorder::Tick );
+  Dali::Timer slowTimer = Dali::Timer::New( 6u * SLACK );
+  slowTimer.TickSignal().Connect( &slow, &TickRecorder::Tick );
+  fastTimer.Start();
+  slowTimer.Start();
+
+  Ecore_Timer* timeout = ecore_timer_add( 10.0, QuitMainLoop, NULL );
+  ecore_main_loop_begin();
+  ecore_timer_del( timeout );
+
+  fastTimer.Stop();
+  slowTimer.Stop();
+  TimerCoalescer::Get().SetSlack( 0u );
+
+  DALI_TEST_EQUALS( fast.times.size(), std::size_t( TICKS ), TEST_LOCATION );
+  DALI_TEST_EQUALS( slow.times.size(), std::size_t( TICKS ), TEST_LOCATION );
+
+  const TickRecorder* const recorders[] = { &fast, &slow };
+  for( unsigned int i = 0u; i < 2u; ++i )
+  {
+    for( std::vector< double >::const_iterator it = recorders[i]->times.begin(); it != recorders[i]->times.end(); ++it )
+    {
+      // How long after the end of a slot the timer ticked
+      const double lateness = fmod( *it, SLACK / 1000.0 );
+      tet_printf( "Timer %u ticked %.2f ms after its slot\n", i, lateness * 1000.0 );
+      DALI_TEST_CHECK( lateness < TOLERANCE );
+    }
+  }
+
+  ecore_shutdown();
+
+  END_TEST;
+}
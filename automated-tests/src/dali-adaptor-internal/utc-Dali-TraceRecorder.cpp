@@ -0,0 +1,202 @@
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <stdint.h>
+#include <string>
+#include <pthread.h>
+#include <dali-test-suite-utils.h>
+
+#include "adaptors/base/performance-logging/trace-recorder.h"
+
+using namespace Dali;
+using namespace Dali::Internal::Adaptor;
+
+namespace
+{
+
+const unsigned int MARKERS_PER_THREAD = 100u;
+
+/**
+ * @brief Count the occurrences of some text in the trace.
+ */
+unsigned int CountOf( const std::string& trace, const char* const text )
+{
+  unsigned int count = 0u;
+  for( std::string::size_type position = trace.find( text ); position != std::string::npos; position = trace.find( text, position + 1u ) )
+  {
+    ++count;
+  }
+  return count;
+}
+
+/**
+ * @brief Records update markers from a new thread.
+ */
+void* RecordUpdates( void* recorder )
+{
+  for( unsigned int i = 0; i < MARKERS_PER_THREAD; ++i )
+  {
+    static_cast< TraceRecorder* >( recorder )->Record( PerformanceInterface::UPDATE_START, 1000u + i * 10u );
+    static_cast< TraceRecorder* >( recorder )->Record( PerformanceInterface::UPDATE_END, 1005u + i * 10u );
+  }
+  return NULL;
+}
+
+} // anon namespace
+
+void utc_dali_trace_recorder_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_trace_recorder_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+/**
+ * @brief The buffer size is rounded up to a power of two, and nothing is dumped until something is recorded.
+ */
+int UtcDaliTraceRecorderEmpty(void)
+{
+  TraceRecorder recorder( 1000u );
+  DALI_TEST_EQUALS( recorder.GetBufferSize(), 1024u, TEST_LOCATION );
+  DALI_TEST_EQUALS( recorder.GetThreadCount(), 0u, TEST_LOCATION );
+
+  TraceRecorder defaultRecorder( 0u );
+  DALI_TEST_EQUALS( defaultRecorder.GetBufferSize(), TraceRecorder::DEFAULT_BUFFER_SIZE, TEST_LOCATION );
+
+  std::string trace;
+  recorder.DumpChromeTrace( trace );
+  DALI_TEST_EQUALS( trace, std::string( "{\"traceEvents\":[],\"displayTimeUnit\":\"ms\"}\n" ), TEST_LOCATION );
+
+  END_TEST;
+}
+
+/**
+ * @brief Start and end markers become the beginning and end of a slice, and vsyncs are frame boundaries.
+ */
+int UtcDaliTraceRecorderInternalMarkers(void)
+{
+  TraceRecorder recorder;
+  recorder.Record( PerformanceInterface::VSYNC, 1000u );
+  recorder.Record( PerformanceInterface::UPDATE_START, 1010u );
+  recorder.Record( PerformanceInterface::UPDATE_END, 1020u );
+  recorder.Record( PerformanceInterface::PROCESS_EVENTS_START, 1030u );
+  recorder.Record( PerformanceInterface::PROCESS_EVENTS_END, 1040u );
+  recorder.Record( PerformanceInterface::FRAME_DEADLINE_MISSED, 1050u );
+  DALI_TEST_EQUALS( recorder.GetThreadCount(), 1u, TEST_LOCATION );
+
+  std::string trace;
+  recorder.DumpChromeTrace( trace );
+  tet_printf( "%s", trace.c_str() );
+
+  DALI_TEST_CHECK( trace.find( "\"name\":\"V_SYNC\",\"ph\":\"i\",\"ts\":1000," ) != std::string::npos );
+  DALI_TEST_CHECK( trace.find( "\"s\":\"g\"" ) != std::string::npos );
+  DALI_TEST_CHECK( trace.find( "\"name\":\"UPDATE\",\"ph\":\"B\",\"ts\":1010," ) != std::string::npos );
+  DALI_TEST_CHECK( trace.find( "\"name\":\"UPDATE\",\"ph\":\"E\",\"ts\":1020," ) != std::string::npos );
+  DALI_TEST_CHECK( trace.find( "\"name\":\"PROCESS_EVENT\",\"ph\":\"B\",\"ts\":1030," ) != std::string::npos );
+  DALI_TEST_CHECK( trace.find( "\"name\":\"FRAME_DEADLINE_MISSED\",\"ph\":\"i\",\"ts\":1050," ) != std::string::npos );
+  DALI_TEST_EQUALS( CountOf( trace, "\"ph\":\"M\"" ), 1u, TEST_LOCATION );
+
+  END_TEST;
+}
+
+/**
+ * @brief Custom markers are named after their context, or numbered if it has no name.
+ */
+int UtcDaliTraceRecorderCustomMarkers(void)
+{
+  TraceRecorder recorder;
+  recorder.SetContextName( 4u, "SIZE_NEGOTIATION" );
+  recorder.SetContextName( 5u, "Quote\"d" );
+  recorder.Record( PerformanceInterface::START, 4u, 2000u );
+  recorder.Record( PerformanceInterface::END, 4u, 2500u );
+  recorder.Record( PerformanceInterface::START, 5u, 3000u );
+  recorder.Record( PerformanceInterface::START, 6u, 3500u );
+
+  std::string trace;
+  recorder.DumpChromeTrace( trace );
+
+  DALI_TEST_CHECK( trace.find( "\"name\":\"SIZE_NEGOTIATION\",\"ph\":\"B\",\"ts\":2000," ) != std::string::npos );
+  DALI_TEST_CHECK( trace.find( "\"name\":\"SIZE_NEGOTIATION\",\"ph\":\"E\",\"ts\":2500," ) != std::string::npos );
+  DALI_TEST_CHECK( trace.find( "\"name\":\"Quote\\\"d\",\"ph\":\"B\"" ) != std::string::npos );
+  DALI_TEST_CHECK( trace.find( "\"name\":\"CONTEXT_6\",\"ph\":\"B\"" ) != std::string::npos );
+
+  END_TEST;
+}
+
+/**
+ * @brief Only the most recent markers are kept, less the oldest once the buffer is full, as it may be being overwritten.
+ */
+int UtcDaliTraceRecorderKeepsMostRecent(void)
+{
+  TraceRecorder recorder( 4u );
+  for( unsigned int i = 0; i < 3u; ++i )
+  {
+    recorder.Record( PerformanceInterface::VSYNC, 100u + i );
+  }
+
+  std::string trace;
+  recorder.DumpChromeTrace( trace );
+  DALI_TEST_EQUALS( CountOf( trace, "\"name\":\"V_SYNC\"" ), 3u, TEST_LOCATION );
+  DALI_TEST_CHECK( trace.find( "\"ts\":100," ) != std::string::npos );
+
+  for( unsigned int i = 3u; i < 10u; ++i )
+  {
+    recorder.Record( PerformanceInterface::VSYNC, 100u + i );
+  }
+
+  recorder.DumpChromeTrace( trace );
+  DALI_TEST_EQUALS( CountOf( trace, "\"name\":\"V_SYNC\"" ), 3u, TEST_LOCATION );
+  DALI_TEST_CHECK( trace.find( "\"ts\":106," ) == std::string::npos );
+  DALI_TEST_CHECK( trace.find( "\"ts\":107," ) != std::string::npos );
+  DALI_TEST_CHECK( trace.find( "\"ts\":109," ) != std::string::npos );
+
+  END_TEST;
+}
+
+/**
+ * @brief Each thread records into its own buffer, and is its own track in the trace.
+ */
+int UtcDaliTraceRecorderThreads(void)
+{
+  TraceRecorder recorder;
+
+  pthread_t threads[ 2 ];
+  for( unsigned int i = 0; i < 2u; ++i )
+  {
+    pthread_create( &threads[i], NULL, RecordUpdates, &recorder );
+  }
+  for( unsigned int i = 0; i < 2u; ++i )
+  {
+    pthread_join( threads[i], NULL );
+  }
+
+  DALI_TEST_EQUALS( recorder.GetThreadCount(), 2u, TEST_LOCATION );
+
+  std::string trace;
+  recorder.DumpChromeTrace( trace );
+
+  DALI_TEST_EQUALS( CountOf( trace, "\"ph\":\"M\"" ), 2u, TEST_LOCATION );
+  DALI_TEST_EQUALS( CountOf( trace, "\"ph\":\"B\"" ), 2u * MARKERS_PER_THREAD, TEST_LOCATION );
+  DALI_TEST_EQUALS( CountOf( trace, "\"ph\":\"E\"" ), 2u * MARKERS_PER_THREAD, TEST_LOCATION );
+  DALI_TEST_EQUALS( CountOf( trace, "\"tid\":1}" ), MARKERS_PER_THREAD * 2u, TEST_LOCATION );
+  DALI_TEST_EQUALS( CountOf( trace, "\"tid\":2}" ), MARKERS_PER_THREAD * 2u, TEST_LOCATION );
+
+  END_TEST;
+}
@@ -0,0 +1,365 @@
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <stdint.h>
+#include <vector>
+#include <pthread.h>
+#include <poll.h>
+#include <unistd.h>
+#include <sys/eventfd.h>
+#include <dali-test-suite-utils.h>
+
+#include "adaptors/common/trigger-event-queue.h"
+#include "test-timing.h"
+
+using namespace Dali;
+using namespace Dali::Internal::Adaptor;
+
+namespace
+{
+
+const unsigned int PRODUCER_THREADS = 4u;
+const unsigned int TRIGGERS_PER_THREAD = 200000u;
+
+/**
+ * @brief Records the order entries are dispatched in, and optionally triggers or removes an entry when dispatched.
+ */
+struct RecordingEntry : public TriggerEventQueue::Entry
+{
+  RecordingEntry( TriggerEventQueue& queue, std::vector< int >& dispatched, int id )
+  : queue( queue ),
+    dispatched( dispatched ),
+    pushWhenDispatched( NULL ),
+    removeWhenDispatched( NULL ),
+    id( id )
+  {
+  }
+
+  virtual ~RecordingEntry()
+  {
+  }
+
+  virtual void Dispatch()
+  {
+    dispatched.push_back( id );
+    if( pushWhenDispatched )
+    {
+      queue.Push( *pushWhenDispatched );
+      pushWhenDispatched = NULL;
+    }
+    if( removeWhenDispatched )
+    {
+      queue.Remove( *removeWhenDispatched );
+    }
+  }
+
+  TriggerEventQueue& queue;
+  std::vector< int >& dispatched;
+  RecordingEntry* pushWhenDispatched;
+  RecordingEntry* removeWhenDispatched;
+  int id;
+};
+
+/**
+ * @brief Counts how many times it is dispatched, for the benchmark.
+ */
+struct CountingEntry : public TriggerEventQueue::Entry
+{
+  CountingEntry()
+  : count( 0u )
+  {
+  }
+
+  virtual ~CountingEntry()
+  {
+  }
+
+  virtual void Dispatch()
+  {
+    ++count;
+  }
+
+  unsigned int count;
+};
+
+/**
+ * @brief One producer thread of the benchmark, with either a queue entry or an event file descriptor of its own.
+ */
+struct Producer
+{
+  TriggerEventQueue* queue;
+  CountingEntry entry;
+  int fileDescriptor;
+  volatile int finished;
+};
+
+void* TriggerQueue( void* data )
+{
+  Producer& producer = *static_cast< Producer* >( data );
+  for( unsigned int i = 0; i < TRIGGERS_PER_THREAD; ++i )
+  {
+    producer.queue->Push( producer.entry );
+  }
+  __sync_lock_test_and_set( &producer.finished, 1 );
+  return NULL;
+}
+
+void* TriggerFileDescriptor( void* data )
+{
+  Producer& producer = *static_cast< Producer* >( data );
+  for( unsigned int i = 0; i < TRIGGERS_PER_THREAD; ++i )
+  {
+    uint64_t one = 1u;
+    if( write( producer.fileDescriptor, &one, sizeof( one ) ) != sizeof( one ) )
+    {
+      break;
+    }
+  }
+  __sync_lock_test_and_set( &producer.finished, 1 );
+  return NULL;
+}
+
+/**
+ * @brief Whether all the producers have finished triggering.
+ */
+bool Finished( Producer* producers )
+{
+  for( unsigned int i = 0; i < PRODUCER_THREADS; ++i )
+  {
+    if( ! __sync_fetch_and_or( &producers[i].finished, 0 ) )
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+} // anon namespace
+
+void utc_dali_trigger_event_queue_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_trigger_event_queue_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+/**
+ * @brief Entries are dispatched in one batch, in the order they were pushed, after one wakeup.
+ */
+int UtcDaliTriggerEventQueueBatch(void)
+{
+  TriggerEventQueue queue;
+  DALI_TEST_CHECK( queue.GetFileDescriptor() >= 0 );
+
+  std::vector< int > dispatched;
+  RecordingEntry first( queue, dispatched, 1 );
+  RecordingEntry second( queue, dispatched, 2 );
+  RecordingEntry third( queue, dispatched, 3 );
+
+  queue.Push( first );
+  queue.Push( second );
+  queue.Push( second );
+  queue.Push( third );
+
+  // Only the first push wrote to the file descriptor; reading it here means the dispatch finds it unreadable
+  uint64_t wakeups = 0u;
+  DALI_TEST_EQUALS( read( queue.GetFileDescriptor(), &wakeups, sizeof( wakeups ) ), ssize_t( sizeof( wakeups ) ), TEST_LOCATION );
+  DALI_TEST_EQUALS( wakeups, uint64_t( 1u ), TEST_LOCATION );
+
+  queue.Dispatch();
+  DALI_TEST_EQUALS( dispatched.size(), size_t( 3u ), TEST_LOCATION );
+  DALI_TEST_EQUALS( dispatched[0], 1, TEST_LOCATION );
+  DALI_TEST_EQUALS( dispatched[1], 2, TEST_LOCATION );
+  DALI_TEST_EQUALS( dispatched[2], 3, TEST_LOCATION );
+
+  // Nothing is left, and the next push wakes the dispatching thread again
+  queue.Dispatch();
+  DALI_TEST_EQUALS( dispatched.size(), size_t( 3u ), TEST_LOCATION );
+
+  queue.Push( first );
+  pollfd descriptor = { queue.GetFileDescriptor(), POLLIN, 0 };
+  DALI_TEST_EQUALS( poll( &descriptor, 1, 0 ), 1, TEST_LOCATION );
+  queue.Dispatch();
+  DALI_TEST_EQUALS( dispatched.size(), size_t( 4u ), TEST_LOCATION );
+
+  END_TEST;
+}
+
+/**
+ * @brief An entry triggered while it is dispatched, or triggering another, is dispatched in the next batch.
+ */
+int UtcDaliTriggerEventQueueTriggerDuringDispatch(void)
+{
+  TriggerEventQueue queue;
+  std::vector< int > dispatched;
+  RecordingEntry first( queue, dispatched, 1 );
+  RecordingEntry second( queue, dispatched, 2 );
+  first.pushWhenDispatched = &first;
+  second.pushWhenDispatched = &first;
+
+  queue.Push( first );
+  queue.Push( second );
+  queue.Dispatch();
+  DALI_TEST_EQUALS( dispatched.size(), size_t( 2u ), TEST_LOCATION );
+
+  pollfd descriptor = { queue.GetFileDescriptor(), POLLIN, 0 };
+  DALI_TEST_EQUALS( poll( &descriptor, 1, 0 ), 1, TEST_LOCATION );
+  queue.Dispatch();
+  DALI_TEST_EQUALS( dispatched.size(), size_t( 3u ), TEST_LOCATION );
+  DALI_TEST_EQUALS( dispatched[2], 1, TEST_LOCATION );
+
+  END_TEST;
+}
+
+/**
+ * @brief A removed entry is not dispatched, whether it is waiting or later in the current batch.
+ */
+int UtcDaliTriggerEventQueueRemove(void)
+{
+  TriggerEventQueue queue;
+  std::vector< int > dispatched;
+  RecordingEntry first( queue, dispatched, 1 );
+  RecordingEntry second( queue, dispatched, 2 );
+  RecordingEntry third( queue, dispatched, 3 );
+
+  queue.Push( first );
+  queue.Push( second );
+  queue.Push( third );
+  queue.Remove( second );
+
+  // Removing an entry which is not queued does nothing
+  queue.Remove( second );
+
+  first.removeWhenDispatched = &third;
+  queue.Dispatch();
+  DALI_TEST_EQUALS( dispatched.size(), size_t( 1u ), TEST_LOCATION );
+  DALI_TEST_EQUALS( dispatched[0], 1, TEST_LOCATION );
+
+  // Removed entries can be queued again
+  first.removeWhenDispatched = NULL;
+  queue.Push( third );
+  queue.Push( second );
+  queue.Dispatch();
+  DALI_TEST_EQUALS( dispatched.size(), size_t( 3u ), TEST_LOCATION );
+  DALI_TEST_EQUALS( dispatched[1], 3, TEST_LOCATION );
+  DALI_TEST_EQUALS( dispatched[2], 2, TEST_LOCATION );
+
+  END_TEST;
+}
+
+/**
+ * @brief Measures notifications per second from several threads through the shared queue, and through
+ * an event file descriptor per event as each trigger event had before.
+ *
+ * Timings are only printed, as they depend on the machine.
+ */
+int UtcDaliTriggerEventQueueBenchmark(void)
+{
+  TriggerEventQueue queue;
+  Producer producers[ PRODUCER_THREADS ];
+  pthread_t threads[ PRODUCER_THREADS ];
+
+  // The shared queue
+  for( unsigned int i = 0; i < PRODUCER_THREADS; ++i )
+  {
+    producers[i].queue = &queue;
+    producers[i].fileDescriptor = -1;
+    producers[i].finished = 0;
+  }
+
+  uint64_t start = GetNanoseconds();
+  for( unsigned int i = 0; i < PRODUCER_THREADS; ++i )
+  {
+    pthread_create( &threads[i], NULL, TriggerQueue, &producers[i] );
+  }
+
+  unsigned int queueWakeups = 0u;
+  pollfd descriptor = { queue.GetFileDescriptor(), POLLIN, 0 };
+  bool finished = false;
+  while( ! finished )
+  {
+    // Check before dispatching, so the last triggers are dispatched
+    finished = Finished( producers );
+    if( poll( &descriptor, 1, finished ? 0 : 100 ) > 0 )
+    {
+      queue.Dispatch();
+      ++queueWakeups;
+    }
+  }
+  const uint64_t queueTime = GetNanoseconds() - start;
+
+  for( unsigned int i = 0; i < PRODUCER_THREADS; ++i )
+  {
+    pthread_join( threads[i], NULL );
+
+    // Every thread's last trigger was dispatched, however many were merged
+    DALI_TEST_CHECK( producers[i].entry.count > 0u );
+    DALI_TEST_CHECK( producers[i].entry.count <= TRIGGERS_PER_THREAD );
+  }
+
+  // An event file descriptor for each producer
+  std::vector< pollfd > descriptors( PRODUCER_THREADS );
+  for( unsigned int i = 0; i < PRODUCER_THREADS; ++i )
+  {
+    producers[i].fileDescriptor = eventfd( 0, EFD_NONBLOCK );
+    producers[i].finished = 0;
+    descriptors[i].fd = producers[i].fileDescriptor;
+    descriptors[i].events = POLLIN;
+  }
+
+  start = GetNanoseconds();
+  for( unsigned int i = 0; i < PRODUCER_THREADS; ++i )
+  {
+    pthread_create( &threads[i], NULL, TriggerFileDescriptor, &producers[i] );
+  }
+
+  unsigned int fileDescriptorWakeups = 0u;
+  finished = false;
+  while( ! finished )
+  {
+    finished = Finished( producers );
+    if( poll( &descriptors[0], PRODUCER_THREADS, finished ? 0 : 100 ) > 0 )
+    {
+      for( unsigned int i = 0; i < PRODUCER_THREADS; ++i )
+      {
+        uint64_t count;
+        if( ( descriptors[i].revents & POLLIN ) && read( descriptors[i].fd, &count, sizeof( count ) ) == sizeof( count ) )
+        {
+          ++fileDescriptorWakeups;
+        }
+      }
+    }
+  }
+  const uint64_t fileDescriptorTime = GetNanoseconds() - start;
+
+  for( unsigned int i = 0; i < PRODUCER_THREADS; ++i )
+  {
+    pthread_join( threads[i], NULL );
+    close( producers[i].fileDescriptor );
+  }
+
+  const double notifications = static_cast< double >( PRODUCER_THREADS * TRIGGERS_PER_THREAD );
+  tet_printf( "Shared queue:           %.0f notifications per second, %u wakeups\n", notifications * 1e9 / static_cast< double >( queueTime ), queueWakeups );
+  tet_printf( "Event fd per trigger:   %.0f notifications per second, %u wakeups\n", notifications * 1e9 / static_cast< double >( fileDescriptorTime ), fileDescriptorWakeups );
+
+  DALI_TEST_CHECK( queueWakeups > 0u );
+
+  END_TEST;
+}
@@ -71,6 +71,10 @@ void TestGlAbstraction::Initialize()
   mLastProgramIdUsed = 0;
   mLastUniformIdUsed = 0;
 
+  mBufferCount = 0;
+  mTextureCount = 0;
+  mProgramCount = 0;
+
   mUniforms.clear();
   mProgramUniforms1i.clear();
   mProgramUniforms1f.clear();
@@ -97,6 +101,7 @@ void TestGlAbstraction::PreRender()
 
 void TestGlAbstraction::PostRender()
 {
+  mFrameRecorder.EndFrame( mBufferCount, mTextureCount, mProgramCount );
 }
 
 } // Namespace dali
@@ -32,6 +32,7 @@
 #include <dali/integration-api/gl-abstraction.h>
 #include <dali/integration-api/gl-defines.h>
 #include "test-trace-call-stack.h"
+#include "adaptors/common/gl/gl-frame-recorder.h"
 
 namespace Dali
 {
@@ -61,6 +62,7 @@ public:
 
   inline void ActiveTexture( GLenum textureUnit )
   {
+    mFrameRecorder.StateChange();
     mActiveTextureUnit = textureUnit - GL_TEXTURE0;
   }
 
@@ -86,10 +88,12 @@ public:
 
   inline void BindBuffer( GLenum target, GLuint buffer )
   {
+    mFrameRecorder.StateChange();
   }
 
   inline void BindFramebuffer( GLenum target, GLuint framebuffer )
   {
+    mFrameRecorder.StateChange();
     //Add 010 bit;
     mFramebufferStatus |= 2;
   }
@@ -132,6 +136,7 @@ public:
 
   inline void BindTexture( GLenum target, GLuint texture )
   {
+    mFrameRecorder.StateChange();
     // Record the bound textures for future checks
     if( texture )
     {
@@ -168,12 +173,14 @@ public:
 
   inline void BlendEquation( GLenum mode )
   {
+    mFrameRecorder.StateChange();
     mLastBlendEquationRgb   = mode;
     mLastBlendEquationAlpha = mode;
   }
 
   inline void BlendEquationSeparate( GLenum modeRgb, GLenum modeAlpha )
   {
+    mFrameRecorder.StateChange();
     mLastBlendEquationRgb   = modeRgb;
     mLastBlendEquationAlpha = modeAlpha;
   }
@@ -190,6 +197,7 @@ public:
 
   inline void BlendFunc(GLenum sfactor, GLenum dfactor)
   {
+    mFrameRecorder.StateChange();
     mLastBlendFuncSrcRgb = sfactor;
     mLastBlendFuncDstRgb = dfactor;
     mLastBlendFuncSrcAlpha = sfactor;
@@ -198,6 +206,7 @@ public:
 
   inline void BlendFuncSeparate(GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha)
   {
+    mFrameRecorder.StateChange();
     mLastBlendFuncSrcRgb = srcRGB;
     mLastBlendFuncDstRgb = dstRGB;
     mLastBlendFuncSrcAlpha = srcAlpha;
@@ -226,11 +235,16 @@ public:
 
   inline void BufferData(GLenum target, GLsizeiptr size, const void* data, GLenum usage)
   {
+    if( data )
+    {
+      mFrameRecorder.BufferUpload( size );
+    }
      mBufferDataCalls.push_back(size);
   }
 
   inline void BufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void* data)
   {
+    mFrameRecorder.BufferUpload( size );
      mBufferSubDataCalls.push_back(size);
   }
 
@@ -306,6 +320,10 @@ public:
 
   inline void CompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void* data)
   {
+    if( data )
+    {
+      mFrameRecorder.CompressedTextureUpload( imageSize );
+    }
     std::stringstream out;
     out << target<<", "<<level<<", "<<width << ", " << height;
 
@@ -323,6 +341,7 @@ public:
 
   inline void CompressedTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void* data)
   {
+    mFrameRecorder.CompressedTextureUpload( imageSize );
     std::stringstream out;
     out << target << ", "<<level <<", " << xoffset << ", " << yoffset << ", " << width << ", " << height;
 
@@ -346,6 +365,7 @@ public:
 
   inline GLuint CreateProgram(void)
   {
+    ++mProgramCount;
     mShaderTrace.PushCall("CreateProgram", "");
 
     ++mLastProgramIdUsed;
@@ -367,6 +387,7 @@ public:
 
   inline void CullFace(GLenum mode)
   {
+    mFrameRecorder.StateChange();
     std::stringstream out;
     out << mode;
 
@@ -378,6 +399,7 @@ public:
 
   inline void DeleteBuffers(GLsizei n, const GLuint* buffers)
   {
+    mBufferCount -= n;
   }
 
   inline void DeleteFramebuffers(GLsizei n, const GLuint* framebuffers)
@@ -386,6 +408,7 @@ public:
 
   inline void DeleteProgram(GLuint program)
   {
+    --mProgramCount;
     std::stringstream out;
     out << program;
 
@@ -412,6 +435,7 @@ public:
 
   inline void DeleteTextures(GLsizei n, const GLuint* textures)
   {
+    mTextureCount -= n;
     std::stringstream out;
     out << n << ", " << textures << " = [";
 
@@ -457,6 +481,7 @@ public:
 
   inline void DepthFunc(GLenum func)
   {
+    mFrameRecorder.StateChange();
     std::stringstream out;
     out << func;
 
@@ -468,6 +493,7 @@ public:
 
   inline void DepthMask(GLboolean flag)
   {
+    mFrameRecorder.StateChange();
   }
 
   inline void DepthRangef(GLclampf zNear, GLclampf zFar)
@@ -486,6 +512,7 @@ public:
 
   inline void Disable(GLenum cap)
   {
+    mFrameRecorder.StateChange();
     std::stringstream out;
     out << cap;
     TraceCallStack::NamedParams namedParams;
@@ -500,6 +527,7 @@ public:
 
   inline void DrawArrays(GLenum mode, GLint first, GLsizei count)
   {
+    mFrameRecorder.DrawCall();
     std::stringstream out;
     out << mode << ", " << first << ", " << count;
     TraceCallStack::NamedParams namedParams;
@@ -511,6 +539,7 @@ public:
 
   inline void DrawElements(GLenum mode, GLsizei count, GLenum type, const void* indices)
   {
+    mFrameRecorder.DrawCall();
     std::stringstream out;
     out << mode << ", " << count << ", " << type << ", indices";
 
@@ -524,6 +553,7 @@ public:
 
   inline void Enable(GLenum cap)
   {
+    mFrameRecorder.StateChange();
     std::stringstream out;
     out << cap;
     TraceCallStack::NamedParams namedParams;
@@ -574,6 +604,7 @@ public:
 
   inline void GenBuffers(GLsizei n, GLuint* buffers)
   {
+    mBufferCount += n;
     // avoids an assert in GpuBuffers
     *buffers = 1u;
   }
@@ -623,6 +654,7 @@ public:
 
   inline void GenTextures(GLsizei count, GLuint* textures)
   {
+    mTextureCount += count;
     for( int i=0; i<count; ++i )
     {
       if( !mNextTextureIds.empty() )
@@ -926,6 +958,7 @@ public:
 
   inline void Scissor(GLint x, GLint y, GLsizei width, GLsizei height)
   {
+    mFrameRecorder.StateChange();
     mScissorParams.x = x;
     mScissorParams.y = y;
     mScissorParams.width = width;
@@ -1047,6 +1080,10 @@ public:
 
   inline void TexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void* pixels)
   {
+    if( pixels )
+    {
+      mFrameRecorder.TextureUpload( width, height, format, type );
+    }
     std::stringstream out;
     out << target<<", "<<level<<", "<<width << ", " << height;
 
@@ -1113,6 +1150,7 @@ public:
 
   inline void TexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void* pixels)
   {
+    mFrameRecorder.TextureUpload( width, height, format, type );
     std::stringstream out;
     out << target << ", "<<level <<", " << xoffset << ", " << yoffset << ", " << width << ", " << height;
 
@@ -1128,6 +1166,7 @@ public:
 
   inline void Uniform1f(GLint location, GLfloat x)
   {
+    mFrameRecorder.UniformCall();
     if( ! mProgramUniforms1f.SetUniformValue( mCurrentProgram, location, x ) )
     {
       mGetErrorResult = GL_INVALID_OPERATION;
@@ -1136,6 +1175,7 @@ public:
 
   inline void Uniform1fv(GLint location, GLsizei count, const GLfloat* v)
   {
+    mFrameRecorder.UniformCall();
     for( int i = 0; i < count; ++i )
     {
       if( ! mProgramUniforms1f.SetUniformValue( mCurrentProgram, location, v[i] ) )
@@ -1148,6 +1188,7 @@ public:
 
   inline void Uniform1i(GLint location, GLint x)
   {
+    mFrameRecorder.UniformCall();
     if( ! mProgramUniforms1i.SetUniformValue( mCurrentProgram, location, x ) )
     {
       mGetErrorResult = GL_INVALID_OPERATION;
@@ -1156,6 +1197,7 @@ public:
 
   inline void Uniform1iv(GLint location, GLsizei count, const GLint* v)
   {
+    mFrameRecorder.UniformCall();
     for( int i = 0; i < count; ++i )
     {
       if( ! mProgramUniforms1i.SetUniformValue( mCurrentProgram,
@@ -1170,6 +1212,7 @@ public:
 
   inline void Uniform2f(GLint location, GLfloat x, GLfloat y)
   {
+    mFrameRecorder.UniformCall();
     if( ! mProgramUniforms2f.SetUniformValue( mCurrentProgram,
                                                location,
                                                Vector2( x, y ) ) )
@@ -1180,6 +1223,7 @@ public:
 
   inline void Uniform2fv(GLint location, GLsizei count, const GLfloat* v)
   {
+    mFrameRecorder.UniformCall();
     for( int i = 0; i < count; ++i )
     {
       if( ! mProgramUniforms2f.SetUniformValue( mCurrentProgram,
@@ -1194,14 +1238,17 @@ public:
 
   inline void Uniform2i(GLint location, GLint x, GLint y)
   {
+    mFrameRecorder.UniformCall();
   }
 
   inline void Uniform2iv(GLint location, GLsizei count, const GLint* v)
   {
+    mFrameRecorder.UniformCall();
   }
 
   inline void Uniform3f(GLint location, GLfloat x, GLfloat y, GLfloat z)
   {
+    mFrameRecorder.UniformCall();
     if( ! mProgramUniforms3f.SetUniformValue( mCurrentProgram,
                                                location,
                                                Vector3( x, y, z ) ) )
@@ -1212,6 +1259,7 @@ public:
 
   inline void Uniform3fv(GLint location, GLsizei count, const GLfloat* v)
   {
+    mFrameRecorder.UniformCall();
     for( int i = 0; i < count; ++i )
     {
       if( ! mProgramUniforms3f.SetUniformValue(
@@ -1227,14 +1275,17 @@ public:
 
   inline void Uniform3i(GLint location, GLint x, GLint y, GLint z)
   {
+    mFrameRecorder.UniformCall();
   }
 
   inline void Uniform3iv(GLint location, GLsizei count, const GLint* v)
   {
+    mFrameRecorder.UniformCall();
   }
 
   inline void Uniform4f(GLint location, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
   {
+    mFrameRecorder.UniformCall();
     if( ! mProgramUniforms4f.SetUniformValue( mCurrentProgram,
                                               location,
                                               Vector4( x, y, z, w ) ) )
@@ -1245,6 +1296,7 @@ public:
 
   inline void Uniform4fv(GLint location, GLsizei count, const GLfloat* v)
   {
+    mFrameRecorder.UniformCall();
     for( int i = 0; i < count; ++i )
     {
       if( ! mProgramUniforms4f.SetUniformValue(
@@ -1260,18 +1312,22 @@ public:
 
   inline void Uniform4i(GLint location, GLint x, GLint y, GLint z, GLint w)
   {
+    mFrameRecorder.UniformCall();
   }
 
   inline void Uniform4iv(GLint location, GLsizei count, const GLint* v)
   {
+    mFrameRecorder.UniformCall();
   }
 
   inline void UniformMatrix2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat* value)
   {
+    mFrameRecorder.UniformCall();
   }
 
   inline void UniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat* value)
   {
+    mFrameRecorder.UniformCall();
     for( int i = 0; i < count; ++i )
     {
       if( ! mProgramUniformsMat3.SetUniformValue(
@@ -1287,6 +1343,7 @@ public:
 
   inline void UniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat* value)
   {
+    mFrameRecorder.UniformCall();
     for( int i = 0; i < count; ++i )
     {
       if( ! mProgramUniformsMat4.SetUniformValue(
@@ -1302,6 +1359,7 @@ public:
 
   inline void UseProgram(GLuint program)
   {
+    mFrameRecorder.StateChange();
     mCurrentProgram = program;
   }
 
@@ -1347,6 +1405,7 @@ public:
 
   inline void Viewport(GLint x, GLint y, GLsizei width, GLsizei height)
   {
+    mFrameRecorder.StateChange();
   }
 
   /* OpenGL ES 3.0 */
@@ -1840,6 +1899,9 @@ public: // TEST FUNCTIONS
   inline void ResetDrawCallStack() { mDrawTrace.Reset(); }
   inline TraceCallStack& GetDrawTrace() { return mDrawTrace; }
 
+  //Methods for GL statistics verification, the calls are counted as the adaptor's GL proxy counts them
+  inline const Internal::Adaptor::GlFrameRecorder& GetFrameRecorder() const { return mFrameRecorder; }
+
   //Methods for Depth function verification
   inline void EnableDepthFunctionCallTrace(bool enable) { mDepthFunctionTrace.Enable(enable); }
   inline void ResetDepthFunctionCallStack() { mDepthFunctionTrace.Reset(); }
@@ -2081,6 +2143,12 @@ private:
   TraceCallStack mDepthFunctionTrace;
   TraceCallStack mStencilFunctionTrace;
 
+  // GL statistics
+  Internal::Adaptor::GlFrameRecorder mFrameRecorder;
+  unsigned int mBufferCount;
+  unsigned int mTextureCount;
+  unsigned int mProgramCount;
+
   // Shaders & Uniforms
   GLuint mLastShaderIdUsed;
   GLuint mLastProgramIdUsed;
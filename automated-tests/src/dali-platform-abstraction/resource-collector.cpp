@@ -39,6 +39,7 @@ ResourceCollector::~ResourceCollector() {}
 void ResourceCollector::LoadResponse( Dali::Integration::ResourceId id, Dali::Integration::ResourceTypeId type, Dali::Integration::ResourcePointer resource, Dali::Integration::LoadStatus status )
 {
   ++mGrandTotalNotifications;
+  mNotificationSequence.push_back( std::make_pair( id, status ) );
   if( status == RESOURCE_COMPLETELY_LOADED )
   {
     DALI_ASSERT_DEBUG( mCompletionCounts.find(id) == mCompletionCounts.end() && "A resource can only complete once." );
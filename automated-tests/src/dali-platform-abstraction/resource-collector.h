@@ -20,6 +20,8 @@
 #include <dali/integration-api/resource-cache.h>
 
 #include <map>
+#include <utility>
+#include <vector>
 
 namespace Dali
 {
@@ -41,6 +43,8 @@ namespace Platform
   typedef std::map<Integration::ResourceId, unsigned> ResourceCounterMap;
   /** Used to track the order in which a sequence of requests is completed.*/
   typedef std::vector<Integration::ResourceId> ResourceSequence;
+  /** Used to track the order of all the notifications, partial loads included.*/
+  typedef std::vector<std::pair<Integration::ResourceId, Integration::LoadStatus> > ResourceNotificationSequence;
 
 /**
  * @brief Used for platform testing to record the result of resource requests
@@ -73,6 +77,8 @@ public:
   ResourceCounterMap mFailureCounts;
   /** Remember the order of request completions so request priority can be tested. */
   ResourceSequence mCompletionSequence;
+  /** Remember the order of successful notifications so partial loads can be checked to precede complete ones. */
+  ResourceNotificationSequence mNotificationSequence;
   /** Count of all successes and failures.*/
   unsigned mGrandTotalCompletions;
   /** Count of all successes, failures, loading notifications and partially loaded notifications.*/
@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "utc-image-loading-common.h"
+#include "image-loaders/image-loader.h"
+
+using Dali::TizenPlatform::ImageLoader::HeaderProbe;
+using Dali::TizenPlatform::ImageLoader::HeaderProbeCache;
+using Dali::TizenPlatform::ImageLoader::FileStamp;
+
+namespace
+{
+
+/** The number of size queries a screen of layout might make. */
+const unsigned NUM_SIZE_QUERIES = 500u;
+
+HeaderProbe MakeProbe( unsigned int width, unsigned int height )
+{
+  HeaderProbe probe;
+  probe.width = width;
+  probe.height = height;
+  return probe;
+}
+
+} // anon namespace
+
+void utc_image_header_probe_cache_startup(void)
+{
+  utc_dali_loading_startup();
+  TizenPlatform::ImageLoader::GetHeaderProbeCache().Clear();
+}
+
+void utc_image_header_probe_cache_cleanup(void)
+{
+  utc_dali_loading_cleanup();
+}
+
+// The least recently used probe is evicted when the cache is full.
+int UtcDaliHeaderProbeCacheEvictsLeastRecentlyUsed(void)
+{
+  HeaderProbeCache cache( 2u );
+  const FileStamp stamp( 1000, 64 );
+  HeaderProbe probe;
+
+  cache.Insert( HeaderProbeCache::Key( "a.png" ), stamp, MakeProbe( 1, 1 ) );
+  cache.Insert( HeaderProbeCache::Key( "b.png" ), stamp, MakeProbe( 2, 2 ) );
+
+  // Touch a so that b is the least recently used:
+  DALI_TEST_CHECK( cache.Find( HeaderProbeCache::Key( "a.png" ), stamp, probe ) );
+  cache.Insert( HeaderProbeCache::Key( "c.png" ), stamp, MakeProbe( 3, 3 ) );
+
+  DALI_TEST_EQUALS( cache.GetCount(), 2u, TEST_LOCATION );
+  DALI_TEST_CHECK( !cache.Find( HeaderProbeCache::Key( "b.png" ), stamp, probe ) );
+  DALI_TEST_CHECK( cache.Find( HeaderProbeCache::Key( "a.png" ), stamp, probe ) );
+  DALI_TEST_EQUALS( probe.width, 1u, TEST_LOCATION );
+  DALI_TEST_CHECK( cache.Find( HeaderProbeCache::Key( "c.png" ), stamp, probe ) );
+  DALI_TEST_EQUALS( probe.width, 3u, TEST_LOCATION );
+
+  END_TEST;
+}
+
+// A probe is discarded once the file it was made from changes.
+int UtcDaliHeaderProbeCacheStaleStamp(void)
+{
+  HeaderProbeCache cache( 4u );
+  const HeaderProbeCache::Key key( "a.png" );
+  HeaderProbe probe;
+
+  cache.Insert( key, FileStamp( 1000, 64 ), MakeProbe( 1, 1 ) );
+  DALI_TEST_CHECK( !cache.Find( key, FileStamp( 2000, 64 ), probe ) );
+  DALI_TEST_EQUALS( cache.GetCount(), 0u, TEST_LOCATION );
+
+  cache.Insert( key, FileStamp( 1000, 64 ), MakeProbe( 1, 1 ) );
+  DALI_TEST_CHECK( !cache.Find( key, FileStamp( 1000, 128 ), probe ) );
+  DALI_TEST_EQUALS( cache.GetHitCount(), 0u, TEST_LOCATION );
+  DALI_TEST_EQUALS( cache.GetMissCount(), 2u, TEST_LOCATION );
+
+  END_TEST;
+}
+
+// Probes with different scaling parameters are cached separately.
+int UtcDaliHeaderProbeCacheKeyedByScaling(void)
+{
+  HeaderProbeCache cache( 4u );
+  const FileStamp stamp( 1000, 64 );
+  HeaderProbe probe;
+
+  cache.Insert( HeaderProbeCache::Key( "a.jpg" ), stamp, MakeProbe( 640, 480 ) );
+  cache.Insert( HeaderProbeCache::Key( "a.jpg", ImageDimensions( 64, 64 ), FittingMode::SHRINK_TO_FIT ), stamp, MakeProbe( 64, 48 ) );
+
+  DALI_TEST_CHECK( cache.Find( HeaderProbeCache::Key( "a.jpg" ), stamp, probe ) );
+  DALI_TEST_EQUALS( probe.width, 640u, TEST_LOCATION );
+  DALI_TEST_CHECK( cache.Find( HeaderProbeCache::Key( "a.jpg", ImageDimensions( 64, 64 ), FittingMode::SHRINK_TO_FIT ), stamp, probe ) );
+  DALI_TEST_EQUALS( probe.width, 64u, TEST_LOCATION );
+  DALI_TEST_CHECK( !cache.Find( HeaderProbeCache::Key( "a.jpg", ImageDimensions( 64, 64 ), FittingMode::SCALE_TO_FILL ), stamp, probe ) );
+
+  END_TEST;
+}
+
+// Repeated size queries for the same files should be answered from the cache
+// with the same results as the first, uncached, query.
+int UtcDaliGetClosestImageSizeCached(void)
+{
+  HeaderProbeCache& cache = TizenPlatform::ImageLoader::GetHeaderProbeCache();
+
+  ImageDimensions firstSizes[NUM_VALID_IMAGES];
+  const double startUncached = GetTimeMilliseconds( *gAbstraction );
+  for( unsigned i = 0; i < NUM_VALID_IMAGES; ++i )
+  {
+    firstSizes[i] = gAbstraction->GetClosestImageSize( VALID_IMAGES[i], ImageDimensions(), FittingMode::DEFAULT, SamplingMode::DEFAULT, true );
+    DALI_TEST_CHECK( firstSizes[i].GetWidth() > 0u && firstSizes[i].GetHeight() > 0u );
+  }
+  const double uncachedMilliseconds = GetTimeMilliseconds( *gAbstraction ) - startUncached;
+  const unsigned int hitsBefore = cache.GetHitCount();
+
+  const double startCached = GetTimeMilliseconds( *gAbstraction );
+  for( unsigned query = 0; query < NUM_SIZE_QUERIES; ++query )
+  {
+    const unsigned i = query % NUM_VALID_IMAGES;
+    const ImageDimensions size = gAbstraction->GetClosestImageSize( VALID_IMAGES[i], ImageDimensions(), FittingMode::DEFAULT, SamplingMode::DEFAULT, true );
+    DALI_TEST_CHECK( size == firstSizes[i] );
+  }
+  const double cachedMilliseconds = GetTimeMilliseconds( *gAbstraction ) - startCached;
+
+  tet_printf( "Uncached size queries: %u in %.3f ms, cached size queries: %u in %.3f ms\n", NUM_VALID_IMAGES, uncachedMilliseconds, NUM_SIZE_QUERIES, cachedMilliseconds );
+  DALI_TEST_EQUALS( cache.GetHitCount() - hitsBefore, NUM_SIZE_QUERIES, TEST_LOCATION );
+
+  END_TEST;
+}
+
+// A load after a size query should reuse the probe rather than parse the header again.
+int UtcDaliLoadReusesHeaderProbe(void)
+{
+  HeaderProbeCache& cache = TizenPlatform::ImageLoader::GetHeaderProbeCache();
+
+  const ImageDimensions size = gAbstraction->GetClosestImageSize( VALID_IMAGES[0], ImageDimensions(), FittingMode::DEFAULT, SamplingMode::DEFAULT, true );
+  const unsigned int hitsBefore = cache.GetHitCount();
+
+  Dali::Integration::BitmapResourceType bitmapResourceType;
+  Integration::ResourcePointer resource = gAbstraction->LoadResourceSynchronously( bitmapResourceType, VALID_IMAGES[0] );
+  DALI_TEST_CHECK( resource );
+
+  Integration::Bitmap* bitmap = static_cast<Integration::Bitmap*>( resource.Get() );
+  DALI_TEST_EQUALS( bitmap->GetImageWidth(), unsigned( size.GetWidth() ), TEST_LOCATION );
+  DALI_TEST_EQUALS( bitmap->GetImageHeight(), unsigned( size.GetHeight() ), TEST_LOCATION );
+  DALI_TEST_EQUALS( cache.GetHitCount(), hitsBefore + 1u, TEST_LOCATION );
+
+  END_TEST;
+}
@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#include "utc-image-loading-common.h"
+#include "resource-loader.h"
+
+namespace
+{
+
+/** The number of images loaded through the resource threads. */
+const unsigned NUM_HAND_OFF_LOADS = 40u;
+
+/**
+ * Make a bitmap to hand off as if it had been loaded.
+ */
+ResourcePointer NewBitmap( unsigned width, unsigned height )
+{
+  BitmapPtr bitmap = Bitmap::New( Bitmap::BITMAP_2D_PACKED_PIXELS, ResourcePolicy::OWNED_DISCARD );
+  bitmap->GetPackedPixelsProfile()->ReserveBuffer( Pixel::RGBA8888, width, height );
+  return ResourcePointer( bitmap.Get() );
+}
+
+/**
+ * Check the id and status of a notification the cache received.
+ */
+bool IsNotification( const ResourceCollector::ResourceNotificationSequence& sequence, std::size_t index, ResourceId id, LoadStatus status )
+{
+  return index < sequence.size() && sequence[index].first == id && sequence[index].second == status;
+}
+
+} // anon namespace
+
+void utc_image_loading_hand_off_startup(void)
+{
+  utc_dali_loading_startup();
+}
+
+void utc_image_loading_hand_off_cleanup(void)
+{
+  utc_dali_loading_cleanup();
+}
+
+// Loads through the resource threads are all counted as delivered, in batches
+// no bigger than the number of loads.
+int UtcDaliLoadHandOffStatisticsLoads(void)
+{
+  TizenPlatform::ResourceLoader loader;
+  Dali::Internal::Platform::ResourceCollector resourceSink;
+
+  Dali::Integration::BitmapResourceType bitmapResourceType;
+  for( ResourceId id = 1; id <= NUM_HAND_OFF_LOADS; ++id )
+  {
+    loader.LoadResource( ResourceRequest( id, bitmapResourceType, VALID_IMAGES[id % NUM_VALID_IMAGES], LoadPriorityNormal ) );
+  }
+
+  unsigned batches = 0u;
+  const double startTime = GetTimeMilliseconds( *gAbstraction );
+  while( resourceSink.mGrandTotalCompletions < NUM_HAND_OFF_LOADS &&
+         GetTimeMilliseconds( *gAbstraction ) - startTime < MAX_MILLIS_TO_WAIT_FOR_KNOWN_LOADS )
+  {
+    usleep( 1000 );
+    const unsigned before = resourceSink.mGrandTotalCompletions;
+    loader.GetResources( resourceSink );
+    batches += resourceSink.mGrandTotalCompletions > before ? 1u : 0u;
+  }
+  DALI_TEST_EQUALS( resourceSink.mGrandTotalCompletions, NUM_HAND_OFF_LOADS, TEST_LOCATION );
+
+  const TizenPlatform::ResourceHandOffStatistics statistics = loader.GetHandOffStatistics();
+  tet_printf( "%u loads handed off in %u batches, maximum batch %u, maximum latency %llu us\n",
+              statistics.delivered, statistics.batches, statistics.maximumBatch, statistics.maximumLatency );
+
+  DALI_TEST_EQUALS( statistics.queued, 0u, TEST_LOCATION );
+  DALI_TEST_EQUALS( statistics.delivered, NUM_HAND_OFF_LOADS, TEST_LOCATION );
+  DALI_TEST_EQUALS( statistics.batches, batches, TEST_LOCATION );
+  DALI_TEST_CHECK( statistics.maximumBatch >= 1u );
+  DALI_TEST_CHECK( statistics.maximumBatch <= NUM_HAND_OFF_LOADS );
+  DALI_TEST_CHECK( statistics.maximumBatch * statistics.batches >= NUM_HAND_OFF_LOADS );
+  DALI_TEST_CHECK( statistics.maximumLatency * NUM_HAND_OFF_LOADS >= statistics.totalLatency );
+
+  END_TEST;
+}
+
+// Loads and failures queued between two calls to GetResources() are handed
+// off in one batch.
+int UtcDaliLoadHandOffStatisticsBatches(void)
+{
+  TizenPlatform::ResourceLoader loader;
+  Dali::Internal::Platform::ResourceCollector resourceSink;
+
+  for( ResourceId id = 1; id <= 5; ++id )
+  {
+    TizenPlatform::LoadedResource loaded( id, ResourceBitmap, NewBitmap( 4u, 4u ) );
+    loader.AddLoadedResource( loaded );
+  }
+  TizenPlatform::FailedResource failed( 6, FailureUnknown );
+  loader.AddFailedLoad( failed );
+
+  TizenPlatform::ResourceHandOffStatistics statistics = loader.GetHandOffStatistics();
+  DALI_TEST_EQUALS( statistics.queued, 6u, TEST_LOCATION );
+  DALI_TEST_EQUALS( statistics.delivered, 0u, TEST_LOCATION );
+  DALI_TEST_EQUALS( statistics.batches, 0u, TEST_LOCATION );
+
+  loader.GetResources( resourceSink );
+  statistics = loader.GetHandOffStatistics();
+  DALI_TEST_EQUALS( statistics.queued, 0u, TEST_LOCATION );
+  DALI_TEST_EQUALS( statistics.delivered, 6u, TEST_LOCATION );
+  DALI_TEST_EQUALS( statistics.batches, 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( statistics.maximumBatch, 6u, TEST_LOCATION );
+  DALI_TEST_EQUALS( resourceSink.mGrandTotalCompletions, 6u, TEST_LOCATION );
+  DALI_TEST_EQUALS( resourceSink.mFailureCounts.size(), std::size_t( 1u ), TEST_LOCATION );
+
+  // A call with nothing to hand off is not a batch:
+  loader.GetResources( resourceSink );
+  statistics = loader.GetHandOffStatistics();
+  DALI_TEST_EQUALS( statistics.batches, 1u, TEST_LOCATION );
+
+  // A smaller batch doesn't lower the maximum:
+  for( ResourceId id = 7; id <= 8; ++id )
+  {
+    TizenPlatform::LoadedResource loaded( id, ResourceBitmap, NewBitmap( 4u, 4u ) );
+    loader.AddLoadedResource( loaded );
+  }
+  loader.GetResources( resourceSink );
+  statistics = loader.GetHandOffStatistics();
+  DALI_TEST_EQUALS( statistics.delivered, 8u, TEST_LOCATION );
+  DALI_TEST_EQUALS( statistics.batches, 2u, TEST_LOCATION );
+  DALI_TEST_EQUALS( statistics.maximumBatch, 6u, TEST_LOCATION );
+
+  END_TEST;
+}
+
+// Loads the texture upload budget defers are handed off before those which
+// completed after them, and a preview before its complete load.
+int UtcDaliLoadHandOffDeferralOrder(void)
+{
+  TizenPlatform::ResourceLoader loader;
+  Dali::Internal::Platform::ResourceCollector resourceSink;
+
+  const ResourcePointer probe = NewBitmap( 16u, 16u );
+  const unsigned long long bitmapBytes = static_cast< Bitmap* >( probe.Get() )->GetBufferSize();
+  loader.SetTextureUploadBudget( static_cast< unsigned int >( 2u * bitmapBytes ) );
+
+  // Keep a request for resource 1 stored, without loading it, so its preview is handed off:
+  loader.Pause();
+  Dali::Integration::BitmapResourceType bitmapResourceType;
+  loader.LoadResource( ResourceRequest( 1, bitmapResourceType, VALID_IMAGES[0], LoadPriorityNormal ) );
+
+  for( ResourceId id = 2; id <= 4; ++id )
+  {
+    TizenPlatform::LoadedResource loaded( id, ResourceBitmap, NewBitmap( 16u, 16u ) );
+    loader.AddLoadedResource( loaded );
+  }
+  TizenPlatform::LoadedResource preview( 1, ResourceBitmap, NewBitmap( 16u, 16u ), true );
+  loader.AddLoadedResource( preview );
+  TizenPlatform::LoadedResource complete( 1, ResourceBitmap, NewBitmap( 16u, 16u ) );
+  loader.AddLoadedResource( complete );
+
+  // Two fit in the budget, three wait:
+  loader.GetResources( resourceSink );
+  TizenPlatform::ResourceHandOffStatistics statistics = loader.GetHandOffStatistics();
+  DALI_TEST_EQUALS( resourceSink.mNotificationSequence.size(), std::size_t( 2u ), TEST_LOCATION );
+  DALI_TEST_EQUALS( statistics.lastDeferred, 3u, TEST_LOCATION );
+  DALI_TEST_EQUALS( statistics.lastDeferredBytes, 3u * bitmapBytes, TEST_LOCATION );
+  DALI_TEST_EQUALS( statistics.lastDeliveredBytes, 2u * bitmapBytes, TEST_LOCATION );
+
+  // A load completing now goes after those deferred:
+  TizenPlatform::LoadedResource newer( 5, ResourceBitmap, NewBitmap( 16u, 16u ) );
+  loader.AddLoadedResource( newer );
+
+  loader.GetResources( resourceSink );
+  statistics = loader.GetHandOffStatistics();
+  DALI_TEST_EQUALS( statistics.lastDeferred, 2u, TEST_LOCATION );
+
+  loader.GetResources( resourceSink );
+  statistics = loader.GetHandOffStatistics();
+  DALI_TEST_EQUALS( statistics.lastDeferred, 0u, TEST_LOCATION );
+  DALI_TEST_EQUALS( statistics.delivered, 6u, TEST_LOCATION );
+
+  const ResourceCollector::ResourceNotificationSequence& sequence = resourceSink.mNotificationSequence;
+  DALI_TEST_EQUALS( sequence.size(), std::size_t( 6u ), TEST_LOCATION );
+  DALI_TEST_CHECK( IsNotification( sequence, 0u, 2, RESOURCE_COMPLETELY_LOADED ) );
+  DALI_TEST_CHECK( IsNotification( sequence, 1u, 3, RESOURCE_COMPLETELY_LOADED ) );
+  DALI_TEST_CHECK( IsNotification( sequence, 2u, 4, RESOURCE_COMPLETELY_LOADED ) );
+  DALI_TEST_CHECK( IsNotification( sequence, 3u, 1, RESOURCE_PARTIALLY_LOADED ) );
+  DALI_TEST_CHECK( IsNotification( sequence, 4u, 1, RESOURCE_COMPLETELY_LOADED ) );
+  DALI_TEST_CHECK( IsNotification( sequence, 5u, 5, RESOURCE_COMPLETELY_LOADED ) );
+
+  // The figures of the budget describe the latest call, even one with nothing to hand off:
+  loader.GetResources( resourceSink );
+  statistics = loader.GetHandOffStatistics();
+  DALI_TEST_EQUALS( statistics.lastDeliveredBytes, 0ull, TEST_LOCATION );
+  DALI_TEST_EQUALS( statistics.batches, 3u, TEST_LOCATION );
+
+  END_TEST;
+}
@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "utc-image-loading-common.h"
+#include <algorithm>
+
+namespace
+{
+
+/** The number of off-screen loads issued ahead of the visible one. */
+const unsigned NUM_BURST_LOADS = 500u;
+
+/**
+ * A visible load may complete behind the loads already in flight when it was
+ * issued, plus a small allowance for loads finishing as the burst is issued.
+ */
+const unsigned MAX_COMPLETIONS_BEFORE_VISIBLE = 8u;
+
+/** Issue a burst of loads with ids 1 to NUM_BURST_LOADS. */
+void IssueBurst( TizenPlatform::TizenPlatformAbstraction& abstraction, LoadResourcePriority priority )
+{
+  Dali::Integration::BitmapResourceType bitmapResourceType;
+  for( unsigned id = 1; id <= NUM_BURST_LOADS; ++id )
+  {
+    abstraction.LoadResource( ResourceRequest( id, bitmapResourceType, VALID_IMAGES[id % NUM_VALID_IMAGES], priority ) );
+  }
+}
+
+/**
+ * Poll until the load with the given id has completed.
+ * @return The number of loads which completed before it, or NUM_BURST_LOADS if it never completed
+ */
+unsigned WaitForLoad( TizenPlatform::TizenPlatformAbstraction& abstraction, Dali::Internal::Platform::ResourceCollector& resourceSink, ResourceId id, double& milliseconds )
+{
+  const double startTime = GetTimeMilliseconds( abstraction );
+  while( resourceSink.mCompletionStatuses.find( id ) == resourceSink.mCompletionStatuses.end() &&
+         GetTimeMilliseconds( abstraction ) - startTime < MAX_MILLIS_TO_WAIT_FOR_KNOWN_LOADS )
+  {
+    usleep( 100 );
+    abstraction.GetResources( resourceSink );
+  }
+  milliseconds = GetTimeMilliseconds( abstraction ) - startTime;
+
+  ResourceSequence::const_iterator found = std::find( resourceSink.mCompletionSequence.begin(), resourceSink.mCompletionSequence.end(), id );
+  return found != resourceSink.mCompletionSequence.end() ? unsigned( found - resourceSink.mCompletionSequence.begin() ) : NUM_BURST_LOADS;
+}
+
+} // anon namespace
+
+void utc_image_loading_priority_startup(void)
+{
+  utc_dali_loading_startup();
+}
+
+void utc_image_loading_priority_cleanup(void)
+{
+  utc_dali_loading_cleanup();
+}
+
+// A high priority on-screen load issued after a burst of off-screen loads
+// should overtake them.
+int UtcDaliLoadPriorityVisibleFirst(void)
+{
+  TizenPlatform::TizenPlatformAbstraction abstraction;
+  Dali::Internal::Platform::ResourceCollector resourceSink;
+
+  IssueBurst( abstraction, LoadPriorityLow );
+
+  const ResourceId visibleId = NUM_BURST_LOADS + 1;
+  Dali::Integration::BitmapResourceType bitmapResourceType;
+  abstraction.LoadResource( ResourceRequest( visibleId, bitmapResourceType, VALID_IMAGES[0], LoadPriorityHighest ) );
+
+  double milliseconds = 0.0;
+  const unsigned position = WaitForLoad( abstraction, resourceSink, visibleId, milliseconds );
+
+  tet_printf( "Time to first visible image after a burst of %u loads: %.2f ms (%u loads completed before it)\n", NUM_BURST_LOADS, milliseconds, position );
+  DALI_TEST_CHECK( position <= MAX_COMPLETIONS_BEFORE_VISIBLE );
+
+  END_TEST;
+}
+
+// Raising the priority of a queued load should move it ahead of the others.
+int UtcDaliLoadPriorityReprioritise(void)
+{
+  TizenPlatform::TizenPlatformAbstraction abstraction;
+  Dali::Internal::Platform::ResourceCollector resourceSink;
+
+  IssueBurst( abstraction, LoadPriorityNormal );
+
+  const ResourceId scrolledOnScreenId = NUM_BURST_LOADS - 10;
+  abstraction.SetLoadPriority( scrolledOnScreenId, ResourceBitmap, LoadPriorityHighest );
+
+  double milliseconds = 0.0;
+  const unsigned position = WaitForLoad( abstraction, resourceSink, scrolledOnScreenId, milliseconds );
+
+  tet_printf( "Time to re-prioritised image: %.2f ms (%u loads completed before it)\n", milliseconds, position );
+  DALI_TEST_CHECK( position <= MAX_COMPLETIONS_BEFORE_VISIBLE );
+
+  END_TEST;
+}
+
+// In last-in-first-out mode the most recent of equal priority loads goes first.
+int UtcDaliLoadPriorityLastInFirstOut(void)
+{
+  TizenPlatform::TizenPlatformAbstraction abstraction;
+  Dali::Internal::Platform::ResourceCollector resourceSink;
+
+  abstraction.SetRequestSchedulingMode( TizenPlatform::RequestSchedulingMode::LAST_IN_FIRST_OUT );
+  IssueBurst( abstraction, LoadPriorityNormal );
+
+  double milliseconds = 0.0;
+  const unsigned position = WaitForLoad( abstraction, resourceSink, NUM_BURST_LOADS, milliseconds );
+
+  tet_printf( "Time to latest image in LIFO mode: %.2f ms (%u loads completed before it)\n", milliseconds, position );
+  DALI_TEST_CHECK( position <= MAX_COMPLETIONS_BEFORE_VISIBLE );
+
+  END_TEST;
+}
+
+// Bulk cancellation should leave only the uncancelled loads to complete.
+int UtcDaliLoadPriorityBulkCancel(void)
+{
+  TizenPlatform::TizenPlatformAbstraction abstraction;
+  Dali::Internal::Platform::ResourceCollector resourceSink;
+
+  const ResourceId NUM_ON_SCREEN = 10u;
+
+  IssueBurst( abstraction, LoadPriorityNormal );
+
+  ResourceIdSet offScreen;
+  for( ResourceId id = NUM_ON_SCREEN + 1; id <= NUM_BURST_LOADS; ++id )
+  {
+    offScreen.insert( id );
+  }
+  abstraction.CancelLoads( offScreen, ResourceBitmap );
+
+  double milliseconds = 0.0;
+  for( ResourceId id = 1; id <= NUM_ON_SCREEN; ++id )
+  {
+    WaitForLoad( abstraction, resourceSink, id, milliseconds );
+    DALI_TEST_CHECK( resourceSink.mSuccessCounts[id] == 1u );
+  }
+  usleep( 100 * 1000 );
+  abstraction.GetResources( resourceSink );
+
+  tet_printf( "Issued Loads: %u, Completed Loads: %u\n", NUM_BURST_LOADS, resourceSink.mGrandTotalCompletions );
+
+  // Only loads which were already in flight when the set was cancelled can
+  // complete in addition to the on-screen ones:
+  DALI_TEST_CHECK( resourceSink.mGrandTotalCompletions >= NUM_ON_SCREEN );
+  DALI_TEST_CHECK( resourceSink.mGrandTotalCompletions < NUM_BURST_LOADS / 2u );
+
+  END_TEST;
+}
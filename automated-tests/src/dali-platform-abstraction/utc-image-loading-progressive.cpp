@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#include "utc-image-loading-common.h"
+
+namespace
+{
+
+/** An Adam7 interlaced PNG large enough to be previewed. */
+const char* const INTERLACED_IMAGE = TEST_IMAGE_DIR "/interlaced-512x512.png";
+
+/** The number of loads of the interlaced image to issue. */
+const unsigned NUM_PROGRESSIVE_LOADS = 8u;
+
+/**
+ * Poll until the given number of loads have completed.
+ */
+void WaitForLoads( TizenPlatform::TizenPlatformAbstraction& abstraction, Dali::Internal::Platform::ResourceCollector& resourceSink, unsigned loads )
+{
+  const double startTime = GetTimeMilliseconds( abstraction );
+  while( resourceSink.mGrandTotalCompletions < loads &&
+         GetTimeMilliseconds( abstraction ) - startTime < MAX_MILLIS_TO_WAIT_FOR_KNOWN_LOADS )
+  {
+    usleep( 100 );
+    abstraction.GetResources( resourceSink );
+  }
+}
+
+} // anon namespace
+
+void utc_image_loading_progressive_startup(void)
+{
+  utc_dali_loading_startup();
+}
+
+void utc_image_loading_progressive_cleanup(void)
+{
+  utc_dali_loading_cleanup();
+}
+
+// With progressive loading on, each load of an interlaced image is partially
+// loaded with a preview before it completes.
+int UtcDaliLoadProgressivePreviewBeforeCompletion(void)
+{
+  TizenPlatform::TizenPlatformAbstraction abstraction;
+  Dali::Internal::Platform::ResourceCollector resourceSink;
+  abstraction.SetProgressiveImageLoading( true );
+
+  Dali::Integration::BitmapResourceType bitmapResourceType;
+  for( ResourceId id = 1; id <= NUM_PROGRESSIVE_LOADS; ++id )
+  {
+    abstraction.LoadResource( ResourceRequest( id, bitmapResourceType, INTERLACED_IMAGE, LoadPriorityNormal ) );
+  }
+
+  WaitForLoads( abstraction, resourceSink, NUM_PROGRESSIVE_LOADS );
+  DALI_TEST_EQUALS( resourceSink.mGrandTotalCompletions, NUM_PROGRESSIVE_LOADS, TEST_LOCATION );
+  DALI_TEST_EQUALS( resourceSink.mSuccessCounts.size(), std::size_t( NUM_PROGRESSIVE_LOADS ), TEST_LOCATION );
+
+  // Each id has exactly one preview, delivered before its complete load:
+  for( ResourceId id = 1; id <= NUM_PROGRESSIVE_LOADS; ++id )
+  {
+    unsigned partialLoads = 0u;
+    bool completed = false;
+    for( ResourceNotificationSequence::const_iterator it = resourceSink.mNotificationSequence.begin(), end = resourceSink.mNotificationSequence.end(); it != end; ++it )
+    {
+      if( it->first == id )
+      {
+        if( it->second == RESOURCE_PARTIALLY_LOADED )
+        {
+          DALI_TEST_CHECK( !completed );
+          ++partialLoads;
+        }
+        else if( it->second == RESOURCE_COMPLETELY_LOADED )
+        {
+          completed = true;
+        }
+      }
+    }
+    DALI_TEST_EQUALS( partialLoads, 1u, TEST_LOCATION );
+    DALI_TEST_CHECK( completed );
+  }
+
+  END_TEST;
+}
+
+// With progressive loading off, the same image completes without a preview.
+int UtcDaliLoadProgressiveOff(void)
+{
+  TizenPlatform::TizenPlatformAbstraction abstraction;
+  Dali::Internal::Platform::ResourceCollector resourceSink;
+
+  Dali::Integration::BitmapResourceType bitmapResourceType;
+  abstraction.LoadResource( ResourceRequest( 1, bitmapResourceType, INTERLACED_IMAGE, LoadPriorityNormal ) );
+
+  WaitForLoads( abstraction, resourceSink, 1u );
+  DALI_TEST_EQUALS( resourceSink.mGrandTotalCompletions, 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( resourceSink.mNotificationSequence.size(), std::size_t( 1u ), TEST_LOCATION );
+  DALI_TEST_CHECK( resourceSink.mNotificationSequence[0].second == RESOURCE_COMPLETELY_LOADED );
+
+  END_TEST;
+}
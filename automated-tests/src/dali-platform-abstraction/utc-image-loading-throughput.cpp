@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "utc-image-loading-common.h"
+
+namespace
+{
+
+/** The worker counts to benchmark, in increasing order. */
+const unsigned int WORKER_COUNTS[] = { 1u, 2u, 4u, 8u };
+const unsigned int NUM_WORKER_COUNTS = sizeof(WORKER_COUNTS) / sizeof(WORKER_COUNTS[0]);
+
+/** The number of times the set of valid images is loaded for each worker count. */
+const unsigned int NUM_THROUGHPUT_LOAD_GROUPS = NUM_LOAD_GROUPS_TO_ISSUE / 4u;
+
+/**
+ * Load every valid image repeatedly through a pool of workerCount threads and
+ * wait for all the loads to complete.
+ * @param[in] workerCount The number of resource threads to decode with
+ * @param[out] completions The number of loads which completed
+ * @return The number of milliseconds taken to issue and complete all the loads
+ */
+double LoadAll( unsigned int workerCount, unsigned int& completions )
+{
+  TizenPlatform::TizenPlatformAbstraction abstraction;
+  abstraction.SetResourceThreadCount( workerCount );
+
+  Dali::Integration::BitmapResourceType bitmapResourceType;
+  Dali::Internal::Platform::ResourceCollector resourceSink;
+  unsigned loadsLaunched = 0;
+
+  const double startTime = GetTimeMilliseconds( abstraction );
+
+  for( unsigned loadGroup = 0; loadGroup < NUM_THROUGHPUT_LOAD_GROUPS; ++loadGroup )
+  {
+    for( unsigned validImage = 0; validImage < NUM_VALID_IMAGES; ++validImage )
+    {
+      Dali::Integration::ResourceRequest request( loadsLaunched + 1, bitmapResourceType, VALID_IMAGES[validImage], Dali::Integration::LoadPriorityNormal );
+      abstraction.LoadResource( request );
+      ++loadsLaunched;
+    }
+  }
+
+  while( resourceSink.mGrandTotalCompletions < loadsLaunched && GetTimeMilliseconds( abstraction ) - startTime < MAX_MILLIS_TO_WAIT_FOR_KNOWN_LOADS )
+  {
+    usleep( 1000 );
+    abstraction.GetResources( resourceSink );
+  }
+
+  completions = resourceSink.mGrandTotalCompletions;
+  return GetTimeMilliseconds( abstraction ) - startTime;
+}
+
+} // anon namespace
+
+void utc_image_loading_throughput_startup(void)
+{
+  utc_dali_loading_startup();
+}
+
+void utc_image_loading_throughput_cleanup(void)
+{
+  utc_dali_loading_cleanup();
+}
+
+/**
+ * @brief Benchmark of images decoded per second against the number of resource
+ * worker threads.
+ *
+ * Only completion is asserted as timings depend on the machine running the test.
+ */
+int UtcDaliLoadThroughputByWorkerCount(void)
+{
+  tet_printf( "Running load throughput benchmark.\n" );
+
+  const unsigned loadsLaunched = NUM_THROUGHPUT_LOAD_GROUPS * NUM_VALID_IMAGES;
+
+  for( unsigned i = 0; i < NUM_WORKER_COUNTS; ++i )
+  {
+    unsigned int completions = 0;
+    const double milliseconds = LoadAll( WORKER_COUNTS[i], completions );
+
+    tet_printf( "Workers: %u, Loads: %u, Time: %.1f ms, Images per second: %.1f\n", WORKER_COUNTS[i], completions, milliseconds, milliseconds > 0.0 ? completions * 1000.0 / milliseconds : 0.0 );
+    DALI_TEST_EQUALS( completions, loadsLaunched, TEST_LOCATION );
+  }
+
+  END_TEST;
+}
+
+// Cancelling loads while they are spread across several workers must still
+// deliver exactly one notification per load.
+int UtcDaliLoadCancelWithWorkerPool(void)
+{
+  tet_printf( "Running load cancel with worker pool test.\n" );
+
+  TizenPlatform::TizenPlatformAbstraction abstraction;
+  abstraction.SetResourceThreadCount( 4u );
+
+  Dali::Integration::BitmapResourceType bitmapResourceType;
+  Dali::Internal::Platform::ResourceCollector resourceSink;
+  unsigned loadsLaunched = 0;
+
+  for( unsigned loadGroup = 0; loadGroup < NUM_LOAD_GROUPS_TO_ISSUE; ++loadGroup )
+  {
+    for( unsigned validImage = 0; validImage < NUM_VALID_IMAGES; ++validImage )
+    {
+      abstraction.LoadResource( ResourceRequest( loadsLaunched + 1, bitmapResourceType, VALID_IMAGES[validImage], LoadPriorityNormal ) );
+      ++loadsLaunched;
+    }
+  }
+
+  // Cancel every other load, some of which will already be in flight on a worker:
+  for( unsigned id = 1; id <= loadsLaunched; id += 2 )
+  {
+    abstraction.CancelLoad( id, ResourceBitmap );
+  }
+
+  const double startDrainTime = GetTimeMilliseconds( abstraction );
+  unsigned lastNotifications = -1;
+  while( resourceSink.mGrandTotalNotifications != lastNotifications && GetTimeMilliseconds( abstraction ) - startDrainTime < MAX_MILLIS_TO_WAIT_FOR_KNOWN_LOADS )
+  {
+    lastNotifications = resourceSink.mGrandTotalNotifications;
+    usleep( 100 * 1000 );
+    abstraction.GetResources( resourceSink );
+  }
+
+  tet_printf( "Issued Loads: %u, Completed Loads: %u, Successful Loads: %u, Failed Loads: %u \n", loadsLaunched, resourceSink.mGrandTotalCompletions, unsigned(resourceSink.mSuccessCounts.size()), unsigned(resourceSink.mFailureCounts.size()) );
+
+  // All the uncancelled loads must have completed:
+  DALI_TEST_CHECK( resourceSink.mGrandTotalCompletions >= loadsLaunched / 2 );
+  DALI_TEST_CHECK( resourceSink.mGrandTotalCompletions <= loadsLaunched );
+
+  // Check that each success was reported exactly once:
+  for( ResourceCounterMap::const_iterator it = resourceSink.mSuccessCounts.begin(), end = resourceSink.mSuccessCounts.end(); it != end; ++it )
+  {
+    DALI_TEST_CHECK( it->second == 1u );
+  }
+
+  END_TEST;
+}
@@ -0,0 +1,124 @@
+#ifndef _DALI_INTERNAL_PLATFORM_FILEMAPPER_H__
+#define _DALI_INTERNAL_PLATFORM_FILEMAPPER_H__
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <cstdio>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <dali/integration-api/debug.h>
+
+namespace Dali
+{
+namespace Internal
+{
+namespace Platform
+{
+
+/**
+ * Maps the whole of an open regular file read-only into memory and unmaps it
+ * later even if an exception is thrown.
+ *
+ * Files which are not regular files (e.g. a FILE* opened on a memory buffer)
+ * or are smaller than the minimum size requested are not mapped, so callers
+ * must fall back to reading through the FILE* when GetData() returns NULL.
+ */
+class FileMapper
+{
+public:
+
+  /**
+   * @brief Construct a FileMapper mapping the file underlying the FILE* passed in.
+   * @param[in] file The open file to map. Its position is not changed.
+   * @param[in] minimumSize Files smaller than this are not worth a mapping and are left unmapped.
+   */
+  FileMapper( FILE * const file, const size_t minimumSize ) :
+    mData( 0 ),
+    mSize( 0 )
+  {
+    const int fileDescriptor = file ? fileno( file ) : -1;
+    struct stat fileStatus;
+
+    if( fileDescriptor >= 0 &&
+        fstat( fileDescriptor, &fileStatus ) == 0 &&
+        S_ISREG( fileStatus.st_mode ) &&
+        fileStatus.st_size > 0 &&
+        static_cast<size_t>( fileStatus.st_size ) >= minimumSize )
+    {
+      const size_t size = static_cast<size_t>( fileStatus.st_size );
+      void * const data = mmap( 0, size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0 );
+      if( data != MAP_FAILED )
+      {
+        // Decoders walk the data front to back so let the kernel read ahead aggressively:
+        madvise( data, size, MADV_SEQUENTIAL );
+        mData = static_cast<const unsigned char*>( data );
+        mSize = size;
+      }
+      else
+      {
+        DALI_LOG_WARNING( "File mapping failed for FILE: \"%p\" of size: \"%u\".\n", static_cast<void*>(file), static_cast<unsigned>(size) );
+      }
+    }
+  }
+
+  /**
+   * @brief Destroy the FileMapper and unmap its memory.
+   */
+  ~FileMapper()
+  {
+    if( mData != 0 )
+    {
+      munmap( const_cast<unsigned char*>( mData ), mSize );
+      mData = 0;
+    }
+  }
+
+  /**
+   * @return The start of the read-only mapped file, or NULL if it was not mapped.
+   */
+  const unsigned char* GetData() const
+  {
+    return mData;
+  }
+
+  /**
+   * @return The number of bytes mapped, or zero if the file was not mapped.
+   */
+  size_t GetSize() const
+  {
+    return mSize;
+  }
+
+private:
+
+  // Undefined
+  FileMapper( const FileMapper& fileMapper );
+
+  // Undefined
+  FileMapper& operator=( const FileMapper& fileMapper );
+
+private:
+  const unsigned char* mData;
+  size_t mSize;
+};
+
+} /* namespace Platform */
+} /* namespace Internal */
+} /* namespace Dali */
+
+#endif /* _DALI_INTERNAL_PLATFORM_FILEMAPPER_H__ */
@@ -0,0 +1,581 @@
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include "image-operations-simd.h"
+
+// EXTERNAL INCLUDES
+#include <cstring>
+#include <stddef.h>
+#include <dali/integration-api/debug.h>
+
+#if defined(__SSE2__)
+#define DALI_IMAGE_OPERATIONS_SSE2
+#include <emmintrin.h>
+#include <tmmintrin.h>
+#elif defined(__ARM_NEON__) || defined(__ARM_NEON)
+#define DALI_IMAGE_OPERATIONS_NEON
+#include <arm_neon.h>
+#if !defined(__aarch64__)
+#include <sys/auxv.h>
+#include <asm/hwcap.h>
+#endif
+#endif
+
+namespace Dali
+{
+namespace Internal
+{
+namespace Platform
+{
+namespace Simd
+{
+
+namespace
+{
+
+/**
+ * @brief Ask the CPU which vector unit it has.
+ */
+VectorUnit DetectVectorUnit()
+{
+#if defined(DALI_IMAGE_OPERATIONS_SSE2)
+  // SSE2 is implied by the compiler flags so only SSSE3 needs checking for:
+  __builtin_cpu_init();
+  return __builtin_cpu_supports( "ssse3" ) ? VECTOR_UNIT_SSSE3 : VECTOR_UNIT_SSE2;
+#elif defined(DALI_IMAGE_OPERATIONS_NEON)
+#if defined(__aarch64__)
+  return VECTOR_UNIT_NEON;
+#else
+  return ( getauxval( AT_HWCAP ) & HWCAP_NEON ) ? VECTOR_UNIT_NEON : VECTOR_UNIT_NONE;
+#endif
+#else
+  return VECTOR_UNIT_NONE;
+#endif
+}
+
+/**
+ * @brief Average pairs of bytes at corresponding offsets in two arrays.
+ */
+inline void AverageBytes( const unsigned char * const bytes1,
+                          const unsigned char * const __restrict__ bytes2,
+                          unsigned char * const outputBytes,
+                          const unsigned int count )
+{
+  unsigned int byte = 0;
+
+#if defined(DALI_IMAGE_OPERATIONS_SSE2)
+  const __m128i ones = _mm_set1_epi8( 1 );
+  for( ; byte + 16u <= count; byte += 16u )
+  {
+    const __m128i a = _mm_loadu_si128( reinterpret_cast<const __m128i*>( bytes1 + byte ) );
+    const __m128i b = _mm_loadu_si128( reinterpret_cast<const __m128i*>( bytes2 + byte ) );
+    // The SSE2 average rounds up so correct it to round down like AverageComponent():
+    const __m128i averaged = _mm_sub_epi8( _mm_avg_epu8( a, b ), _mm_and_si128( _mm_xor_si128( a, b ), ones ) );
+    _mm_storeu_si128( reinterpret_cast<__m128i*>( outputBytes + byte ), averaged );
+  }
+#elif defined(DALI_IMAGE_OPERATIONS_NEON)
+  for( ; byte + 16u <= count; byte += 16u )
+  {
+    vst1q_u8( outputBytes + byte, vhaddq_u8( vld1q_u8( bytes1 + byte ), vld1q_u8( bytes2 + byte ) ) );
+  }
+#endif
+
+  // Finish off any bytes left over:
+  for( ; byte < count; ++byte )
+  {
+    outputBytes[byte] = AverageComponent( bytes1[byte], bytes2[byte] );
+  }
+}
+
+#if defined(DALI_IMAGE_OPERATIONS_SSE2)
+
+/** @brief Average each byte of two vectors, rounding down. */
+inline __m128i FloorAverageBytes( __m128i a, __m128i b )
+{
+  return _mm_sub_epi8( _mm_avg_epu8( a, b ), _mm_and_si128( _mm_xor_si128( a, b ), _mm_set1_epi8( 1 ) ) );
+}
+
+/** @brief Average RGB565 pixels held in 16 bit lanes, exactly as AveragePixelRGB565() does. */
+inline __m128i AveragePixelsRGB565( __m128i a, __m128i b )
+{
+  const __m128i redMask = _mm_set1_epi16( 0xf800 );
+  const __m128i greenMask = _mm_set1_epi16( 0x7e0 );
+  const __m128i blueMask = _mm_set1_epi16( 0x1f );
+
+  // Halve the red components before adding them so the sum cannot overflow 16 bits:
+  const __m128i red = _mm_and_si128( _mm_add_epi16( _mm_srli_epi16( _mm_and_si128( a, redMask ), 1 ), _mm_srli_epi16( _mm_and_si128( b, redMask ), 1 ) ), redMask );
+  const __m128i green = _mm_and_si128( _mm_srli_epi16( _mm_add_epi16( _mm_and_si128( a, greenMask ), _mm_and_si128( b, greenMask ) ), 1 ), greenMask );
+  const __m128i blue = _mm_srli_epi16( _mm_add_epi16( _mm_and_si128( a, blueMask ), _mm_and_si128( b, blueMask ) ), 1 );
+  return _mm_or_si128( _mm_or_si128( red, green ), blue );
+}
+
+/** @brief Pack the low 16 bits of each 32 bit lane of two vectors into one vector. */
+inline __m128i PackLow16( __m128i low, __m128i high )
+{
+  // Sign extend so the saturating pack leaves the bits untouched:
+  return _mm_packs_epi32( _mm_srai_epi32( _mm_slli_epi32( low, 16 ), 16 ), _mm_srai_epi32( _mm_slli_epi32( high, 16 ), 16 ) );
+}
+
+/**
+ * @brief Halve RGB888 scanlines four output pixels at a time using the SSSE3 byte shuffle.
+ * @return The number of output pixels written.
+ */
+__attribute__((target("ssse3")))
+unsigned int HalveScanlineInPlaceRGB888Ssse3( unsigned char * const pixels, const unsigned int pairs )
+{
+  // Gather the even and odd pixels of eight RGB888 pixels from two overlapping loads:
+  const __m128i evenFromFirst  = _mm_setr_epi8( 0, 1, 2, 6, 7, 8, 12, 13, 14, -1, -1, -1, -1, -1, -1, -1 );
+  const __m128i evenFromSecond = _mm_setr_epi8( -1, -1, -1, -1, -1, -1, -1, -1, -1, 10, 11, 12, -1, -1, -1, -1 );
+  const __m128i oddFromFirst   = _mm_setr_epi8( 3, 4, 5, 9, 10, 11, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1 );
+  const __m128i oddFromSecond  = _mm_setr_epi8( -1, -1, -1, -1, -1, -1, -1, 8, 9, 13, 14, 15, -1, -1, -1, -1 );
+
+  unsigned int outPixel = 0;
+  for( ; outPixel + 4u <= pairs; outPixel += 4u )
+  {
+    const unsigned char * const in = pixels + outPixel * 6u;
+    const __m128i first  = _mm_loadu_si128( reinterpret_cast<const __m128i*>( in ) );
+    const __m128i second = _mm_loadu_si128( reinterpret_cast<const __m128i*>( in + 8u ) );
+
+    const __m128i even = _mm_or_si128( _mm_shuffle_epi8( first, evenFromFirst ), _mm_shuffle_epi8( second, evenFromSecond ) );
+    const __m128i odd  = _mm_or_si128( _mm_shuffle_epi8( first, oddFromFirst ), _mm_shuffle_epi8( second, oddFromSecond ) );
+    const __m128i averaged = FloorAverageBytes( even, odd );
+
+    // Write the twelve bytes of the four output pixels:
+    unsigned char * const out = pixels + outPixel * 3u;
+    _mm_storel_epi64( reinterpret_cast<__m128i*>( out ), averaged );
+    const int lastFour = _mm_cvtsi128_si32( _mm_srli_si128( averaged, 8 ) );
+    memcpy( out + 8u, &lastFour, 4u );
+  }
+  return outPixel;
+}
+
+/**
+ * @brief Blend two sets of 16 bit components with 0.16 fixed-point weights into 16.16 fixed-point.
+ *
+ * Equivalent to WeightedBlendIntToFixed1616() for each of the eight components.
+ */
+inline void BlendComponentsToFixed1616( __m128i left, __m128i right, __m128i leftWeights, __m128i rightWeights, __m128i& lowHalf, __m128i& highHalf )
+{
+  // Build 32 bit products from the low and high halves of the 16 x 16 bit multiplies:
+  const __m128i leftLow   = _mm_mullo_epi16( left, leftWeights );
+  const __m128i leftHigh  = _mm_mulhi_epu16( left, leftWeights );
+  const __m128i rightLow  = _mm_mullo_epi16( right, rightWeights );
+  const __m128i rightHigh = _mm_mulhi_epu16( right, rightWeights );
+
+  lowHalf  = _mm_add_epi32( _mm_unpacklo_epi16( leftLow, leftHigh ), _mm_unpacklo_epi16( rightLow, rightHigh ) );
+  highHalf = _mm_add_epi32( _mm_unpackhi_epi16( leftLow, leftHigh ), _mm_unpackhi_epi16( rightLow, rightHigh ) );
+}
+
+/**
+ * @brief Blend two sets of four 16.16 fixed-point components vertically and round them to integers.
+ *
+ * Equivalent to the second half of BilinearFilter1Component() for each of the four components.
+ */
+inline __m128i BlendFixed1616ToInt( __m128i top, __m128i bottom, __m128i topWeight, __m128i bottomWeight )
+{
+  const __m128i round = _mm_set_epi32( 0, static_cast<int>( 1u << 31u ), 0, static_cast<int>( 1u << 31u ) );
+
+  // Components 0 and 2 are blended in 64 bit lanes, then components 1 and 3:
+  const __m128i even = _mm_add_epi64( _mm_add_epi64( _mm_mul_epu32( top, topWeight ), _mm_mul_epu32( bottom, bottomWeight ) ), round );
+  const __m128i odd  = _mm_add_epi64( _mm_add_epi64( _mm_mul_epu32( _mm_srli_epi64( top, 32 ), topWeight ), _mm_mul_epu32( _mm_srli_epi64( bottom, 32 ), bottomWeight ) ), round );
+
+  return _mm_or_si128( _mm_srli_epi64( even, 32 ), _mm_slli_epi64( _mm_srli_epi64( odd, 32 ), 32 ) );
+}
+
+#endif // DALI_IMAGE_OPERATIONS_SSE2
+
+/** @brief Load a pixel of up to four bytes into the low bytes of a word. */
+template< unsigned int BYTES_PER_PIXEL >
+inline uint32_t LoadPixel( const unsigned char * const pixel )
+{
+  uint32_t word = 0;
+  memcpy( &word, pixel, BYTES_PER_PIXEL );
+  return word;
+}
+
+/** @brief Store the low bytes of a word as a pixel. */
+template< unsigned int BYTES_PER_PIXEL >
+inline void StorePixel( unsigned char * const pixel, const uint32_t word )
+{
+  memcpy( pixel, &word, BYTES_PER_PIXEL );
+}
+
+/**
+ * @brief Shared implementation of the bilinear scanline kernels for pixels of
+ * three or four byte components.
+ */
+template< unsigned int BYTES_PER_PIXEL >
+inline void LinearSampleScanlineBytes( const unsigned char * __restrict__ inScanline1,
+                                       const unsigned char * __restrict__ inScanline2,
+                                       unsigned int inputYWeight,
+                                       const unsigned int * columns1,
+                                       const unsigned int * columns2,
+                                       const unsigned int * columnWeights,
+                                       unsigned char * __restrict__ outScanline,
+                                       unsigned int desiredWidth )
+{
+  unsigned int outX = 0;
+
+#if defined(DALI_IMAGE_OPERATIONS_SSE2)
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i topWeight = _mm_set1_epi32( 65535u - inputYWeight );
+  const __m128i bottomWeight = _mm_set1_epi32( inputYWeight );
+
+  // Filter two output pixels at a time, with their components spread across 16 bit lanes:
+  for( ; outX + 2u <= desiredWidth; outX += 2u )
+  {
+    const unsigned int x1a = columns1[outX] * BYTES_PER_PIXEL, x2a = columns2[outX] * BYTES_PER_PIXEL;
+    const unsigned int x1b = columns1[outX + 1u] * BYTES_PER_PIXEL, x2b = columns2[outX + 1u] * BYTES_PER_PIXEL;
+
+    const __m128i topLeft     = _mm_unpacklo_epi8( _mm_unpacklo_epi32( _mm_cvtsi32_si128( LoadPixel<BYTES_PER_PIXEL>( inScanline1 + x1a ) ), _mm_cvtsi32_si128( LoadPixel<BYTES_PER_PIXEL>( inScanline1 + x1b ) ) ), zero );
+    const __m128i topRight    = _mm_unpacklo_epi8( _mm_unpacklo_epi32( _mm_cvtsi32_si128( LoadPixel<BYTES_PER_PIXEL>( inScanline1 + x2a ) ), _mm_cvtsi32_si128( LoadPixel<BYTES_PER_PIXEL>( inScanline1 + x2b ) ) ), zero );
+    const __m128i bottomLeft  = _mm_unpacklo_epi8( _mm_unpacklo_epi32( _mm_cvtsi32_si128( LoadPixel<BYTES_PER_PIXEL>( inScanline2 + x1a ) ), _mm_cvtsi32_si128( LoadPixel<BYTES_PER_PIXEL>( inScanline2 + x1b ) ) ), zero );
+    const __m128i bottomRight = _mm_unpacklo_epi8( _mm_unpacklo_epi32( _mm_cvtsi32_si128( LoadPixel<BYTES_PER_PIXEL>( inScanline2 + x2a ) ), _mm_cvtsi32_si128( LoadPixel<BYTES_PER_PIXEL>( inScanline2 + x2b ) ) ), zero );
+
+    const short weightA = static_cast<short>( columnWeights[outX] );
+    const short weightB = static_cast<short>( columnWeights[outX + 1u] );
+    const short inverseWeightA = static_cast<short>( 65535u - columnWeights[outX] );
+    const short inverseWeightB = static_cast<short>( 65535u - columnWeights[outX + 1u] );
+    const __m128i rightWeights = _mm_set_epi16( weightB, weightB, weightB, weightB, weightA, weightA, weightA, weightA );
+    const __m128i leftWeights  = _mm_set_epi16( inverseWeightB, inverseWeightB, inverseWeightB, inverseWeightB, inverseWeightA, inverseWeightA, inverseWeightA, inverseWeightA );
+
+    __m128i topA, topB, bottomA, bottomB;
+    BlendComponentsToFixed1616( topLeft, topRight, leftWeights, rightWeights, topA, topB );
+    BlendComponentsToFixed1616( bottomLeft, bottomRight, leftWeights, rightWeights, bottomA, bottomB );
+
+    const __m128i pixelA = BlendFixed1616ToInt( topA, bottomA, topWeight, bottomWeight );
+    const __m128i pixelB = BlendFixed1616ToInt( topB, bottomB, topWeight, bottomWeight );
+    const __m128i packed = _mm_packus_epi16( _mm_packs_epi32( pixelA, pixelB ), zero );
+
+    StorePixel<BYTES_PER_PIXEL>( outScanline + outX * BYTES_PER_PIXEL, _mm_cvtsi128_si32( packed ) );
+    StorePixel<BYTES_PER_PIXEL>( outScanline + ( outX + 1u ) * BYTES_PER_PIXEL, _mm_cvtsi128_si32( _mm_srli_si128( packed, 4 ) ) );
+  }
+#elif defined(DALI_IMAGE_OPERATIONS_NEON)
+  const uint32x2_t topWeight = vdup_n_u32( 65535u - inputYWeight );
+  const uint32x2_t bottomWeight = vdup_n_u32( inputYWeight );
+  const uint64x2_t round = vdupq_n_u64( 1u << 31u );
+
+  for( ; outX < desiredWidth; ++outX )
+  {
+    const unsigned int x1 = columns1[outX] * BYTES_PER_PIXEL, x2 = columns2[outX] * BYTES_PER_PIXEL;
+
+    const uint16x4_t topLeft     = vget_low_u16( vmovl_u8( vcreate_u8( LoadPixel<BYTES_PER_PIXEL>( inScanline1 + x1 ) ) ) );
+    const uint16x4_t topRight    = vget_low_u16( vmovl_u8( vcreate_u8( LoadPixel<BYTES_PER_PIXEL>( inScanline1 + x2 ) ) ) );
+    const uint16x4_t bottomLeft  = vget_low_u16( vmovl_u8( vcreate_u8( LoadPixel<BYTES_PER_PIXEL>( inScanline2 + x1 ) ) ) );
+    const uint16x4_t bottomRight = vget_low_u16( vmovl_u8( vcreate_u8( LoadPixel<BYTES_PER_PIXEL>( inScanline2 + x2 ) ) ) );
+
+    const uint16x4_t rightWeight = vdup_n_u16( columnWeights[outX] );
+    const uint16x4_t leftWeight  = vdup_n_u16( 65535u - columnWeights[outX] );
+
+    // Horizontal blends to 16.16 fixed-point:
+    const uint32x4_t top    = vmlal_u16( vmull_u16( topLeft, leftWeight ), topRight, rightWeight );
+    const uint32x4_t bottom = vmlal_u16( vmull_u16( bottomLeft, leftWeight ), bottomRight, rightWeight );
+
+    // Vertical blends to 16.32 fixed-point, rounded to integers:
+    const uint64x2_t low  = vaddq_u64( vmlal_u32( vmull_u32( vget_low_u32( top ), topWeight ), vget_low_u32( bottom ), bottomWeight ), round );
+    const uint64x2_t high = vaddq_u64( vmlal_u32( vmull_u32( vget_high_u32( top ), topWeight ), vget_high_u32( bottom ), bottomWeight ), round );
+    const uint16x4_t components = vmovn_u32( vcombine_u32( vshrn_n_u64( low, 32 ), vshrn_n_u64( high, 32 ) ) );
+    const uint8x8_t bytes = vmovn_u16( vcombine_u16( components, components ) );
+
+    StorePixel<BYTES_PER_PIXEL>( outScanline + outX * BYTES_PER_PIXEL, vget_lane_u32( vreinterpret_u32_u8( bytes ), 0 ) );
+  }
+#endif
+
+  // Finish off any pixel left over:
+  for( ; outX < desiredWidth; ++outX )
+  {
+    const unsigned char * const topLeft     = inScanline1 + columns1[outX] * BYTES_PER_PIXEL;
+    const unsigned char * const topRight    = inScanline1 + columns2[outX] * BYTES_PER_PIXEL;
+    const unsigned char * const bottomLeft  = inScanline2 + columns1[outX] * BYTES_PER_PIXEL;
+    const unsigned char * const bottomRight = inScanline2 + columns2[outX] * BYTES_PER_PIXEL;
+    for( unsigned int component = 0; component < BYTES_PER_PIXEL; ++component )
+    {
+      outScanline[outX * BYTES_PER_PIXEL + component] = BilinearFilter1Component( topLeft[component], topRight[component], bottomLeft[component], bottomRight[component], columnWeights[outX], inputYWeight );
+    }
+  }
+}
+
+} // unnamed namespace
+
+VectorUnit GetVectorUnit()
+{
+  static const VectorUnit vectorUnit = DetectVectorUnit();
+  return vectorUnit;
+}
+
+void HalveScanlineInPlaceRGB888( unsigned char * const pixels, const unsigned int width )
+{
+  const unsigned int pairs = width / 2u;
+  unsigned int outPixel = 0;
+
+#if defined(DALI_IMAGE_OPERATIONS_SSE2)
+  if( GetVectorUnit() == VECTOR_UNIT_SSSE3 )
+  {
+    outPixel = HalveScanlineInPlaceRGB888Ssse3( pixels, pairs );
+  }
+#elif defined(DALI_IMAGE_OPERATIONS_NEON)
+  // De-interleave sixteen pixels into planes and add horizontal pairs in each plane:
+  for( ; outPixel + 8u <= pairs; outPixel += 8u )
+  {
+    const uint8x16x3_t in = vld3q_u8( pixels + outPixel * 6u );
+    uint8x8x3_t out;
+    out.val[0] = vshrn_n_u16( vpaddlq_u8( in.val[0] ), 1 );
+    out.val[1] = vshrn_n_u16( vpaddlq_u8( in.val[1] ), 1 );
+    out.val[2] = vshrn_n_u16( vpaddlq_u8( in.val[2] ), 1 );
+    vst3_u8( pixels + outPixel * 3u, out );
+  }
+#endif
+
+  for( ; outPixel < pairs; ++outPixel )
+  {
+    const unsigned int pixel = outPixel * 2u;
+    pixels[outPixel * 3]     = AverageComponent( pixels[pixel * 3],     pixels[pixel * 3 + 3] );
+    pixels[outPixel * 3 + 1] = AverageComponent( pixels[pixel * 3 + 1], pixels[pixel * 3 + 4] );
+    pixels[outPixel * 3 + 2] = AverageComponent( pixels[pixel * 3 + 2], pixels[pixel * 3 + 5] );
+  }
+}
+
+void HalveScanlineInPlaceRGBA8888( unsigned char * const pixels, const unsigned int width )
+{
+  DALI_ASSERT_DEBUG( ((reinterpret_cast<ptrdiff_t>(pixels) & 3u) == 0u) && "Pointer should be 4-byte aligned for performance on some platforms." );
+
+  uint32_t* const alignedPixels = reinterpret_cast<uint32_t*>(pixels);
+  const unsigned int pairs = width / 2u;
+  unsigned int outPixel = 0;
+
+#if defined(DALI_IMAGE_OPERATIONS_SSE2)
+  for( ; outPixel + 4u <= pairs; outPixel += 4u )
+  {
+    const __m128 first  = _mm_castsi128_ps( _mm_loadu_si128( reinterpret_cast<const __m128i*>( alignedPixels + outPixel * 2u ) ) );
+    const __m128 second = _mm_castsi128_ps( _mm_loadu_si128( reinterpret_cast<const __m128i*>( alignedPixels + outPixel * 2u + 4u ) ) );
+    const __m128i even = _mm_castps_si128( _mm_shuffle_ps( first, second, _MM_SHUFFLE( 2, 0, 2, 0 ) ) );
+    const __m128i odd  = _mm_castps_si128( _mm_shuffle_ps( first, second, _MM_SHUFFLE( 3, 1, 3, 1 ) ) );
+    _mm_storeu_si128( reinterpret_cast<__m128i*>( alignedPixels + outPixel ), FloorAverageBytes( even, odd ) );
+  }
+#elif defined(DALI_IMAGE_OPERATIONS_NEON)
+  for( ; outPixel + 4u <= pairs; outPixel += 4u )
+  {
+    const uint32x4x2_t in = vld2q_u32( alignedPixels + outPixel * 2u );
+    vst1q_u32( alignedPixels + outPixel, vreinterpretq_u32_u8( vhaddq_u8( vreinterpretq_u8_u32( in.val[0] ), vreinterpretq_u8_u32( in.val[1] ) ) ) );
+  }
+#endif
+
+  for( ; outPixel < pairs; ++outPixel )
+  {
+    alignedPixels[outPixel] = AveragePixelRGBA8888( alignedPixels[outPixel * 2u], alignedPixels[outPixel * 2u + 1u] );
+  }
+}
+
+void HalveScanlineInPlaceRGB565( unsigned char * const pixels, const unsigned int width )
+{
+  DALI_ASSERT_DEBUG( ((reinterpret_cast<ptrdiff_t>(pixels) & 1u) == 0u) && "Pointer should be 2-byte aligned for performance on some platforms." );
+
+  uint16_t* const alignedPixels = reinterpret_cast<uint16_t*>(pixels);
+  const unsigned int pairs = width / 2u;
+  unsigned int outPixel = 0;
+
+#if defined(DALI_IMAGE_OPERATIONS_SSE2)
+  const __m128i lowHalfMask = _mm_set1_epi32( 0xffff );
+  for( ; outPixel + 8u <= pairs; outPixel += 8u )
+  {
+    const __m128i first  = _mm_loadu_si128( reinterpret_cast<const __m128i*>( alignedPixels + outPixel * 2u ) );
+    const __m128i second = _mm_loadu_si128( reinterpret_cast<const __m128i*>( alignedPixels + outPixel * 2u + 8u ) );
+    const __m128i averagedFirst  = AveragePixelsRGB565( _mm_and_si128( first, lowHalfMask ), _mm_srli_epi32( first, 16 ) );
+    const __m128i averagedSecond = AveragePixelsRGB565( _mm_and_si128( second, lowHalfMask ), _mm_srli_epi32( second, 16 ) );
+    _mm_storeu_si128( reinterpret_cast<__m128i*>( alignedPixels + outPixel ), PackLow16( averagedFirst, averagedSecond ) );
+  }
+#elif defined(DALI_IMAGE_OPERATIONS_NEON)
+  const uint16x8_t redMask = vdupq_n_u16( 0xf800 );
+  const uint16x8_t greenMask = vdupq_n_u16( 0x7e0 );
+  const uint16x8_t blueMask = vdupq_n_u16( 0x1f );
+  for( ; outPixel + 8u <= pairs; outPixel += 8u )
+  {
+    const uint16x8x2_t in = vld2q_u16( alignedPixels + outPixel * 2u );
+    const uint16x8_t red   = vandq_u16( vaddq_u16( vshrq_n_u16( vandq_u16( in.val[0], redMask ), 1 ), vshrq_n_u16( vandq_u16( in.val[1], redMask ), 1 ) ), redMask );
+    const uint16x8_t green = vandq_u16( vshrq_n_u16( vaddq_u16( vandq_u16( in.val[0], greenMask ), vandq_u16( in.val[1], greenMask ) ), 1 ), greenMask );
+    const uint16x8_t blue  = vshrq_n_u16( vaddq_u16( vandq_u16( in.val[0], blueMask ), vandq_u16( in.val[1], blueMask ) ), 1 );
+    vst1q_u16( alignedPixels + outPixel, vorrq_u16( vorrq_u16( red, green ), blue ) );
+  }
+#endif
+
+  for( ; outPixel < pairs; ++outPixel )
+  {
+    alignedPixels[outPixel] = AveragePixelRGB565( alignedPixels[outPixel * 2u], alignedPixels[outPixel * 2u + 1u] );
+  }
+}
+
+void HalveScanlineInPlace2Bytes( unsigned char * const pixels, const unsigned int width )
+{
+  const unsigned int pairs = width / 2u;
+  unsigned int outPixel = 0;
+
+#if defined(DALI_IMAGE_OPERATIONS_SSE2)
+  const __m128i lowHalfMask = _mm_set1_epi32( 0xffff );
+  for( ; outPixel + 8u <= pairs; outPixel += 8u )
+  {
+    const __m128i first  = _mm_loadu_si128( reinterpret_cast<const __m128i*>( pixels + outPixel * 4u ) );
+    const __m128i second = _mm_loadu_si128( reinterpret_cast<const __m128i*>( pixels + outPixel * 4u + 16u ) );
+    const __m128i averagedFirst  = FloorAverageBytes( _mm_and_si128( first, lowHalfMask ), _mm_srli_epi32( first, 16 ) );
+    const __m128i averagedSecond = FloorAverageBytes( _mm_and_si128( second, lowHalfMask ), _mm_srli_epi32( second, 16 ) );
+    _mm_storeu_si128( reinterpret_cast<__m128i*>( pixels + outPixel * 2u ), PackLow16( averagedFirst, averagedSecond ) );
+  }
+#elif defined(DALI_IMAGE_OPERATIONS_NEON)
+  for( ; outPixel + 8u <= pairs; outPixel += 8u )
+  {
+    // De-interleave whole two byte pixels so even and odd pixels land in separate vectors:
+    const uint16x8x2_t in = vld2q_u16( reinterpret_cast<const uint16_t*>( pixels + outPixel * 4u ) );
+    vst1q_u8( pixels + outPixel * 2u, vhaddq_u8( vreinterpretq_u8_u16( in.val[0] ), vreinterpretq_u8_u16( in.val[1] ) ) );
+  }
+#endif
+
+  for( ; outPixel < pairs; ++outPixel )
+  {
+    const unsigned int pixel = outPixel * 2u;
+    pixels[outPixel * 2]     = AverageComponent( pixels[pixel * 2],     pixels[pixel * 2 + 2] );
+    pixels[outPixel * 2 + 1] = AverageComponent( pixels[pixel * 2 + 1], pixels[pixel * 2 + 3] );
+  }
+}
+
+void HalveScanlineInPlace1Byte( unsigned char * const pixels, const unsigned int width )
+{
+  const unsigned int pairs = width / 2u;
+  unsigned int outPixel = 0;
+
+#if defined(DALI_IMAGE_OPERATIONS_SSE2)
+  const __m128i lowByteMask = _mm_set1_epi16( 0xff );
+  for( ; outPixel + 16u <= pairs; outPixel += 16u )
+  {
+    const __m128i first  = _mm_loadu_si128( reinterpret_cast<const __m128i*>( pixels + outPixel * 2u ) );
+    const __m128i second = _mm_loadu_si128( reinterpret_cast<const __m128i*>( pixels + outPixel * 2u + 16u ) );
+    const __m128i averagedFirst  = _mm_srli_epi16( _mm_add_epi16( _mm_and_si128( first, lowByteMask ), _mm_srli_epi16( first, 8 ) ), 1 );
+    const __m128i averagedSecond = _mm_srli_epi16( _mm_add_epi16( _mm_and_si128( second, lowByteMask ), _mm_srli_epi16( second, 8 ) ), 1 );
+    _mm_storeu_si128( reinterpret_cast<__m128i*>( pixels + outPixel ), _mm_packus_epi16( averagedFirst, averagedSecond ) );
+  }
+#elif defined(DALI_IMAGE_OPERATIONS_NEON)
+  for( ; outPixel + 16u <= pairs; outPixel += 16u )
+  {
+    const uint8x16x2_t in = vld2q_u8( pixels + outPixel * 2u );
+    vst1q_u8( pixels + outPixel, vhaddq_u8( in.val[0], in.val[1] ) );
+  }
+#endif
+
+  for( ; outPixel < pairs; ++outPixel )
+  {
+    pixels[outPixel] = AverageComponent( pixels[outPixel * 2u], pixels[outPixel * 2u + 1u] );
+  }
+}
+
+void AverageScanlines1( const unsigned char * const scanline1,
+                        const unsigned char * const __restrict__ scanline2,
+                        unsigned char* const outputScanline,
+                        const unsigned int width )
+{
+  AverageBytes( scanline1, scanline2, outputScanline, width );
+}
+
+void AverageScanlines2( const unsigned char * const scanline1,
+                        const unsigned char * const __restrict__ scanline2,
+                        unsigned char* const outputScanline,
+                        const unsigned int width )
+{
+  AverageBytes( scanline1, scanline2, outputScanline, width * 2u );
+}
+
+void AverageScanlines3( const unsigned char * const scanline1,
+                        const unsigned char * const __restrict__ scanline2,
+                        unsigned char* const outputScanline,
+                        const unsigned int width )
+{
+  AverageBytes( scanline1, scanline2, outputScanline, width * 3u );
+}
+
+void AverageScanlinesRGBA8888( const unsigned char * const scanline1,
+                               const unsigned char * const __restrict__ scanline2,
+                               unsigned char * const outputScanline,
+                               const unsigned int width )
+{
+  // Averaging RGBA8888 pixels is the same as averaging each of their bytes:
+  AverageBytes( scanline1, scanline2, outputScanline, width * 4u );
+}
+
+void AverageScanlinesRGB565( const unsigned char * const scanline1,
+                             const unsigned char * const __restrict__ scanline2,
+                             unsigned char * const outputScanline,
+                             const unsigned int width )
+{
+  const uint16_t* const alignedScanline1 = reinterpret_cast<const uint16_t*>(scanline1);
+  const uint16_t* const alignedScanline2 = reinterpret_cast<const uint16_t*>(scanline2);
+  uint16_t* const alignedOutput = reinterpret_cast<uint16_t*>(outputScanline);
+  unsigned int pixel = 0;
+
+#if defined(DALI_IMAGE_OPERATIONS_SSE2)
+  for( ; pixel + 8u <= width; pixel += 8u )
+  {
+    const __m128i a = _mm_loadu_si128( reinterpret_cast<const __m128i*>( alignedScanline1 + pixel ) );
+    const __m128i b = _mm_loadu_si128( reinterpret_cast<const __m128i*>( alignedScanline2 + pixel ) );
+    _mm_storeu_si128( reinterpret_cast<__m128i*>( alignedOutput + pixel ), AveragePixelsRGB565( a, b ) );
+  }
+#elif defined(DALI_IMAGE_OPERATIONS_NEON)
+  const uint16x8_t redMask = vdupq_n_u16( 0xf800 );
+  const uint16x8_t greenMask = vdupq_n_u16( 0x7e0 );
+  const uint16x8_t blueMask = vdupq_n_u16( 0x1f );
+  for( ; pixel + 8u <= width; pixel += 8u )
+  {
+    const uint16x8_t a = vld1q_u16( alignedScanline1 + pixel );
+    const uint16x8_t b = vld1q_u16( alignedScanline2 + pixel );
+    const uint16x8_t red   = vandq_u16( vaddq_u16( vshrq_n_u16( vandq_u16( a, redMask ), 1 ), vshrq_n_u16( vandq_u16( b, redMask ), 1 ) ), redMask );
+    const uint16x8_t green = vandq_u16( vshrq_n_u16( vaddq_u16( vandq_u16( a, greenMask ), vandq_u16( b, greenMask ) ), 1 ), greenMask );
+    const uint16x8_t blue  = vshrq_n_u16( vaddq_u16( vandq_u16( a, blueMask ), vandq_u16( b, blueMask ) ), 1 );
+    vst1q_u16( alignedOutput + pixel, vorrq_u16( vorrq_u16( red, green ), blue ) );
+  }
+#endif
+
+  for( ; pixel < width; ++pixel )
+  {
+    alignedOutput[pixel] = AveragePixelRGB565( alignedScanline1[pixel], alignedScanline2[pixel] );
+  }
+}
+
+void LinearSampleScanline3BPP( const unsigned char * __restrict__ inScanline1,
+                               const unsigned char * __restrict__ inScanline2,
+                               unsigned int inputYWeight,
+                               const unsigned int * columns1,
+                               const unsigned int * columns2,
+                               const unsigned int * columnWeights,
+                               unsigned char * __restrict__ outScanline,
+                               unsigned int desiredWidth )
+{
+  LinearSampleScanlineBytes<3>( inScanline1, inScanline2, inputYWeight, columns1, columns2, columnWeights, outScanline, desiredWidth );
+}
+
+void LinearSampleScanline4BPP( const unsigned char * __restrict__ inScanline1,
+                               const unsigned char * __restrict__ inScanline2,
+                               unsigned int inputYWeight,
+                               const unsigned int * columns1,
+                               const unsigned int * columns2,
+                               const unsigned int * columnWeights,
+                               unsigned char * __restrict__ outScanline,
+                               unsigned int desiredWidth )
+{
+  LinearSampleScanlineBytes<4>( inScanline1, inScanline2, inputYWeight, columns1, columns2, columnWeights, outScanline, desiredWidth );
+}
+
+} /* namespace Simd */
+} /* namespace Platform */
+} /* namespace Internal */
+} /* namespace Dali */
@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef DALI_INTERNAL_PLATFORM_IMAGE_OPERATIONS_SIMD_H_
+#define DALI_INTERNAL_PLATFORM_IMAGE_OPERATIONS_SIMD_H_
+
+// INTERNAL INCLUDES
+#include "image-operations.h"
+
+namespace Dali
+{
+namespace Internal
+{
+namespace Platform
+{
+
+/**
+ * @brief Vectorised versions of the scanline kernels used by the image
+ * operations, using SSE2 (and SSSE3 where present) on x86 and NEON on ARM.
+ *
+ * Every kernel produces output which is bit-exact with its scalar counterpart
+ * declared in image-operations.h so the two can be swapped freely. Callers
+ * must check IsAvailable() before calling any other function in this
+ * namespace.
+ */
+namespace Simd
+{
+
+/**
+ * @brief The vector instruction sets the kernels can be built for.
+ */
+enum VectorUnit
+{
+  VECTOR_UNIT_NONE,  ///< No usable vector unit, so only the scalar kernels can be used
+  VECTOR_UNIT_SSE2,  ///< x86 SSE2
+  VECTOR_UNIT_SSSE3, ///< x86 SSE2 plus the SSSE3 byte shuffle
+  VECTOR_UNIT_NEON   ///< ARM NEON
+};
+
+/**
+ * @brief Find out which vector unit the kernels run on.
+ *
+ * The CPU is queried the first time this is called and the result reused.
+ * @return The vector unit of the CPU this process is running on, or VECTOR_UNIT_NONE
+ *         if it has none this build can use.
+ */
+VectorUnit GetVectorUnit();
+
+/**
+ * @return true if the vectorised kernels can be used on this CPU.
+ */
+inline bool IsAvailable()
+{
+  return GetVectorUnit() != VECTOR_UNIT_NONE;
+}
+
+/**
+ * @copydoc Dali::Internal::Platform::HalveScanlineInPlaceRGB888
+ */
+void HalveScanlineInPlaceRGB888( unsigned char * const pixels, const unsigned int width );
+
+/**
+ * @copydoc Dali::Internal::Platform::HalveScanlineInPlaceRGBA8888
+ */
+void HalveScanlineInPlaceRGBA8888( unsigned char * const pixels, const unsigned int width );
+
+/**
+ * @copydoc Dali::Internal::Platform::HalveScanlineInPlaceRGB565
+ */
+void HalveScanlineInPlaceRGB565( unsigned char * const pixels, const unsigned int width );
+
+/**
+ * @copydoc Dali::Internal::Platform::HalveScanlineInPlace2Bytes
+ */
+void HalveScanlineInPlace2Bytes( unsigned char * const pixels, const unsigned int width );
+
+/**
+ * @copydoc Dali::Internal::Platform::HalveScanlineInPlace1Byte
+ */
+void HalveScanlineInPlace1Byte( unsigned char * const pixels, const unsigned int width );
+
+/**
+ * @copydoc Dali::Internal::Platform::AverageScanlines1
+ */
+void AverageScanlines1( const unsigned char * const scanline1,
+                        const unsigned char * const __restrict__ scanline2,
+                        unsigned char* const outputScanline,
+                        const unsigned int width );
+
+/**
+ * @copydoc Dali::Internal::Platform::AverageScanlines2
+ */
+void AverageScanlines2( const unsigned char * const scanline1,
+                        const unsigned char * const __restrict__ scanline2,
+                        unsigned char* const outputScanline,
+                        const unsigned int width );
+
+/**
+ * @copydoc Dali::Internal::Platform::AverageScanlines3
+ */
+void AverageScanlines3( const unsigned char * const scanline1,
+                        const unsigned char * const __restrict__ scanline2,
+                        unsigned char* const outputScanline,
+                        const unsigned int width );
+
+/**
+ * @copydoc Dali::Internal::Platform::AverageScanlinesRGBA8888
+ */
+void AverageScanlinesRGBA8888( const unsigned char * const scanline1,
+                               const unsigned char * const __restrict__ scanline2,
+                               unsigned char * const outputScanline,
+                               const unsigned int width );
+
+/**
+ * @copydoc Dali::Internal::Platform::AverageScanlinesRGB565
+ */
+void AverageScanlinesRGB565( const unsigned char * const scanline1,
+                             const unsigned char * const __restrict__ scanline2,
+                             unsigned char * const outputScanline,
+                             const unsigned int width );
+
+/**
+ * @brief Bilinear filter one scanline of an RGB888 image.
+ *
+ * @param[in] inScanline1 The upper of the two input scanlines being blended.
+ * @param[in] inScanline2 The lower of the two input scanlines being blended.
+ * @param[in] inputYWeight The 0.16 fixed-point weight of the lower scanline.
+ * @param[in] columns1 The left input pixel to blend for each output pixel.
+ * @param[in] columns2 The right input pixel to blend for each output pixel.
+ * @param[in] columnWeights The 0.16 fixed-point weight of the right input pixel for each output pixel.
+ * @param[out] outScanline The scanline to write to.
+ * @param[in] desiredWidth The number of pixels to write.
+ */
+void LinearSampleScanline3BPP( const unsigned char * __restrict__ inScanline1,
+                               const unsigned char * __restrict__ inScanline2,
+                               unsigned int inputYWeight,
+                               const unsigned int * columns1,
+                               const unsigned int * columns2,
+                               const unsigned int * columnWeights,
+                               unsigned char * __restrict__ outScanline,
+                               unsigned int desiredWidth );
+
+/**
+ * @copydoc LinearSampleScanline3BPP
+ * @note For RGBA8888 images.
+ */
+void LinearSampleScanline4BPP( const unsigned char * __restrict__ inScanline1,
+                               const unsigned char * __restrict__ inScanline2,
+                               unsigned int inputYWeight,
+                               const unsigned int * columns1,
+                               const unsigned int * columns2,
+                               const unsigned int * columnWeights,
+                               unsigned char * __restrict__ outScanline,
+                               unsigned int desiredWidth );
+
+} /* namespace Simd */
+
+} /* namespace Platform */
+} /* namespace Internal */
+} /* namespace Dali */
+
+#endif /* DALI_INTERNAL_PLATFORM_IMAGE_OPERATIONS_SIMD_H_ */
@@ -22,9 +22,12 @@
 #include <stddef.h>
 #include <cmath>
 #include <dali/integration-api/debug.h>
+#include <vector>
 #include <dali/public-api/math/vector2.h>
 
 // INTERNAL INCLUDES
+#include "image-operations-simd.h"
+#include "scaling-thread-pool.h"
 
 namespace Dali
 {
@@ -43,10 +46,45 @@ const uint8_t BORDER_FILL_VALUE( 0x00 );
 // A maximum size limit for newly created bitmaps. ( 1u << 16 ) - 1 is chosen as we are using 16bit words for dimensions.
 const unsigned int MAXIMUM_TARGET_BITMAP_SIZE( ( 1u << 16 ) - 1 );
 
+// Images with fewer pixels than this are scaled on the calling thread alone as splitting them costs more than it saves.
+const unsigned int MINIMUM_PIXELS_FOR_BANDS( 256u * 256u );
+// The fewest rows of an image worth handing to a scaling thread.
+const unsigned int MINIMUM_BAND_HEIGHT( 32u );
+
 using Integration::Bitmap;
 using Integration::BitmapPtr;
 typedef unsigned char PixelBuffer;
 
+/**
+ * @brief Owns the threads shared by all scaling operations and stops them at exit.
+ */
+struct ScalingThreads
+{
+  ScalingThreads()
+  : mPool( NULL )
+  {
+  }
+
+  ~ScalingThreads()
+  {
+    delete mPool;
+  }
+
+  ScalingThreadPool* mPool; ///< NULL when scaling on the calling thread alone
+};
+
+ScalingThreads gScalingThreads;
+
+/**
+ * @brief Get the thread pool to scale an image across.
+ * @param[in] numPixels The number of pixels the operation writes.
+ * @return The pool, or NULL if the image should be scaled on the calling thread.
+ */
+inline ScalingThreadPool* GetScalingThreadPool( unsigned int numPixels )
+{
+  return numPixels >= MINIMUM_PIXELS_FOR_BANDS ? gScalingThreads.mPool : NULL;
+}
+
 /**
  * @brief 4 byte pixel structure.
  */
@@ -738,6 +776,17 @@ Integration::BitmapPtr DownscaleBitmap( Integration::Bitmap& bitmap,
   return outputBitmap;
 }
 
+void SetScalingThreadCount( unsigned int count )
+{
+  delete gScalingThreads.mPool;
+  gScalingThreads.mPool = count > 1u ? new ScalingThreadPool( count ) : NULL;
+}
+
+unsigned int GetScalingThreadCount()
+{
+  return gScalingThreads.mPool ? gScalingThreads.mPool->GetThreadCount() : 1u;
+}
+
 namespace
 {
 /**
@@ -784,6 +833,43 @@ bool ContinueScaling( BoxDimensionTest test, unsigned int scaledWidth, unsigned
   return keepScaling;
 }
 
+/**
+ * @brief The state shared by the bands of one step of the box filter.
+ */
+struct HalvingBandContext
+{
+  unsigned char * pixels;   ///< The image being filtered in place
+  unsigned int lastWidth;   ///< The width of the image before this step
+  unsigned int scaledWidth; ///< The width of the image after this step
+};
+
+/**
+ * @brief Box filter a band of output scanlines, leaving each one at the start
+ * of the first of the two input scanlines it was averaged from.
+ *
+ * Each band touches only its own input scanlines, so bands can be filtered
+ * concurrently. The output scanlines must be packed together afterwards.
+ */
+template<
+  int BYTES_PER_PIXEL,
+  void (*HalveScanlineInPlace)( unsigned char * const pixels, const unsigned int width ),
+  void (*AverageScanlines) ( const unsigned char * const scanline1, const unsigned char * const __restrict__ scanline2, unsigned char* const outputScanline, const unsigned int width )
+>
+void HalveBand( void* context, unsigned int firstRow, unsigned int endRow )
+{
+  const HalvingBandContext& band = *static_cast<HalvingBandContext*>( context );
+  const unsigned int inputStride = band.lastWidth * BYTES_PER_PIXEL;
+
+  for( unsigned int y = firstRow; y < endRow; ++y )
+  {
+    unsigned char * const scanline1 = &band.pixels[y * 2 * inputStride];
+    unsigned char * const scanline2 = scanline1 + inputStride;
+    HalveScanlineInPlace( scanline1, band.lastWidth );
+    HalveScanlineInPlace( scanline2, band.lastWidth );
+    AverageScanlines( scanline1, scanline2, scanline1, band.scaledWidth );
+  }
+}
+
 /**
  * @brief A shared implementation of the overall iterative box filter
  * downscaling algorithm.
@@ -826,6 +912,22 @@ void DownscaleInPlacePow2Generic( unsigned char * const pixels,
 
     const unsigned int lastScanlinePair = scaledHeight - 1;
 
+    ScalingThreadPool* const pool = GetScalingThreadPool( lastWidth * scaledHeight * 2u );
+    if( pool && pool->GetBandCount( scaledHeight, MINIMUM_BAND_HEIGHT ) > 1u )
+    {
+      // Filter bands of scanlines concurrently, each output scanline landing on the first of its input pair:
+      HalvingBandContext context = { pixels, lastWidth, scaledWidth };
+      pool->Run( HalveBand<BYTES_PER_PIXEL, HalveScanlineInPlace, AverageScanlines>, &context, scaledHeight, MINIMUM_BAND_HEIGHT );
+
+      // Pack the output scanlines together. Each destination lies before any
+      // input scanline not yet moved, so this must run in order on one thread:
+      for( unsigned int y = 1; y <= lastScanlinePair; ++y )
+      {
+        memmove( &pixels[y * scaledWidth * BYTES_PER_PIXEL], &pixels[y * 2 * lastWidth * BYTES_PER_PIXEL], scaledWidth * BYTES_PER_PIXEL );
+      }
+      continue;
+    }
+
     // Scale pairs of scanlines until any spare one at the end is dropped:
     for( unsigned int y = 0; y <= lastScanlinePair; ++y )
     {
@@ -1091,7 +1193,14 @@ void DownscaleInPlacePow2RGB888( unsigned char *pixels,
                                  unsigned& outWidth,
                                  unsigned& outHeight )
 {
-  DownscaleInPlacePow2Generic<3, HalveScanlineInPlaceRGB888, AverageScanlines3>( pixels, inputWidth, inputHeight, desiredWidth, desiredHeight, dimensionTest, outWidth, outHeight );
+  if( Simd::IsAvailable() )
+  {
+    DownscaleInPlacePow2Generic<3, Simd::HalveScanlineInPlaceRGB888, Simd::AverageScanlines3>( pixels, inputWidth, inputHeight, desiredWidth, desiredHeight, dimensionTest, outWidth, outHeight );
+  }
+  else
+  {
+    DownscaleInPlacePow2Generic<3, HalveScanlineInPlaceRGB888, AverageScanlines3>( pixels, inputWidth, inputHeight, desiredWidth, desiredHeight, dimensionTest, outWidth, outHeight );
+  }
 }
 
 void DownscaleInPlacePow2RGBA8888( unsigned char * pixels,
@@ -1104,7 +1213,14 @@ void DownscaleInPlacePow2RGBA8888( unsigned char * pixels,
                                    unsigned& outHeight )
 {
   DALI_ASSERT_DEBUG( ((reinterpret_cast<ptrdiff_t>(pixels) & 3u) == 0u) && "Pointer should be 4-byte aligned for performance on some platforms." );
-  DownscaleInPlacePow2Generic<4, HalveScanlineInPlaceRGBA8888, AverageScanlinesRGBA8888>( pixels, inputWidth, inputHeight, desiredWidth, desiredHeight, dimensionTest, outWidth, outHeight );
+  if( Simd::IsAvailable() )
+  {
+    DownscaleInPlacePow2Generic<4, Simd::HalveScanlineInPlaceRGBA8888, Simd::AverageScanlinesRGBA8888>( pixels, inputWidth, inputHeight, desiredWidth, desiredHeight, dimensionTest, outWidth, outHeight );
+  }
+  else
+  {
+    DownscaleInPlacePow2Generic<4, HalveScanlineInPlaceRGBA8888, AverageScanlinesRGBA8888>( pixels, inputWidth, inputHeight, desiredWidth, desiredHeight, dimensionTest, outWidth, outHeight );
+  }
 }
 
 void DownscaleInPlacePow2RGB565( unsigned char * pixels,
@@ -1116,7 +1232,14 @@ void DownscaleInPlacePow2RGB565( unsigned char * pixels,
                                  unsigned int& outWidth,
                                  unsigned int& outHeight )
 {
-  DownscaleInPlacePow2Generic<2, HalveScanlineInPlaceRGB565, AverageScanlinesRGB565>( pixels, inputWidth, inputHeight, desiredWidth, desiredHeight, dimensionTest, outWidth, outHeight );
+  if( Simd::IsAvailable() )
+  {
+    DownscaleInPlacePow2Generic<2, Simd::HalveScanlineInPlaceRGB565, Simd::AverageScanlinesRGB565>( pixels, inputWidth, inputHeight, desiredWidth, desiredHeight, dimensionTest, outWidth, outHeight );
+  }
+  else
+  {
+    DownscaleInPlacePow2Generic<2, HalveScanlineInPlaceRGB565, AverageScanlinesRGB565>( pixels, inputWidth, inputHeight, desiredWidth, desiredHeight, dimensionTest, outWidth, outHeight );
+  }
 }
 
 /**
@@ -1133,7 +1256,14 @@ void DownscaleInPlacePow2ComponentPair( unsigned char *pixels,
                                         unsigned& outWidth,
                                         unsigned& outHeight )
 {
-  DownscaleInPlacePow2Generic<2, HalveScanlineInPlace2Bytes, AverageScanlines2>( pixels, inputWidth, inputHeight, desiredWidth, desiredHeight, dimensionTest, outWidth, outHeight );
+  if( Simd::IsAvailable() )
+  {
+    DownscaleInPlacePow2Generic<2, Simd::HalveScanlineInPlace2Bytes, Simd::AverageScanlines2>( pixels, inputWidth, inputHeight, desiredWidth, desiredHeight, dimensionTest, outWidth, outHeight );
+  }
+  else
+  {
+    DownscaleInPlacePow2Generic<2, HalveScanlineInPlace2Bytes, AverageScanlines2>( pixels, inputWidth, inputHeight, desiredWidth, desiredHeight, dimensionTest, outWidth, outHeight );
+  }
 }
 
 void DownscaleInPlacePow2SingleBytePerPixel( unsigned char * pixels,
@@ -1145,7 +1275,196 @@ void DownscaleInPlacePow2SingleBytePerPixel( unsigned char * pixels,
                                              unsigned int& outWidth,
                                              unsigned int& outHeight )
 {
-  DownscaleInPlacePow2Generic<1, HalveScanlineInPlace1Byte, AverageScanlines1>( pixels, inputWidth, inputHeight, desiredWidth, desiredHeight, dimensionTest, outWidth, outHeight );
+  if( Simd::IsAvailable() )
+  {
+    DownscaleInPlacePow2Generic<1, Simd::HalveScanlineInPlace1Byte, Simd::AverageScanlines1>( pixels, inputWidth, inputHeight, desiredWidth, desiredHeight, dimensionTest, outWidth, outHeight );
+  }
+  else
+  {
+    DownscaleInPlacePow2Generic<1, HalveScanlineInPlace1Byte, AverageScanlines1>( pixels, inputWidth, inputHeight, desiredWidth, desiredHeight, dimensionTest, outWidth, outHeight );
+  }
+}
+
+unsigned int CalculateBoxFilterHalvings( Pixel::Format pixelFormat,
+                                         ImageDimensions inputDimensions,
+                                         ImageDimensions desiredDimensions,
+                                         FittingMode::Type fittingMode,
+                                         SamplingMode::Type samplingMode )
+{
+  unsigned int halvings = 0;
+
+  // Mirror the conditions under which DownscaleBitmap() and DownscaleInPlacePow2() box filter:
+  const unsigned int desiredWidth = desiredDimensions.GetWidth();
+  const unsigned int desiredHeight = desiredDimensions.GetHeight();
+  if( ( samplingMode == SamplingMode::BOX || samplingMode == SamplingMode::BOX_THEN_NEAREST || samplingMode == SamplingMode::BOX_THEN_LINEAR ) &&
+      ( pixelFormat == Pixel::RGBA8888 || pixelFormat == Pixel::RGB888 || pixelFormat == Pixel::RGB565 || pixelFormat == Pixel::LA88 || pixelFormat == Pixel::L8 || pixelFormat == Pixel::A8 ) &&
+      desiredWidth > 0u && desiredHeight > 0u &&
+      ( desiredWidth < inputDimensions.GetWidth() || desiredHeight < inputDimensions.GetHeight() ) )
+  {
+    const BoxDimensionTest dimensionTest = DimensionTestForScalingMode( fittingMode );
+    unsigned int scaledWidth = inputDimensions.GetWidth(), scaledHeight = inputDimensions.GetHeight();
+    while( ContinueScaling( dimensionTest, scaledWidth, scaledHeight, desiredWidth, desiredHeight ) )
+    {
+      scaledWidth  >>= 1u;
+      scaledHeight >>= 1u;
+      ++halvings;
+    }
+  }
+
+  return halvings;
+}
+
+ScanlineBoxFilter::ScanlineBoxFilter()
+: mScanlines(),
+  mLevelOffsets(),
+  mLevelWidths(),
+  mLevelPending(),
+  mOutputPixels( NULL ),
+  mOutputStride( 0 ),
+  mOutputHeight( 0 ),
+  mOutputScanline( 0 ),
+  mBytesPerPixel( 0 ),
+  mHalveScanline( NULL ),
+  mAverageScanlines( NULL )
+{
+}
+
+bool ScanlineBoxFilter::Initialize( Pixel::Format pixelFormat, ImageDimensions inputDimensions, unsigned int halvings, unsigned char* outputPixels )
+{
+  // Use the same kernels as DownscaleInPlacePow2() so the output matches it exactly:
+  const bool simd = Simd::IsAvailable();
+  switch( pixelFormat )
+  {
+    case Pixel::RGBA8888:
+    {
+      mBytesPerPixel = 4u;
+      mHalveScanline = simd ? Simd::HalveScanlineInPlaceRGBA8888 : HalveScanlineInPlaceRGBA8888;
+      mAverageScanlines = simd ? Simd::AverageScanlinesRGBA8888 : AverageScanlinesRGBA8888;
+      break;
+    }
+    case Pixel::RGB888:
+    {
+      mBytesPerPixel = 3u;
+      mHalveScanline = simd ? Simd::HalveScanlineInPlaceRGB888 : HalveScanlineInPlaceRGB888;
+      mAverageScanlines = simd ? Simd::AverageScanlines3 : AverageScanlines3;
+      break;
+    }
+    case Pixel::RGB565:
+    {
+      mBytesPerPixel = 2u;
+      mHalveScanline = simd ? Simd::HalveScanlineInPlaceRGB565 : HalveScanlineInPlaceRGB565;
+      mAverageScanlines = simd ? Simd::AverageScanlinesRGB565 : AverageScanlinesRGB565;
+      break;
+    }
+    case Pixel::LA88:
+    {
+      mBytesPerPixel = 2u;
+      mHalveScanline = simd ? Simd::HalveScanlineInPlace2Bytes : HalveScanlineInPlace2Bytes;
+      mAverageScanlines = simd ? Simd::AverageScanlines2 : AverageScanlines2;
+      break;
+    }
+    case Pixel::L8:
+    case Pixel::A8:
+    {
+      mBytesPerPixel = 1u;
+      mHalveScanline = simd ? Simd::HalveScanlineInPlace1Byte : HalveScanlineInPlace1Byte;
+      mAverageScanlines = simd ? Simd::AverageScanlines1 : AverageScanlines1;
+      break;
+    }
+    default:
+    {
+      DALI_LOG_INFO( gImageOpsLogFilter, Dali::Integration::Log::Verbose, "Scanlines cannot be box filtered: unsupported pixel format: %u.\n", unsigned(pixelFormat) );
+      return false;
+    }
+  }
+
+  const ImageDimensions outputDimensions = GetOutputDimensions( inputDimensions, halvings );
+  if( outputDimensions.GetWidth() == 0u || outputDimensions.GetHeight() == 0u )
+  {
+    return false;
+  }
+
+  // Lay out a pair of scanlines for each halving, each level half the width of the one before:
+  mLevelOffsets.resize( halvings );
+  mLevelWidths.resize( halvings );
+  mLevelPending.assign( halvings, false );
+  unsigned int scratchSize = 0;
+  for( unsigned int level = 0; level < halvings; ++level )
+  {
+    mLevelOffsets[level] = scratchSize;
+    mLevelWidths[level] = inputDimensions.GetWidth() >> level;
+    scratchSize += 2u * mLevelWidths[level] * mBytesPerPixel;
+  }
+  mScanlines.resize( scratchSize );
+
+  mOutputPixels = outputPixels;
+  mOutputStride = outputDimensions.GetWidth() * mBytesPerPixel;
+  mOutputHeight = outputDimensions.GetHeight();
+  mOutputScanline = 0;
+  return true;
+}
+
+ImageDimensions ScanlineBoxFilter::GetOutputDimensions( ImageDimensions inputDimensions, unsigned int halvings )
+{
+  return ImageDimensions( inputDimensions.GetWidth() >> halvings, inputDimensions.GetHeight() >> halvings );
+}
+
+unsigned char* ScanlineBoxFilter::GetInputScanline()
+{
+  if( mLevelWidths.empty() )
+  {
+    // Nothing to filter so decode straight into the output. Any surplus scanline reuses the last one:
+    const unsigned int scanline = mOutputScanline < mOutputHeight ? mOutputScanline : mOutputHeight - 1u;
+    return mOutputPixels + scanline * mOutputStride;
+  }
+  return GetLevelScanline( 0u, mLevelPending[0] ? 1u : 0u );
+}
+
+void ScanlineBoxFilter::CommitInputScanline()
+{
+  const unsigned int halvings = mLevelWidths.size();
+  unsigned int level = 0;
+  while( level < halvings )
+  {
+    if( !mLevelPending[level] )
+    {
+      // Wait for the second scanline of the pair:
+      mLevelPending[level] = true;
+      return;
+    }
+    mLevelPending[level] = false;
+
+    const unsigned int width = mLevelWidths[level];
+    unsigned char * const scanline1 = GetLevelScanline( level, 0u );
+    unsigned char * const scanline2 = GetLevelScanline( level, 1u );
+    mHalveScanline( scanline1, width );
+    mHalveScanline( scanline2, width );
+
+    // Average the pair straight into the next level's pair, or into the output after the last halving:
+    const unsigned int nextLevel = level + 1u;
+    unsigned char* outputScanline = NULL;
+    if( nextLevel < halvings )
+    {
+      outputScanline = GetLevelScanline( nextLevel, mLevelPending[nextLevel] ? 1u : 0u );
+    }
+    else if( mOutputScanline < mOutputHeight )
+    {
+      outputScanline = mOutputPixels + mOutputScanline * mOutputStride;
+    }
+    else
+    {
+      return;
+    }
+    mAverageScanlines( scanline1, scanline2, outputScanline, width >> 1u );
+    level = nextLevel;
+  }
+
+  ++mOutputScanline;
+}
+
+unsigned char* ScanlineBoxFilter::GetLevelScanline( unsigned int level, unsigned int scanline )
+{
+  return &mScanlines[ mLevelOffsets[level] + scanline * mLevelWidths[level] * mBytesPerPixel ];
 }
 
 namespace
@@ -1164,7 +1483,9 @@ inline void PointSampleAddressablePixels( const uint8_t * inPixels,
                                    unsigned int inputHeight,
                                    uint8_t * outPixels,
                                    unsigned int desiredWidth,
-                                   unsigned int desiredHeight )
+                                   unsigned int desiredHeight,
+                                   unsigned int firstRow,
+                                   unsigned int endRow )
 {
   DALI_ASSERT_DEBUG( ((desiredWidth <= inputWidth && desiredHeight <= inputHeight) ||
       outPixels >= inPixels + inputWidth * inputHeight * sizeof(PIXEL) || outPixels <= inPixels - desiredWidth * desiredHeight * sizeof(PIXEL)) &&
@@ -1181,8 +1502,9 @@ inline void PointSampleAddressablePixels( const uint8_t * inPixels,
   const unsigned int deltaX = (inputWidth  << 16u) / desiredWidth;
   const unsigned int deltaY = (inputHeight << 16u) / desiredHeight;
 
-  unsigned int inY = 0;
-  for( unsigned int outY = 0; outY < desiredHeight; ++outY )
+  unsigned int inY = firstRow * deltaY;
+  unsigned int lastIntegerY = inputHeight;
+  for( unsigned int outY = firstRow; outY < endRow; ++outY )
   {
     // Round fixed point y coordinate to nearest integer:
     const unsigned int integerY = (inY + (1u << 15u)) >> 16u;
@@ -1193,6 +1515,15 @@ inline void PointSampleAddressablePixels( const uint8_t * inPixels,
     DALI_ASSERT_DEBUG( reinterpret_cast<const uint8_t*>(inScanline) < ( inPixels + inputWidth * inputHeight * sizeof(PIXEL) ) );
     DALI_ASSERT_DEBUG( reinterpret_cast<uint8_t*>(outScanline) < ( outPixels + desiredWidth * desiredHeight * sizeof(PIXEL) ) );
 
+    // When upscaling vertically, repeated input scanlines produce identical output scanlines so copy the last one:
+    inY += deltaY;
+    if( integerY == lastIntegerY )
+    {
+      memcpy( outScanline, outScanline - desiredWidth, desiredWidth * sizeof(PIXEL) );
+      continue;
+    }
+    lastIntegerY = integerY;
+
     unsigned int inX = 0;
     for( unsigned int outX = 0; outX < desiredWidth; ++outX )
     {
@@ -1203,54 +1534,22 @@ inline void PointSampleAddressablePixels( const uint8_t * inPixels,
       outScanline[outX] = pixel;
       inX += deltaX;
     }
-    inY += deltaY;
   }
 }
 
-}
-
-// RGBA8888
-void PointSample4BPP( const unsigned char * inPixels,
-                      unsigned int inputWidth,
-                      unsigned int inputHeight,
-                      unsigned char * outPixels,
-                      unsigned int desiredWidth,
-                      unsigned int desiredHeight )
-{
-  PointSampleAddressablePixels<uint32_t>( inPixels, inputWidth, inputHeight, outPixels, desiredWidth, desiredHeight );
-}
-
-// RGB565, LA88
-void PointSample2BPP( const unsigned char * inPixels,
-                      unsigned int inputWidth,
-                      unsigned int inputHeight,
-                      unsigned char * outPixels,
-                      unsigned int desiredWidth,
-                      unsigned int desiredHeight )
-{
-  PointSampleAddressablePixels<uint16_t>( inPixels, inputWidth, inputHeight, outPixels, desiredWidth, desiredHeight );
-}
-
-// L8, A8
-void PointSample1BPP( const unsigned char * inPixels,
-                      unsigned int inputWidth,
-                      unsigned int inputHeight,
-                      unsigned char * outPixels,
-                      unsigned int desiredWidth,
-                      unsigned int desiredHeight )
-{
-  PointSampleAddressablePixels<uint8_t>( inPixels, inputWidth, inputHeight, outPixels, desiredWidth, desiredHeight );
-}
-
-/* RGB888
+/**
+ * @brief Point sample the rows [firstRow, endRow) of an RGB888 image.
+ *
  * RGB888 is a special case as its pixels are not aligned addressable units.
  */
-void PointSample3BPP( const uint8_t * inPixels,
-                      unsigned int inputWidth,
-                      unsigned int inputHeight,
-                      uint8_t * outPixels,
-                      unsigned int desiredWidth,
-                      unsigned int desiredHeight )
+void PointSample3BPPRows( const uint8_t * inPixels,
+                          unsigned int inputWidth,
+                          unsigned int inputHeight,
+                          uint8_t * outPixels,
+                          unsigned int desiredWidth,
+                          unsigned int desiredHeight,
+                          unsigned int firstRow,
+                          unsigned int endRow )
 {
   if( inputWidth < 1u || inputHeight < 1u || desiredWidth < 1u || desiredHeight < 1u )
   {
@@ -1265,12 +1564,23 @@ void PointSample3BPP( const uint8_t * inPixels,
   // Step through output image in whole integer pixel steps while tracking the
   // corresponding locations in the input image using 16.16 fixed-point
   // coordinates:
-  unsigned int inY = 0; //< 16.16 fixed-point input image y-coord.
-  for( unsigned int outY = 0; outY < desiredHeight; ++outY )
+  unsigned int inY = firstRow * deltaY; //< 16.16 fixed-point input image y-coord.
+  unsigned int lastIntegerY = inputHeight;
+  for( unsigned int outY = firstRow; outY < endRow; ++outY )
   {
     const unsigned int integerY = (inY + (1u << 15u)) >> 16u;
     const uint8_t* const inScanline = &inPixels[inputWidth * integerY * BYTES_PER_PIXEL];
     uint8_t* const outScanline = &outPixels[desiredWidth * outY * BYTES_PER_PIXEL];
+
+    // Copy the previous output scanline if it was sampled from the same input one:
+    inY += deltaY;
+    if( integerY == lastIntegerY )
+    {
+      memcpy( outScanline, outScanline - desiredWidth * BYTES_PER_PIXEL, desiredWidth * BYTES_PER_PIXEL );
+      continue;
+    }
+    lastIntegerY = integerY;
+
     unsigned int inX = 0; //< 16.16 fixed-point input image x-coord.
 
     for( unsigned int outX = 0; outX < desiredWidth * BYTES_PER_PIXEL; outX += BYTES_PER_PIXEL )
@@ -1293,11 +1603,123 @@ void PointSample3BPP( const uint8_t * inPixels,
       // Increment the fixed-point input coordinate:
       inX += deltaX;
     }
+  }
+}
 
-    inY += deltaY;
+/**
+ * @brief Resample the rows [firstRow, endRow) of an image to a new resolution.
+ */
+typedef void (*RowSampler)( const unsigned char * inPixels,
+                            unsigned int inputWidth,
+                            unsigned int inputHeight,
+                            unsigned char * outPixels,
+                            unsigned int desiredWidth,
+                            unsigned int desiredHeight,
+                            unsigned int firstRow,
+                            unsigned int endRow );
+
+/**
+ * @brief The state shared by the bands of one resampling.
+ */
+struct SamplingBandContext
+{
+  RowSampler sampler;             ///< The sampler to run on each band
+  const unsigned char * inPixels; ///< The image being resampled
+  unsigned int inputWidth;        ///< The width of the image being resampled
+  unsigned int inputHeight;       ///< The height of the image being resampled
+  unsigned char * outPixels;      ///< The resampled image
+  unsigned int desiredWidth;      ///< The width of the resampled image
+  unsigned int desiredHeight;     ///< The height of the resampled image
+};
+
+/** @brief Resample one band of rows of the output image. */
+void SampleBand( void* context, unsigned int firstRow, unsigned int endRow )
+{
+  const SamplingBandContext& band = *static_cast<SamplingBandContext*>( context );
+  band.sampler( band.inPixels, band.inputWidth, band.inputHeight, band.outPixels, band.desiredWidth, band.desiredHeight, firstRow, endRow );
+}
+
+/**
+ * @brief Resample an image, splitting large ones into bands of output rows
+ * which are sampled concurrently.
+ *
+ * Every output row is computed the same way whichever band it falls in, so the
+ * result does not depend on how the rows are split. Images resampled in place
+ * are only ever sampled on the calling thread as their rows depend on the order
+ * they are written in.
+ */
+void SampleInBands( RowSampler sampler,
+                    const unsigned char * inPixels,
+                    unsigned int inputWidth,
+                    unsigned int inputHeight,
+                    unsigned int bytesPerPixel,
+                    unsigned char * outPixels,
+                    unsigned int desiredWidth,
+                    unsigned int desiredHeight )
+{
+  const bool separateBuffers = outPixels >= inPixels + inputWidth * inputHeight * bytesPerPixel ||
+                               inPixels >= outPixels + desiredWidth * desiredHeight * bytesPerPixel;
+  ScalingThreadPool* const pool = separateBuffers ? GetScalingThreadPool( desiredWidth * desiredHeight ) : NULL;
+
+  if( pool )
+  {
+    SamplingBandContext context = { sampler, inPixels, inputWidth, inputHeight, outPixels, desiredWidth, desiredHeight };
+    pool->Run( SampleBand, &context, desiredHeight, MINIMUM_BAND_HEIGHT );
+  }
+  else
+  {
+    sampler( inPixels, inputWidth, inputHeight, outPixels, desiredWidth, desiredHeight, 0u, desiredHeight );
   }
 }
 
+}
+
+// RGBA8888
+void PointSample4BPP( const unsigned char * inPixels,
+                      unsigned int inputWidth,
+                      unsigned int inputHeight,
+                      unsigned char * outPixels,
+                      unsigned int desiredWidth,
+                      unsigned int desiredHeight )
+{
+  SampleInBands( PointSampleAddressablePixels<uint32_t>, inPixels, inputWidth, inputHeight, 4u, outPixels, desiredWidth, desiredHeight );
+}
+
+// RGB565, LA88
+void PointSample2BPP( const unsigned char * inPixels,
+                      unsigned int inputWidth,
+                      unsigned int inputHeight,
+                      unsigned char * outPixels,
+                      unsigned int desiredWidth,
+                      unsigned int desiredHeight )
+{
+  SampleInBands( PointSampleAddressablePixels<uint16_t>, inPixels, inputWidth, inputHeight, 2u, outPixels, desiredWidth, desiredHeight );
+}
+
+// L8, A8
+void PointSample1BPP( const unsigned char * inPixels,
+                      unsigned int inputWidth,
+                      unsigned int inputHeight,
+                      unsigned char * outPixels,
+                      unsigned int desiredWidth,
+                      unsigned int desiredHeight )
+{
+  SampleInBands( PointSampleAddressablePixels<uint8_t>, inPixels, inputWidth, inputHeight, 1u, outPixels, desiredWidth, desiredHeight );
+}
+
+/* RGB888
+ * RGB888 is a special case as its pixels are not aligned addressable units.
+ */
+void PointSample3BPP( const uint8_t * inPixels,
+                      unsigned int inputWidth,
+                      unsigned int inputHeight,
+                      uint8_t * outPixels,
+                      unsigned int desiredWidth,
+                      unsigned int desiredHeight )
+{
+  SampleInBands( PointSample3BPPRows, inPixels, inputWidth, inputHeight, 3u, outPixels, desiredWidth, desiredHeight );
+}
+
 // Dispatch to a format-appropriate point sampling function:
 void PointSample( const unsigned char * inPixels,
                   unsigned int inputWidth,
@@ -1398,15 +1820,14 @@ template<
   bool DEBUG_ASSERT_ALIGNMENT
 >
 inline void LinearSampleGeneric( const unsigned char * __restrict__ inPixels,
-                       ImageDimensions inputDimensions,
+                       unsigned int inputWidth,
+                       unsigned int inputHeight,
                        unsigned char * __restrict__ outPixels,
-                       ImageDimensions desiredDimensions )
+                       unsigned int desiredWidth,
+                       unsigned int desiredHeight,
+                       unsigned int firstRow,
+                       unsigned int endRow )
 {
-  const unsigned int inputWidth = inputDimensions.GetWidth();
-  const unsigned int inputHeight = inputDimensions.GetHeight();
-  const unsigned int desiredWidth = desiredDimensions.GetWidth();
-  const unsigned int desiredHeight = desiredDimensions.GetHeight();
-
   DALI_ASSERT_DEBUG( ((outPixels >= inPixels + inputWidth   * inputHeight   * sizeof(PIXEL)) ||
                       (inPixels >= outPixels + desiredWidth * desiredHeight * sizeof(PIXEL))) &&
                      "Input and output buffers cannot overlap.");
@@ -1425,8 +1846,8 @@ inline void LinearSampleGeneric( const unsigned char * __restrict__ inPixels,
   const unsigned int deltaX = (inputWidth  << 16u) / desiredWidth;
   const unsigned int deltaY = (inputHeight << 16u) / desiredHeight;
 
-  unsigned int inY = 0;
-  for( unsigned int outY = 0; outY < desiredHeight; ++outY )
+  unsigned int inY = firstRow * deltaY;
+  for( unsigned int outY = firstRow; outY < endRow; ++outY )
   {
     PIXEL* const outScanline = &outAligned[desiredWidth * outY];
 
@@ -1465,6 +1886,89 @@ inline void LinearSampleGeneric( const unsigned char * __restrict__ inPixels,
   }
 }
 
+/**
+ * @brief Bilinear sampling image resize function which hands whole scanlines
+ * to a vectorised kernel.
+ *
+ * The input pixel columns and weights are the same for every output scanline
+ * so they are worked out once up-front. The sampling positions match
+ * LinearSampleGeneric() exactly.
+ */
+template<
+  unsigned int BYTES_PER_PIXEL,
+  void (*ScanlineKernel) ( const unsigned char * __restrict__ inScanline1, const unsigned char * __restrict__ inScanline2, unsigned int inputYWeight,
+                           const unsigned int * columns1, const unsigned int * columns2, const unsigned int * columnWeights,
+                           unsigned char * __restrict__ outScanline, unsigned int desiredWidth )
+>
+inline void LinearSampleByScanline( const unsigned char * __restrict__ inPixels,
+                                    unsigned int inputWidth,
+                                    unsigned int inputHeight,
+                                    unsigned char * __restrict__ outPixels,
+                                    unsigned int desiredWidth,
+                                    unsigned int desiredHeight,
+                                    unsigned int firstRow,
+                                    unsigned int endRow )
+{
+  const unsigned int bytesPerPixel = BYTES_PER_PIXEL;
+
+  DALI_ASSERT_DEBUG( ((outPixels >= inPixels + inputWidth   * inputHeight   * bytesPerPixel) ||
+                      (inPixels >= outPixels + desiredWidth * desiredHeight * bytesPerPixel)) &&
+                     "Input and output buffers cannot overlap.");
+
+  if( inputWidth < 1u || inputHeight < 1u || desiredWidth < 1u || desiredHeight < 1u )
+  {
+    return;
+  }
+  const unsigned int deltaX = (inputWidth  << 16u) / desiredWidth;
+  const unsigned int deltaY = (inputHeight << 16u) / desiredHeight;
+
+  // Work out the two input pixels to blend, and the weight to blend them with, for each output column:
+  std::vector<unsigned int> columns( desiredWidth * 3u );
+  unsigned int * const columns1 = &columns[0];
+  unsigned int * const columns2 = columns1 + desiredWidth;
+  unsigned int * const columnWeights = columns2 + desiredWidth;
+  unsigned int inX = 0;
+  for( unsigned int outX = 0; outX < desiredWidth; ++outX )
+  {
+    const unsigned int integerX1 = inX >> 16u;
+    columns1[outX] = integerX1;
+    columns2[outX] = integerX1 >= inputWidth ? integerX1 : integerX1 + 1;
+    columnWeights[outX] = inX & 65535u;
+    inX += deltaX;
+  }
+
+  const unsigned int inputStride = inputWidth * bytesPerPixel;
+  const unsigned int outputStride = desiredWidth * bytesPerPixel;
+  unsigned int inY = firstRow * deltaY;
+  for( unsigned int outY = firstRow; outY < endRow; ++outY )
+  {
+    // Find the two scanlines to blend and the weight to blend with:
+    const unsigned int integerY1 = inY >> 16u;
+    const unsigned int integerY2 = integerY1 >= inputHeight ? integerY1 : integerY1 + 1;
+    const unsigned int inputYWeight = inY & 65535u;
+
+    DALI_ASSERT_DEBUG( integerY1 < inputHeight );
+    DALI_ASSERT_DEBUG( integerY2 < inputHeight );
+
+    ScanlineKernel( &inPixels[inputStride * integerY1], &inPixels[inputStride * integerY2], inputYWeight,
+                    columns1, columns2, columnWeights, &outPixels[outputStride * outY], desiredWidth );
+    inY += deltaY;
+  }
+}
+
+/**
+ * @brief Bilinear sample an image, splitting large ones into bands of output rows.
+ */
+inline void SampleLinearInBands( RowSampler sampler,
+                                 const unsigned char * __restrict__ inPixels,
+                                 ImageDimensions inputDimensions,
+                                 unsigned int bytesPerPixel,
+                                 unsigned char * __restrict__ outPixels,
+                                 ImageDimensions desiredDimensions )
+{
+  SampleInBands( sampler, inPixels, inputDimensions.GetWidth(), inputDimensions.GetHeight(), bytesPerPixel, outPixels, desiredDimensions.GetWidth(), desiredDimensions.GetHeight() );
+}
+
 }
 
 // Format-specific linear scaling instantiations:
@@ -1474,7 +1978,7 @@ void LinearSample1BPP( const unsigned char * __restrict__ inPixels,
                        unsigned char * __restrict__ outPixels,
                        ImageDimensions desiredDimensions )
 {
-  LinearSampleGeneric<uint8_t, BilinearFilter1BPPByte, false>( inPixels, inputDimensions, outPixels, desiredDimensions );
+  SampleLinearInBands( LinearSampleGeneric<uint8_t, BilinearFilter1BPPByte, false>, inPixels, inputDimensions, 1u, outPixels, desiredDimensions );
 }
 
 void LinearSample2BPP( const unsigned char * __restrict__ inPixels,
@@ -1482,7 +1986,7 @@ void LinearSample2BPP( const unsigned char * __restrict__ inPixels,
                        unsigned char * __restrict__ outPixels,
                        ImageDimensions desiredDimensions )
 {
-  LinearSampleGeneric<Pixel2Bytes, BilinearFilter2Bytes, true>( inPixels, inputDimensions, outPixels, desiredDimensions );
+  SampleLinearInBands( LinearSampleGeneric<Pixel2Bytes, BilinearFilter2Bytes, true>, inPixels, inputDimensions, 2u, outPixels, desiredDimensions );
 }
 
 void LinearSampleRGB565( const unsigned char * __restrict__ inPixels,
@@ -1490,7 +1994,7 @@ void LinearSampleRGB565( const unsigned char * __restrict__ inPixels,
                        unsigned char * __restrict__ outPixels,
                        ImageDimensions desiredDimensions )
 {
-  LinearSampleGeneric<PixelRGB565, BilinearFilterRGB565, true>( inPixels, inputDimensions, outPixels, desiredDimensions );
+  SampleLinearInBands( LinearSampleGeneric<PixelRGB565, BilinearFilterRGB565, true>, inPixels, inputDimensions, 2u, outPixels, desiredDimensions );
 }
 
 void LinearSample3BPP( const unsigned char * __restrict__ inPixels,
@@ -1498,7 +2002,14 @@ void LinearSample3BPP( const unsigned char * __restrict__ inPixels,
                        unsigned char * __restrict__ outPixels,
                        ImageDimensions desiredDimensions )
 {
-  LinearSampleGeneric<Pixel3Bytes, BilinearFilterRGB888, false>( inPixels, inputDimensions, outPixels, desiredDimensions );
+  if( Simd::IsAvailable() )
+  {
+    SampleLinearInBands( LinearSampleByScanline<3u, Simd::LinearSampleScanline3BPP>, inPixels, inputDimensions, 3u, outPixels, desiredDimensions );
+  }
+  else
+  {
+    SampleLinearInBands( LinearSampleGeneric<Pixel3Bytes, BilinearFilterRGB888, false>, inPixels, inputDimensions, 3u, outPixels, desiredDimensions );
+  }
 }
 
 void LinearSample4BPP( const unsigned char * __restrict__ inPixels,
@@ -1506,7 +2017,14 @@ void LinearSample4BPP( const unsigned char * __restrict__ inPixels,
                        unsigned char * __restrict__ outPixels,
                        ImageDimensions desiredDimensions )
 {
-  LinearSampleGeneric<Pixel4Bytes, BilinearFilter4Bytes, true>( inPixels, inputDimensions, outPixels, desiredDimensions );
+  if( Simd::IsAvailable() )
+  {
+    SampleLinearInBands( LinearSampleByScanline<4u, Simd::LinearSampleScanline4BPP>, inPixels, inputDimensions, 4u, outPixels, desiredDimensions );
+  }
+  else
+  {
+    SampleLinearInBands( LinearSampleGeneric<Pixel4Bytes, BilinearFilter4Bytes, true>, inPixels, inputDimensions, 4u, outPixels, desiredDimensions );
+  }
 }
 
 // Dispatch to a format-appropriate linear sampling function:
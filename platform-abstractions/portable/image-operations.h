@@ -20,6 +20,7 @@
 
 // EXTERNAL INCLUDES
 #include <stdint.h>
+#include <vector>
 
 // INTERNAL INCLUDES
 #include <dali/integration-api/bitmap.h>
@@ -86,6 +87,23 @@ Integration::BitmapPtr ApplyAttributesToBitmap( Integration::BitmapPtr bitmap, I
  * @note The input bitmap pixel buffer may be modified and used as scratch working space for efficiency, so it must be discarded.
  **/
 Integration::BitmapPtr DownscaleBitmap( Integration::Bitmap& bitmap, ImageDimensions desired, FittingMode::Type fittingMode, SamplingMode::Type samplingMode );
+
+/**
+ * @brief Set the number of threads large images are scaled across.
+ *
+ * The box filter and the point and linear samplers split large images into
+ * horizontal bands of rows which are scaled concurrently. The output is
+ * identical to scaling on a single thread.
+ * @note Must not be called while any image is being scaled.
+ * @param[in] count The number of threads, including the one which asked for the
+ *                  scaling. One, the default, scales on the calling thread alone.
+ */
+void SetScalingThreadCount( unsigned int count );
+
+/**
+ * @return The number of threads large images are scaled across.
+ */
+unsigned int GetScalingThreadCount();
 /**@}*/
 
 /**
@@ -119,6 +137,104 @@ void DownscaleInPlacePow2( unsigned char * const pixels,
                            unsigned& outWidth,
                            unsigned& outHeight );
 
+/**
+ * @brief Work out how many times DownscaleBitmap() would halve an image with
+ * the box filter, without touching any pixels.
+ *
+ * @param[in] pixelFormat The format of the image.
+ * @param[in] inputDimensions The dimensions of the image before filtering.
+ * @param[in] desiredDimensions The dimensions the client is requesting.
+ * @param[in] fittingMode The fitting mode the client is requesting.
+ * @param[in] samplingMode The sampling mode the client is requesting.
+ * @return The number of halvings, zero if the sampling mode or pixel format is not box filtered.
+ */
+unsigned int CalculateBoxFilterHalvings( Pixel::Format pixelFormat,
+                                         ImageDimensions inputDimensions,
+                                         ImageDimensions desiredDimensions,
+                                         FittingMode::Type fittingMode,
+                                         SamplingMode::Type samplingMode );
+
+/**
+ * @brief Box filters an image down by a power of 2 factor one scanline at a
+ * time as the scanlines arrive from a decoder.
+ *
+ * Only a pair of scanlines is held for each halving, so a streaming decoder
+ * can shrink a large image to its final size without ever holding the whole
+ * of it in memory. The output is identical to that of DownscaleInPlacePow2()
+ * on the whole image for the same number of halvings.
+ */
+class ScanlineBoxFilter
+{
+public:
+
+  /**
+   * @brief Constructor. Initialize() must be called before any scanlines are filtered.
+   */
+  ScanlineBoxFilter();
+
+  /**
+   * @brief Prepare to filter an image.
+   * @param[in] pixelFormat The format of the image. Must be one DownscaleInPlacePow2() supports.
+   * @param[in] inputDimensions The dimensions of the image as it will be decoded.
+   * @param[in] halvings The number of times to halve the image.
+   * @param[out] outputPixels The buffer to write the filtered image to, with room for GetOutputDimensions() pixels.
+   * @return false if the pixel format is not supported or the image is too small to halve that many times.
+   */
+  bool Initialize( Pixel::Format pixelFormat, ImageDimensions inputDimensions, unsigned int halvings, unsigned char* outputPixels );
+
+  /**
+   * @brief Work out the dimensions of the filtered image.
+   * @param[in] inputDimensions The dimensions of the image as it will be decoded.
+   * @param[in] halvings The number of times to halve the image.
+   * @return The dimensions of the filtered image.
+   */
+  static ImageDimensions GetOutputDimensions( ImageDimensions inputDimensions, unsigned int halvings );
+
+  /**
+   * @brief Get the buffer to decode the next input scanline into.
+   *
+   * With no halvings this is the scanline of the output image itself, so
+   * nothing is copied.
+   * @return The buffer, with room for one scanline of the input image.
+   */
+  unsigned char* GetInputScanline();
+
+  /**
+   * @brief Filter the input scanline just decoded into the buffer from GetInputScanline().
+   *
+   * Once enough input scanlines have arrived, this writes the next output
+   * scanline. Input scanlines beyond the last whole output scanline are dropped.
+   */
+  void CommitInputScanline();
+
+private:
+
+  // Undefined
+  ScanlineBoxFilter( const ScanlineBoxFilter& scanlineBoxFilter );
+
+  // Undefined
+  ScanlineBoxFilter& operator=( const ScanlineBoxFilter& scanlineBoxFilter );
+
+  /**
+   * @brief Get one of the pair of scanlines held for a halving.
+   */
+  unsigned char* GetLevelScanline( unsigned int level, unsigned int scanline );
+
+private:
+
+  std::vector<unsigned char> mScanlines;     ///< The pair of scanlines held for each halving, widest first
+  std::vector<unsigned int> mLevelOffsets;   ///< The offset of the pair for each halving in mScanlines
+  std::vector<unsigned int> mLevelWidths;    ///< The width of the input to each halving
+  std::vector<bool> mLevelPending;           ///< Whether the first of the pair for each halving is waiting for its partner
+  unsigned char* mOutputPixels;              ///< The buffer the filtered image is written to
+  unsigned int mOutputStride;                ///< The number of bytes in an output scanline
+  unsigned int mOutputHeight;                ///< The number of scanlines in the filtered image
+  unsigned int mOutputScanline;              ///< The next output scanline to write
+  unsigned int mBytesPerPixel;               ///< The number of bytes in a pixel of the image
+  void (*mHalveScanline)( unsigned char * pixels, unsigned int width );
+  void (*mAverageScanlines)( const unsigned char * scanline1, const unsigned char * __restrict__ scanline2, unsigned char* outputScanline, unsigned int width );
+};
+
 /**
  * @brief Destructive in-place downscaling by a power of 2 factor.
  *
@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include "scaling-thread-pool.h"
+
+// EXTERNAL INCLUDES
+#include <dali/integration-api/debug.h>
+
+namespace Dali
+{
+namespace Internal
+{
+namespace Platform
+{
+
+ScalingThreadPool::ScalingThreadPool( unsigned int threadCount )
+: mThreads(),
+  mCondition(),
+  mFunction( NULL ),
+  mContext( NULL ),
+  mRowCount( 0 ),
+  mBandCount( 0 ),
+  mNextBand( 0 ),
+  mBandsRemaining( 0 ),
+  mBusy( false ),
+  mTerminate( false )
+{
+  // The thread calling Run() is one of the threads so start one fewer:
+  for( unsigned int i = 1; i < threadCount; ++i )
+  {
+    pthread_t thread;
+    int error = pthread_create( &thread, NULL, ThreadEntry, this );
+    DALI_ASSERT_ALWAYS( !error && "Error in pthread_create()" );
+    mThreads.push_back( thread );
+  }
+}
+
+ScalingThreadPool::~ScalingThreadPool()
+{
+  {
+    ConditionalWait::ScopedLock lock( mCondition );
+    mTerminate = true;
+  }
+  mCondition.Notify();
+
+  for( std::vector<pthread_t>::iterator iter = mThreads.begin(), endIter = mThreads.end(); iter != endIter; ++iter )
+  {
+    pthread_join( *iter, NULL );
+  }
+}
+
+unsigned int ScalingThreadPool::GetThreadCount() const
+{
+  return mThreads.size() + 1u;
+}
+
+unsigned int ScalingThreadPool::GetBandCount( unsigned int rowCount, unsigned int minimumBandHeight ) const
+{
+  const unsigned int tallestUseful = minimumBandHeight > 0u ? rowCount / minimumBandHeight : rowCount;
+  const unsigned int threadCount = GetThreadCount();
+  const unsigned int bandCount = tallestUseful < threadCount ? tallestUseful : threadCount;
+  return bandCount > 0u ? bandCount : 1u;
+}
+
+void ScalingThreadPool::Run( BandFunction function, void* context, unsigned int rowCount, unsigned int minimumBandHeight )
+{
+  const unsigned int bandCount = GetBandCount( rowCount, minimumBandHeight );
+
+  bool ownsPool = false;
+  if( bandCount > 1u )
+  {
+    ConditionalWait::ScopedLock lock( mCondition );
+    if( !mBusy )
+    {
+      mBusy = true;
+      mFunction = function;
+      mContext = context;
+      mRowCount = rowCount;
+      mBandCount = bandCount;
+      mNextBand = 0;
+      mBandsRemaining = bandCount;
+      ownsPool = true;
+    }
+  }
+
+  if( !ownsPool )
+  {
+    // Either not worth splitting or another thread has the pool, so process the bands here in order:
+    for( unsigned int band = 0; band < bandCount; ++band )
+    {
+      function( context, ( rowCount * band ) / bandCount, ( rowCount * ( band + 1u ) ) / bandCount );
+    }
+    return;
+  }
+
+  // Wake the workers then help them out:
+  mCondition.Notify();
+
+  Band band;
+  while( ClaimBand( band ) )
+  {
+    ProcessBand( band );
+  }
+
+  ConditionalWait::ScopedLock lock( mCondition );
+  while( mBandsRemaining > 0u )
+  {
+    mCondition.Wait( lock );
+  }
+  mBusy = false;
+  mFunction = NULL;
+  mContext = NULL;
+}
+
+bool ScalingThreadPool::ClaimBand( Band& band )
+{
+  ConditionalWait::ScopedLock lock( mCondition );
+  return ClaimBandLocked( band );
+}
+
+bool ScalingThreadPool::ClaimBandLocked( Band& band )
+{
+  if( !mBusy || mNextBand >= mBandCount )
+  {
+    return false;
+  }
+
+  const unsigned int index = mNextBand++;
+  band.function = mFunction;
+  band.context = mContext;
+  band.firstRow = ( mRowCount * index ) / mBandCount;
+  band.endRow = ( mRowCount * ( index + 1u ) ) / mBandCount;
+  return true;
+}
+
+void ScalingThreadPool::ProcessBand( const Band& band )
+{
+  band.function( band.context, band.firstRow, band.endRow );
+
+  bool operationComplete = false;
+  {
+    ConditionalWait::ScopedLock lock( mCondition );
+    operationComplete = --mBandsRemaining == 0u;
+  }
+
+  if( operationComplete )
+  {
+    // Wake the thread waiting in Run():
+    mCondition.Notify();
+  }
+}
+
+void ScalingThreadPool::WorkerLoop()
+{
+  for( ;; )
+  {
+    Band band;
+    bool claimed = false;
+    {
+      ConditionalWait::ScopedLock lock( mCondition );
+      while( !mTerminate && !( claimed = ClaimBandLocked( band ) ) )
+      {
+        mCondition.Wait( lock );
+      }
+    }
+    if( !claimed )
+    {
+      break;
+    }
+    ProcessBand( band );
+  }
+}
+
+void* ScalingThreadPool::ThreadEntry( void* data )
+{
+  static_cast<ScalingThreadPool*>( data )->WorkerLoop();
+  return NULL;
+}
+
+} /* namespace Platform */
+} /* namespace Internal */
+} /* namespace Dali */
@@ -0,0 +1,159 @@
+#ifndef DALI_INTERNAL_PLATFORM_SCALING_THREAD_POOL_H_
+#define DALI_INTERNAL_PLATFORM_SCALING_THREAD_POOL_H_
+
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <pthread.h>
+#include <vector>
+#include <dali/devel-api/threading/conditional-wait.h>
+
+namespace Dali
+{
+namespace Internal
+{
+namespace Platform
+{
+
+/**
+ * @brief A pool of threads which split the rows of an image operation into
+ * horizontal bands and process the bands concurrently.
+ *
+ * The bands an operation is split into depend only on the number of rows, the
+ * minimum band height and the size of the pool, never on which thread picks up
+ * which band, so an operation whose bands are independent produces the same
+ * output on every run. The thread calling Run() processes bands too, and if the
+ * pool is already busy with an operation from another thread it processes all
+ * of the bands of its own operation itself rather than waiting.
+ */
+class ScalingThreadPool
+{
+public:
+
+  /**
+   * @brief Process the rows [firstRow, endRow) of an operation.
+   * @param[in] context The context passed to Run().
+   * @param[in] firstRow The first row of the band.
+   * @param[in] endRow One past the last row of the band.
+   */
+  typedef void (*BandFunction)( void* context, unsigned int firstRow, unsigned int endRow );
+
+  /**
+   * @brief Constructor.
+   * @param[in] threadCount The number of threads to spread operations across,
+   *                        including the one calling Run(). A pool of one thread
+   *                        starts no threads of its own.
+   */
+  explicit ScalingThreadPool( unsigned int threadCount );
+
+  /**
+   * @brief Destructor. Stops and joins the worker threads.
+   */
+  ~ScalingThreadPool();
+
+  /**
+   * @return The number of threads operations are spread across, including the caller of Run().
+   */
+  unsigned int GetThreadCount() const;
+
+  /**
+   * @brief Work out how many bands an operation would be split into.
+   * @param[in] rowCount The number of rows in the operation.
+   * @param[in] minimumBandHeight The fewest rows worth handing to a thread.
+   * @return The number of bands, at least one.
+   */
+  unsigned int GetBandCount( unsigned int rowCount, unsigned int minimumBandHeight ) const;
+
+  /**
+   * @brief Split the rows of an operation into bands and process them across
+   * the pool, returning once every band is complete.
+   * @param[in] function Called once for each band.
+   * @param[in] context Passed through to function.
+   * @param[in] rowCount The number of rows in the operation.
+   * @param[in] minimumBandHeight The fewest rows worth handing to a thread.
+   */
+  void Run( BandFunction function, void* context, unsigned int rowCount, unsigned int minimumBandHeight );
+
+private:
+
+  /**
+   * @brief One band of an operation, claimed by a thread.
+   */
+  struct Band
+  {
+    BandFunction function; ///< The band function of the operation
+    void* context;         ///< The context of the operation
+    unsigned int firstRow; ///< The first row of the band
+    unsigned int endRow;   ///< One past the last row of the band
+  };
+
+  /**
+   * @brief Claim the next unclaimed band of the current operation.
+   * @param[out] band Set to the claimed band.
+   * @return false if there is no band left to claim.
+   */
+  bool ClaimBand( Band& band );
+
+  /**
+   * @copydoc ClaimBand
+   * @note mCondition must already be locked.
+   */
+  bool ClaimBandLocked( Band& band );
+
+  /**
+   * @brief Process a claimed band and wake the thread in Run() if it was the last one outstanding.
+   * @param[in] band The band to process.
+   */
+  void ProcessBand( const Band& band );
+
+  /**
+   * @brief The main loop of each worker thread.
+   */
+  void WorkerLoop();
+
+  /**
+   * @brief Entry point of the worker threads.
+   * @param[in] data The pool.
+   */
+  static void* ThreadEntry( void* data );
+
+  // Undefined
+  ScalingThreadPool( const ScalingThreadPool& scalingThreadPool );
+
+  // Undefined
+  ScalingThreadPool& operator=( const ScalingThreadPool& scalingThreadPool );
+
+private:
+
+  std::vector<pthread_t> mThreads; ///< The worker threads
+  ConditionalWait mCondition;      ///< Guards the operation state below and wakes the threads
+  BandFunction mFunction;          ///< The band function of the current operation
+  void* mContext;                  ///< The context of the current operation
+  unsigned int mRowCount;          ///< The number of rows in the current operation
+  unsigned int mBandCount;         ///< The number of bands the current operation is split into
+  unsigned int mNextBand;          ///< The first band of the current operation not yet claimed by a thread
+  unsigned int mBandsRemaining;    ///< The number of bands of the current operation not yet complete
+  bool mBusy;                      ///< Whether an operation is in progress
+  bool mTerminate;                 ///< Set to stop the worker threads
+};
+
+} /* namespace Platform */
+} /* namespace Internal */
+} /* namespace Dali */
+
+#endif /* DALI_INTERNAL_PLATFORM_SCALING_THREAD_POOL_H_ */
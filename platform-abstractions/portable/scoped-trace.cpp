@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include "scoped-trace.h"
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace Trace
+{
+
+namespace
+{
+Recorder* gRecorder = NULL; ///< Where traces are recorded while any category is enabled
+
+/**
+ * Records the beginning or end of a scope, unless tracing has been disabled since the scope began
+ */
+void RecordScope( const char* const name, bool begin )
+{
+  Recorder* recorder = __atomic_load_n( &gRecorder, __ATOMIC_ACQUIRE );
+  if( recorder )
+  {
+    recorder->RecordScope( name, begin );
+  }
+}
+
+} // unnamed namespace
+
+unsigned int gEnabledCategories = 0u;
+
+void Enable( Recorder& recorder, unsigned int categories )
+{
+  // Publish the recorder before any category can see it
+  __atomic_store_n( &gRecorder, &recorder, __ATOMIC_RELEASE );
+  __atomic_store_n( &gEnabledCategories, categories, __ATOMIC_RELEASE );
+}
+
+void Disable()
+{
+  __atomic_store_n( &gEnabledCategories, 0u, __ATOMIC_RELEASE );
+  __atomic_store_n( &gRecorder, static_cast< Recorder* >( NULL ), __ATOMIC_RELEASE );
+}
+
+void Begin( const char* const name )
+{
+  RecordScope( name, true );
+}
+
+void End( const char* const name )
+{
+  RecordScope( name, false );
+}
+
+} // namespace Trace
+
+} // namespace Internal
+
+} // namespace Dali
@@ -0,0 +1,190 @@
+#ifndef __DALI_INTERNAL_SCOPED_TRACE_H__
+#define __DALI_INTERNAL_SCOPED_TRACE_H__
+
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <stddef.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+/**
+ * Scoped traces record the beginning and end of a block of code into the adaptor's TraceRecorder, so that it
+ * shows up as a named slice in the Chrome trace. They are finer grained than the performance markers, which also
+ * feed the statistics. They are declared here so the adaptor, the platform abstraction and the text abstraction
+ * can all record them.
+ *
+ * Use the DALI_TRACE_SCOPE macro rather than ScopedTrace directly:
+ *
+ *   DALI_TRACE_SCOPE( Trace::RESOURCE, "DecodeJpeg" );
+ *
+ * Unless the library is built with --enable-trace (TRACE_ENABLED), the macro compiles to nothing, and its
+ * arguments are not evaluated. When it is built in, a trace costs one relaxed atomic load and a branch unless
+ * its category is enabled at runtime, see DALI_TRACE_CATEGORIES.
+ */
+namespace Trace
+{
+
+/**
+ * Categories of scoped traces, which are enabled separately at runtime
+ */
+enum Category
+{
+  UPDATE         = 1 << 0, ///< Bit 0 (1), update thread
+  RENDER         = 1 << 1, ///< Bit 1 (2), render thread
+  RESOURCE       = 1 << 2, ///< Bit 2 (4), resource loading and decoding
+  TEXT           = 1 << 3, ///< Bit 3 (8), fonts, glyphs and shaping
+  ALL_CATEGORIES = UPDATE | RENDER | RESOURCE | TEXT
+};
+
+/**
+ * Where scoped traces are recorded while any category is enabled
+ */
+class Recorder
+{
+public:
+
+  /**
+   * Records the beginning or end of a scope, time stamped now. Called from any thread.
+   * @param[in] name The scope name, which must stay valid while the trace is recorded, e.g. a string literal
+   * @param[in] begin true at the beginning of the scope, false at its end
+   */
+  virtual void RecordScope( const char* const name, bool begin ) = 0;
+
+protected:
+
+  /**
+   * Virtual protected destructor, no deletion through this interface
+   */
+  virtual ~Recorder() {}
+};
+
+/**
+ * The categories currently enabled, only to be read through IsEnabled()
+ */
+extern unsigned int gEnabledCategories;
+
+/**
+ * @param[in] category A category
+ * @return Whether traces in the category are recorded
+ */
+inline bool IsEnabled( Category category )
+{
+  // Relaxed, as a trace recorded slightly before or after the categories change makes no difference
+  return ( __atomic_load_n( &gEnabledCategories, __ATOMIC_RELAXED ) & category ) != 0u;
+}
+
+/**
+ * Starts recording traces in the given categories. Called when the performance server is created.
+ * @param[in] recorder The recorder to record into, which must outlive the traces
+ * @param[in] categories Bitmask of the categories to record
+ */
+void Enable( Recorder& recorder, unsigned int categories );
+
+/**
+ * Stops recording traces. Called before the recorder is destroyed.
+ */
+void Disable();
+
+/**
+ * Records the beginning of a scope
+ * @param[in] name The scope name, e.g. a string literal
+ */
+void Begin( const char* const name );
+
+/**
+ * Records the end of a scope
+ * @param[in] name The scope name
+ */
+void End( const char* const name );
+
+/**
+ * Records the beginning of a scope when constructed, and its end when destroyed, if the category is enabled.
+ */
+class ScopedTrace
+{
+public:
+
+  /**
+   * Constructor
+   * @param[in] category The category of the trace
+   * @param[in] name The scope name, which must stay valid while the trace is recorded, e.g. a string literal
+   */
+  ScopedTrace( Category category, const char* const name )
+  : mName( IsEnabled( category ) ? name : NULL )
+  {
+    if( mName )
+    {
+      Begin( mName );
+    }
+  }
+
+  /**
+   * Destructor
+   */
+  ~ScopedTrace()
+  {
+    if( mName )
+    {
+      End( mName );
+    }
+  }
+
+private:
+
+  // Undefined copy constructor.
+  ScopedTrace( const ScopedTrace& );
+
+  // Undefined assignment operator.
+  ScopedTrace& operator=( const ScopedTrace& );
+
+private:
+
+  const char* const mName; ///< the scope name, or NULL if the category was not enabled
+};
+
+} // namespace Trace
+
+} // namespace Internal
+
+} // namespace Dali
+
+#define DALI_TRACE_CONCATENATE_( prefix, line ) prefix ## line
+#define DALI_TRACE_CONCATENATE( prefix, line )  DALI_TRACE_CONCATENATE_( prefix, line )
+
+#ifdef TRACE_ENABLED
+
+/**
+ * Records a named scope, until the end of the enclosing block
+ * @param[in] category A Trace::Category
+ * @param[in] name A string literal
+ */
+#define DALI_TRACE_SCOPE( category, name ) \
+  Dali::Internal::Trace::ScopedTrace DALI_TRACE_CONCATENATE( traceScope, __LINE__ )( Dali::Internal::category, name )
+
+#else
+
+#define DALI_TRACE_SCOPE( category, name )
+
+#endif // TRACE_ENABLED
+
+#endif // __DALI_INTERNAL_SCOPED_TRACE_H__
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include "texture-upload-budget.h"
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+TextureUploadBudget::TextureUploadBudget()
+: mBytesPerFrame( 0u ),
+  mBytesUploaded( 0u ),
+  mUploadCount( 0u ),
+  mDeferredCount( 0u ),
+  mLastFrameBytesUploaded( 0u ),
+  mLastFrameDeferredCount( 0u )
+{
+}
+
+TextureUploadBudget::~TextureUploadBudget()
+{
+}
+
+void TextureUploadBudget::SetBytesPerFrame( unsigned int bytesPerFrame )
+{
+  mBytesPerFrame = bytesPerFrame;
+}
+
+unsigned int TextureUploadBudget::GetBytesPerFrame() const
+{
+  return mBytesPerFrame;
+}
+
+bool TextureUploadBudget::Upload( uint64_t bytes )
+{
+  // The first upload of a frame always goes ahead, however large, so that it is never deferred forever
+  if( mBytesPerFrame > 0u && mUploadCount > 0u && mBytesUploaded + bytes > mBytesPerFrame )
+  {
+    ++mDeferredCount;
+    return false;
+  }
+
+  mBytesUploaded += bytes;
+  ++mUploadCount;
+  return true;
+}
+
+void TextureUploadBudget::NextFrame()
+{
+  // The previous frame's counts may be read from other threads
+  __atomic_store_n( &mLastFrameBytesUploaded, mBytesUploaded, __ATOMIC_RELAXED );
+  __atomic_store_n( &mLastFrameDeferredCount, mDeferredCount, __ATOMIC_RELAXED );
+
+  mBytesUploaded = 0u;
+  mUploadCount = 0u;
+  mDeferredCount = 0u;
+}
+
+uint64_t TextureUploadBudget::GetBytesUploaded() const
+{
+  return __atomic_load_n( &mLastFrameBytesUploaded, __ATOMIC_RELAXED );
+}
+
+unsigned int TextureUploadBudget::GetDeferredCount() const
+{
+  return __atomic_load_n( &mLastFrameDeferredCount, __ATOMIC_RELAXED );
+}
+
+} // namespace Internal
+
+} // namespace Dali
@@ -0,0 +1,110 @@
+#ifndef __DALI_INTERNAL_TEXTURE_UPLOAD_BUDGET_H__
+#define __DALI_INTERNAL_TEXTURE_UPLOAD_BUDGET_H__
+
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <stdint.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+/**
+ * Limits the bytes of texture data uploaded in each frame, so that a burst of large uploads
+ * is spread over several frames rather than causing one long frame.
+ *
+ * Whoever uploads asks the budget first, and defers the upload to a later frame if it does not fit.
+ * The first upload of a frame always fits, so that one larger than the whole budget still happens.
+ *
+ * The budget is used from one thread only. The counts of the previous frame can be read from any thread.
+ * The adaptor keeps one for the render thread and the platform abstraction one for the resources it hands to core.
+ */
+class TextureUploadBudget
+{
+public:
+
+  /**
+   * Constructor, with no limit.
+   */
+  TextureUploadBudget();
+
+  /**
+   * Non-virtual destructor; not intended as a base class.
+   */
+  ~TextureUploadBudget();
+
+  /**
+   * Set the limit.
+   * @param[in] bytesPerFrame The bytes which may be uploaded in each frame, or zero for no limit
+   */
+  void SetBytesPerFrame( unsigned int bytesPerFrame );
+
+  /**
+   * @return The bytes which may be uploaded in each frame, or zero for no limit.
+   */
+  unsigned int GetBytesPerFrame() const;
+
+  /**
+   * Ask to upload some data in the current frame. If the upload fits it is counted against the budget,
+   * otherwise it is counted as deferred.
+   * @param[in] bytes The size of the data
+   * @return true if the data can be uploaded now, false if it should wait for a later frame
+   */
+  bool Upload( uint64_t bytes );
+
+  /**
+   * Start a new frame, with the whole budget available.
+   */
+  void NextFrame();
+
+  /**
+   * @return The bytes uploaded in the previous frame.
+   */
+  uint64_t GetBytesUploaded() const;
+
+  /**
+   * @return The number of uploads deferred in the previous frame.
+   */
+  unsigned int GetDeferredCount() const;
+
+private:
+
+  // Undefined
+  TextureUploadBudget( const TextureUploadBudget& textureUploadBudget );
+
+  // Undefined
+  TextureUploadBudget& operator=( const TextureUploadBudget& textureUploadBudget );
+
+private: // Data
+
+  unsigned int mBytesPerFrame;          ///< The limit, zero for none
+  uint64_t mBytesUploaded;              ///< Bytes uploaded in the current frame
+  unsigned int mUploadCount;            ///< Uploads in the current frame
+  unsigned int mDeferredCount;          ///< Uploads deferred in the current frame
+  uint64_t mLastFrameBytesUploaded;     ///< Bytes uploaded in the previous frame
+  unsigned int mLastFrameDeferredCount; ///< Uploads deferred in the previous frame
+};
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // __DALI_INTERNAL_TEXTURE_UPLOAD_BUDGET_H__
@@ -118,7 +118,7 @@ bool DecodeRle( const unsigned char* input,
   // check the decoded data will fit in to
   if( outputLength < decodedSize )
   {
-    DALI_LOG_ERROR("buffer too small, buffer size =%d, data size = %d \n",outputLength, decodedSize);
+    DALI_LOG_ERROR("buffer too small, buffer size =%u, data size = %u \n", static_cast<unsigned int>(outputLength), static_cast<unsigned int>(decodedSize));
     return false;
   }
 
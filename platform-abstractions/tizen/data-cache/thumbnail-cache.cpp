@@ -0,0 +1,554 @@
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include "thumbnail-cache.h"
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <vector>
+#include <dirent.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <dali/integration-api/debug.h>
+
+// INTERNAL INCLUDES
+#include "data-compression.h"
+
+namespace Dali
+{
+namespace TizenPlatform
+{
+
+namespace
+{
+
+#if defined(DEBUG_ENABLED)
+Debug::Filter* gThumbnailCacheLogFilter = Debug::Filter::New( Debug::NoLogging, false, "LOG_THUMBNAIL_CACHE" );
+#endif
+
+/** Identifies entry files, and changes whenever their layout does. */
+const char ENTRY_MAGIC[8] = { 'D', 'A', 'L', 'I', 'T', 'H', 'M', '1' };
+
+/** The extension of complete entry files. */
+const char * const ENTRY_EXTENSION = ".thumb";
+
+/** Marks the files entries are written to before being renamed into place. */
+const char * const TEMPORARY_SUFFIX = ".tmpXXXXXX";
+
+/** How the pixels of an entry are stored. */
+enum Encoding
+{
+  ENCODING_RAW = 0, ///< As they are in the bitmap
+  ENCODING_RLE = 1  ///< Run length encoded by DataCompression::EncodeRle()
+};
+
+/**
+ * @brief The start of every entry file. It is followed by the serialised key
+ * and then the pixels.
+ */
+struct EntryHeader
+{
+  char magic[8];
+  uint32_t keyLength;    ///< The length of the serialised key
+  uint32_t pixelFormat;
+  uint32_t width;
+  uint32_t height;
+  uint32_t encoding;     ///< An Encoding value
+  uint32_t pixelBytes;   ///< The size of the decoded pixels
+  uint32_t payloadBytes; ///< The size of the pixels as stored
+  uint32_t checksum;     ///< Of the serialised key followed by the stored pixels
+};
+
+/**
+ * @brief FNV-1a hash of a block of bytes, continuing from a previous hash.
+ */
+uint32_t Checksum( const unsigned char* bytes, std::size_t count, uint32_t hash = 2166136261u )
+{
+  for( std::size_t i = 0; i < count; ++i )
+  {
+    hash = ( hash ^ bytes[i] ) * 16777619u;
+  }
+  return hash;
+}
+
+/**
+ * @brief Turn a key into the string stored in its entry file to catch collisions of entry names.
+ */
+std::string SerializeKey( const ThumbnailCache::Key& key )
+{
+  char attributes[128];
+  snprintf( attributes, sizeof( attributes ), "\n%lld %lld %ux%u %d %d %d",
+            key.modificationTime, key.fileSize,
+            static_cast<unsigned int>( key.dimensions.GetWidth() ), static_cast<unsigned int>( key.dimensions.GetHeight() ),
+            static_cast<int>( key.fittingMode ), static_cast<int>( key.samplingMode ), key.orientationCorrection ? 1 : 0 );
+  return key.path + attributes;
+}
+
+/**
+ * @brief Work out the name of the entry file of a key from a 64 bit FNV-1a hash of it.
+ */
+std::string GetEntryName( const std::string& serializedKey )
+{
+  uint64_t hash = 14695981039346656037ULL;
+  for( std::string::const_iterator iter = serializedKey.begin(), endIter = serializedKey.end(); iter != endIter; ++iter )
+  {
+    hash = ( hash ^ static_cast<unsigned char>( *iter ) ) * 1099511628211ULL;
+  }
+
+  char name[32];
+  snprintf( name, sizeof( name ), "%016llx%s", static_cast<unsigned long long>( hash ), ENTRY_EXTENSION );
+  return name;
+}
+
+/**
+ * @brief Check whether a name ends with a suffix.
+ */
+bool EndsWith( const std::string& name, const char * const suffix )
+{
+  const std::size_t suffixLength = strlen( suffix );
+  return name.size() >= suffixLength && name.compare( name.size() - suffixLength, suffixLength, suffix ) == 0;
+}
+
+/**
+ * @brief Write a whole block to a file descriptor, retrying short writes.
+ * @return false on error.
+ */
+bool WriteAll( int fileDescriptor, const void* data, std::size_t size )
+{
+  const unsigned char* bytes = static_cast<const unsigned char*>( data );
+  while( size > 0 )
+  {
+    const ssize_t written = write( fileDescriptor, bytes, size );
+    if( written < 0 )
+    {
+      if( errno == EINTR )
+      {
+        continue;
+      }
+      return false;
+    }
+    bytes += written;
+    size -= written;
+  }
+  return true;
+}
+
+/** An entry file found in the directory, with the time it was last used. */
+typedef std::pair<long long, std::pair<std::string, std::size_t> > FoundEntry;
+
+bool MoreRecentlyUsed( const FoundEntry& a, const FoundEntry& b )
+{
+  return a.first > b.first;
+}
+
+} // unnamed namespace
+
+ThumbnailCache::Key::Key( const std::string& path,
+                          long long modificationTime,
+                          long long fileSize,
+                          ImageDimensions dimensions,
+                          FittingMode::Type fittingMode,
+                          SamplingMode::Type samplingMode,
+                          bool orientationCorrection ) :
+  path( path ),
+  modificationTime( modificationTime ),
+  fileSize( fileSize ),
+  dimensions( dimensions ),
+  fittingMode( fittingMode ),
+  samplingMode( samplingMode ),
+  orientationCorrection( orientationCorrection )
+{
+}
+
+ThumbnailCache::ThumbnailCache() :
+  mDirectory(),
+  mEntries(),
+  mIndex(),
+  mCapacity( 0 ),
+  mSize( 0 ),
+  mHits( 0 ),
+  mMisses( 0 )
+{
+}
+
+ThumbnailCache::~ThumbnailCache()
+{
+}
+
+bool ThumbnailCache::SetDirectory( const std::string& directory, std::size_t capacity )
+{
+  Mutex::ScopedLock lock( mMutex );
+
+  mDirectory.clear();
+  mEntries.clear();
+  mIndex.clear();
+  mCapacity = capacity;
+  mSize = 0;
+
+  if( directory.empty() )
+  {
+    return false;
+  }
+
+  if( mkdir( directory.c_str(), 0700 ) != 0 && errno != EEXIST )
+  {
+    DALI_LOG_ERROR( "Unable to create thumbnail cache directory %s (errno %d)\n", directory.c_str(), errno );
+    return false;
+  }
+
+  DIR* const dir = opendir( directory.c_str() );
+  if( NULL == dir )
+  {
+    DALI_LOG_ERROR( "Unable to open thumbnail cache directory %s (errno %d)\n", directory.c_str(), errno );
+    return false;
+  }
+
+  // Find the entries left by earlier runs, deleting any which were never completed:
+  std::vector<FoundEntry> found;
+  for( struct dirent* dirEntry = readdir( dir ); dirEntry != NULL; dirEntry = readdir( dir ) )
+  {
+    const std::string name( dirEntry->d_name );
+    const std::string path = directory + '/' + name;
+    if( name.find( ".tmp" ) != std::string::npos )
+    {
+      unlink( path.c_str() );
+    }
+    else if( EndsWith( name, ENTRY_EXTENSION ) )
+    {
+      struct stat fileStatus;
+      if( stat( path.c_str(), &fileStatus ) == 0 && S_ISREG( fileStatus.st_mode ) )
+      {
+        const long long lastUse = fileStatus.st_mtim.tv_sec * 1000000000LL + fileStatus.st_mtim.tv_nsec;
+        found.push_back( FoundEntry( lastUse, std::make_pair( name, static_cast<std::size_t>( fileStatus.st_size ) ) ) );
+      }
+    }
+  }
+  closedir( dir );
+
+  std::sort( found.begin(), found.end(), MoreRecentlyUsed );
+  for( std::vector<FoundEntry>::const_iterator iter = found.begin(), endIter = found.end(); iter != endIter; ++iter )
+  {
+    mEntries.push_back( Entry( iter->second.first, iter->second.second ) );
+    mIndex[iter->second.first] = --mEntries.end();
+    mSize += iter->second.second;
+  }
+
+  mDirectory = directory;
+  TrimLocked();
+
+  DALI_LOG_INFO( gThumbnailCacheLogFilter, Debug::General, "Thumbnail cache in %s holds %u entries of %u bytes\n", mDirectory.c_str(), static_cast<unsigned int>( mEntries.size() ), static_cast<unsigned int>( mSize ) );
+  return true;
+}
+
+bool ThumbnailCache::IsEnabled() const
+{
+  Mutex::ScopedLock lock( mMutex );
+  return !mDirectory.empty();
+}
+
+Integration::BitmapPtr ThumbnailCache::Find( const Key& key )
+{
+  std::string directory;
+  {
+    Mutex::ScopedLock lock( mMutex );
+    directory = mDirectory;
+  }
+  if( directory.empty() )
+  {
+    return Integration::BitmapPtr();
+  }
+
+  const std::string serializedKey = SerializeKey( key );
+  const std::string name = GetEntryName( serializedKey );
+  const std::string path = directory + '/' + name;
+
+  FILE* const fp = fopen( path.c_str(), "rb" );
+  if( NULL == fp )
+  {
+    return Miss( name, false );
+  }
+
+  // Read and check the whole entry before trusting any of it:
+  EntryHeader header;
+  std::vector<unsigned char> payload;
+  bool valid = fread( &header, sizeof( header ), 1, fp ) == 1 &&
+               memcmp( header.magic, ENTRY_MAGIC, sizeof( ENTRY_MAGIC ) ) == 0;
+
+  // An entry for a different key whose name collides with this one is kept:
+  bool collision = false;
+  if( valid )
+  {
+    collision = header.keyLength != serializedKey.size();
+    if( !collision )
+    {
+      std::vector<char> storedKey( header.keyLength + 1u );
+      collision = fread( &storedKey[0], 1, header.keyLength, fp ) != header.keyLength ||
+                  serializedKey.compare( 0, std::string::npos, &storedKey[0], header.keyLength ) != 0;
+    }
+    valid = !collision;
+  }
+
+  const Pixel::Format pixelFormat = static_cast<Pixel::Format>( header.pixelFormat );
+  if( valid )
+  {
+    const std::size_t pixelBytes = static_cast<std::size_t>( header.width ) * header.height * Pixel::GetBytesPerPixel( pixelFormat );
+    valid = pixelBytes > 0 && pixelBytes == header.pixelBytes && header.payloadBytes > 0 &&
+            ( ( header.encoding == ENCODING_RAW && header.payloadBytes == pixelBytes ) ||
+              ( header.encoding == ENCODING_RLE && header.payloadBytes <= DataCompression::GetMaximumRleCompressedSize( pixelBytes ) ) );
+  }
+  if( valid )
+  {
+    // A corrupt header must not make the payload larger than the file:
+    struct stat fileStatus;
+    valid = fstat( fileno( fp ), &fileStatus ) == 0 &&
+            static_cast<uint64_t>( sizeof( header ) ) + header.keyLength + header.payloadBytes <= static_cast<uint64_t>( fileStatus.st_size );
+  }
+  if( valid )
+  {
+    payload.resize( header.payloadBytes );
+    valid = fread( &payload[0], 1, header.payloadBytes, fp ) == header.payloadBytes &&
+            Checksum( &payload[0], payload.size(), Checksum( reinterpret_cast<const unsigned char*>( serializedKey.data() ), serializedKey.size() ) ) == header.checksum;
+  }
+  if( !valid )
+  {
+    fclose( fp );
+    DALI_LOG_INFO( gThumbnailCacheLogFilter, Debug::Verbose, "Unusable thumbnail cache entry %s for %s\n", name.c_str(), key.path.c_str() );
+    return Miss( name, !collision );
+  }
+
+  Integration::BitmapPtr bitmap = Integration::Bitmap::New( Integration::Bitmap::BITMAP_2D_PACKED_PIXELS, ResourcePolicy::OWNED_DISCARD );
+  unsigned char * const pixels = bitmap->GetPackedPixelsProfile()->ReserveBuffer( pixelFormat, header.width, header.height );
+  if( header.encoding == ENCODING_RLE )
+  {
+    std::size_t decodedSize = 0;
+    valid = DataCompression::DecodeRle( &payload[0], payload.size(), pixels, header.pixelBytes, decodedSize ) && decodedSize == header.pixelBytes;
+  }
+  else
+  {
+    memcpy( pixels, &payload[0], header.pixelBytes );
+  }
+
+  // Mark the entry as used so the order of use survives restarts:
+  futimens( fileno( fp ), NULL );
+  fclose( fp );
+
+  if( !valid )
+  {
+    return Miss( name, true );
+  }
+
+  Mutex::ScopedLock lock( mMutex );
+  ++mHits;
+  EntryIndex::iterator found = mIndex.find( name );
+  if( found != mIndex.end() )
+  {
+    mEntries.splice( mEntries.begin(), mEntries, found->second );
+  }
+  else
+  {
+    AddEntryLocked( name, sizeof( header ) + header.keyLength + header.payloadBytes );
+  }
+  DALI_LOG_INFO( gThumbnailCacheLogFilter, Debug::Verbose, "Thumbnail cache hit for %s (hits: %u, misses: %u)\n", key.path.c_str(), mHits, mMisses );
+  return bitmap;
+}
+
+bool ThumbnailCache::Insert( const Key& key, Integration::Bitmap& bitmap )
+{
+  std::string directory;
+  std::size_t capacity = 0;
+  {
+    Mutex::ScopedLock lock( mMutex );
+    directory = mDirectory;
+    capacity = mCapacity;
+  }
+  if( directory.empty() || NULL == bitmap.GetPackedPixelsProfile() )
+  {
+    return false;
+  }
+
+  const Pixel::Format pixelFormat = bitmap.GetPixelFormat();
+  const std::size_t pixelBytes = static_cast<std::size_t>( bitmap.GetImageWidth() ) * bitmap.GetImageHeight() * Pixel::GetBytesPerPixel( pixelFormat );
+  if( pixelBytes == 0 || pixelBytes != bitmap.GetBufferSize() || static_cast<uint64_t>( pixelBytes ) > std::numeric_limits<uint32_t>::max() )
+  {
+    // Empty, padded or compressed bitmaps are not stored:
+    return false;
+  }
+
+  // Run length encode the pixels if that makes them smaller:
+  const unsigned char* payload = bitmap.GetBuffer();
+  std::size_t payloadBytes = pixelBytes;
+  uint32_t encoding = ENCODING_RAW;
+  std::vector<unsigned char> encoded( DataCompression::GetMaximumRleCompressedSize( pixelBytes ) );
+  std::size_t encodedSize = 0;
+  DataCompression::EncodeRle( payload, pixelBytes, &encoded[0], encoded.size(), encodedSize );
+  if( encodedSize < pixelBytes )
+  {
+    payload = &encoded[0];
+    payloadBytes = encodedSize;
+    encoding = ENCODING_RLE;
+  }
+
+  const std::string serializedKey = SerializeKey( key );
+  const std::string name = GetEntryName( serializedKey );
+  const std::size_t entrySize = sizeof( EntryHeader ) + serializedKey.size() + payloadBytes;
+  if( entrySize > capacity )
+  {
+    return false;
+  }
+
+  EntryHeader header;
+  memcpy( header.magic, ENTRY_MAGIC, sizeof( ENTRY_MAGIC ) );
+  header.keyLength = serializedKey.size();
+  header.pixelFormat = pixelFormat;
+  header.width = bitmap.GetImageWidth();
+  header.height = bitmap.GetImageHeight();
+  header.encoding = encoding;
+  header.pixelBytes = pixelBytes;
+  header.payloadBytes = payloadBytes;
+  header.checksum = Checksum( payload, payloadBytes, Checksum( reinterpret_cast<const unsigned char*>( serializedKey.data() ), serializedKey.size() ) );
+
+  // Write a temporary file and rename it into place so a crash never leaves a partial entry under the entry's name.
+  // The file isn't synced: that would stall the resource thread on a disk flush for every entry, and an entry
+  // torn by a power loss fails its checksum and is simply decoded again.
+  const std::string path = directory + '/' + name;
+  std::string temporaryPath = path + TEMPORARY_SUFFIX;
+  const int fileDescriptor = mkstemp( &temporaryPath[0] );
+  if( fileDescriptor < 0 )
+  {
+    DALI_LOG_INFO( gThumbnailCacheLogFilter, Debug::General, "Unable to create thumbnail cache entry for %s (errno %d)\n", key.path.c_str(), errno );
+    return false;
+  }
+
+  const bool written = WriteAll( fileDescriptor, &header, sizeof( header ) ) &&
+                       WriteAll( fileDescriptor, serializedKey.data(), serializedKey.size() ) &&
+                       WriteAll( fileDescriptor, payload, payloadBytes );
+  const bool closed = close( fileDescriptor ) == 0;
+  if( !written || !closed || rename( temporaryPath.c_str(), path.c_str() ) != 0 )
+  {
+    DALI_LOG_INFO( gThumbnailCacheLogFilter, Debug::General, "Unable to write thumbnail cache entry for %s (errno %d)\n", key.path.c_str(), errno );
+    unlink( temporaryPath.c_str() );
+    return false;
+  }
+
+  Mutex::ScopedLock lock( mMutex );
+  if( mDirectory != directory )
+  {
+    // The cache was moved or disabled while writing:
+    unlink( path.c_str() );
+    return false;
+  }
+  AddEntryLocked( name, entrySize );
+  TrimLocked();
+  return true;
+}
+
+void ThumbnailCache::Clear()
+{
+  Mutex::ScopedLock lock( mMutex );
+  while( !mEntries.empty() )
+  {
+    RemoveEntryLocked( mEntries.back().name );
+  }
+  mHits = 0;
+  mMisses = 0;
+}
+
+unsigned int ThumbnailCache::GetCount() const
+{
+  Mutex::ScopedLock lock( mMutex );
+  return mEntries.size();
+}
+
+std::size_t ThumbnailCache::GetSize() const
+{
+  Mutex::ScopedLock lock( mMutex );
+  return mSize;
+}
+
+unsigned int ThumbnailCache::GetHitCount() const
+{
+  Mutex::ScopedLock lock( mMutex );
+  return mHits;
+}
+
+unsigned int ThumbnailCache::GetMissCount() const
+{
+  Mutex::ScopedLock lock( mMutex );
+  return mMisses;
+}
+
+void ThumbnailCache::AddEntryLocked( const std::string& name, std::size_t size )
+{
+  EntryIndex::iterator found = mIndex.find( name );
+  if( found != mIndex.end() )
+  {
+    mSize -= found->second->size;
+    mEntries.erase( found->second );
+  }
+  mEntries.push_front( Entry( name, size ) );
+  mIndex[name] = mEntries.begin();
+  mSize += size;
+}
+
+void ThumbnailCache::RemoveEntryLocked( const std::string& name )
+{
+  // Name may refer to the entry being erased so use it first:
+  if( !mDirectory.empty() )
+  {
+    const std::string path = mDirectory + '/' + name;
+    unlink( path.c_str() );
+  }
+
+  EntryIndex::iterator found = mIndex.find( name );
+  if( found != mIndex.end() )
+  {
+    mSize -= found->second->size;
+    mEntries.erase( found->second );
+    mIndex.erase( found );
+  }
+}
+
+void ThumbnailCache::TrimLocked()
+{
+  while( mSize > mCapacity && !mEntries.empty() )
+  {
+    DALI_LOG_INFO( gThumbnailCacheLogFilter, Debug::Verbose, "Evicting thumbnail cache entry %s\n", mEntries.back().name.c_str() );
+    RemoveEntryLocked( mEntries.back().name );
+  }
+}
+
+Integration::BitmapPtr ThumbnailCache::Miss( const std::string& name, bool removeEntry )
+{
+  Mutex::ScopedLock lock( mMutex );
+  ++mMisses;
+  if( removeEntry )
+  {
+    RemoveEntryLocked( name );
+  }
+  return Integration::BitmapPtr();
+}
+
+} // namespace TizenPlatform
+
+} // namespace Dali
@@ -0,0 +1,209 @@
+#ifndef __DALI_TIZEN_PLATFORM_THUMBNAIL_CACHE_H__
+#define __DALI_TIZEN_PLATFORM_THUMBNAIL_CACHE_H__
+
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <cstddef>
+#include <list>
+#include <string>
+#include <dali/public-api/images/image-operations.h>
+#include <dali/devel-api/common/map-wrapper.h>
+#include <dali/devel-api/threading/mutex.h>
+#include <dali/integration-api/bitmap.h>
+
+namespace Dali
+{
+namespace TizenPlatform
+{
+
+/**
+ * @brief A persistent cache of decoded and scaled images, held as files in a
+ * directory so that it survives restarts of the application.
+ *
+ * Each entry holds the pixels of an image after the requested attributes have
+ * been applied, run length encoded where that makes them smaller. Entries are
+ * keyed by everything the pixels depend on, including the modification time
+ * and size of the source file, so a modified file simply misses and its old
+ * entries age out.
+ *
+ * Entries are written to a temporary file and renamed into place, and carry a
+ * checksum of their contents, so a crash mid-write never leaves an entry which
+ * is read back wrongly. They are not synced to disk, as the cache can always
+ * be rebuilt by decoding the images again. When the total size of the entries exceeds the
+ * capacity, the least recently used are deleted. Use is recorded in the
+ * modification times of the entry files so the order survives restarts too.
+ */
+class ThumbnailCache
+{
+public:
+
+  /**
+   * @brief Everything the pixels of a cached image depend on.
+   */
+  struct Key
+  {
+    Key( const std::string& path,
+         long long modificationTime,
+         long long fileSize,
+         ImageDimensions dimensions,
+         FittingMode::Type fittingMode,
+         SamplingMode::Type samplingMode,
+         bool orientationCorrection );
+
+    std::string path;
+    long long modificationTime;      ///< Nanoseconds since the epoch at which the source file was last modified
+    long long fileSize;              ///< The size of the source file in bytes
+    ImageDimensions dimensions;      ///< The requested dimensions
+    FittingMode::Type fittingMode;
+    SamplingMode::Type samplingMode;
+    bool orientationCorrection;
+  };
+
+  /**
+   * @brief Constructor. The cache is disabled until a directory is set.
+   */
+  ThumbnailCache();
+
+  /**
+   * @brief Destructor.
+   */
+  ~ThumbnailCache();
+
+  /**
+   * @brief Set the directory the cache keeps its entries in, creating it if
+   * necessary, and index the entries already there.
+   *
+   * Temporary files left behind by writes which never completed are deleted.
+   * @param[in] directory The directory, or an empty string to disable the cache
+   * @param[in] capacity The most bytes of entries to keep
+   * @return true if the cache is enabled
+   */
+  bool SetDirectory( const std::string& directory, std::size_t capacity );
+
+  /**
+   * @return Whether a directory has been set and entries are being cached.
+   */
+  bool IsEnabled() const;
+
+  /**
+   * @brief Look up the pixels of an image.
+   * @param[in] key The image and the attributes applied to it
+   * @return The cached bitmap, or an empty pointer on a miss
+   */
+  Integration::BitmapPtr Find( const Key& key );
+
+  /**
+   * @brief Add the pixels of an image, evicting the least recently used entries if over capacity.
+   *
+   * Only uncompressed bitmaps whose rows are tightly packed are stored.
+   * @param[in] key The image and the attributes applied to it
+   * @param[in] bitmap The image with the attributes applied
+   * @return true if the entry was stored
+   */
+  bool Insert( const Key& key, Integration::Bitmap& bitmap );
+
+  /**
+   * @brief Delete all entries and reset the hit and miss counts.
+   */
+  void Clear();
+
+  /**
+   * @return The number of entries held.
+   */
+  unsigned int GetCount() const;
+
+  /**
+   * @return The total size in bytes of the entries held.
+   */
+  std::size_t GetSize() const;
+
+  /**
+   * @return The number of lookups which found an entry.
+   */
+  unsigned int GetHitCount() const;
+
+  /**
+   * @return The number of lookups which did not find a usable entry.
+   */
+  unsigned int GetMissCount() const;
+
+private:
+
+  /**
+   * @brief Add an entry file to the front of the recently used list, replacing any existing one.
+   * @note mMutex must already be locked.
+   */
+  void AddEntryLocked( const std::string& name, std::size_t size );
+
+  /**
+   * @brief Delete an entry file and forget it.
+   * @note mMutex must already be locked.
+   */
+  void RemoveEntryLocked( const std::string& name );
+
+  /**
+   * @brief Delete least recently used entries until the total size is within capacity.
+   * @note mMutex must already be locked.
+   */
+  void TrimLocked();
+
+  /**
+   * @brief Record a lookup which did not find a usable entry, deleting the entry file if there was one.
+   * @return An empty pointer
+   */
+  Integration::BitmapPtr Miss( const std::string& name, bool removeEntry );
+
+  // Undefined
+  ThumbnailCache( const ThumbnailCache& thumbnailCache );
+
+  // Undefined
+  ThumbnailCache& operator=( const ThumbnailCache& thumbnailCache );
+
+private:
+
+  struct Entry
+  {
+    Entry( const std::string& name, std::size_t size ) :
+      name( name ),
+      size( size )
+    {
+    }
+
+    std::string name;  ///< The name of the entry file within the directory
+    std::size_t size;  ///< The size of the entry file in bytes
+  };
+
+  typedef std::list<Entry> EntryList;                        ///< Most recently used at the front
+  typedef std::map<std::string, EntryList::iterator> EntryIndex;
+
+  std::string mDirectory;      ///< Where the entry files live, or empty if disabled
+  EntryList mEntries;          ///< The entry files in order of use
+  EntryIndex mIndex;           ///< Finds an entry in mEntries by file name
+  std::size_t mCapacity;       ///< The most bytes of entry files to keep
+  std::size_t mSize;           ///< The total bytes of entry files held
+  unsigned int mHits;          ///< The number of successful lookups
+  unsigned int mMisses;        ///< The number of unsuccessful lookups
+  mutable Dali::Mutex mMutex;  ///< Serialises access from the resource threads and the event thread
+};
+
+} // namespace TizenPlatform
+
+} // namespace Dali
+
+#endif // __DALI_TIZEN_PLATFORM_THUMBNAIL_CACHE_H__
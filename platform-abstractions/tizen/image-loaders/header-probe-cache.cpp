@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// CLASS HEADER
+#include "header-probe-cache.h"
+
+// EXTERNAL INCLUDES
+#include <dali/integration-api/debug.h>
+
+namespace Dali
+{
+namespace TizenPlatform
+{
+namespace ImageLoader
+{
+
+HeaderProbeCache::Key::Key( const std::string& path,
+                            ImageDimensions dimensions,
+                            FittingMode::Type fittingMode,
+                            SamplingMode::Type samplingMode,
+                            bool orientationCorrection ) :
+  path( path ),
+  dimensions( ( dimensions.GetWidth() << 16u ) | dimensions.GetHeight() ),
+  fittingMode( fittingMode ),
+  samplingMode( samplingMode ),
+  orientationCorrection( orientationCorrection )
+{
+}
+
+bool HeaderProbeCache::Key::operator<( const Key& rhs ) const
+{
+  if( dimensions != rhs.dimensions )
+  {
+    return dimensions < rhs.dimensions;
+  }
+  if( fittingMode != rhs.fittingMode )
+  {
+    return fittingMode < rhs.fittingMode;
+  }
+  if( samplingMode != rhs.samplingMode )
+  {
+    return samplingMode < rhs.samplingMode;
+  }
+  if( orientationCorrection != rhs.orientationCorrection )
+  {
+    return orientationCorrection < rhs.orientationCorrection;
+  }
+  return path < rhs.path;
+}
+
+HeaderProbeCache::HeaderProbeCache( unsigned int capacity ) :
+  mCapacity( capacity ),
+  mHits( 0 ),
+  mMisses( 0 )
+{
+  DALI_ASSERT_DEBUG( capacity > 0u && "A header probe cache must be able to hold at least one probe." );
+}
+
+HeaderProbeCache::~HeaderProbeCache()
+{
+}
+
+bool HeaderProbeCache::Find( const Key& key, const FileStamp& stamp, HeaderProbe& probe )
+{
+  Mutex::ScopedLock lock( mMutex );
+
+  EntryIndex::iterator found = mIndex.find( key );
+  if( found == mIndex.end() )
+  {
+    ++mMisses;
+    return false;
+  }
+
+  EntryList::iterator entry = found->second;
+  if( !( entry->stamp == stamp ) )
+  {
+    // The file has changed since it was probed:
+    mEntries.erase( entry );
+    mIndex.erase( found );
+    ++mMisses;
+    return false;
+  }
+
+  // Move the entry to the front as the most recently used:
+  mEntries.splice( mEntries.begin(), mEntries, entry );
+  probe = entry->probe;
+  ++mHits;
+  return true;
+}
+
+void HeaderProbeCache::Insert( const Key& key, const FileStamp& stamp, const HeaderProbe& probe )
+{
+  Mutex::ScopedLock lock( mMutex );
+
+  EntryIndex::iterator found = mIndex.find( key );
+  if( found != mIndex.end() )
+  {
+    // Another thread may have probed the same file in the meantime:
+    found->second->stamp = stamp;
+    found->second->probe = probe;
+    mEntries.splice( mEntries.begin(), mEntries, found->second );
+    return;
+  }
+
+  if( mIndex.size() >= mCapacity )
+  {
+    mIndex.erase( mEntries.back().key );
+    mEntries.pop_back();
+  }
+
+  mEntries.push_front( Entry( key, stamp, probe ) );
+  mIndex.insert( EntryIndex::value_type( key, mEntries.begin() ) );
+}
+
+void HeaderProbeCache::Clear()
+{
+  Mutex::ScopedLock lock( mMutex );
+  mEntries.clear();
+  mIndex.clear();
+  mHits = 0;
+  mMisses = 0;
+}
+
+unsigned int HeaderProbeCache::GetCount() const
+{
+  Mutex::ScopedLock lock( mMutex );
+  return mIndex.size();
+}
+
+unsigned int HeaderProbeCache::GetHitCount() const
+{
+  Mutex::ScopedLock lock( mMutex );
+  return mHits;
+}
+
+unsigned int HeaderProbeCache::GetMissCount() const
+{
+  Mutex::ScopedLock lock( mMutex );
+  return mMisses;
+}
+
+} // ImageLoader
+} // TizenPlatform
+} // Dali
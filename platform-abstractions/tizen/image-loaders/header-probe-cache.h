@@ -0,0 +1,200 @@
+#ifndef __DALI_TIZEN_PLATFORM_HEADER_PROBE_CACHE_H__
+#define __DALI_TIZEN_PLATFORM_HEADER_PROBE_CACHE_H__
+
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// EXTERNAL INCLUDES
+#include <list>
+#include <string>
+#include <dali/public-api/images/image-operations.h>
+#include <dali/devel-api/common/map-wrapper.h>
+#include <dali/devel-api/threading/mutex.h>
+#include <dali/integration-api/bitmap.h>
+
+namespace Dali
+{
+namespace TizenPlatform
+{
+namespace ImageLoader
+{
+
+/**
+ * @brief The result of probing the header of an image file.
+ */
+struct HeaderProbe
+{
+  HeaderProbe() :
+    format( 0 ),
+    width( 0 ),
+    height( 0 ),
+    profile( Integration::Bitmap::BITMAP_2D_PACKED_PIXELS )
+  {
+  }
+
+  unsigned int format;                 ///< The index of the loader which recognised the file
+  unsigned int width;                  ///< The width reported by the header of the file
+  unsigned int height;                 ///< The height reported by the header of the file
+  Integration::Bitmap::Profile profile; ///< The kind of bitmap the loader decodes into
+};
+
+/**
+ * @brief Identifies a version of a file on disk so that cached probes of it
+ * can be discarded once it is replaced or modified.
+ */
+struct FileStamp
+{
+  FileStamp() :
+    modificationTime( 0 ),
+    size( 0 )
+  {
+  }
+
+  FileStamp( long long modificationTime, long long size ) :
+    modificationTime( modificationTime ),
+    size( size )
+  {
+  }
+
+  bool operator==( const FileStamp& rhs ) const
+  {
+    return modificationTime == rhs.modificationTime && size == rhs.size;
+  }
+
+  long long modificationTime; ///< Nanoseconds since the epoch at which the file was last modified
+  long long size;             ///< The size of the file in bytes
+};
+
+/**
+ * @brief A thread-safe, least recently used cache of header probes.
+ *
+ * Entries are keyed by the path of the file together with the scaling
+ * parameters the header was probed with, as some loaders report the size the
+ * image will be after scaling. A cached entry is only returned while the
+ * stamp of the file still matches the one it was probed from.
+ */
+class HeaderProbeCache
+{
+public:
+
+  /**
+   * @brief Everything a probed size depends on other than the file's contents.
+   */
+  struct Key
+  {
+    Key( const std::string& path,
+         ImageDimensions dimensions = ImageDimensions(),
+         FittingMode::Type fittingMode = FittingMode::DEFAULT,
+         SamplingMode::Type samplingMode = SamplingMode::DEFAULT,
+         bool orientationCorrection = true );
+
+    bool operator<( const Key& rhs ) const;
+
+    std::string path;
+    unsigned int dimensions;           ///< The requested dimensions, packed into one word
+    FittingMode::Type fittingMode;
+    SamplingMode::Type samplingMode;
+    bool orientationCorrection;
+  };
+
+  /**
+   * @brief Constructor.
+   * @param[in] capacity The maximum number of probes held before the least recently used is evicted.
+   */
+  HeaderProbeCache( unsigned int capacity );
+
+  /**
+   * @brief Destructor.
+   */
+  ~HeaderProbeCache();
+
+  /**
+   * @brief Look up the probe of a file.
+   * @param[in] key The file and scaling parameters the probe was made with
+   * @param[in] stamp The current stamp of the file; stale entries are discarded
+   * @param[out] probe Set to the cached probe if one is found
+   * @return true if a current probe was found
+   */
+  bool Find( const Key& key, const FileStamp& stamp, HeaderProbe& probe );
+
+  /**
+   * @brief Add or replace the probe of a file, evicting the least recently used entry if full.
+   * @param[in] key The file and scaling parameters the probe was made with
+   * @param[in] stamp The stamp of the file when it was probed
+   * @param[in] probe The result of the probe
+   */
+  void Insert( const Key& key, const FileStamp& stamp, const HeaderProbe& probe );
+
+  /**
+   * @brief Discard all cached probes and reset the hit and miss counts.
+   */
+  void Clear();
+
+  /**
+   * @return The number of probes held.
+   */
+  unsigned int GetCount() const;
+
+  /**
+   * @return The number of lookups which found a current probe.
+   */
+  unsigned int GetHitCount() const;
+
+  /**
+   * @return The number of lookups which did not find a current probe.
+   */
+  unsigned int GetMissCount() const;
+
+private:
+
+  // Undefined
+  HeaderProbeCache( const HeaderProbeCache& headerProbeCache );
+
+  // Undefined
+  HeaderProbeCache& operator=( const HeaderProbeCache& headerProbeCache );
+
+private:
+
+  struct Entry
+  {
+    Entry( const Key& key, const FileStamp& stamp, const HeaderProbe& probe ) :
+      key( key ),
+      stamp( stamp ),
+      probe( probe )
+    {
+    }
+
+    Key key;
+    FileStamp stamp;
+    HeaderProbe probe;
+  };
+
+  typedef std::list<Entry> EntryList;                ///< Most recently used at the front
+  typedef std::map<Key, EntryList::iterator> EntryIndex;
+
+  EntryList mEntries;           ///< The cached probes in order of use
+  EntryIndex mIndex;            ///< Finds an entry in mEntries by key
+  const unsigned int mCapacity; ///< The maximum size of mEntries
+  unsigned int mHits;           ///< The number of successful lookups
+  unsigned int mMisses;         ///< The number of unsuccessful lookups
+  mutable Dali::Mutex mMutex;   ///< Serialises access from the resource threads and the event thread
+};
+
+} // ImageLoader
+} // TizenPlatform
+} // Dali
+
+#endif // __DALI_TIZEN_PLATFORM_HEADER_PROBE_CACHE_H__
@@ -52,8 +52,20 @@ public:
 struct Input
 {
   Input( FILE* file, ScalingParameters scalingParameters = ScalingParameters(), bool reorientationRequested = true ) :
-    file(file), scalingParameters(scalingParameters), reorientationRequested(reorientationRequested) {}
+    file(file), mappedData(0), mappedSize(0), scalingParameters(scalingParameters), reorientationRequested(reorientationRequested) {}
+
+  /**
+   * @brief Bundle a file together with a read-only mapping of its whole contents.
+   *
+   * Loaders able to decode straight out of memory use the mapping and skip
+   * reading the file into a heap buffer. Others keep reading through the FILE*.
+   */
+  Input( FILE* file, const unsigned char* mappedData, size_t mappedSize, ScalingParameters scalingParameters = ScalingParameters(), bool reorientationRequested = true ) :
+    file(file), mappedData(mappedData), mappedSize(mappedSize), scalingParameters(scalingParameters), reorientationRequested(reorientationRequested) {}
+
   FILE* file;
+  const unsigned char* mappedData; ///< The whole file mapped into memory, or NULL if not mapped
+  size_t mappedSize;               ///< The number of bytes at mappedData
   ScalingParameters scalingParameters;
   bool reorientationRequested;
 };
@@ -16,6 +16,7 @@
 
 #include "image-loader.h"
 
+#include <sys/stat.h>
 #include <dali/devel-api/common/ref-counted-dali-vector.h>
 #include <dali/integration-api/bitmap.h>
 #include <dali/integration-api/debug.h>
@@ -31,6 +32,9 @@
 #include "image-operations.h"
 #include "image-loader-input.h"
 #include "portable/file-closer.h"
+#include "portable/file-mapper.h"
+#include "header-probe-cache.h"
+#include "portable/scoped-trace.h"
 
 using namespace Dali::Integration;
 
@@ -102,6 +106,12 @@ const BitmapLoader BITMAP_LOADER_LOOKUP_TABLE[FORMAT_TOTAL_COUNT] =
 
 const unsigned int MAGIC_LENGTH = 2;
 
+/**
+ * Files at least this big are mapped into memory for the loaders which can
+ * decode straight out of a memory buffer. Smaller files are cheaper to read.
+ */
+const size_t MINIMUM_MAPPED_FILE_SIZE = 64 * 1024;
+
 /**
  * This code tries to predict the file format from the filename to help with format picking.
  */
@@ -143,21 +153,68 @@ FileFormats GetFormatHint( const std::string& filename )
   return format;
 }
 
+/**
+ * The number of header probes remembered across loads and size queries.
+ * Each entry is a path and a few words so this costs tens of kilobytes at most.
+ */
+const unsigned int HEADER_PROBE_CACHE_CAPACITY = 256;
+
+/**
+ * Probes of files on disk, shared by the resource threads and the event thread.
+ */
+ImageLoader::HeaderProbeCache gHeaderProbeCache( HEADER_PROBE_CACHE_CAPACITY );
+
+/**
+ * Scaled images persisted across runs of the application.
+ */
+ThumbnailCache gThumbnailCache;
+
+/**
+ * Get the stamp identifying the current version of an open file.
+ * @param[in]  fp    The file
+ * @param[out] stamp Set to the stamp of the file
+ * @return true if the file is a regular file which could be stamped
+ */
+bool GetFileStamp( FILE * const fp, ImageLoader::FileStamp& stamp )
+{
+  const int fileDescriptor = fileno( fp );
+  struct stat fileStatus;
+  if( fileDescriptor < 0 || fstat( fileDescriptor, &fileStatus ) != 0 || !S_ISREG( fileStatus.st_mode ) )
+  {
+    return false;
+  }
+  stamp = ImageLoader::FileStamp( fileStatus.st_mtim.tv_sec * 1000000000LL + fileStatus.st_mtim.tv_nsec, fileStatus.st_size );
+  return true;
+}
+
+/**
+ * Get the stamp identifying the current version of a file without opening it.
+ * @param[in]  path  The path of the file
+ * @param[out] stamp Set to the stamp of the file
+ * @return true if the file is a regular file which could be stamped
+ */
+bool GetFileStamp( const std::string& path, ImageLoader::FileStamp& stamp )
+{
+  struct stat fileStatus;
+  if( stat( path.c_str(), &fileStatus ) != 0 || !S_ISREG( fileStatus.st_mode ) )
+  {
+    return false;
+  }
+  stamp = ImageLoader::FileStamp( fileStatus.st_mtim.tv_sec * 1000000000LL + fileStatus.st_mtim.tv_nsec, fileStatus.st_size );
+  return true;
+}
+
 /**
  * Checks the magic bytes of the file first to determine which Image decoder to use to decode the
- * bitmap.
+ * bitmap, then confirms the choice by decoding the header.
  * @param[in]   fp      The file to decode
  * @param[in]   format  Hint about what format to try first
- * @param[out]  loader  Set with the function to use to decode the image
- * @param[out]  header  Set with the function to use to decode the header
- * @param[out]  profile The kind of bitmap to hold the bits loaded for the bitmap.
+ * @param[out]  probe   Set with the format, header dimensions and bitmap profile of the file
  * @return true, if we can decode the image, false otherwise
  */
-bool GetBitmapLoaderFunctions( FILE *fp,
-                               FileFormats format,
-                               LoadBitmapFunction& loader,
-                               LoadBitmapHeaderFunction& header,
-                               Bitmap::Profile& profile )
+bool ProbeHeader( FILE *fp,
+                  FileFormats format,
+                  ImageLoader::HeaderProbe& probe )
 {
   unsigned char magic[MAGIC_LENGTH];
   size_t read = fread(magic, sizeof(unsigned char), MAGIC_LENGTH, fp);
@@ -176,6 +233,8 @@ bool GetBitmapLoaderFunctions( FILE *fp,
   bool loaderFound = false;
   const BitmapLoader *lookupPtr = BITMAP_LOADER_LOOKUP_TABLE;
   ImageLoader::Input defaultInput( fp );
+  unsigned int width = 0;
+  unsigned int height = 0;
 
   // try hinted format first
   if ( format != FORMAT_UNKNOWN )
@@ -184,9 +243,7 @@ bool GetBitmapLoaderFunctions( FILE *fp,
     if ( format >= FORMAT_MAGIC_BYTE_COUNT ||
          ( lookupPtr->magicByte1 == magic[0] && lookupPtr->magicByte2 == magic[1] ) )
     {
-      unsigned int width = 0;
-      unsigned int height = 0;
-      loaderFound = lookupPtr->header( fp, width, height );
+      loaderFound = lookupPtr->header( defaultInput, width, height );
     }
   }
 
@@ -200,9 +257,7 @@ bool GetBitmapLoaderFunctions( FILE *fp,
       if ( lookupPtr->magicByte1 == magic[0] && lookupPtr->magicByte2 == magic[1] )
       {
         // to seperate ico file format and wbmp file format
-        unsigned int width = 0;
-        unsigned int height = 0;
-        loaderFound = lookupPtr->header(fp, width, height);
+        loaderFound = lookupPtr->header( defaultInput, width, height );
       }
       if (loaderFound)
       {
@@ -219,9 +274,7 @@ bool GetBitmapLoaderFunctions( FILE *fp,
           ++lookupPtr )
     {
       // to seperate ico file format and wbmp file format
-      unsigned int width = 0;
-      unsigned int height = 0;
-      loaderFound = lookupPtr->header(fp, width, height);
+      loaderFound = lookupPtr->header( defaultInput, width, height );
       if (loaderFound)
       {
         break;
@@ -232,9 +285,10 @@ bool GetBitmapLoaderFunctions( FILE *fp,
   // if a loader was found set the outputs
   if ( loaderFound )
   {
-    loader  = lookupPtr->loader;
-    header  = lookupPtr->header;
-    profile = lookupPtr->profile;
+    probe.format  = lookupPtr - BITMAP_LOADER_LOOKUP_TABLE;
+    probe.width   = width;
+    probe.height  = height;
+    probe.profile = lookupPtr->profile;
   }
 
   // Reset to the start of the file.
@@ -246,6 +300,73 @@ bool GetBitmapLoaderFunctions( FILE *fp,
   return loaderFound;
 }
 
+/**
+ * Probe the header of a file, reusing the result of an earlier probe of the
+ * same version of the file if there is one.
+ * @param[in]  fp     The file to decode, positioned at its start
+ * @param[in]  path   The path the file was opened from
+ * @param[in]  stamp  The stamp of the file, or NULL if it is not a file on disk
+ * @param[out] probe  Set with the format, header dimensions and bitmap profile of the file
+ * @return true, if we can decode the image, false otherwise
+ */
+bool ProbeFile( FILE *fp, const std::string& path, const ImageLoader::FileStamp* stamp, ImageLoader::HeaderProbe& probe )
+{
+  const ImageLoader::HeaderProbeCache::Key key( path );
+  if( stamp && gHeaderProbeCache.Find( key, *stamp, probe ) )
+  {
+    return true;
+  }
+
+  if( !ProbeHeader( fp, GetFormatHint( path ), probe ) )
+  {
+    return false;
+  }
+
+  if( stamp )
+  {
+    gHeaderProbeCache.Insert( key, *stamp, probe );
+  }
+  return true;
+}
+
+/**
+ * @brief Wraps the client of a load to apply the requested image attributes
+ * to previews before passing them on, so they match the final bitmap.
+ */
+class AttributeApplyingClient : public ResourceLoadingClient
+{
+public:
+  AttributeApplyingClient( const ResourceLoadingClient& client, const BitmapResourceType& resourceType )
+  : mClient( client ),
+    mResourceType( resourceType )
+  {
+  }
+
+  virtual void InterruptionPoint() const
+  {
+    mClient.InterruptionPoint();
+  }
+
+  virtual bool PreviewsRequested() const
+  {
+    return mClient.PreviewsRequested();
+  }
+
+  virtual void PreviewDecoded( BitmapPtr preview ) const
+  {
+    mClient.InterruptionPoint(); // Note: By design, this can throw an exception
+    preview = Internal::Platform::ApplyAttributesToBitmap( preview, mResourceType.size, mResourceType.scalingMode, mResourceType.samplingMode );
+    if( preview )
+    {
+      mClient.PreviewDecoded( preview );
+    }
+  }
+
+private:
+  const ResourceLoadingClient& mClient;
+  const BitmapResourceType& mResourceType;
+};
+
 } // anonymous namespace
 
 
@@ -255,6 +376,7 @@ namespace ImageLoader
 bool ConvertStreamToBitmap( const ResourceType& resourceType, std::string path, FILE * const fp, const ResourceLoadingClient& client, BitmapPtr& ptr )
 {
   DALI_LOG_TRACE_METHOD( gLogFilter );
+  DALI_TRACE_SCOPE( Trace::RESOURCE, "DecodeImage" );
   DALI_ASSERT_DEBUG( ResourceBitmap == resourceType.id );
 
   bool result = false;
@@ -262,29 +384,43 @@ bool ConvertStreamToBitmap( const ResourceType& resourceType, std::string path,
 
   if (fp != NULL)
   {
-    LoadBitmapFunction function;
-    LoadBitmapHeaderFunction header;
-    Bitmap::Profile profile;
-
-    if ( GetBitmapLoaderFunctions( fp,
-                                   GetFormatHint( path ),
-                                   function,
-                                   header,
-                                   profile ) )
+    ImageLoader::FileStamp stamp;
+    const bool stamped = GetFileStamp( fp, stamp );
+    const BitmapResourceType& resType = static_cast<const BitmapResourceType&>( resourceType );
+
+    // Only images scaled to a requested size are worth persisting as they are
+    // much smaller than their files decode to:
+    const bool cacheable = stamped && ( resType.size.GetWidth() != 0 || resType.size.GetHeight() != 0 ) && gThumbnailCache.IsEnabled();
+    const ThumbnailCache::Key thumbnailKey( path, stamp.modificationTime, stamp.size, resType.size, resType.scalingMode, resType.samplingMode, resType.orientationCorrection );
+    if( cacheable )
+    {
+      BitmapPtr cached = gThumbnailCache.Find( thumbnailKey );
+      if( cached )
+      {
+        ptr.Reset( cached.Get() );
+        return true;
+      }
+    }
+
+    HeaderProbe probe;
+
+    if ( ProbeFile( fp, path, stamped ? &stamp : NULL, probe ) )
     {
-      bitmap = Bitmap::New( profile, ResourcePolicy::OWNED_DISCARD );
+      const LoadBitmapFunction function = BITMAP_LOADER_LOOKUP_TABLE[probe.format].loader;
+      bitmap = Bitmap::New( probe.profile, ResourcePolicy::OWNED_DISCARD );
 
       DALI_LOG_SET_OBJECT_STRING( bitmap, path );
-      const BitmapResourceType& resType = static_cast<const BitmapResourceType&>( resourceType );
       const ScalingParameters scalingParameters( resType.size, resType.scalingMode, resType.samplingMode );
-      const ImageLoader::Input input( fp, scalingParameters, resType.orientationCorrection );
+      const Internal::Platform::FileMapper fileMapper( fp, MINIMUM_MAPPED_FILE_SIZE );
+      const ImageLoader::Input input( fp, fileMapper.GetData(), fileMapper.GetSize(), scalingParameters, resType.orientationCorrection );
 
       // Check for cancellation now we have hit the filesystem, done some allocation, and burned some cycles:
       // This won't do anything from synchronous API, it's only useful when called from another thread.
       client.InterruptionPoint(); // Note: By design, this can throw an exception
 
       // Run the image type decoder:
-      result = function( client, input, *bitmap );
+      const AttributeApplyingClient previewClient( client, resType );
+      result = function( previewClient, input, *bitmap );
 
       if (!result)
       {
@@ -295,6 +431,11 @@ bool ConvertStreamToBitmap( const ResourceType& resourceType, std::string path,
       // Apply the requested image attributes if not interrupted:
       client.InterruptionPoint(); // Note: By design, this can throw an exception
       bitmap = Internal::Platform::ApplyAttributesToBitmap( bitmap, resType.size, resType.scalingMode, resType.samplingMode );
+
+      if( result && bitmap && cacheable )
+      {
+        gThumbnailCache.Insert( thumbnailKey, *bitmap );
+      }
     }
     else
     {
@@ -306,6 +447,16 @@ bool ConvertStreamToBitmap( const ResourceType& resourceType, std::string path,
   return result;
 }
 
+HeaderProbeCache& GetHeaderProbeCache()
+{
+  return gHeaderProbeCache;
+}
+
+ThumbnailCache& GetThumbnailCache()
+{
+  return gThumbnailCache;
+}
+
 ResourcePointer LoadResourceSynchronously( const Integration::ResourceType& resourceType, const std::string& resourcePath )
 {
   ResourcePointer resource;
@@ -334,27 +485,46 @@ ImageDimensions  GetClosestImageSize( const std::string& filename,
   unsigned int width = 0;
   unsigned int height = 0;
 
+  // Layout asks for the same sizes over and over so answer from the cache
+  // while the file is unchanged, without opening it:
+  const HeaderProbeCache::Key key( filename, size, fittingMode, samplingMode, orientationCorrection );
+  FileStamp stamp;
+  const bool stamped = GetFileStamp( filename, stamp );
+  HeaderProbe probe;
+  if( stamped && gHeaderProbeCache.Find( key, stamp, probe ) )
+  {
+    return ImageDimensions( probe.width, probe.height );
+  }
+
   Internal::Platform::FileCloser fc(filename.c_str(), "rb");
   FILE *fp = fc.GetFile();
   if (fp != NULL)
   {
-    LoadBitmapFunction loaderFunction;
-    LoadBitmapHeaderFunction headerFunction;
-    Bitmap::Profile profile;
-
-    if ( GetBitmapLoaderFunctions( fp,
-                                   GetFormatHint(filename),
-                                   loaderFunction,
-                                   headerFunction,
-                                   profile ) )
+    if ( ProbeFile( fp, filename, stamped ? &stamp : NULL, probe ) )
     {
-      const ImageLoader::Input input( fp, ScalingParameters( size, fittingMode, samplingMode ), orientationCorrection );
+      bool read_res = true;
+      if( size.GetWidth() == 0 && size.GetHeight() == 0 )
+      {
+        // The probe already decoded the header with no scaling requested:
+        width = probe.width;
+        height = probe.height;
+      }
+      else
+      {
+        const ImageLoader::Input input( fp, ScalingParameters( size, fittingMode, samplingMode ), orientationCorrection );
+        read_res = BITMAP_LOADER_LOOKUP_TABLE[probe.format].header( input, width, height );
+      }
 
-      const bool read_res = headerFunction( input, width, height );
       if(!read_res)
       {
         DALI_LOG_WARNING("Image Decoder failed to read header for %s\n", filename.c_str());
       }
+      else if( stamped )
+      {
+        probe.width = width;
+        probe.height = height;
+        gHeaderProbeCache.Insert( key, stamp, probe );
+      }
     }
     else
     {
@@ -393,18 +563,12 @@ ImageDimensions GetClosestImageSize( Integration::ResourcePointer resourceBuffer
       FILE *fp = fc.GetFile();
       if ( fp != NULL )
       {
-        LoadBitmapFunction loaderFunction;
-        LoadBitmapHeaderFunction headerFunction;
-        Bitmap::Profile profile;
-
-        if ( GetBitmapLoaderFunctions( fp,
-                                       FORMAT_UNKNOWN,
-                                       loaderFunction,
-                                       headerFunction,
-                                       profile ) )
+        HeaderProbe probe;
+
+        if ( ProbeHeader( fp, FORMAT_UNKNOWN, probe ) )
         {
           const ImageLoader::Input input( fp, ScalingParameters( size, fittingMode, samplingMode ), orientationCorrection );
-          const bool read_res = headerFunction( input, width, height );
+          const bool read_res = BITMAP_LOADER_LOOKUP_TABLE[probe.format].header( input, width, height );
           if( !read_res )
           {
             DALI_LOG_WARNING( "Image Decoder failed to read header for resourceBuffer\n" );
@@ -25,6 +25,8 @@
 
 // INTERNAL INCLUDES
 #include "resource-loading-client.h"
+#include "header-probe-cache.h"
+#include "data-cache/thumbnail-cache.h"
 
 namespace Dali
 {
@@ -52,6 +54,19 @@ bool ConvertStreamToBitmap( const Integration::ResourceType& resourceType, std::
  */
 bool ConvertBitmapToStream( std::string path, FILE * const fp, Integration::BitmapPtr& ptr );
 
+/**
+ * Get the cache of image header probes shared by all loads and size queries
+ * of files on disk.
+ * @return The header probe cache
+ */
+HeaderProbeCache& GetHeaderProbeCache();
+
+/**
+ * Get the persistent cache of scaled images shared by all loads of files on
+ * disk which request a size. It is disabled until given a directory.
+ * @return The thumbnail cache
+ */
+ThumbnailCache& GetThumbnailCache();
 
 Integration::ResourcePointer LoadResourceSynchronously( const Integration::ResourceType& resourceType, const std::string& resourcePath );
 
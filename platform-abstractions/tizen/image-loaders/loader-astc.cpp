@@ -114,23 +114,15 @@ Pixel::Format GetAstcPixelFormat( AstcFileHeader& header )
 }
 
 /**
- * @brief Internal method to load ASTC header info from a file.
+ * @brief Internal method to check an ASTC header read into memory is one we support.
  *
- * @param[in]  filePointer The file pointer to the ASTC file to read
+ * @param[in]  fileHeader  The header data
  * @param[out] width       The width is output to this value
  * @param[out] height      The height is output to this value
- * @param[out] fileHeader  This will be populated with the header data
- * @return                 True if the file is valid, false otherwise
+ * @return                 True if the header is valid, false otherwise
  */
-bool LoadAstcHeader( FILE * const filePointer, unsigned int &width, unsigned int &height, AstcFileHeader &fileHeader )
+bool ValidateAstcHeader( const AstcFileHeader &fileHeader, unsigned int &width, unsigned int &height )
 {
-  // Pull the bytes of the file header in as a block:
-  unsigned int readLength = sizeof( AstcFileHeader );
-  if( fread( (void*)&fileHeader, 1, readLength, filePointer ) != readLength )
-  {
-    return false;
-  }
-
   // Check the header contains the ASTC native file identifier.
   bool headerIsValid = memcmp( fileHeader.magic, FileIdentifier, sizeof( fileHeader.magic ) ) == 0;
   if( !headerIsValid )
@@ -163,6 +155,77 @@ bool LoadAstcHeader( FILE * const filePointer, unsigned int &width, unsigned int
   return headerIsValid;
 }
 
+/**
+ * @brief Internal method to load ASTC header info from a file.
+ *
+ * @param[in]  filePointer The file pointer to the ASTC file to read
+ * @param[out] width       The width is output to this value
+ * @param[out] height      The height is output to this value
+ * @param[out] fileHeader  This will be populated with the header data
+ * @return                 True if the file is valid, false otherwise
+ */
+bool LoadAstcHeader( FILE * const filePointer, unsigned int &width, unsigned int &height, AstcFileHeader &fileHeader )
+{
+  // Pull the bytes of the file header in as a block:
+  unsigned int readLength = sizeof( AstcFileHeader );
+  if( fread( (void*)&fileHeader, 1, readLength, filePointer ) != readLength )
+  {
+    return false;
+  }
+
+  return ValidateAstcHeader( fileHeader, width, height );
+}
+
+/**
+ * @brief Internal method to load an ASTC file straight out of a read-only mapping of the whole file.
+ *
+ * @param[in]  data   The start of the mapped file
+ * @param[in]  size   The size of the mapped file
+ * @param[out] bitmap The bitmap to load the compressed image data into
+ * @return            True if the file was loaded, false otherwise
+ */
+bool LoadBitmapFromMappedAstc( const Byte * const data, const size_t size, Integration::Bitmap& bitmap )
+{
+  AstcFileHeader fileHeader;
+  if( size < sizeof( AstcFileHeader ) )
+  {
+    return false;
+  }
+  memcpy( &fileHeader, data, sizeof( AstcFileHeader ) );
+
+  unsigned int width, height;
+  if( !ValidateAstcHeader( fileHeader, width, height ) )
+  {
+    DALI_LOG_ERROR( "Could not load ASTC Header from file.\n" );
+    return false;
+  }
+
+  Pixel::Format pixelFormat = GetAstcPixelFormat( fileHeader );
+  if( pixelFormat == Pixel::INVALID )
+  {
+    DALI_LOG_ERROR( "No internal pixel format supported for ASTC file pixel format.\n" );
+    return false;
+  }
+
+  // Data size is file size - header size.
+  const size_t imageByteCount = size - sizeof( AstcFileHeader );
+  if( ( imageByteCount > MAX_IMAGE_DATA_SIZE ) || ( imageByteCount > ( ( width * height ) << 1 ) ) )
+  {
+    DALI_LOG_ERROR( "ASTC file has too large image-data field.\n" );
+    return false;
+  }
+
+  PixelBuffer* const pixels = bitmap.GetCompressedProfile()->ReserveBufferOfSize( pixelFormat, width, height, imageByteCount );
+  if( !pixels )
+  {
+    DALI_LOG_ERROR( "Unable to reserve a pixel buffer to load the requested bitmap into.\n" );
+    return false;
+  }
+  memcpy( pixels, data + sizeof( AstcFileHeader ), imageByteCount );
+
+  return true;
+}
+
 } // Unnamed namespace.
 
 
@@ -176,6 +239,11 @@ bool LoadAstcHeader( const ImageLoader::Input& input, unsigned int& width, unsig
 // File loading API entry-point:
 bool LoadBitmapFromAstc( const ResourceLoadingClient& client, const ImageLoader::Input& input, Integration::Bitmap& bitmap )
 {
+  if( input.mappedData )
+  {
+    return LoadBitmapFromMappedAstc( input.mappedData, input.mappedSize, bitmap );
+  }
+
   FILE* const filePointer = input.file;
   if( !filePointer )
   {
@@ -158,6 +158,15 @@ namespace
     unsigned char * const mTjMem;
   };
 
+  // Decoding is cancellable between batches of this many scanlines:
+  const unsigned int SCANLINES_PER_INTERRUPTION_POINT = 64u;
+
+  // Images smaller than this many pixels decode too quickly to be worth a preview:
+  const unsigned int MINIMUM_PREVIEW_PIXELS = 512u * 512u;
+
+  // An APP1 marker holds Exif data if it starts with this; others, such as XMP, use APP1 too:
+  const unsigned char EXIF_HEADER[] = { 'E', 'x', 'i', 'f', 0, 0 };
+
   // Workaround to avoid exceeding the maximum texture size
   const int MAX_TEXTURE_WIDTH  = 4096;
   const int MAX_TEXTURE_HEIGHT = 4096;
@@ -172,7 +181,8 @@ bool TransformSize( int requiredWidth, int requiredHeight,
                     FittingMode::Type fittingMode, SamplingMode::Type samplingMode,
                     JPGFORM_CODE transform,
                     int& preXformImageWidth, int& preXformImageHeight,
-                    int& postXformImageWidth, int& postXformImageHeight );
+                    int& postXformImageWidth, int& postXformImageHeight,
+                    tjscalingfactor& scalingFactor );
 
 bool LoadJpegHeader( FILE *fp, unsigned int &width, unsigned int &height )
 {
@@ -211,59 +221,414 @@ bool LoadJpegHeader( FILE *fp, unsigned int &width, unsigned int &height )
   return true;
 }
 
-bool LoadBitmapFromJpeg( const ResourceLoadingClient& client, const ImageLoader::Input& input, Integration::Bitmap& bitmap )
+namespace
 {
-  const int flags= 0;
-  FILE* const fp = input.file;
 
-  if( fseek(fp,0,SEEK_END) )
+/**
+ * @brief Rotate decoded pixels to respect the exif orientation of the image.
+ * @return false if the transformation is not supported.
+ */
+bool ApplyTransform( JPGFORM_CODE transform, unsigned char * const pixels, const unsigned int width, const unsigned int height )
+{
+  bool result = false;
+  switch(transform)
+  {
+    case JPGFORM_NONE:
+    {
+      result = true;
+      break;
+    }
+    // 3 orientation changes for a camera held perpendicular to the ground or upside-down:
+    case JPGFORM_ROT_180:
+    {
+      result = JpegRotate180(pixels, width, height, DECODED_PIXEL_SIZE);
+      break;
+    }
+    case JPGFORM_ROT_270:
+    {
+      result = JpegRotate270(pixels, width, height, DECODED_PIXEL_SIZE);
+      break;
+    }
+    case JPGFORM_ROT_90:
+    {
+      result = JpegRotate90(pixels, width, height, DECODED_PIXEL_SIZE);
+      break;
+    }
+    /// Less-common orientation changes, since they don't correspond to a camera's
+    // physical orientation:
+    case JPGFORM_FLIP_H:
+    case JPGFORM_FLIP_V:
+    case JPGFORM_TRANSPOSE:
+    case JPGFORM_TRANSVERSE:
+    {
+      DALI_LOG_WARNING( "Unsupported JPEG Orientation transformation: %x.\n", transform );
+      break;
+    }
+  }
+  return result;
+}
+
+/**
+ * @brief Work out how many times the box filter will halve the image after it
+ * has been scaled by the decoder.
+ * @param[in] input The image and the attributes the application requested for it.
+ * @param[in] scaledPostXformWidth The width of the image after decoder scaling and reorientation.
+ * @param[in] scaledPostXformHeight The height of the image after decoder scaling and reorientation.
+ * @return The number of halvings.
+ */
+unsigned int CountBoxFilterHalvings( const ImageLoader::Input& input, int scaledPostXformWidth, int scaledPostXformHeight )
+{
+  const ImageDimensions scaledDimensions( scaledPostXformWidth, scaledPostXformHeight );
+  const ImageDimensions desiredDimensions = Internal::Platform::CalculateDesiredDimensions( scaledDimensions, input.scalingParameters.dimensions );
+  return Internal::Platform::CalculateBoxFilterHalvings( Pixel::RGB888, scaledDimensions, desiredDimensions, input.scalingParameters.scalingMode, input.scalingParameters.samplingMode );
+}
+
+/**
+ * The libjpeg calls below each get a function of their own to hold the setjmp
+ * target for their errors, so the jump never crosses C++ objects which would
+ * need destroying.
+ */
+
+/**
+ * @brief Create a libjpeg decompressor reading from a file.
+ * @return false on error, with the decompressor destroyed.
+ */
+bool JpegCreateDecompress( jpeg_decompress_struct& cinfo, JpegErrorState& jerr, FILE* fp )
+{
+  cinfo.err = jpeg_std_error( &jerr.errorManager );
+  jerr.errorManager.output_message = JpegOutputMessageHandler;
+  jerr.errorManager.error_exit = JpegErrorHandler;
+
+  // On error exit from the JPEG lib, control will pass via JpegErrorHandler
+  // into this branch body for cleanup and error return:
+  if( setjmp( jerr.jumpBuffer ) )
   {
-    DALI_LOG_ERROR("Error seeking to end of file\n");
+    jpeg_destroy_decompress( &cinfo );
     return false;
   }
 
-  long positionIndicator = ftell(fp);
-  unsigned int jpegBufferSize = 0u;
-  if( positionIndicator > -1L )
+  jpeg_create_decompress( &cinfo );
+  jpeg_stdio_src( &cinfo, fp );
+  return true;
+}
+
+/**
+ * @brief Read the header of the image, keeping any exif block if it is needed for reorientation.
+ * @return false on error.
+ */
+bool JpegReadHeader( jpeg_decompress_struct& cinfo, JpegErrorState& jerr, bool keepExif )
+{
+  if( setjmp( jerr.jumpBuffer ) )
+  {
+    return false;
+  }
+
+  if( keepExif )
   {
-    jpegBufferSize = static_cast<unsigned int>(positionIndicator);
+    // Exif data lives in the APP1 marker:
+    jpeg_save_markers( &cinfo, JPEG_APP0 + 1, 0xFFFF );
   }
+  return jpeg_read_header( &cinfo, TRUE ) == JPEG_HEADER_OK;
+}
 
-  if( 0u == jpegBufferSize )
+/**
+ * @brief Start decompressing the image with the scaling factor and colour space already set in cinfo.
+ * @return false on error.
+ */
+bool JpegStartDecompress( jpeg_decompress_struct& cinfo, JpegErrorState& jerr )
+{
+  if( setjmp( jerr.jumpBuffer ) )
   {
     return false;
   }
 
-  if( fseek(fp, 0, SEEK_SET) )
+  return jpeg_start_decompress( &cinfo );
+}
+
+/**
+ * @brief Decode the next scanline of the image.
+ * @return false on error.
+ */
+bool JpegReadScanline( jpeg_decompress_struct& cinfo, JpegErrorState& jerr, unsigned char* scanline )
+{
+  if( setjmp( jerr.jumpBuffer ) )
   {
-    DALI_LOG_ERROR("Error seeking to start of file\n");
     return false;
   }
 
-  Vector<unsigned char> jpegBuffer;
-  try
+  JSAMPROW rows[1] = { scanline };
+  return jpeg_read_scanlines( &cinfo, rows, 1 ) == 1;
+}
+
+/**
+ * @brief Start a pass of buffered-image output showing the image as of the given scan.
+ * @return false on error.
+ */
+bool JpegStartOutput( jpeg_decompress_struct& cinfo, JpegErrorState& jerr, int scanNumber )
+{
+  if( setjmp( jerr.jumpBuffer ) )
   {
-    jpegBuffer.Reserve( jpegBufferSize );
+    return false;
   }
-  catch(...)
+
+  return jpeg_start_output( &cinfo, scanNumber );
+}
+
+/**
+ * @brief Finish a pass of buffered-image output.
+ * @return false on error.
+ */
+bool JpegFinishOutput( jpeg_decompress_struct& cinfo, JpegErrorState& jerr )
+{
+  if( setjmp( jerr.jumpBuffer ) )
   {
-    DALI_LOG_ERROR( "Could not allocate temporary memory to hold JPEG file of size %uMB.\n", jpegBufferSize / 1048576U );
     return false;
   }
-  unsigned char * const jpegBufferPtr = jpegBuffer.Begin();
 
-  // Pull the compressed JPEG image bytes out of a file and into memory:
-  if( fread( jpegBufferPtr, 1, jpegBufferSize, fp ) != jpegBufferSize )
+  return jpeg_finish_output( &cinfo );
+}
+
+/**
+ * @brief Read the remaining scans of a buffered-image decode into the coefficient buffer.
+ * @return false on error.
+ */
+bool JpegConsumeInput( const ResourceLoadingClient& client, jpeg_decompress_struct& cinfo, JpegErrorState& jerr )
+{
+  if( setjmp( jerr.jumpBuffer ) )
   {
-    DALI_LOG_WARNING("Error on image file read.");
     return false;
   }
 
-  if( fseek(fp, 0, SEEK_SET) )
+  int status = JPEG_SUSPENDED;
+  do
+  {
+    status = jpeg_consume_input( &cinfo );
+    if( status == JPEG_REACHED_SOS )
+    {
+      // Allow early cancellation between scans. Unwinding here is safe as the
+      // decompressor is not left mid-call:
+      client.InterruptionPoint();
+    }
+  }
+  while( status != JPEG_REACHED_EOI && status != JPEG_SUSPENDED );
+  return true;
+}
+
+/**
+ * @brief Decode the scanlines of the current output pass through the box filter.
+ * @return false on error.
+ */
+bool JpegReadFilteredScanlines( const ResourceLoadingClient& client, jpeg_decompress_struct& cinfo, JpegErrorState& jerr, Internal::Platform::ScanlineBoxFilter& filter )
+{
+  while( cinfo.output_scanline < cinfo.output_height )
+  {
+    if( cinfo.output_scanline % SCANLINES_PER_INTERRUPTION_POINT == 0 )
+    {
+      // Allow early cancellation during long decodes:
+      client.InterruptionPoint();
+    }
+
+    if( !JpegReadScanline( cinfo, jerr, filter.GetInputScanline() ) )
+    {
+      DALI_LOG_ERROR( "Error decoding JPEG scanline %u.\n", cinfo.output_scanline );
+      return false;
+    }
+    filter.CommitInputScanline();
+  }
+  return true;
+}
+
+/** RAII wrapper to destroy a libjpeg decompressor however decoding ends. */
+struct AutoJpegDecompress
+{
+  AutoJpegDecompress( jpeg_decompress_struct& cinfo )
+  : mCinfo( cinfo )
+  {
+  }
+
+  ~AutoJpegDecompress()
+  {
+    jpeg_destroy_decompress( &mCinfo );
+  }
+
+private:
+  AutoJpegDecompress( const AutoJpegDecompress& ); //< not defined
+  AutoJpegDecompress& operator= ( const AutoJpegDecompress& ); //< not defined
+
+  jpeg_decompress_struct& mCinfo;
+};
+
+/**
+ * @brief Decode a JPEG file a scanline at a time, box filtering the scanlines
+ * down to their final size as they arrive.
+ *
+ * The compressed file is never read into memory and the decoded image is only
+ * ever held at its filtered size, so the memory used is that of the final
+ * bitmap plus a few scanlines.
+ *
+ * If the client asks for previews and the image is a large progressive one,
+ * the first scan is decoded and handed over as a preview before the whole
+ * file is read and decoded for the final bitmap.
+ */
+bool LoadBitmapFromJpegStream( const ResourceLoadingClient& client, const ImageLoader::Input& input, Integration::Bitmap& bitmap )
+{
+  FILE* const fp = input.file;
+  if( fseek( fp, 0, SEEK_SET ) )
   {
     DALI_LOG_ERROR("Error seeking to start of file\n");
+    return false;
+  }
+
+  struct jpeg_decompress_struct cinfo;
+  struct JpegErrorState jerr;
+  if( !JpegCreateDecompress( cinfo, jerr, fp ) )
+  {
+    return false;
+  }
+  AutoJpegDecompress autoJpegDecompress( cinfo );
+
+  if( !JpegReadHeader( cinfo, jerr, input.reorientationRequested ) )
+  {
+    DALI_LOG_WARNING("Invalid Image!");
+    return false;
+  }
+
+  JPGFORM_CODE transform = JPGFORM_NONE;
+  if( input.reorientationRequested )
+  {
+    for( jpeg_saved_marker_ptr marker = cinfo.marker_list; marker != NULL; marker = marker->next )
+    {
+      if( marker->marker == JPEG_APP0 + 1 &&
+          marker->data_length >= sizeof( EXIF_HEADER ) &&
+          memcmp( marker->data, EXIF_HEADER, sizeof( EXIF_HEADER ) ) == 0 )
+      {
+        ExifAutoPtr exifData( exif_data_new_from_data( marker->data, marker->data_length ) );
+        if( exifData.mData && exif_data_get_entry( exifData.mData, EXIF_TAG_ORIENTATION ) )
+        {
+          transform = ConvertExifOrientation(exifData.mData);
+          break;
+        }
+      }
+    }
+  }
+
+  if( cinfo.image_width == 0 || cinfo.image_height == 0 )
+  {
+    DALI_LOG_WARNING("Invalid Image!");
+    return false;
+  }
+
+  // Have the decoder do as much of the scaling as it can in the DCT domain:
+  int scaledPreXformWidth   = cinfo.image_width;
+  int scaledPreXformHeight  = cinfo.image_height;
+  int scaledPostXformWidth  = cinfo.image_width;
+  int scaledPostXformHeight = cinfo.image_height;
+  tjscalingfactor scalingFactor;
+  TransformSize( input.scalingParameters.dimensions.GetWidth(), input.scalingParameters.dimensions.GetHeight(),
+                 input.scalingParameters.scalingMode,
+                 input.scalingParameters.samplingMode,
+                 transform,
+                 scaledPreXformWidth, scaledPreXformHeight,
+                 scaledPostXformWidth, scaledPostXformHeight,
+                 scalingFactor );
+
+  cinfo.scale_num = scalingFactor.num;
+  cinfo.scale_denom = scalingFactor.denom;
+  cinfo.out_color_space = JCS_RGB;
+
+  const bool preview = client.PreviewsRequested() && jpeg_has_multiple_scans( &cinfo ) &&
+                       cinfo.image_width * cinfo.image_height >= MINIMUM_PREVIEW_PIXELS;
+  cinfo.buffered_image = preview;
+
+  // Allow early cancellation before decoding:
+  client.InterruptionPoint();
+
+  if( !JpegStartDecompress( cinfo, jerr ) || cinfo.output_components != DECODED_PIXEL_SIZE )
+  {
+    DALI_LOG_ERROR( "Could not start decompressing JPEG image.\n" );
+    return false;
+  }
+
+  // Then have the box filter finish the power of 2 scaling as the scanlines arrive:
+  const bool swapDimensions = transform == JPGFORM_ROT_90 || transform == JPGFORM_ROT_270;
+  const unsigned int halvings = swapDimensions ?
+      CountBoxFilterHalvings( input, cinfo.output_height, cinfo.output_width ) :
+      CountBoxFilterHalvings( input, cinfo.output_width, cinfo.output_height );
+  const ImageDimensions decodedDimensions( cinfo.output_width, cinfo.output_height );
+  const ImageDimensions filteredDimensions = Internal::Platform::ScanlineBoxFilter::GetOutputDimensions( decodedDimensions, halvings );
+  const unsigned int filteredWidth = filteredDimensions.GetWidth();
+  const unsigned int filteredHeight = filteredDimensions.GetHeight();
+
+  unsigned char * const bitmapPixelBuffer = bitmap.GetPackedPixelsProfile()->ReserveBuffer( Pixel::RGB888,
+                                                                                            swapDimensions ? filteredHeight : filteredWidth,
+                                                                                            swapDimensions ? filteredWidth : filteredHeight );
+
+  Internal::Platform::ScanlineBoxFilter filter;
+  if( !filter.Initialize( Pixel::RGB888, decodedDimensions, halvings, bitmapPixelBuffer ) )
+  {
+    DALI_LOG_ERROR( "Could not box filter JPEG image of %u x %u pixels.\n", cinfo.output_width, cinfo.output_height );
+    return false;
+  }
+
+  if( preview )
+  {
+    // Decode the image as it stands after the first scan, typically just the DC coefficients:
+    if( !JpegStartOutput( cinfo, jerr, 1 ) || !JpegReadFilteredScanlines( client, cinfo, jerr, filter ) || !JpegFinishOutput( cinfo, jerr ) )
+    {
+      return false;
+    }
+
+    Integration::BitmapPtr previewBitmap = Bitmap::New( Bitmap::BITMAP_2D_PACKED_PIXELS, ResourcePolicy::OWNED_DISCARD );
+    unsigned char * const previewPixelBuffer = previewBitmap->GetPackedPixelsProfile()->ReserveBuffer( Pixel::RGB888,
+                                                                                                      swapDimensions ? filteredHeight : filteredWidth,
+                                                                                                      swapDimensions ? filteredWidth : filteredHeight );
+    memcpy( previewPixelBuffer, bitmapPixelBuffer, filteredWidth * filteredHeight * DECODED_PIXEL_SIZE );
+    if( ApplyTransform( transform, previewPixelBuffer, GetTextureDimension( filteredWidth ), GetTextureDimension( filteredHeight ) ) )
+    {
+      client.PreviewDecoded( previewBitmap );
+    }
+
+    // Then bring in the rest of the scans and decode the final image:
+    if( !JpegConsumeInput( client, cinfo, jerr ) ||
+        !JpegStartOutput( cinfo, jerr, cinfo.input_scan_number ) ||
+        !filter.Initialize( Pixel::RGB888, decodedDimensions, halvings, bitmapPixelBuffer ) ||
+        !JpegReadFilteredScanlines( client, cinfo, jerr, filter ) ||
+        !JpegFinishOutput( cinfo, jerr ) )
+    {
+      return false;
+    }
+  }
+  else if( !JpegReadFilteredScanlines( client, cinfo, jerr, filter ) )
+  {
+    return false;
+  }
+
+  if( transform != JPGFORM_NONE )
+  {
+    // Allow early cancellation before shuffling pixels around on the CPU:
+    client.InterruptionPoint();
   }
 
+  return ApplyTransform( transform, bitmapPixelBuffer, GetTextureDimension( filteredWidth ), GetTextureDimension( filteredHeight ) );
+}
+
+} // namespace
+
+bool LoadBitmapFromJpeg( const ResourceLoadingClient& client, const ImageLoader::Input& input, Integration::Bitmap& bitmap )
+{
+  // Without a mapping, stream the file through libjpeg rather than reading it all
+  // into memory. Only the streaming decoder can deliver previews:
+  if( NULL == input.mappedData || client.PreviewsRequested() )
+  {
+    return LoadBitmapFromJpegStream( client, input, bitmap );
+  }
+
+  const int flags= 0;
+
+  // Decode straight out of the mapped file:
+  unsigned char* jpegBufferPtr = const_cast<unsigned char*>( input.mappedData ); // TurboJPEG does not write to its source buffer
+  unsigned int jpegBufferSize = static_cast<unsigned int>( input.mappedSize );
+
   // Allow early cancellation between the load and the decompress:
   client.InterruptionPoint();
 
@@ -316,12 +681,22 @@ bool LoadBitmapFromJpeg( const ResourceLoadingClient& client, const ImageLoader:
   int scaledPostXformWidth  = postXformImageWidth;
   int scaledPostXformHeight = postXformImageHeight;
 
+  tjscalingfactor scalingFactor;
   TransformSize( requiredWidth, requiredHeight,
                  input.scalingParameters.scalingMode,
                  input.scalingParameters.samplingMode,
                  transform,
                  scaledPreXformWidth, scaledPreXformHeight,
-                 scaledPostXformWidth, scaledPostXformHeight );
+                 scaledPostXformWidth, scaledPostXformHeight,
+                 scalingFactor );
+
+  // Decoding the whole image out of the mapping is fastest, but if the box
+  // filter would shrink it further, stream it instead so it is never held in
+  // memory at the larger size:
+  if( CountBoxFilterHalvings( input, scaledPostXformWidth, scaledPostXformHeight ) > 0u )
+  {
+    return LoadBitmapFromJpegStream( client, input, bitmap );
+  }
 
   // Allocate a bitmap and decompress the jpeg buffer into its pixel buffer:
 
@@ -358,42 +733,7 @@ bool LoadBitmapFromJpeg( const ResourceLoadingClient& client, const ImageLoader:
     client.InterruptionPoint();
   }
 
-  bool result = false;
-  switch(transform)
-  {
-    case JPGFORM_NONE:
-    {
-      result = true;
-      break;
-    }
-    // 3 orientation changes for a camera held perpendicular to the ground or upside-down:
-    case JPGFORM_ROT_180:
-    {
-      result = JpegRotate180(bitmapPixelBuffer, bufferWidth, bufferHeight, DECODED_PIXEL_SIZE);
-      break;
-    }
-    case JPGFORM_ROT_270:
-    {
-      result = JpegRotate270(bitmapPixelBuffer, bufferWidth, bufferHeight, DECODED_PIXEL_SIZE);
-      break;
-    }
-    case JPGFORM_ROT_90:
-    {
-      result = JpegRotate90(bitmapPixelBuffer, bufferWidth, bufferHeight, DECODED_PIXEL_SIZE);
-      break;
-    }
-    /// Less-common orientation changes, since they don't correspond to a camera's
-    // physical orientation:
-    case JPGFORM_FLIP_H:
-    case JPGFORM_FLIP_V:
-    case JPGFORM_TRANSPOSE:
-    case JPGFORM_TRANSVERSE:
-    {
-      DALI_LOG_WARNING( "Unsupported JPEG Orientation transformation: %x.\n", transform );
-      break;
-    }
-  }
-  return result;
+  return ApplyTransform( transform, bitmapPixelBuffer, bufferWidth, bufferHeight );
 }
 
 ///@Todo: Move all these rotation functions to portable/image-operations and take "Jpeg" out of their names.
@@ -665,9 +1005,12 @@ bool TransformSize( int requiredWidth, int requiredHeight,
                     FittingMode::Type fittingMode, SamplingMode::Type samplingMode,
                     JPGFORM_CODE transform,
                     int& preXformImageWidth, int& preXformImageHeight,
-                    int& postXformImageWidth, int& postXformImageHeight )
+                    int& postXformImageWidth, int& postXformImageHeight,
+                    tjscalingfactor& scalingFactor )
 {
   bool success = true;
+  scalingFactor.num = 1;
+  scalingFactor.denom = 1;
 
   if( transform == JPGFORM_ROT_90 || transform == JPGFORM_ROT_270 )
   {
@@ -766,6 +1109,7 @@ bool TransformSize( int requiredWidth, int requiredHeight,
     // We have finally chosen the scale-factor, return width/height values
     if( scaleFactorIndex > 0 )
     {
+      scalingFactor = factors[scaleFactorIndex];
       preXformImageWidth   = TJSCALED(preXformImageWidth,   (factors[scaleFactorIndex]));
       preXformImageHeight  = TJSCALED(preXformImageHeight,  (factors[scaleFactorIndex]));
       postXformImageWidth  = TJSCALED(postXformImageWidth,  (factors[scaleFactorIndex]));
@@ -843,7 +1187,8 @@ bool LoadJpegHeader( const ImageLoader::Input& input, unsigned int& width, unsig
         int postXformImageWidth = headerWidth;
         int postXformImageHeight = headerHeight;
 
-        success = TransformSize( requiredWidth, requiredHeight, input.scalingParameters.scalingMode, input.scalingParameters.samplingMode, transform, preXformImageWidth, preXformImageHeight, postXformImageWidth, postXformImageHeight );
+        tjscalingfactor scalingFactor;
+        success = TransformSize( requiredWidth, requiredHeight, input.scalingParameters.scalingMode, input.scalingParameters.samplingMode, transform, preXformImageWidth, preXformImageHeight, postXformImageWidth, postXformImageHeight, scalingFactor );
         if(success)
         {
           width = postXformImageWidth;
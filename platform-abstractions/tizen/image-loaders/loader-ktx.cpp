@@ -454,13 +454,15 @@ bool ConvertPixelFormat(const uint32_t ktxPixelFormat, Dali::Pixel::Format& form
   return true;
 }
 
-bool LoadKtxHeader(FILE * const fp, unsigned int &width, unsigned int &height, KtxFileHeader &fileHeader)
+/**
+ * Check a KTX file header read into memory describes a texture we support.
+ * @param[in]  fileHeader The header of the file
+ * @param[out] width      The width of the texture
+ * @param[out] height     The height of the texture
+ * @return true if the header is valid
+ */
+bool ValidateKtxHeader(const KtxFileHeader &fileHeader, unsigned int &width, unsigned int &height)
 {
-  // Pull the bytes of the file header in as a block:
-  if ( !ReadHeader(fp, fileHeader) )
-  {
-    return false;
-  }
   width = fileHeader.pixelWidth;
   height = fileHeader.pixelHeight;
 
@@ -501,6 +503,71 @@ bool LoadKtxHeader(FILE * const fp, unsigned int &width, unsigned int &height, K
   return headerIsValid;
 }
 
+bool LoadKtxHeader(FILE * const fp, unsigned int &width, unsigned int &height, KtxFileHeader &fileHeader)
+{
+  // Pull the bytes of the file header in as a block:
+  if ( !ReadHeader(fp, fileHeader) )
+  {
+    return false;
+  }
+  return ValidateKtxHeader(fileHeader, width, height);
+}
+
+/**
+ * Load a KTX file straight out of a read-only mapping of the whole file.
+ */
+bool LoadBitmapFromMappedKtx( const Byte * const data, const size_t size, Integration::Bitmap& bitmap )
+{
+  KtxFileHeader fileHeader;
+  if( size < sizeof(KtxFileHeader) )
+  {
+    return false;
+  }
+  memcpy( &fileHeader, data, sizeof(KtxFileHeader) );
+
+  unsigned int width, height;
+  if( !ValidateKtxHeader(fileHeader, width, height) )
+  {
+    return false;
+  }
+
+  // Skip the key-values and load the size of the image data:
+  const size_t imageSizeOffset = sizeof(KtxFileHeader) + fileHeader.bytesOfKeyValueData;
+  uint32_t imageByteCount = 0;
+  if( imageSizeOffset + sizeof(imageByteCount) > size )
+  {
+    DALI_LOG_ERROR( "Read of image size failed.\n" );
+    return false;
+  }
+  memcpy( &imageByteCount, data + imageSizeOffset, sizeof(imageByteCount) );
+
+  // Sanity-check the image size:
+  if( imageByteCount > MAX_IMAGE_DATA_SIZE ||
+      // A compressed texture should certainly be less than 2 bytes per texel:
+      imageByteCount > width * height * 2 ||
+      imageSizeOffset + sizeof(imageByteCount) + imageByteCount > size )
+  {
+    DALI_LOG_ERROR( "KTX file with too-large image-data field.\n" );
+    return false;
+  }
+
+  Pixel::Format pixelFormat;
+  if( !ConvertPixelFormat(fileHeader.glInternalFormat, pixelFormat) )
+  {
+    DALI_LOG_ERROR( "No internal pixel format supported for KTX file pixel format.\n" );
+    return false;
+  }
+
+  PixelBuffer * const pixels = bitmap.GetCompressedProfile()->ReserveBufferOfSize( pixelFormat, width, height, (size_t) imageByteCount );
+  if(!pixels)
+  {
+    DALI_LOG_ERROR( "Unable to reserve a pixel buffer to load the requested bitmap into.\n" );
+    return false;
+  }
+  memcpy( pixels, data + imageSizeOffset + sizeof(imageByteCount), imageByteCount );
+
+  return true;
+}
 
 } // unnamed namespace
 
@@ -520,6 +587,11 @@ bool LoadBitmapFromKtx( const ResourceLoadingClient& client, const ImageLoader::
   DALI_COMPILE_TIME_ASSERT( sizeof(Byte) == 1);
   DALI_COMPILE_TIME_ASSERT( sizeof(uint32_t) == 4);
 
+  if( input.mappedData )
+  {
+    return LoadBitmapFromMappedKtx( input.mappedData, input.mappedSize, bitmap );
+  }
+
   FILE* const fp = input.file;
   if( fp == NULL )
   {
@@ -19,6 +19,7 @@
 
 #include <cstring>
 #include <cstdlib>
+#include <vector>
 
 #include <zlib.h>
 #include <png.h>
@@ -29,6 +30,7 @@
 #include "dali/public-api/math/math-utils.h"
 #include "dali/public-api/math/vector2.h"
 #include "platform-capabilities.h"
+#include "resource-loading-client.h"
 
 namespace Dali
 {
@@ -115,6 +117,25 @@ bool LoadPngHeader(FILE *fp, unsigned int &width, unsigned int &height, png_stru
   return true;
 }
 
+// Images smaller than this many pixels decode too quickly to be worth a preview:
+const unsigned int MINIMUM_PREVIEW_PIXELS = 512u * 512u;
+
+// The number of Adam7 passes to decode before delivering a preview. After
+// three passes one pixel in every 4x4 block is known:
+const int PREVIEW_INTERLACE_PASSES = 3;
+
+/**
+ * @brief Copy the pixels decoded so far into a new bitmap of the same layout
+ * and hand it to the client as a preview.
+ */
+void DeliverPreview( const ResourceLoadingClient& client, Integration::Bitmap& bitmap, Pixel::Format pixelFormat, unsigned int width, unsigned int height, unsigned int bufferWidth, unsigned int bufferHeight )
+{
+  Integration::BitmapPtr preview = Bitmap::New( Bitmap::BITMAP_2D_PACKED_PIXELS, ResourcePolicy::OWNED_DISCARD );
+  unsigned char * const previewPixels = preview->GetPackedPixelsProfile()->ReserveBuffer( pixelFormat, width, height, bufferWidth, bufferHeight );
+  memcpy( previewPixels, bitmap.GetBuffer(), bitmap.GetBufferSize() );
+  client.PreviewDecoded( preview );
+}
+
 } // namespace - anonymous
 
 bool LoadPngHeader( const ImageLoader::Input& input, unsigned int& width, unsigned int& height )
@@ -138,7 +159,7 @@ bool LoadBitmapFromPng( const ResourceLoadingClient& client, const ImageLoader::
   unsigned int y;
   unsigned int width, height;
   unsigned char *pixels;
-  png_bytep *rows;
+  std::vector<png_bytep> rows;
   unsigned int bpp = 0; // bytes per pixel
   bool valid = false;
 
@@ -281,6 +302,9 @@ bool LoadBitmapFromPng( const ResourceLoadingClient& client, const ImageLoader::
   // bytes per pixel
   bpp = Pixel::GetBytesPerPixel(pixelFormat);
 
+  // Have PNGLib deinterlace Adam7 images as their passes are read:
+  const int passes = png_set_interlace_handling(png);
+
   png_read_update_info(png, info);
 
   if(setjmp(png_jmpbuf(png)))
@@ -306,16 +330,34 @@ bool LoadBitmapFromPng( const ResourceLoadingClient& client, const ImageLoader::
   pixels = bitmap.GetPackedPixelsProfile()->ReserveBuffer(pixelFormat, width, height, bufferWidth, bufferHeight);
 
   DALI_ASSERT_DEBUG(pixels);
-  rows = (png_bytep*) malloc(sizeof(png_bytep) * height);
+  rows.resize(height);
   for(y=0; y<height; y++)
   {
     rows[y] = (png_byte*) (pixels + y * stride);
   }
 
-  // decode image
-  png_read_image(png, rows);
+  if( passes > PREVIEW_INTERLACE_PASSES && width * height >= MINIMUM_PREVIEW_PIXELS && client.PreviewsRequested() )
+  {
+    // Decode a pass at a time, each pass filling the blocks around its pixels
+    // so the image is complete at low resolution after the first few passes:
+    for( int pass = 0; pass < passes; ++pass )
+    {
+      for( y = 0; y < height; ++y )
+      {
+        png_read_row( png, NULL, rows[y] );
+      }
 
-  free(rows);
+      if( pass + 1 == PREVIEW_INTERLACE_PASSES )
+      {
+        DeliverPreview( client, bitmap, pixelFormat, width, height, bufferWidth, bufferHeight );
+      }
+    }
+  }
+  else
+  {
+    // decode image
+    png_read_image(png, &rows[0]);
+  }
 
   return true;
 }
@@ -43,7 +43,8 @@ enum ResourceScheme
 ResourceBitmapRequester::ResourceBitmapRequester( ResourceLoader& resourceLoader )
 : ResourceRequesterBase( resourceLoader ),
   mThreadImageLocal( NULL ),
-  mThreadImageRemote( NULL )
+  mThreadImageRemote( NULL ),
+  mSchedulingMode( RequestSchedulingMode::FIRST_IN_FIRST_OUT )
 {
 }
 
@@ -117,7 +118,8 @@ void ResourceBitmapRequester::LoadResource( Integration::ResourceRequest& reques
   {
     if( !mThreadImageLocal )
     {
-      mThreadImageLocal = new ResourceThreadImage( mResourceLoader );
+      mThreadImageLocal = new ResourceThreadImage( mResourceLoader, mResourceLoader.GetResourceThreadCount() );
+      mThreadImageLocal->SetSchedulingMode( mSchedulingMode );
     }
     mThreadImageLocal->AddRequest( request, requestType );
   }
@@ -126,6 +128,7 @@ void ResourceBitmapRequester::LoadResource( Integration::ResourceRequest& reques
     if( !mThreadImageRemote )
     {
       mThreadImageRemote = new ResourceThreadImage( mResourceLoader );
+      mThreadImageRemote->SetSchedulingMode( mSchedulingMode );
     }
     mThreadImageRemote->AddRequest( request, requestType );
   }
@@ -149,5 +152,43 @@ void ResourceBitmapRequester::CancelLoad(Integration::ResourceId id, Integration
   }
 }
 
+void ResourceBitmapRequester::CancelLoads( const ResourceIdSet& ids, Integration::ResourceTypeId typeId )
+{
+  if( mThreadImageLocal )
+  {
+    mThreadImageLocal->CancelRequests( ids );
+  }
+  if( mThreadImageRemote )
+  {
+    mThreadImageRemote->CancelRequests( ids );
+  }
+}
+
+void ResourceBitmapRequester::SetLoadPriority( Integration::ResourceId id, Integration::ResourceTypeId typeId, Integration::LoadResourcePriority priority )
+{
+  if( mThreadImageLocal )
+  {
+    mThreadImageLocal->SetRequestPriority( id, priority );
+  }
+  if( mThreadImageRemote )
+  {
+    mThreadImageRemote->SetRequestPriority( id, priority );
+  }
+}
+
+void ResourceBitmapRequester::SetSchedulingMode( RequestSchedulingMode::Type mode )
+{
+  mSchedulingMode = mode;
+
+  if( mThreadImageLocal )
+  {
+    mThreadImageLocal->SetSchedulingMode( mode );
+  }
+  if( mThreadImageRemote )
+  {
+    mThreadImageRemote->SetSchedulingMode( mode );
+  }
+}
+
 } // TizenPlatform
 } // Dali
@@ -68,9 +68,25 @@ public:
    */
   virtual void CancelLoad(Integration::ResourceId id, Integration::ResourceTypeId typeId);
 
+  /**
+   * @copydoc ResourceRequester::CancelLoads()
+   */
+  virtual void CancelLoads( const ResourceIdSet& ids, Integration::ResourceTypeId typeId );
+
+  /**
+   * @copydoc ResourceRequester::SetLoadPriority()
+   */
+  virtual void SetLoadPriority( Integration::ResourceId id, Integration::ResourceTypeId typeId, Integration::LoadResourcePriority priority );
+
+  /**
+   * @copydoc ResourceRequester::SetSchedulingMode()
+   */
+  virtual void SetSchedulingMode( RequestSchedulingMode::Type mode );
+
 private:
-  ResourceThreadImage*          mThreadImageLocal;      ///< Image loader thread object to load images in local machine
+  ResourceThreadImage*          mThreadImageLocal;      ///< Image loader thread pool to load images in local machine
   ResourceThreadImage*          mThreadImageRemote;     ///< Image loader thread object to download images in remote http server
+  RequestSchedulingMode::Type   mSchedulingMode;        ///< Scheduling mode applied to the loader threads
 };
 
 } // TizenPlatform
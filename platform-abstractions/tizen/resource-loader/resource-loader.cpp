@@ -21,8 +21,9 @@
 // EXTERNAL HEADERS
 #include <iostream>
 #include <fstream>
-#include <queue>
+#include <vector>
 #include <cstring>
+#include <time.h>
 #include <dali/devel-api/common/map-wrapper.h>
 #include <dali/devel-api/threading/mutex.h>
 
@@ -36,6 +37,7 @@
 #include "resource-requester-base.h"
 #include "resource-bitmap-requester.h"
 #include "debug/resource-loader-debug.h"
+#include "portable/texture-upload-budget.h"
 
 using namespace Dali::Integration;
 
@@ -45,27 +47,76 @@ namespace Dali
 namespace TizenPlatform
 {
 
+namespace
+{
+
+/**
+ * @return The time on the monotonic clock in microseconds.
+ */
+unsigned long long GetMicroseconds()
+{
+  timespec time;
+  clock_gettime( CLOCK_MONOTONIC, &time );
+  return time.tv_sec * 1000000ULL + time.tv_nsec / 1000u;
+}
+
+/**
+ * @return The bytes core uploads to a texture for a loaded resource, or zero if it is not a bitmap.
+ */
+unsigned long long GetUploadSize( const LoadedResource& loaded )
+{
+  const Bitmap* const bitmap = dynamic_cast< const Bitmap* >( loaded.resource.Get() );
+  return bitmap ? bitmap->GetBufferSize() : 0u;
+}
+
+/**
+ * A load waiting to be handed off, with the time it was queued.
+ */
+template< typename Resource >
+struct Queued
+{
+  Queued( const Resource& resource, unsigned long long time )
+  : resource( resource ),
+    time( time )
+  {
+  }
+
+  Resource resource;
+  unsigned long long time;
+};
+
+} // unnamed namespace
+
 struct ResourceLoader::ResourceLoaderImpl
 {
   typedef std::pair<ResourceId, ResourceRequest>  RequestStorePair;
   typedef std::map<ResourceId, ResourceRequest>   RequestStore;
   typedef RequestStore::iterator                  RequestStoreIter;
 
-  typedef std::queue<LoadedResource> LoadedQueue;
-  typedef std::queue<FailedResource> FailedQueue;
+  typedef std::vector< Queued<LoadedResource> > LoadedQueue;
+  typedef std::vector< Queued<FailedResource> > FailedQueue;
 
   typedef std::pair<ResourceTypeId, ResourceRequesterBase*> RequestHandlerPair;
   typedef std::map<ResourceTypeId,  ResourceRequesterBase*> RequestHandlers;
   typedef RequestHandlers::iterator                         RequestHandlersIter;
 
-  Dali::Mutex  mQueueMutex;             ///< used to synchronize access to mLoadedQueue and mFailedQueue
+  mutable Dali::Mutex mQueueMutex;      ///< used to synchronize access to mLoadedQueue, mFailedLoads and mStatistics
   LoadedQueue  mLoadedQueue;            ///< Completed load requests notifications are stored here until fetched by core
   FailedQueue  mFailedLoads;            ///< Failed load request notifications are stored here until fetched by core
+  LoadedQueue  mDrainedLoads;           ///< The completed loads being handed to core, swapped with mLoadedQueue, and those deferred by the budget
+  FailedQueue  mDrainedFailures;        ///< The failed loads being handed to core, swapped with mFailedLoads
+  ResourceHandOffStatistics mStatistics; ///< Counters of the hand-off to core
 
   RequestHandlers mRequestHandlers;
   RequestStore mStoredRequests;         ///< Used to store load requests until loading is completed
 
+  unsigned int mResourceThreadCount;    ///< Number of worker threads for loading local images
+  volatile bool mProgressiveLoading;    ///< Whether image loaders deliver previews of large progressive images
+  Internal::TextureUploadBudget mUploadBudget; ///< Bytes of bitmaps handed to core per call to GetResources()
+
   ResourceLoaderImpl( ResourceLoader* loader )
+  : mResourceThreadCount( 1u ),
+    mProgressiveLoading( false )
   {
     mRequestHandlers.insert(std::make_pair(ResourceBitmap, new ResourceBitmapRequester(*loader)));
   }
@@ -149,6 +200,40 @@ struct ResourceLoader::ResourceLoaderImpl
     ClearRequest( id );
   }
 
+  void CancelLoads( const ResourceIdSet& ids, ResourceTypeId typeId )
+  {
+    ResourceRequesterBase* requester = GetRequester(typeId);
+    if( requester )
+    {
+      requester->CancelLoads( ids, typeId );
+    }
+    for( ResourceIdSet::const_iterator iter = ids.begin(), endIter = ids.end(); iter != endIter; ++iter )
+    {
+      ClearRequest( *iter );
+    }
+  }
+
+  void SetLoadPriority( ResourceId id, ResourceTypeId typeId, LoadResourcePriority priority )
+  {
+    ResourceRequesterBase* requester = GetRequester(typeId);
+    if( requester )
+    {
+      requester->SetLoadPriority( id, typeId, priority );
+    }
+  }
+
+  void SetSchedulingMode( RequestSchedulingMode::Type mode )
+  {
+    for( RequestHandlersIter it = mRequestHandlers.begin(), end = mRequestHandlers.end(); it != end;  ++it )
+    {
+      ResourceRequesterBase * const requester = it->second;
+      if( requester )
+      {
+        requester->SetSchedulingMode( mode );
+      }
+    }
+  }
+
   LoadStatus LoadFurtherResources( LoadedResource partialResource )
   {
     LoadStatus loadStatus = RESOURCE_LOADING;
@@ -176,43 +261,142 @@ struct ResourceLoader::ResourceLoaderImpl
 
   void GetResources(ResourceCache& cache)
   {
-    // Fill the resource cache
+    // Take everything queued since the last call in one swap, so the resource
+    // threads are never held up while core processes the loads:
+    {
+      Mutex::ScopedLock lock( mQueueMutex );
+      if( mDrainedLoads.empty() )
+      {
+        mDrainedLoads.swap( mLoadedQueue );
+      }
+      else
+      {
+        // Loads deferred by the budget go before those which completed after them
+        mDrainedLoads.insert( mDrainedLoads.end(), mLoadedQueue.begin(), mLoadedQueue.end() );
+        mLoadedQueue.clear();
+      }
+      mDrainedFailures.swap( mFailedLoads );
+    }
 
-    Mutex::ScopedLock lock( mQueueMutex );
+    // Core uploads the bitmaps handed off now in its next frame
+    mUploadBudget.NextFrame();
 
-    // iterate through the successfully loaded resources
-    while (!mLoadedQueue.empty())
+    LoadedQueue::iterator deferredBegin = mDrainedLoads.begin();
+    unsigned long long deliveredBytes = 0;
+    while( deferredBegin != mDrainedLoads.end() )
     {
-      LoadedResource loaded( mLoadedQueue.front() );
-      mLoadedQueue.pop();
-      ClearRequest( loaded.id );
-      cache.LoadResponse( loaded.id, loaded.type, loaded.resource, RESOURCE_COMPLETELY_LOADED );
+      const unsigned long long size = GetUploadSize( deferredBegin->resource );
+      if( ! mUploadBudget.Upload( size ) )
+      {
+        break;
+      }
+      deliveredBytes += size;
+      ++deferredBegin;
+    }
+
+    unsigned long long deferredBytes = 0;
+    for( LoadedQueue::iterator iter = deferredBegin, endIter = mDrainedLoads.end(); iter != endIter; ++iter )
+    {
+      deferredBytes += GetUploadSize( iter->resource );
+    }
+    const unsigned int deferred = mDrainedLoads.end() - deferredBegin;
+
+    {
+      // These describe this call, so are updated even when it hands nothing off
+      Mutex::ScopedLock lock( mQueueMutex );
+      mStatistics.lastDeferred = deferred;
+      mStatistics.lastDeferredBytes = deferredBytes;
+      mStatistics.lastDeliveredBytes = deliveredBytes;
+    }
+
+    const unsigned int batch = ( deferredBegin - mDrainedLoads.begin() ) + mDrainedFailures.size();
+    if( batch == 0u )
+    {
+      return;
+    }
+
+    const unsigned long long now = GetMicroseconds();
+    unsigned long long totalLatency = 0;
+    unsigned long long maximumLatency = 0;
+
+    // Fill the resource cache
+
+    // iterate through the successfully loaded resources which fit in the budget
+    for( LoadedQueue::iterator iter = mDrainedLoads.begin(); iter != deferredBegin; ++iter )
+    {
+      const LoadedResource& loaded = iter->resource;
+      const unsigned long long latency = now - iter->time;
+      totalLatency += latency;
+      maximumLatency = latency > maximumLatency ? latency : maximumLatency;
+
+      if( loaded.partial )
+      {
+        // Keep the request for the final resource and drop previews of cancelled loads:
+        if( GetRequest( loaded.id ) )
+        {
+          cache.LoadResponse( loaded.id, loaded.type, loaded.resource, RESOURCE_PARTIALLY_LOADED );
+        }
+      }
+      else
+      {
+        ClearRequest( loaded.id );
+        cache.LoadResponse( loaded.id, loaded.type, loaded.resource, RESOURCE_COMPLETELY_LOADED );
+      }
     }
 
     // iterate through the resources which failed to load
-    while (!mFailedLoads.empty())
+    for( FailedQueue::iterator iter = mDrainedFailures.begin(), endIter = mDrainedFailures.end(); iter != endIter; ++iter )
     {
-      FailedResource failed(mFailedLoads.front());
-      mFailedLoads.pop();
+      const FailedResource& failed = iter->resource;
+      const unsigned long long latency = now - iter->time;
+      totalLatency += latency;
+      maximumLatency = latency > maximumLatency ? latency : maximumLatency;
+
       ClearRequest(failed.id);
       cache.LoadFailed(failed.id, failed.failureType);
     }
+
+    // Release the resources now they are owned by the cache, keeping the capacity and the deferred loads for next time:
+    mDrainedLoads.erase( mDrainedLoads.begin(), deferredBegin );
+    mDrainedFailures.clear();
+
+    DALI_LOG_INFO( gLoaderFilter, Debug::Verbose, "ResourceLoader::GetResources() handed off %u loads, maximum latency %llu us, deferred %u\n", batch, maximumLatency, deferred );
+
+    Mutex::ScopedLock lock( mQueueMutex );
+    mStatistics.delivered += batch;
+    ++mStatistics.batches;
+    mStatistics.maximumBatch = batch > mStatistics.maximumBatch ? batch : mStatistics.maximumBatch;
+    mStatistics.totalLatency += totalLatency;
+    mStatistics.maximumLatency = maximumLatency > mStatistics.maximumLatency ? maximumLatency : mStatistics.maximumLatency;
   }
 
   void AddLoadedResource(LoadedResource& resource)
   {
+    const Queued<LoadedResource> queued( resource, GetMicroseconds() );
+
     // Lock the LoadedQueue to store the loaded resource
     Mutex::ScopedLock lock( mQueueMutex );
 
-    mLoadedQueue.push( resource );
+    mLoadedQueue.push_back( queued );
   }
 
   void AddFailedLoad(FailedResource& resource)
   {
+    const Queued<FailedResource> queued( resource, GetMicroseconds() );
+
     // Lock the FailedQueue to store the failed resource information
     Mutex::ScopedLock lock( mQueueMutex );
 
-    mFailedLoads.push(resource);
+    mFailedLoads.push_back( queued );
+  }
+
+  ResourceHandOffStatistics GetHandOffStatistics() const
+  {
+    Mutex::ScopedLock lock( mQueueMutex );
+
+    ResourceHandOffStatistics statistics( mStatistics );
+    statistics.queued = mLoadedQueue.size() + mFailedLoads.size();
+    return statistics;
   }
 
   void StoreRequest( const ResourceRequest& request )
@@ -271,6 +455,41 @@ void ResourceLoader::Resume()
   mImpl->Resume();
 }
 
+void ResourceLoader::SetResourceThreadCount( unsigned int count )
+{
+  mImpl->mResourceThreadCount = count > 0u ? count : 1u;
+}
+
+unsigned int ResourceLoader::GetResourceThreadCount() const
+{
+  return mImpl->mResourceThreadCount;
+}
+
+void ResourceLoader::SetProgressiveLoading( bool progressive )
+{
+  mImpl->mProgressiveLoading = progressive;
+}
+
+bool ResourceLoader::GetProgressiveLoading() const
+{
+  return mImpl->mProgressiveLoading;
+}
+
+void ResourceLoader::SetTextureUploadBudget( unsigned int bytesPerFrame )
+{
+  mImpl->mUploadBudget.SetBytesPerFrame( bytesPerFrame );
+}
+
+unsigned int ResourceLoader::GetTextureUploadBudget() const
+{
+  return mImpl->mUploadBudget.GetBytesPerFrame();
+}
+
+void ResourceLoader::SetRequestSchedulingMode( RequestSchedulingMode::Type mode )
+{
+  mImpl->SetSchedulingMode( mode );
+}
+
 bool ResourceLoader::IsTerminating()
 {
   return __sync_fetch_and_or( &mTerminateThread, 0 );
@@ -299,6 +518,11 @@ void ResourceLoader::AddFailedLoad(FailedResource& resource)
 /*********************   CALLED FROM PLATFORM ABSTRACTION  **********************/
 /********************************************************************************/
 
+ResourceHandOffStatistics ResourceLoader::GetHandOffStatistics() const
+{
+  return mImpl->GetHandOffStatistics();
+}
+
 void ResourceLoader::LoadResource(const ResourceRequest& request)
 {
   mImpl->LoadResource(request);
@@ -309,6 +533,16 @@ void ResourceLoader::CancelLoad(ResourceId id, ResourceTypeId typeId)
   mImpl->CancelLoad(id, typeId);
 }
 
+void ResourceLoader::SetLoadPriority( ResourceId id, ResourceTypeId typeId, LoadResourcePriority priority )
+{
+  mImpl->SetLoadPriority( id, typeId, priority );
+}
+
+void ResourceLoader::CancelLoads( const ResourceIdSet& ids, ResourceTypeId typeId )
+{
+  mImpl->CancelLoads( ids, typeId );
+}
+
 bool ResourceLoader::LoadFile( const std::string& filename, std::vector< unsigned char >& buffer ) const
 {
   Dali::Vector<unsigned char> daliVec;
@@ -20,9 +20,11 @@
 
 #include <dali/integration-api/platform-abstraction.h>
 #include <dali/integration-api/resource-cache.h>
+#include <dali/integration-api/resource-request.h>
 #include <dali/public-api/common/dali-vector.h>
 
 #include <string>
+#include <dali/devel-api/common/set-wrapper.h>
 
 namespace Dali
 {
@@ -38,6 +40,24 @@ class Filter;
 namespace TizenPlatform
 {
 
+/** A set of resource ids, e.g., for cancelling many requests at once. */
+typedef std::set<Integration::ResourceId> ResourceIdSet;
+
+namespace RequestSchedulingMode
+{
+
+/**
+ * The order in which queued resource requests of equal priority are processed.
+ * Requests of higher priority are always processed first.
+ */
+enum Type
+{
+  FIRST_IN_FIRST_OUT, ///< Process requests in the order they were made (default)
+  LAST_IN_FIRST_OUT   ///< Process the most recent request first, e.g., for fast scrolling lists
+};
+
+} // namespace RequestSchedulingMode
+
 /**
  * Contains information about a successfully loaded resource
  */
@@ -48,13 +68,16 @@ struct LoadedResource
    * @param[in] loadedId        The ID of the resource
    * @param[in] loadedType      The resource type
    * @param[in] loadedResource  A pointer to the loaded resource data
+   * @param[in] loadedPartial   Whether this is a preview which the final resource will follow
    */
   LoadedResource(Integration::ResourceId      loadedId,
                  Integration::ResourceTypeId  loadedType,
-                 Integration::ResourcePointer loadedResource)
+                 Integration::ResourcePointer loadedResource,
+                 bool                         loadedPartial = false)
   : id(loadedId),
     type(loadedType),
-    resource(loadedResource)
+    resource(loadedResource),
+    partial(loadedPartial)
   {
   }
 
@@ -62,7 +85,8 @@ struct LoadedResource
   LoadedResource(const LoadedResource& loaded)
   : id(loaded.id),
     type(loaded.type),
-    resource(loaded.resource)
+    resource(loaded.resource),
+    partial(loaded.partial)
   {
   }
 
@@ -74,6 +98,7 @@ struct LoadedResource
       id = rhs.id;
       type = rhs.type;
       resource = rhs.resource;
+      partial = rhs.partial;
     }
     return *this;
   }
@@ -81,6 +106,7 @@ struct LoadedResource
   Integration::ResourceId      id;         ///< Integer ID
   Integration::ResourceTypeId  type;       ///< Type enum (bitmap, ...)
   Integration::ResourcePointer resource;   ///< Reference counting pointer to the loaded / decoded representation  of the resource.
+  bool                         partial;    ///< Whether the resource is a preview which the final resource will follow
 };
 
 /**
@@ -116,6 +142,39 @@ struct FailedResource
   Integration::ResourceFailure failureType;
 };
 
+/**
+ * Counters of the hand-off of completed and failed loads from the resource
+ * threads to the cache in GetResources(), since the loader was created,
+ * and what the texture upload budget let through in the most recent call.
+ */
+struct ResourceHandOffStatistics
+{
+  ResourceHandOffStatistics()
+  : queued( 0 ),
+    delivered( 0 ),
+    batches( 0 ),
+    maximumBatch( 0 ),
+    totalLatency( 0 ),
+    maximumLatency( 0 ),
+    lastDeferred( 0 ),
+    lastDeferredBytes( 0 ),
+    lastDeliveredBytes( 0 )
+  {
+  }
+
+  unsigned int queued;               ///< Loads waiting to be handed off now
+  unsigned int delivered;            ///< Loads handed off so far
+  unsigned int batches;              ///< Calls to GetResources() which handed off at least one load
+  unsigned int maximumBatch;         ///< The most loads handed off by one call to GetResources()
+  unsigned long long totalLatency;   ///< Sum over delivered loads of the microseconds from queuing to hand-off
+  unsigned long long maximumLatency; ///< The most microseconds a load waited to be handed off
+
+  // Of the most recent call to GetResources(), even one which handed nothing off:
+  unsigned int lastDeferred;             ///< Loads kept back by the texture upload budget
+  unsigned long long lastDeferredBytes;  ///< Bitmap bytes kept back by the texture upload budget
+  unsigned long long lastDeliveredBytes; ///< Bitmap bytes handed off
+};
+
 /**
  * This implements the resource loading part of the PlatformAbstraction API.
  * The requests for a specific resource type are farmed-out to a resource
@@ -148,6 +207,64 @@ public:
    */
   void Resume();
 
+  /**
+   * Set the number of worker threads used to load local image files.
+   * Only takes effect for loader threads created after this call.
+   * @param[in] count The number of worker threads (values below one mean one)
+   */
+  void SetResourceThreadCount( unsigned int count );
+
+  /**
+   * @return The number of worker threads used to load local image files.
+   */
+  unsigned int GetResourceThreadCount() const;
+
+  /**
+   * Set whether image loaders deliver a low resolution preview of large
+   * progressive images as a partial load before the final image.
+   * @param[in] progressive Whether to deliver previews
+   */
+  void SetProgressiveLoading( bool progressive );
+
+  /**
+   * @return Whether image loaders deliver previews of large progressive images.
+   */
+  bool GetProgressiveLoading() const;
+
+  /**
+   * Set how many bytes of bitmaps are handed to core by each call to GetResources(),
+   * as core uploads them to textures in the following frame. Loads beyond the budget
+   * wait for later calls, in the order they completed.
+   * @param[in] bytesPerFrame The budget, or zero for no limit
+   */
+  void SetTextureUploadBudget( unsigned int bytesPerFrame );
+
+  /**
+   * @return The bytes of bitmaps handed to core by each call to GetResources(), or zero for no limit.
+   */
+  unsigned int GetTextureUploadBudget() const;
+
+  /**
+   * Set the order in which queued requests of equal priority are processed.
+   * @param[in] mode The scheduling mode
+   */
+  void SetRequestSchedulingMode( RequestSchedulingMode::Type mode );
+
+  /**
+   * Change the priority of a request which has not started loading yet.
+   * @param[in] id       The resource id of the request
+   * @param[in] typeId   The resource type id of the request
+   * @param[in] priority The new priority
+   */
+  void SetLoadPriority( Integration::ResourceId id, Integration::ResourceTypeId typeId, Integration::LoadResourcePriority priority );
+
+  /**
+   * Cancel a set of load requests of the same type.
+   * @param[in] ids    The resource ids of the requests
+   * @param[in] typeId The resource type id of the requests
+   */
+  void CancelLoads( const ResourceIdSet& ids, Integration::ResourceTypeId typeId );
+
   /**
    * Check if the ResourceLoader is terminating
    * @return true if terminating else false
@@ -155,7 +272,7 @@ public:
   bool IsTerminating();
 
   /**
-   * Add a completely loaded resource to the LoadedResource queue
+   * Add a completely loaded resource, or a preview of one, to the LoadedResource queue
    * @param[in] resource The resource's information and data
    */
   void AddLoadedResource(LoadedResource& resource);
@@ -166,6 +283,12 @@ public:
    */
   void AddFailedLoad(FailedResource& resource);
 
+  /**
+   * Get the counters of the hand-off of loads to the cache in GetResources().
+   * @return A snapshot of the counters
+   */
+  ResourceHandOffStatistics GetHandOffStatistics() const;
+
   // From PlatformAbstraction
 
   /**
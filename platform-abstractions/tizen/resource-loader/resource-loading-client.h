@@ -20,6 +20,7 @@
 // INTERNAL INCLUDES
 
 // EXTERNAL INCLUDES
+#include <dali/integration-api/bitmap.h>
 
 namespace Dali
 {
@@ -43,6 +44,25 @@ public:
    **/
   virtual void InterruptionPoint() const = 0;
 
+  /**
+   * @brief Check whether the caller wants a low resolution preview of a large
+   * progressive or interlaced image before the final image.
+   *
+   * Loaders only decode a preview when this returns true as it costs an extra
+   * pass over the part of the image decoded so far.
+   **/
+  virtual bool PreviewsRequested() const { return false; }
+
+  /**
+   * @brief Receive a preview of the image being loaded.
+   *
+   * The preview has the full dimensions of the final image, with detail still
+   * to arrive. The loader continues decoding once this returns.
+   * @param[in] preview The preview, owned by the client from this point.
+   * @note Like InterruptionPoint() this may throw to abandon a cancelled load.
+   **/
+  virtual void PreviewDecoded( Integration::BitmapPtr preview ) const {}
+
 protected:
   /** Construction is restricted to derived / implementing classes. */
   ResourceLoadingClient() {}
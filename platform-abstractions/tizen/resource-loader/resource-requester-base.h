@@ -80,6 +80,27 @@ public:
    */
   virtual void CancelLoad(Integration::ResourceId id, Integration::ResourceTypeId typeId) = 0;
 
+  /**
+   * Cancel a set of load requests
+   * @param[in] ids The request ids of the loading requests
+   * @param[in] typeId The resource type id of the loading requests
+   */
+  virtual void CancelLoads( const ResourceIdSet& ids, Integration::ResourceTypeId typeId ) = 0;
+
+  /**
+   * Change the priority of a load request which has not started yet
+   * @param[in] id The request id of the loading request
+   * @param[in] typeId The resource type id of the loading request
+   * @param[in] priority The new priority
+   */
+  virtual void SetLoadPriority( Integration::ResourceId id, Integration::ResourceTypeId typeId, Integration::LoadResourcePriority priority ) = 0;
+
+  /**
+   * Set the order in which queued requests of equal priority are processed
+   * @param[in] mode The scheduling mode
+   */
+  virtual void SetSchedulingMode( RequestSchedulingMode::Type mode ) = 0;
+
 protected:
   ResourceLoader& mResourceLoader; ///< The resource loader to which to send results
 
@@ -38,27 +38,70 @@ const Integration::ResourceId NO_REQUEST_CANCELLED = Integration::ResourceId(0)
 namespace TizenPlatform
 {
 
+struct ResourceThreadBase::Worker
+{
+  Worker( ResourceThreadBase& owner )
+  : mOwner( owner ),
+    mThread( 0 ),
+    mCurrentRequestId( NO_REQUEST_IN_FLIGHT ),
+    mCancelRequestId( NO_REQUEST_CANCELLED )
+  {
+  }
+
+  ResourceThreadBase&              mOwner;            ///< The pool this worker belongs to
+  pthread_t                        mThread;           ///< thread instance
+  Integration::ResourceId          mCurrentRequestId; ///< Current request, set by worker thread under the queue lock
+  volatile Integration::ResourceId mCancelRequestId;  ///< Request to be cancelled on thread: written by external thread and read by worker.
+};
+
 namespace
 {
 const char * const IDLE_PRIORITY_ENVIRONMENT_VARIABLE_NAME = "DALI_RESOURCE_THREAD_IDLE_PRIORITY";
+
+__thread const void* gThreadLocalWorker = NULL; ///< The Worker object of the calling resource thread, NULL on other threads
 } // unnamed namespace
 
 /** Thrown by InterruptionPoint() to abort a request early. */
 class CancelRequestException {};
 
-ResourceThreadBase::ResourceThreadBase( ResourceLoader& resourceLoader ) :
+ResourceThreadBase::ResourceThreadBase( ResourceLoader& resourceLoader, unsigned int workerCount ) :
   mResourceLoader( resourceLoader ),
-  mThread( 0 ),
-  mCurrentRequestId( NO_REQUEST_IN_FLIGHT ),
-  mCancelRequestId( NO_REQUEST_CANCELLED ),
-  mPaused( false )
+  mWorkers(),
+  mPaused( false ),
+  mStopping( false )
 {
 #if defined(DEBUG_ENABLED)
   mLogFilter = Debug::Filter::New(Debug::Concise, false, "LOG_RESOURCE_THREAD_BASE");
 #endif
 
-  int error = pthread_create( &mThread, NULL, InternalThreadEntryFunc, this );
-  DALI_ASSERT_ALWAYS( !error && "Error in pthread_create()" );
+  if( workerCount < 1u )
+  {
+    workerCount = 1u;
+  }
+
+  mWorkers.reserve( workerCount );
+  for( unsigned int i = 0; i < workerCount; ++i )
+  {
+    Worker* worker = new Worker( *this );
+    int error = pthread_create( &worker->mThread, NULL, InternalThreadEntryFunc, worker );
+    if( error )
+    {
+      delete worker;
+
+      // Stop and join the workers already started, as the destructor won't run if the constructor throws:
+      {
+        ConditionalWait::ScopedLock lock( mCondition );
+        mStopping = true;
+      }
+      TerminateThread();
+
+#if defined(DEBUG_ENABLED)
+      delete mLogFilter;
+#endif
+    }
+    DALI_ASSERT_ALWAYS( !error && "Error in pthread_create()" );
+    mWorkers.push_back( worker );
+  }
 }
 
 ResourceThreadBase::~ResourceThreadBase()
@@ -72,18 +115,27 @@ ResourceThreadBase::~ResourceThreadBase()
 
 void ResourceThreadBase::TerminateThread()
 {
-  if (mThread)
+  if( !mWorkers.empty() )
   {
-    // wake thread
+    // wake all the threads
     mCondition.Notify();
 
-    // wait for thread to exit
-    pthread_join( mThread, NULL );
+    // wait for the threads to exit
+    for( WorkerContainer::iterator iter = mWorkers.begin(), endIter = mWorkers.end(); iter != endIter; ++iter )
+    {
+      pthread_join( (*iter)->mThread, NULL );
+      delete *iter;
+    }
 
-    mThread = 0;
+    mWorkers.clear();
   }
 }
 
+unsigned int ResourceThreadBase::GetWorkerCount() const
+{
+  return mWorkers.size();
+}
+
 void ResourceThreadBase::AddRequest(const ResourceRequest& request, const RequestType type)
 {
   bool wasEmpty = false;
@@ -93,10 +145,10 @@ void ResourceThreadBase::AddRequest(const ResourceRequest& request, const Reques
     // Lock while adding to the request queue
     ConditionalWait::ScopedLock lock( mCondition );
 
-    wasEmpty = mQueue.empty();
+    wasEmpty = mQueue.Empty();
     wasPaused = mPaused;
 
-    mQueue.push_back( std::make_pair(request, type) );
+    mQueue.Push( std::make_pair(request, type) );
   }
 
   if( wasEmpty && !wasPaused )
@@ -109,41 +161,77 @@ void ResourceThreadBase::AddRequest(const ResourceRequest& request, const Reques
 // Called from outer thread.
 void ResourceThreadBase::CancelRequest( const Integration::ResourceId resourceId )
 {
-  bool found = false;
   DALI_LOG_INFO( mLogFilter, Debug::Verbose, "%s: %u.\n", __FUNCTION__, unsigned(resourceId) );
 
-  // Eliminate the cancelled request from the request queue if it is in there:
+  // Lock while searching and removing from the request queue:
+  ConditionalWait::ScopedLock lock( mCondition );
+
+  // Eliminate the cancelled request from the request queue if it is in there,
+  // else remember it for the worker thread processing it:
+  if( !mQueue.Remove( resourceId ) )
   {
-    // Lock while searching and removing from the request queue:
-    ConditionalWait::ScopedLock lock( mCondition );
+    CancelInFlightRequest( resourceId );
+  }
+}
 
-    for( RequestQueueIter iterator = mQueue.begin();
-         iterator != mQueue.end();
-         ++iterator )
+// Called from outer thread.
+void ResourceThreadBase::CancelRequests( const ResourceIdSet& resourceIds )
+{
+  DALI_LOG_INFO( mLogFilter, Debug::Verbose, "%s: %u requests.\n", __FUNCTION__, unsigned(resourceIds.size()) );
+
+  ConditionalWait::ScopedLock lock( mCondition );
+
+  for( ResourceIdSet::const_iterator iter = resourceIds.begin(), endIter = resourceIds.end(); iter != endIter; ++iter )
+  {
+    if( !mQueue.Remove( *iter ) )
     {
-      if( ((*iterator).first).GetId() == resourceId )
-      {
-        iterator = mQueue.erase( iterator );
-        found = true;
-        break;
-      }
+      CancelInFlightRequest( *iter );
     }
   }
+}
+
+// Called from outer thread.
+void ResourceThreadBase::SetRequestPriority( Integration::ResourceId resourceId, Integration::LoadResourcePriority priority )
+{
+  ConditionalWait::ScopedLock lock( mCondition );
+  mQueue.SetPriority( resourceId, priority );
+}
 
-  // Remember the cancelled id for the worker thread to poll at one of its points
-  // of interruption:
-  if( !found )
+// Called from outer thread.
+void ResourceThreadBase::SetSchedulingMode( RequestSchedulingMode::Type mode )
+{
+  ConditionalWait::ScopedLock lock( mCondition );
+  mQueue.SetSchedulingMode( mode );
+}
+
+void ResourceThreadBase::CancelInFlightRequest( Integration::ResourceId resourceId )
+{
+  // Remember the cancelled id for the worker thread processing it to poll at
+  // one of its points of interruption:
+  for( WorkerContainer::iterator iter = mWorkers.begin(), endIter = mWorkers.end(); iter != endIter; ++iter )
   {
-    Dali::Internal::AtomicWriteToCacheableAlignedAddress( &mCancelRequestId, resourceId );
-    DALI_LOG_INFO( mLogFilter, Debug::Concise, "%s: Cancelling in-flight resource (%u).\n", __FUNCTION__, unsigned(resourceId) );
+    Worker& worker = **iter;
+    if( worker.mCurrentRequestId == resourceId )
+    {
+      Dali::Internal::AtomicWriteToCacheableAlignedAddress( &worker.mCancelRequestId, resourceId );
+      DALI_LOG_INFO( mLogFilter, Debug::Concise, "%s: Cancelling in-flight resource (%u).\n", __FUNCTION__, unsigned(resourceId) );
+      break;
+    }
   }
 }
 
 // Called from worker thread.
 void ResourceThreadBase::InterruptionPoint() const
 {
-  const Integration::ResourceId cancelled = Dali::Internal::AtomicReadFromCacheableAlignedAddress( &mCancelRequestId );
-  const Integration::ResourceId current = mCurrentRequestId;
+  const Worker* const worker = static_cast<const Worker*>( gThreadLocalWorker );
+  if( !worker || &worker->mOwner != this )
+  {
+    // Not called from one of our own worker threads so there is nothing to cancel:
+    return;
+  }
+
+  const Integration::ResourceId cancelled = Dali::Internal::AtomicReadFromCacheableAlignedAddress( &worker->mCancelRequestId );
+  const Integration::ResourceId current = worker->mCurrentRequestId;
 
   if( current == cancelled )
   {
@@ -152,10 +240,11 @@ void ResourceThreadBase::InterruptionPoint() const
   }
 }
 
-void* ResourceThreadBase::InternalThreadEntryFunc( void* This )
+void* ResourceThreadBase::InternalThreadEntryFunc( void* worker )
 {
-    ( static_cast<ResourceThreadBase*>( This ) )->ThreadLoop();
-    return NULL;
+  Worker* const self = static_cast<Worker*>( worker );
+  self->mOwner.ThreadLoop( *self );
+  return NULL;
 }
 
 void ResourceThreadBase::Pause()
@@ -182,10 +271,12 @@ void ResourceThreadBase::Resume()
   }
 }
 
-//----------------- Called from separate thread (mThread) -----------------
+//----------------- Called from separate threads (mWorkers) -----------------
 
-void ResourceThreadBase::ThreadLoop()
+void ResourceThreadBase::ThreadLoop( Worker& worker )
 {
+  gThreadLocalWorker = &worker;
+
   // TODO: Use Environment Options
   const char* threadPriorityIdleRequired = std::getenv( IDLE_PRIORITY_ENVIRONMENT_VARIABLE_NAME );
   if( threadPriorityIdleRequired )
@@ -199,15 +290,16 @@ void ResourceThreadBase::ThreadLoop()
 
   InstallLogging();
 
-  while( !mResourceLoader.IsTerminating() )
+  bool running = true;
+  while( running && !mResourceLoader.IsTerminating() )
   {
     try
     {
-      WaitForRequests();
+      running = WaitForRequests();
 
-      if ( !mResourceLoader.IsTerminating() )
+      if ( running && !mResourceLoader.IsTerminating() )
       {
-        ProcessNextRequest();
+        ProcessNextRequest( worker );
       }
     }
 
@@ -215,7 +307,7 @@ void ResourceThreadBase::ThreadLoop()
     {
       // No problem: a derived class deliberately threw to abort an in-flight request
       // that was cancelled.
-      DALI_LOG_INFO( mLogFilter, Debug::Concise, "%s: Caught cancellation exception for resource (%u).\n", __FUNCTION__, unsigned(mCurrentRequestId) );
+      DALI_LOG_INFO( mLogFilter, Debug::Concise, "%s: Caught cancellation exception for resource (%u).\n", __FUNCTION__, unsigned(worker.mCurrentRequestId) );
       CancelRequestException* disableUnusedVarWarning = &ex;
       ex = *disableUnusedVarWarning;
     }
@@ -224,33 +316,43 @@ void ResourceThreadBase::ThreadLoop()
     catch( std::exception& ex )
     {
       const char * const what = ex.what();
-      DALI_LOG_ERROR( "std::exception caught in resource thread. Aborting request with id %u because of std::exception with reason, \"%s\".\n", unsigned(mCurrentRequestId), what ? what : "null" );
+      DALI_LOG_ERROR( "std::exception caught in resource thread. Aborting request with id %u because of std::exception with reason, \"%s\".\n", unsigned(worker.mCurrentRequestId), what ? what : "null" );
     }
     catch( Dali::DaliException& ex )
     {
       // Probably a failed assert-always:
-      DALI_LOG_ERROR( "DaliException caught in resource thread. Aborting request with id %u. Location: \"%s\". Condition: \"%s\".\n", unsigned(mCurrentRequestId), ex.location, ex.condition );
+      DALI_LOG_ERROR( "DaliException caught in resource thread. Aborting request with id %u. Location: \"%s\". Condition: \"%s\".\n", unsigned(worker.mCurrentRequestId), ex.location, ex.condition );
     }
     catch( ... )
     {
-      DALI_LOG_ERROR( "Unknown exception caught in resource thread. Aborting request with id %u.\n", unsigned(mCurrentRequestId) );
+      DALI_LOG_ERROR( "Unknown exception caught in resource thread. Aborting request with id %u.\n", unsigned(worker.mCurrentRequestId) );
+    }
+
+    {
+      // The request has finished, been cancelled or failed, so it can no longer be cancelled in flight:
+      ConditionalWait::ScopedLock lock( mCondition );
+      worker.mCurrentRequestId = NO_REQUEST_IN_FLIGHT;
     }
   }
+
+  gThreadLocalWorker = NULL;
 }
 
-void ResourceThreadBase::WaitForRequests()
+bool ResourceThreadBase::WaitForRequests()
 {
   ConditionalWait::ScopedLock lock( mCondition );
 
-  if( mQueue.empty() || mPaused == true )
+  if( !mStopping && ( mQueue.Empty() || mPaused == true ) )
   {
     // Waiting for a wake up from resource loader control thread
     // This will be to process a new request or terminate
     mCondition.Wait( lock );
   }
+
+  return !mStopping;
 }
 
-void ResourceThreadBase::ProcessNextRequest()
+void ResourceThreadBase::ProcessNextRequest( Worker& worker )
 {
   ResourceRequest* request(NULL);
   RequestType type(RequestLoad);
@@ -259,13 +361,13 @@ void ResourceThreadBase::ProcessNextRequest()
     // lock the queue and extract the next request
     ConditionalWait::ScopedLock lock( mCondition );
 
-    if (!mQueue.empty())
+    if (!mQueue.Empty())
     {
-      const RequestInfo & front = mQueue.front();
+      const RequestInfo & front = mQueue.Front();
       request = new ResourceRequest( front.first );
       type = front.second;
-      mCurrentRequestId = front.first.GetId();
-      mQueue.pop_front();
+      worker.mCurrentRequestId = front.first.GetId();
+      mQueue.PopFront();
     }
   } // unlock the queue
 
@@ -322,6 +424,104 @@ void ResourceThreadBase::Decode(const Integration::ResourceRequest& request)
   ///! If you need this for a subclassed thread, look to ResourceThreadImage::Decode() for an example implementation.
 }
 
+//----------------- RequestQueue -----------------
+
+ResourceThreadBase::RequestQueue::RequestQueue()
+: mRequests(),
+  mIndex(),
+  mSequence( 0 ),
+  mSchedulingMode( RequestSchedulingMode::FIRST_IN_FIRST_OUT )
+{
+}
+
+bool ResourceThreadBase::RequestQueue::Empty() const
+{
+  return mRequests.empty();
+}
+
+void ResourceThreadBase::RequestQueue::Push( const RequestInfo& info )
+{
+  // Higher priorities sort first, and the sign of the sequence number decides
+  // whether older or newer requests of the same priority sort first:
+  const long long sequence = mSequence++;
+  const OrderKey key( -static_cast<int>( info.first.GetPriority() ),
+                      mSchedulingMode == RequestSchedulingMode::LAST_IN_FIRST_OUT ? -sequence : sequence );
+
+  // A repeated id replaces the stale request rather than leaving it orphaned in mRequests:
+  Remove( info.first.GetId() );
+
+  mRequests.insert( std::make_pair( key, info ) );
+  mIndex[ info.first.GetId() ] = key;
+}
+
+const ResourceThreadBase::RequestInfo& ResourceThreadBase::RequestQueue::Front() const
+{
+  DALI_ASSERT_DEBUG( !mRequests.empty() );
+  return mRequests.begin()->second;
+}
+
+void ResourceThreadBase::RequestQueue::PopFront()
+{
+  OrderedRequests::iterator front = mRequests.begin();
+  if( front != mRequests.end() )
+  {
+    mIndex.erase( front->second.first.GetId() );
+    mRequests.erase( front );
+  }
+}
+
+bool ResourceThreadBase::RequestQueue::Remove( Integration::ResourceId resourceId )
+{
+  RequestIndex::iterator found = mIndex.find( resourceId );
+  if( found == mIndex.end() )
+  {
+    return false;
+  }
+
+  mRequests.erase( found->second );
+  mIndex.erase( found );
+  return true;
+}
+
+bool ResourceThreadBase::RequestQueue::SetPriority( Integration::ResourceId resourceId, Integration::LoadResourcePriority priority )
+{
+  RequestIndex::iterator found = mIndex.find( resourceId );
+  if( found == mIndex.end() )
+  {
+    return false;
+  }
+
+  OrderKey& key = found->second;
+  OrderedRequests::iterator request = mRequests.find( key );
+  DALI_ASSERT_DEBUG( request != mRequests.end() );
+
+  const RequestInfo info( request->second );
+  mRequests.erase( request );
+
+  key.first = -static_cast<int>( priority );
+  mRequests.insert( std::make_pair( key, info ) );
+  return true;
+}
+
+void ResourceThreadBase::RequestQueue::SetSchedulingMode( RequestSchedulingMode::Type mode )
+{
+  if( mode == mSchedulingMode )
+  {
+    return;
+  }
+  mSchedulingMode = mode;
+
+  // Flipping the sign of every sequence number reverses the order within each priority:
+  OrderedRequests reordered;
+  for( OrderedRequests::const_iterator iter = mRequests.begin(), endIter = mRequests.end(); iter != endIter; ++iter )
+  {
+    const OrderKey key( iter->first.first, -iter->first.second );
+    reordered.insert( std::make_pair( key, iter->second ) );
+    mIndex[ iter->second.first.GetId() ] = key;
+  }
+  mRequests.swap( reordered );
+}
+
 } // namespace TizenPlatform
 
 } // namespace Dali
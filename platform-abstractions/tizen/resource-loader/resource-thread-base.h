@@ -19,7 +19,8 @@
  */
 
 // EXTERNAL INCLUDES
-#include <deque>
+#include <vector>
+#include <dali/devel-api/common/map-wrapper.h>
 #include <dali/devel-api/threading/conditional-wait.h>
 
 // INTERNAL INCLUDES
@@ -33,7 +34,11 @@ namespace TizenPlatform
 {
 
 /**
- * Resource loader worker thread
+ * Resource loader worker thread pool.
+ *
+ * One or more worker threads share a single request queue. Each worker pulls
+ * the request at the head of the queue, so independent requests are decoded
+ * concurrently on as many cores as there are workers.
  */
 class ResourceThreadBase : public ResourceLoadingClient
 {
@@ -53,12 +58,84 @@ public:
   };
 
   typedef std::pair<Integration::ResourceRequest, RequestType>  RequestInfo;
-  typedef std::deque<RequestInfo>                               RequestQueue;
-  typedef RequestQueue::iterator                                RequestQueueIter;
+
+  /**
+   * Queue of requests ordered by priority, then by arrival order.
+   *
+   * The arrival order is first-in-first-out or last-in-first-out depending on
+   * the scheduling mode. Requests are also indexed by resource id so that they
+   * can be found, re-prioritised and removed in O(log n).
+   */
+  class RequestQueue
+  {
+  public:
+    /**
+     * Constructor
+     */
+    RequestQueue();
+
+    /**
+     * @return true if there are no requests in the queue
+     */
+    bool Empty() const;
+
+    /**
+     * Add a request, ordered by the priority of the request.
+     * @param[in] info The request and its type
+     */
+    void Push( const RequestInfo& info );
+
+    /**
+     * @pre The queue is not empty.
+     * @return The request which should be processed next
+     */
+    const RequestInfo& Front() const;
+
+    /**
+     * Remove the request which should be processed next.
+     */
+    void PopFront();
+
+    /**
+     * Remove a request from the queue.
+     * @param[in] resourceId The id of the request to remove
+     * @return true if the request was in the queue
+     */
+    bool Remove( Integration::ResourceId resourceId );
+
+    /**
+     * Change the priority of a queued request, keeping its arrival order.
+     * @param[in] resourceId The id of the request
+     * @param[in] priority The new priority
+     * @return true if the request was in the queue
+     */
+    bool SetPriority( Integration::ResourceId resourceId, Integration::LoadResourcePriority priority );
+
+    /**
+     * Change how requests of equal priority are ordered. Requests already in
+     * the queue are reordered.
+     * @param[in] mode The scheduling mode
+     */
+    void SetSchedulingMode( RequestSchedulingMode::Type mode );
+
+  private:
+    typedef std::pair<int, long long>                        OrderKey; ///< Negated priority, then signed arrival sequence number
+    typedef std::map<OrderKey, RequestInfo>                  OrderedRequests;
+    typedef std::map<Integration::ResourceId, OrderKey>      RequestIndex;
+
+    OrderedRequests             mRequests;       ///< Requests in the order they will be processed
+    RequestIndex                mIndex;          ///< Order keys of the queued requests by resource id
+    long long                   mSequence;       ///< Arrival sequence number of the next request
+    RequestSchedulingMode::Type mSchedulingMode; ///< How to order requests of equal priority
+  };
 
 public:
-  // Constructor
-  ResourceThreadBase(ResourceLoader& resourceLoader);
+  /**
+   * Constructor
+   * @param[in] resourceLoader The resource loader with which to communicate results
+   * @param[in] workerCount    The number of worker threads servicing the request queue (at least one is always created)
+   */
+  ResourceThreadBase( ResourceLoader& resourceLoader, unsigned int workerCount = 1u );
 
   // Destructor
   virtual ~ResourceThreadBase();
@@ -80,6 +157,26 @@ public:
    */
   void CancelRequest(Integration::ResourceId  resourceId);
 
+  /**
+   * Cancel a set of resource requests. Removes the requests from the queue
+   * under a single lock.
+   * @param[in] resourceIds IDs of the resources to be canceled
+   */
+  void CancelRequests( const ResourceIdSet& resourceIds );
+
+  /**
+   * Change the priority of a request which has not started processing yet.
+   * @param[in] resourceId ID of the resource to be re-prioritised
+   * @param[in] priority   The new priority
+   */
+  void SetRequestPriority( Integration::ResourceId resourceId, Integration::LoadResourcePriority priority );
+
+  /**
+   * Change the order in which requests of equal priority are processed.
+   * @param[in] mode The scheduling mode
+   */
+  void SetSchedulingMode( RequestSchedulingMode::Type mode );
+
   /**
    * Pause starting new work in the background, but keep that work queued.
    */
@@ -90,23 +187,35 @@ public:
    */
   void Resume();
 
+  /**
+   * @return The number of worker threads servicing the request queue.
+   */
+  unsigned int GetWorkerCount() const;
 
 protected:
   /**
-   * Main control loop for the thread.
+   * Per worker thread state.
+   */
+  struct Worker;
+
+  /**
+   * Main control loop for a worker thread.
    * The thread is terminated when this function exits
+   * @param[in] worker The state of the worker thread running the loop
    */
-  void ThreadLoop();
+  void ThreadLoop( Worker& worker );
 
   /**
    * Wait for an incoming resource request or termination
+   * @return false if the worker should exit because the pool failed to start
    */
-  void WaitForRequests();
+  bool WaitForRequests();
 
   /**
    * Process the resource request at the head of the queue
+   * @param[in] worker The state of the worker thread processing the request
    */
-  void ProcessNextRequest();
+  void ProcessNextRequest( Worker& worker );
 
   /**
    * Install a logging function in to core for this thread.
@@ -138,28 +247,37 @@ protected:
   virtual void Decode(const Integration::ResourceRequest& request);
 
   /**
-   * @brief Cancels current resource request if it matches the one latched to be cancelled.
+   * @brief Cancels current resource request of the calling worker thread if it
+   * matches the one latched to be cancelled for that worker.
    *
    * @copydoc ResourceLoadingClient::InterruptionPoint
    */
   virtual void InterruptionPoint() const;
 
 private:
+  /**
+   * Latch a request for cancellation on the worker processing it, if any.
+   * @pre The queue lock is held.
+   * @param[in] resourceId ID of the resource to be canceled
+   */
+  void CancelInFlightRequest( Integration::ResourceId resourceId );
+
   /**
    * Helper for the thread calling the entry function
-   * @param[in] This A pointer to the current UpdateThread object
+   * @param[in] worker A pointer to the Worker object of the thread
    */
-  static void* InternalThreadEntryFunc( void* This );
+  static void* InternalThreadEntryFunc( void* worker );
 
 protected:
+  typedef std::vector<Worker*> WorkerContainer;
+
   ResourceLoader&                    mResourceLoader;
-  pthread_t                          mThread;    ///< thread instance
+  WorkerContainer                    mWorkers;   ///< worker thread instances
   ConditionalWait                    mCondition; ///< condition variable
   RequestQueue                       mQueue;     ///< Request queue
 private:
-  Integration::ResourceId          mCurrentRequestId; ///< Current request, set by worker thread
-  volatile Integration::ResourceId mCancelRequestId;  ///< Request to be cancelled on thread: written by external thread and read by worker.
   bool                             mPaused;           ///< Whether to process work in mQueue
+  bool                             mStopping;         ///< Set under the queue lock to stop the workers when the pool fails to start
 
 private:
 
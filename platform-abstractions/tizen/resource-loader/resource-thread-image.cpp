@@ -29,6 +29,7 @@
 #include "portable/file-closer.h"
 #include "image-loaders/image-loader.h"
 #include "network/file-download.h"
+#include "portable/scoped-trace.h"
 
 using namespace Dali::Integration;
 
@@ -43,10 +44,49 @@ namespace
 
 // limit maximum image down load size to 50 MB
 const size_t MAXIMUM_DOWNLOAD_IMAGE_SIZE  = 50 * 1024 * 1024 ;
+
+/**
+ * @brief Forwards cancellation checks to the owning thread and queues any
+ * previews decoded as partial loads of the request's resource.
+ */
+class PreviewingClient : public ResourceLoadingClient
+{
+public:
+  PreviewingClient( const ResourceLoadingClient& owner, ResourceLoader& resourceLoader, const ResourceRequest& request )
+  : mOwner( owner ),
+    mResourceLoader( resourceLoader ),
+    mRequest( request )
+  {
+  }
+
+  virtual void InterruptionPoint() const
+  {
+    mOwner.InterruptionPoint();
+  }
+
+  virtual bool PreviewsRequested() const
+  {
+    return mResourceLoader.GetProgressiveLoading();
+  }
+
+  virtual void PreviewDecoded( BitmapPtr preview ) const
+  {
+    // Don't queue previews of loads which have been cancelled:
+    mOwner.InterruptionPoint(); // Note: This can throw an exception.
+    LoadedResource resource( mRequest.GetId(), mRequest.GetType()->id, ResourcePointer( preview.Get() ), true );
+    mResourceLoader.AddLoadedResource( resource );
+  }
+
+private:
+  const ResourceLoadingClient& mOwner;
+  ResourceLoader& mResourceLoader;
+  const ResourceRequest& mRequest;
+};
+
 }
 
-ResourceThreadImage::ResourceThreadImage(ResourceLoader& resourceLoader)
-: ResourceThreadBase(resourceLoader)
+ResourceThreadImage::ResourceThreadImage(ResourceLoader& resourceLoader, unsigned int workerCount)
+: ResourceThreadBase(resourceLoader, workerCount)
 {
 }
 
@@ -57,6 +97,7 @@ ResourceThreadImage::~ResourceThreadImage()
 void ResourceThreadImage::Load(const ResourceRequest& request)
 {
   DALI_LOG_TRACE_METHOD( mLogFilter );
+  DALI_TRACE_SCOPE( Trace::RESOURCE, "LoadImage" );
   DALI_LOG_INFO( mLogFilter, Debug::Verbose, "%s(%s)\n", __FUNCTION__, request.GetPath().c_str() );
 
   LoadImageFromLocalFile(request);
@@ -67,6 +108,7 @@ void ResourceThreadImage::Download(const ResourceRequest& request)
   bool succeeded;
 
   DALI_LOG_TRACE_METHOD( mLogFilter );
+  DALI_TRACE_SCOPE( Trace::RESOURCE, "DownloadImage" );
   DALI_LOG_INFO( mLogFilter, Debug::Verbose, "%s(%s)\n", __FUNCTION__, request.GetPath().c_str() );
 
   Dali::Vector<uint8_t> dataBuffer;
@@ -81,6 +123,7 @@ void ResourceThreadImage::Download(const ResourceRequest& request)
 void ResourceThreadImage::Decode(const ResourceRequest& request)
 {
   DALI_LOG_TRACE_METHOD( mLogFilter );
+  DALI_TRACE_SCOPE( Trace::RESOURCE, "LoadImageBuffer" );
   DALI_LOG_INFO(mLogFilter, Debug::Verbose, "%s(%s)\n", __FUNCTION__, request.GetPath().c_str());
 
   // Get the blob of binary data that we need to decode:
@@ -124,7 +167,8 @@ void ResourceThreadImage::LoadImageFromLocalFile(const Integration::ResourceRequ
 
   if( NULL != fp )
   {
-    result = ImageLoader::ConvertStreamToBitmap( *request.GetType(), request.GetPath(), fp, *this, bitmap );
+    const PreviewingClient client( *this, mResourceLoader, request );
+    result = ImageLoader::ConvertStreamToBitmap( *request.GetType(), request.GetPath(), fp, client, bitmap );
     // Last chance to interrupt a cancelled load before it is reported back to clients
     // which have already stopped tracking it:
     InterruptionPoint(); // Note: This can throw an exception.
@@ -36,8 +36,9 @@ public:
   /**
    * Constructor
    * @param[in] resourceLoader A reference to the ResourceLoader
+   * @param[in] workerCount    The number of worker threads decoding images concurrently
    */
-  ResourceThreadImage( ResourceLoader& resourceLoader );
+  ResourceThreadImage( ResourceLoader& resourceLoader, unsigned int workerCount = 1u );
 
   /**
    * Destructor
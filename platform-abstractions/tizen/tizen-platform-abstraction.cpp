@@ -30,6 +30,7 @@
 #include "resource-loader/resource-loader.h"
 #include "image-loaders/image-loader.h"
 #include "portable/file-closer.h"
+#include "portable/image-operations.h"
 
 namespace Dali
 {
@@ -139,6 +140,30 @@ void TizenPlatformAbstraction::CancelLoad(Integration::ResourceId id, Integratio
   }
 }
 
+void TizenPlatformAbstraction::CancelLoads( const ResourceIdSet& ids, Integration::ResourceTypeId typeId )
+{
+  if (mResourceLoader)
+  {
+    mResourceLoader->CancelLoads(ids, typeId);
+  }
+}
+
+void TizenPlatformAbstraction::SetLoadPriority( Integration::ResourceId id, Integration::ResourceTypeId typeId, Integration::LoadResourcePriority priority )
+{
+  if (mResourceLoader)
+  {
+    mResourceLoader->SetLoadPriority(id, typeId, priority);
+  }
+}
+
+void TizenPlatformAbstraction::SetRequestSchedulingMode( RequestSchedulingMode::Type mode )
+{
+  if (mResourceLoader)
+  {
+    mResourceLoader->SetRequestSchedulingMode(mode);
+  }
+}
+
 void TizenPlatformAbstraction::GetResources(Integration::ResourceCache& cache)
 {
   if (mResourceLoader)
@@ -228,6 +253,40 @@ void TizenPlatformAbstraction::SetDataStoragePath( const std::string& path )
   mDataStoragePath = path;
 }
 
+void TizenPlatformAbstraction::SetResourceThreadCount( unsigned int count )
+{
+  if( mResourceLoader )
+  {
+    mResourceLoader->SetResourceThreadCount( count );
+  }
+}
+
+void TizenPlatformAbstraction::SetImageScalingThreadCount( unsigned int count )
+{
+  Internal::Platform::SetScalingThreadCount( count );
+}
+
+void TizenPlatformAbstraction::SetProgressiveImageLoading( bool progressive )
+{
+  if( mResourceLoader )
+  {
+    mResourceLoader->SetProgressiveLoading( progressive );
+  }
+}
+
+void TizenPlatformAbstraction::SetThumbnailCache( const std::string& directory, unsigned int megabytes )
+{
+  ImageLoader::GetThumbnailCache().SetDirectory( directory, static_cast<std::size_t>( megabytes ) * 1024u * 1024u );
+}
+
+void TizenPlatformAbstraction::SetTextureUploadBudget( unsigned int bytesPerFrame )
+{
+  if( mResourceLoader )
+  {
+    mResourceLoader->SetTextureUploadBudget( bytesPerFrame );
+  }
+}
+
 }  // namespace TizenPlatform
 
 }  // namespace Dali
@@ -24,6 +24,9 @@
 
 #include <string>
 
+// INTERNAL INCLUDES
+#include "resource-loader/resource-loader.h"
+
 namespace Dali
 {
 
@@ -35,8 +38,6 @@ Integration::PlatformAbstraction* CreatePlatformAbstraction();
 namespace TizenPlatform
 {
 
-class ResourceLoader;
-
 /**
  * Concrete implementation of the platform abstraction class.
  */
@@ -146,6 +147,66 @@ public: // PlatformAbstraction overrides
    */
   void SetDataStoragePath( const std::string& path );
 
+  /**
+   * Sets the number of worker threads used to decode local image files.
+   * @param[in] count The number of worker threads
+   */
+  void SetResourceThreadCount( unsigned int count );
+
+  /**
+   * Sets the number of threads used to scale down large images after they are loaded.
+   * @note Must be called before any resources are requested.
+   * @param[in] count The number of threads, including the resource thread doing the loading
+   */
+  void SetImageScalingThreadCount( unsigned int count );
+
+  /**
+   * Sets whether large progressive JPEG and interlaced PNG images deliver a
+   * low resolution preview as a partial load of their resource before the
+   * final image.
+   * @param[in] progressive Whether to deliver previews
+   */
+  void SetProgressiveImageLoading( bool progressive );
+
+  /**
+   * Sets where images loaded at a requested size are persisted so later runs
+   * of the application can skip decoding and scaling them.
+   * @param[in] directory The directory to keep them in, or an empty string to not persist them
+   * @param[in] megabytes The most space to use, evicting the least recently used images beyond it
+   */
+  void SetThumbnailCache( const std::string& directory, unsigned int megabytes );
+
+  /**
+   * Sets how many bytes of loaded images are handed to core for each frame, as
+   * core uploads them to textures when it receives them. Images beyond the
+   * budget are handed over in later frames.
+   * @param[in] bytesPerFrame The budget, or zero for no limit
+   */
+  void SetTextureUploadBudget( unsigned int bytesPerFrame );
+
+  /**
+   * Sets the order in which queued resource requests of equal priority are processed.
+   * @param[in] mode The scheduling mode, e.g., LAST_IN_FIRST_OUT for scrolling lists
+   */
+  void SetRequestSchedulingMode( RequestSchedulingMode::Type mode );
+
+  /**
+   * Changes the priority of a resource request which has not started loading yet,
+   * e.g., to move a request for an image which has scrolled on-screen to the front.
+   * @param[in] id The resource id of the request
+   * @param[in] typeId The resource type id of the request
+   * @param[in] priority The new priority
+   */
+  void SetLoadPriority( Integration::ResourceId id, Integration::ResourceTypeId typeId, Integration::LoadResourcePriority priority );
+
+  /**
+   * Cancels a set of resource requests of the same type at once,
+   * e.g., all the requests for images which have scrolled off-screen.
+   * @param[in] ids The resource ids of the requests
+   * @param[in] typeId The resource type id of the requests
+   */
+  void CancelLoads( const ResourceIdSet& ids, Integration::ResourceTypeId typeId );
+
 private:
   ResourceLoader* mResourceLoader;
   std::string mDataStoragePath;
@@ -26,6 +26,7 @@
 #include <dali/integration-api/platform-abstraction.h>
 #include <dali/internal/text-abstraction/font-client-helper.h>
 #include <adaptor-impl.h>
+#include <portable/scoped-trace.h>
 
 // EXTERNAL INCLUDES
 #include <fontconfig/fontconfig.h>
@@ -53,6 +54,36 @@ const uint32_t ELLIPSIS_CHARACTER = 0x2026;
 
 const bool FONT_FIXED_SIZE_BITMAP( true );
 
+/**
+ * Hashes the key of a font in the cache: the interned path to its file name, its point size and its face index.
+ */
+uint32_t HashFont( uint32_t pathId, Dali::TextAbstraction::PointSize26Dot6 requestedPointSize, Dali::TextAbstraction::FaceIndex faceIndex )
+{
+  using Dali::TextAbstraction::Internal::HashIndex;
+  return HashIndex::Combine( HashIndex::Combine( HashIndex::Combine( 0u, pathId ), requestedPointSize ), faceIndex );
+}
+
+/**
+ * Hashes the key of a font description in the caches: its interned family, width, weight and slant.
+ */
+uint32_t HashFontDescription( uint32_t familyId, const Dali::TextAbstraction::FontDescription& fontDescription )
+{
+  using Dali::TextAbstraction::Internal::HashIndex;
+  return HashIndex::Combine( HashIndex::Combine( HashIndex::Combine( HashIndex::Combine( 0u, familyId ),
+                                                                     fontDescription.width ),
+                                                 fontDescription.weight ),
+                             fontDescription.slant );
+}
+
+/**
+ * Hashes the key of a font id in the cache: the validated font id and point size.
+ */
+uint32_t HashFontId( uint32_t validatedFontId, Dali::TextAbstraction::PointSize26Dot6 requestedPointSize )
+{
+  using Dali::TextAbstraction::Internal::HashIndex;
+  return HashIndex::Combine( HashIndex::Combine( 0u, validatedFontId ), requestedPointSize );
+}
+
 // http://www.freedesktop.org/software/fontconfig/fontconfig-user.html
 
 // ULTRA_CONDENSED 50
@@ -136,16 +167,38 @@ FontSlant::Type IntToSlantType( int slant )
   return static_cast<FontSlant::Type>( ValueToIndex( slant, FONT_SLANT_TYPE_TO_INT, NUM_FONT_SLANT_TYPE - 1u ) );
 }
 
-FontClient::Plugin::FallbackCacheItem::FallbackCacheItem( const FontDescription& font, FontList* list )
+FontClient::Plugin::CharacterCoverage::CharacterCoverage()
+: characterSets(),
+  fontIds()
+{
+}
+
+FontClient::Plugin::CharacterCoverage::~CharacterCoverage()
+{
+  for( std::vector<_FcCharSet*>::iterator it = characterSets.begin(), endIt = characterSets.end();
+       it != endIt;
+       ++it )
+  {
+    if( NULL != *it )
+    {
+      FcCharSetDestroy( *it );
+    }
+  }
+}
+
+FontClient::Plugin::FallbackCacheItem::FallbackCacheItem( const FontDescription& font, FontList* list, CharacterCoverage* characterCoverage )
 : fontDescription( font ),
-  fallbackFonts( list )
+  fallbackFonts( list ),
+  coverage( characterCoverage ),
+  familyId( 0u )
 {
 }
 
 FontClient::Plugin::FontDescriptionCacheItem::FontDescriptionCacheItem( const FontDescription& fontDescription,
                                                                         FontDescriptionId index )
 : fontDescription( fontDescription ),
-  index( index )
+  index( index ),
+  familyId( 0u )
 {
 }
 
@@ -171,7 +224,10 @@ FontClient::Plugin::CacheItem::CacheItem( FT_Face ftFace,
   mFixedWidthPixels( 0.0f ),
   mFixedHeightPixels( 0.0f ),
   mVectorFontId( 0 ),
-  mIsFixedSizeBitmap( false )
+  mIsFixedSizeBitmap( false ),
+  mPathId( 0u ),
+  mIsColorChecked( false ),
+  mHasColor( false )
 {
 }
 
@@ -190,7 +246,10 @@ FontClient::Plugin::CacheItem::CacheItem( FT_Face ftFace,
   mFixedWidthPixels( fixedWidth ),
   mFixedHeightPixels( fixedHeight ),
   mVectorFontId( 0 ),
-  mIsFixedSizeBitmap( true )
+  mIsFixedSizeBitmap( true ),
+  mPathId( 0u ),
+  mIsColorChecked( false ),
+  mHasColor( false )
 {
 }
 
@@ -202,10 +261,18 @@ FontClient::Plugin::Plugin( unsigned int horizontalDpi,
   mDefaultFontDescription(),
   mSystemFonts(),
   mDefaultFonts(),
+  mDefaultFontsCoverage(),
   mFontCache(),
   mValidatedFontCache(),
   mFontDescriptionCache( 1u ),
   mFontIdCache(),
+  mInternedStrings(),
+  mFontCacheIndex(),
+  mValidatedFontCacheIndex(),
+  mFallbackCacheIndex(),
+  mFontIdCacheIndex(),
+  mFontIdDescriptionIndex(),
+  mGlyphMetricsCache(),
   mVectorFontCache( NULL ),
   mEllipsisCache(),
   mDefaultFontDescriptionCached( false )
@@ -234,6 +301,9 @@ FontClient::Plugin::~Plugin()
       delete item.fallbackFonts;
       item.fallbackFonts = NULL;
     }
+
+    delete item.coverage;
+    item.coverage = NULL;
   }
 
 #ifdef ENABLE_VECTOR_BASED_TEXT_RENDERING
@@ -246,6 +316,13 @@ FontClient::Plugin::~Plugin()
 void FontClient::Plugin::SetDpi( unsigned int horizontalDpi,
                                  unsigned int verticalDpi )
 {
+  if( ( horizontalDpi != mDpiHorizontal ) ||
+      ( verticalDpi != mDpiVertical ) )
+  {
+    // The metrics of fixed size bitmaps are scaled to the dpi.
+    mGlyphMetricsCache.Clear();
+  }
+
   mDpiHorizontal = horizontalDpi;
   mDpiVertical = verticalDpi;
 }
@@ -367,12 +444,11 @@ void FontClient::Plugin::GetSystemFonts( FontList& systemFonts )
 void FontClient::Plugin::GetDescription( FontId id,
                                          FontDescription& fontDescription ) const
 {
-  for( std::vector<FontIdCacheItem>::const_iterator it = mFontIdCache.begin(),
-         endIt = mFontIdCache.end();
-       it != endIt;
-       ++it )
+  uint32_t slot = HashIndex::START;
+  uint32_t index = 0u;
+  while( mFontIdDescriptionIndex.Find( HashIndex::Combine( 0u, id ), slot, index ) )
   {
-    const FontIdCacheItem& item = *it;
+    const FontIdCacheItem& item = mFontIdCache[index];
 
     if( item.fontId == id )
     {
@@ -405,30 +481,61 @@ FontId FontClient::Plugin::FindFontForCharacter( const FontList& fontList,
                                                  Character charcode,
                                                  PointSize26Dot6 requestedPointSize,
                                                  bool preferColor )
+{
+  // The list may be any list of fonts, so the characters its fonts support are only cached for this call.
+  CharacterCoverage coverage;
+
+  return FindFontForCharacter( fontList, coverage, charcode, requestedPointSize, preferColor );
+}
+
+FontId FontClient::Plugin::FindFontForCharacter( const FontList& fontList,
+                                                 CharacterCoverage& coverage,
+                                                 Character charcode,
+                                                 PointSize26Dot6 requestedPointSize,
+                                                 bool preferColor )
 {
   DALI_LOG_INFO( gLogFilter, Debug::Verbose, "FontClient::Plugin::FindFontForCharacter\n");
 
+  // Check first if the character has been queried before.
+  // The character fits in 21 bits, so the key packs the point size, the character and the color preference.
+  const uint64_t key = ( static_cast<uint64_t>( requestedPointSize ) << 32u ) |
+                       ( static_cast<uint64_t>( charcode ) << 1u ) |
+                       ( preferColor ? 1u : 0u );
+
+  std::map<uint64_t, FontId>::const_iterator foundIt = coverage.fontIds.find( key );
+  if( foundIt != coverage.fontIds.end() )
+  {
+    return foundIt->second;
+  }
+
+  DALI_TRACE_SCOPE( Trace::TEXT, "FindFontForCharacter" );
+
   FontId fontId(0);
   bool foundColor(false);
+  bool isColorChecked(true);
+
+  // The character sets are retrieved the first time each font of the list is checked.
+  if( coverage.characterSets.size() < fontList.size() )
+  {
+    coverage.characterSets.resize( fontList.size(), NULL );
+  }
 
   // Traverse the list of fonts.
   // Check for each default font if supports the character.
 
+  std::vector<_FcCharSet*>::iterator characterSetIt = coverage.characterSets.begin();
   for( FontList::const_iterator it = fontList.begin(), endIt = fontList.end();
        it != endIt;
-       ++it )
+       ++it, ++characterSetIt )
   {
     const FontDescription& description = *it;
 
-    FcPattern* pattern = CreateFontFamilyPattern( description );
-
-    FcResult result = FcResultMatch;
-    FcPattern* match = FcFontMatch( NULL /* use default configure */, pattern, &result );
-
-    FcCharSet* charSet = NULL;
-    FcPatternGetCharSet( match, FC_CHARSET, 0u, &charSet );
+    if( NULL == *characterSetIt )
+    {
+      *characterSetIt = CreateCharacterSet( description );
+    }
 
-    if( FcCharSetHasChar( charSet, charcode ) )
+    if( FcCharSetHasChar( *characterSetIt, charcode ) )
     {
       Vector< PointSize26Dot6 > fixedSizes;
       GetFixedSizes( description,
@@ -459,30 +566,88 @@ FontId FontClient::Plugin::FindFontForCharacter( const FontList& fontList,
 
       if( preferColor )
       {
-        PixelData bitmap = CreateBitmap( fontId, GetGlyphIndex(fontId,charcode) );
-        if( bitmap &&
-            Pixel::BGRA8888 == bitmap.GetPixelFormat() )
-        {
-          foundColor = true;
-        }
+        bool isChecked(false);
+        foundColor = HasColor( fontId, GetGlyphIndex( fontId, charcode ), isChecked );
+        isColorChecked = isColorChecked && isChecked;
       }
 
       // Keep going unless we prefer a different (color) font
       if( !preferColor || foundColor )
       {
-        FcPatternDestroy( match );
-        FcPatternDestroy( pattern );
         break;
       }
     }
+  }
 
-    FcPatternDestroy( match );
-    FcPatternDestroy( pattern );
+  // If a font couldn't be checked for color glyphs, a later call may find a different font.
+  if( isColorChecked )
+  {
+    coverage.fontIds.insert( std::make_pair( key, fontId ) );
   }
 
   return fontId;
 }
 
+_FcCharSet* FontClient::Plugin::CreateCharacterSet( const FontDescription& description )
+{
+  FcPattern* pattern = CreateFontFamilyPattern( description );
+
+  FcResult result = FcResultMatch;
+  FcPattern* match = FcFontMatch( NULL /* use default configure */, pattern, &result );
+
+  FcCharSet* characterSet = NULL;
+  if( NULL != match )
+  {
+    FcCharSet* matchCharacterSet = NULL;
+    if( FcResultMatch == FcPatternGetCharSet( match, FC_CHARSET, 0u, &matchCharacterSet ) )
+    {
+      // The pattern owns its character set.
+      characterSet = FcCharSetCopy( matchCharacterSet );
+    }
+
+    FcPatternDestroy( match );
+  }
+  FcPatternDestroy( pattern );
+
+  if( NULL == characterSet )
+  {
+    // An empty set, so the font isn't matched again.
+    characterSet = FcCharSetCreate();
+  }
+
+  return characterSet;
+}
+
+bool FontClient::Plugin::HasColor( FontId fontId, GlyphIndex glyphIndex, bool& isChecked )
+{
+  isChecked = false;
+
+  if( ( fontId > 0u ) &&
+      ( fontId - 1u < mFontCache.size() ) )
+  {
+    CacheItem& font = mFontCache[fontId - 1u];
+
+    if( !font.mIsColorChecked )
+    {
+      // The glyphs of a font are either all color or none, so rendering one is enough.
+      // A glyph which fails to render says nothing about the font, so it's checked again next time.
+      PixelData bitmap = CreateBitmap( fontId, glyphIndex );
+      if( !bitmap )
+      {
+        return false;
+      }
+
+      font.mHasColor = ( Pixel::BGRA8888 == bitmap.GetPixelFormat() );
+      font.mIsColorChecked = true;
+    }
+
+    isChecked = true;
+    return font.mHasColor;
+  }
+
+  return false;
+}
+
 FontId FontClient::Plugin::FindDefaultFont( Character charcode,
                                             PointSize26Dot6 requestedPointSize,
                                             bool preferColor )
@@ -504,7 +669,7 @@ FontId FontClient::Plugin::FindDefaultFont( Character charcode,
 
   // Traverse the list of default fonts.
   // Check for each default font if supports the character.
-  fontId = FindFontForCharacter( mDefaultFonts, charcode, requestedPointSize, preferColor );
+  fontId = FindFontForCharacter( mDefaultFonts, mDefaultFontsCoverage, charcode, requestedPointSize, preferColor );
 
   return fontId;
 }
@@ -522,19 +687,21 @@ FontId FontClient::Plugin::FindFallbackFont( FontId preferredFont,
 
   // Check first if the font's description has been queried before.
   FontList* fontList( NULL );
+  CharacterCoverage* coverage( NULL );
 
-  if( !FindFallbackFontList( fontDescription, fontList ) )
+  if( !FindFallbackFontList( fontDescription, fontList, coverage ) )
   {
     fontList = new FontList;
     SetFontList( fontDescription, *fontList );
+    coverage = new CharacterCoverage;
 
     // Add the font-list to the cache.
-    mFallbackCache.push_back( FallbackCacheItem(fontDescription, fontList) );
+    CacheFallbackFontList( FallbackCacheItem(fontDescription, fontList, coverage) );
   }
 
-  if( fontList )
+  if( fontList && coverage )
   {
-    fontId = FindFontForCharacter( *fontList, charcode, requestedPointSize, preferColor );
+    fontId = FindFontForCharacter( *fontList, *coverage, charcode, requestedPointSize, preferColor );
   }
 
   return fontId;
@@ -618,9 +785,9 @@ FontId FontClient::Plugin::GetFontId( const FontDescription& fontDescription,
                         false );
 
     // Cache the pair 'validatedFontId, requestedPointSize' to improve the following queries.
-    mFontIdCache.push_back( FontIdCacheItem( validatedFontId,
-                                             requestedPointSize,
-                                             fontId ) );
+    CacheFontId( FontIdCacheItem( validatedFontId,
+                                  requestedPointSize,
+                                  fontId ) );
   }
 
   return fontId;
@@ -651,7 +818,7 @@ void FontClient::Plugin::ValidateFont( const FontDescription& fontDescription,
     FontDescriptionCacheItem item( description,
                                    validatedFontId );
 
-    mValidatedFontCache.push_back( item );
+    CacheValidatedFont( item );
 
     if( ( fontDescription.family != description.family ) ||
         ( fontDescription.width != description.width )   ||
@@ -662,7 +829,7 @@ void FontClient::Plugin::ValidateFont( const FontDescription& fontDescription,
       FontDescriptionCacheItem item( fontDescription,
                                      validatedFontId );
 
-      mValidatedFontCache.push_back( item );
+      CacheValidatedFont( item );
     }
   }
   else
@@ -756,66 +923,46 @@ bool FontClient::Plugin::GetBitmapMetrics( GlyphInfo* array,
     {
       const CacheItem& font = mFontCache[fontId-1];
 
-      FT_Face ftFace = font.mFreeTypeFace;
-
-#ifdef FREETYPE_BITMAP_SUPPORT
-      // Check to see if we should be loading a Fixed Size bitmap?
-      if ( font.mIsFixedSizeBitmap )
+      // Only load the glyph the first time its metrics are queried.
+      GlyphMetricsCache::Metrics metrics;
+      if( !mGlyphMetricsCache.Find( fontId, glyph.index, metrics ) )
       {
-        int error = FT_Load_Glyph( ftFace, glyph.index, FT_LOAD_COLOR );
-        if ( FT_Err_Ok == error )
+        if( !LoadGlyphMetrics( font, glyph.index, metrics ) )
         {
-          glyph.width = font.mFixedWidthPixels;
-          glyph.height = font.mFixedHeightPixels;
-          glyph.advance = font.mFixedWidthPixels;
-          glyph.xBearing = 0.0f;
-          glyph.yBearing = font.mFixedHeightPixels;
+          success = false;
+          continue;
+        }
 
-          // Adjust the metrics if the fixed-size font should be down-scaled
-          const float desiredFixedSize =  static_cast<float>( font.mRequestedPointSize ) * FROM_266 / POINTS_PER_INCH * mDpiVertical;
+        mGlyphMetricsCache.Add( fontId, glyph.index, metrics );
+      }
 
-          if( desiredFixedSize > 0.f )
-          {
-            const float scaleFactor = desiredFixedSize / static_cast<float>( font.mFixedHeightPixels );
+      glyph.width = metrics.width;
+      glyph.height = metrics.height;
 
-            glyph.width = floorf( glyph.width * scaleFactor );
-            glyph.height = floorf( glyph.height * scaleFactor );
-            glyph.advance = floorf( glyph.advance * scaleFactor );
-            glyph.xBearing = floorf( glyph.xBearing * scaleFactor );
-            glyph.yBearing = floorf( glyph.yBearing * scaleFactor );
+#ifdef FREETYPE_BITMAP_SUPPORT
+      if( font.mIsFixedSizeBitmap )
+      {
+        glyph.advance = metrics.advance;
+        glyph.xBearing = metrics.horizontalXBearing;
+        glyph.yBearing = metrics.horizontalYBearing;
 
-            glyph.scaleFactor = scaleFactor;
-          }
-        }
-        else
+        if( metrics.scaleFactor > 0.f )
         {
-          DALI_LOG_ERROR( "FreeType Bitmap Load_Glyph error %d\n", error );
-          success = false;
+          glyph.scaleFactor = metrics.scaleFactor;
         }
       }
       else
 #endif
       {
-        int error = FT_Load_Glyph( ftFace, glyph.index, FT_LOAD_DEFAULT );
-
-        if( FT_Err_Ok == error )
+        if( horizontal )
         {
-          glyph.width  = static_cast< float >( ftFace->glyph->metrics.width ) * FROM_266;
-          glyph.height = static_cast< float >( ftFace->glyph->metrics.height ) * FROM_266 ;
-          if( horizontal )
-          {
-            glyph.xBearing += static_cast< float >( ftFace->glyph->metrics.horiBearingX ) * FROM_266;
-            glyph.yBearing += static_cast< float >( ftFace->glyph->metrics.horiBearingY ) * FROM_266;
-          }
-          else
-          {
-            glyph.xBearing += static_cast< float >( ftFace->glyph->metrics.vertBearingX ) * FROM_266;
-            glyph.yBearing += static_cast< float >( ftFace->glyph->metrics.vertBearingY ) * FROM_266;
-          }
+          glyph.xBearing += metrics.horizontalXBearing;
+          glyph.yBearing += metrics.horizontalYBearing;
         }
         else
         {
-          success = false;
+          glyph.xBearing += metrics.verticalXBearing;
+          glyph.yBearing += metrics.verticalYBearing;
         }
       }
     }
@@ -828,6 +975,73 @@ bool FontClient::Plugin::GetBitmapMetrics( GlyphInfo* array,
   return success;
 }
 
+bool FontClient::Plugin::LoadGlyphMetrics( const CacheItem& font,
+                                           GlyphIndex glyphIndex,
+                                           GlyphMetricsCache::Metrics& metrics ) const
+{
+  FT_Face ftFace = font.mFreeTypeFace;
+
+  metrics.scaleFactor = 0.f;
+
+#ifdef FREETYPE_BITMAP_SUPPORT
+  // Check to see if we should be loading a Fixed Size bitmap?
+  if ( font.mIsFixedSizeBitmap )
+  {
+    int error = FT_Load_Glyph( ftFace, glyphIndex, FT_LOAD_COLOR );
+    if ( FT_Err_Ok == error )
+    {
+      metrics.width = font.mFixedWidthPixels;
+      metrics.height = font.mFixedHeightPixels;
+      metrics.advance = font.mFixedWidthPixels;
+      metrics.horizontalXBearing = 0.0f;
+      metrics.horizontalYBearing = font.mFixedHeightPixels;
+
+      // Adjust the metrics if the fixed-size font should be down-scaled
+      const float desiredFixedSize =  static_cast<float>( font.mRequestedPointSize ) * FROM_266 / POINTS_PER_INCH * mDpiVertical;
+
+      if( desiredFixedSize > 0.f )
+      {
+        const float scaleFactor = desiredFixedSize / static_cast<float>( font.mFixedHeightPixels );
+
+        metrics.width = floorf( metrics.width * scaleFactor );
+        metrics.height = floorf( metrics.height * scaleFactor );
+        metrics.advance = floorf( metrics.advance * scaleFactor );
+        metrics.horizontalXBearing = floorf( metrics.horizontalXBearing * scaleFactor );
+        metrics.horizontalYBearing = floorf( metrics.horizontalYBearing * scaleFactor );
+
+        metrics.scaleFactor = scaleFactor;
+      }
+
+      // Fixed size bitmaps have the same bearings in vertical layouts.
+      metrics.verticalXBearing = metrics.horizontalXBearing;
+      metrics.verticalYBearing = metrics.horizontalYBearing;
+
+      return true;
+    }
+
+    DALI_LOG_ERROR( "FreeType Bitmap Load_Glyph error %d\n", error );
+    return false;
+  }
+#endif
+
+  int error = FT_Load_Glyph( ftFace, glyphIndex, FT_LOAD_DEFAULT );
+
+  if( FT_Err_Ok == error )
+  {
+    metrics.width  = static_cast< float >( ftFace->glyph->metrics.width ) * FROM_266;
+    metrics.height = static_cast< float >( ftFace->glyph->metrics.height ) * FROM_266 ;
+    metrics.horizontalXBearing = static_cast< float >( ftFace->glyph->metrics.horiBearingX ) * FROM_266;
+    metrics.horizontalYBearing = static_cast< float >( ftFace->glyph->metrics.horiBearingY ) * FROM_266;
+    metrics.verticalXBearing = static_cast< float >( ftFace->glyph->metrics.vertBearingX ) * FROM_266;
+    metrics.verticalYBearing = static_cast< float >( ftFace->glyph->metrics.vertBearingY ) * FROM_266;
+    metrics.advance = static_cast< float >( ftFace->glyph->metrics.horiAdvance ) * FROM_266;
+
+    return true;
+  }
+
+  return false;
+}
+
 bool FontClient::Plugin::GetVectorMetrics( GlyphInfo* array,
                                            uint32_t size,
                                            bool horizontal )
@@ -874,6 +1088,8 @@ bool FontClient::Plugin::GetVectorMetrics( GlyphInfo* array,
 PixelData FontClient::Plugin::CreateBitmap( FontId fontId,
                                               GlyphIndex glyphIndex )
 {
+  DALI_TRACE_SCOPE( Trace::TEXT, "RasterizeGlyph" );
+
   PixelData bitmap;
 
   if( fontId > 0 &&
@@ -1160,6 +1376,8 @@ FontId FontClient::Plugin::CreateFont( const FontPath& path,
                                        FaceIndex faceIndex,
                                        bool cacheDescription )
 {
+  DALI_TRACE_SCOPE( Trace::TEXT, "LoadFont" );
+
   FontId id( 0 );
 
   // Create & cache new font face
@@ -1197,8 +1415,7 @@ FontId FontClient::Plugin::CreateFont( const FontPath& path,
                                  0.0f,
                                  0.0f );
 
-            mFontCache.push_back( CacheItem( ftFace, path, requestedPointSize, faceIndex, metrics, fixedWidth, fixedHeight ) );
-            id = mFontCache.size();
+            id = CacheFont( CacheItem( ftFace, path, requestedPointSize, faceIndex, metrics, fixedWidth, fixedHeight ) );
 
             if( cacheDescription )
             {
@@ -1242,8 +1459,7 @@ FontId FontClient::Plugin::CreateFont( const FontPath& path,
                              static_cast< float >( ftFace->underline_position ) * FROM_266,
                              static_cast< float >( ftFace->underline_thickness ) * FROM_266 );
 
-        mFontCache.push_back( CacheItem( ftFace, path, requestedPointSize, faceIndex, metrics ) );
-        id = mFontCache.size();
+        id = CacheFont( CacheItem( ftFace, path, requestedPointSize, faceIndex, metrics ) );
 
         if( cacheDescription )
         {
@@ -1311,18 +1527,25 @@ bool FontClient::Plugin::FindFont( const FontPath& path,
                                    FontId& fontId ) const
 {
   fontId = 0u;
-  for( std::vector<CacheItem>::const_iterator it = mFontCache.begin(),
-         endIt = mFontCache.end();
-       it != endIt;
-       ++it, ++fontId )
+
+  // No font is cached for a path which hasn't been interned.
+  uint32_t pathId = 0u;
+  if( !mInternedStrings.Find( path, pathId ) )
   {
-    const CacheItem& cacheItem = *it;
+    return false;
+  }
+
+  uint32_t slot = HashIndex::START;
+  uint32_t index = 0u;
+  while( mFontCacheIndex.Find( HashFont( pathId, requestedPointSize, faceIndex ), slot, index ) )
+  {
+    const CacheItem& cacheItem = mFontCache[index];
 
     if( cacheItem.mRequestedPointSize == requestedPointSize &&
         cacheItem.mFaceIndex == faceIndex &&
-        cacheItem.mPath == path )
+        cacheItem.mPathId == pathId )
     {
-      ++fontId;
+      fontId = index + 1u;
       return true;
     }
   }
@@ -1337,24 +1560,27 @@ bool FontClient::Plugin::FindValidatedFont( const FontDescription& fontDescripti
 
   validatedFontId = 0u;
 
-  for( std::vector<FontDescriptionCacheItem>::const_iterator it = mValidatedFontCache.begin(),
-         endIt = mValidatedFontCache.end();
-       it != endIt;
-       ++it )
+  uint32_t familyId = 0u;
+  if( !fontDescription.family.empty() &&
+      mInternedStrings.Find( fontDescription.family, familyId ) )
   {
-    const FontDescriptionCacheItem& item = *it;
-
-    if( !fontDescription.family.empty() &&
-        ( fontDescription.family == item.fontDescription.family ) &&
-        ( fontDescription.width == item.fontDescription.width ) &&
-        ( fontDescription.weight == item.fontDescription.weight ) &&
-        ( fontDescription.slant == item.fontDescription.slant ) )
+    uint32_t slot = HashIndex::START;
+    uint32_t index = 0u;
+    while( mValidatedFontCacheIndex.Find( HashFontDescription( familyId, fontDescription ), slot, index ) )
     {
-      validatedFontId = item.index;
+      const FontDescriptionCacheItem& item = mValidatedFontCache[index];
+
+      if( ( familyId == item.familyId ) &&
+          ( fontDescription.width == item.fontDescription.width ) &&
+          ( fontDescription.weight == item.fontDescription.weight ) &&
+          ( fontDescription.slant == item.fontDescription.slant ) )
+      {
+        validatedFontId = item.index;
 
-      DALI_LOG_INFO( gLogFilter, Debug::Verbose, "FontClient::Plugin::FindValidatedFont validated font family(%s) font id (%u) \n", fontDescription.family.c_str(), validatedFontId );
+        DALI_LOG_INFO( gLogFilter, Debug::Verbose, "FontClient::Plugin::FindValidatedFont validated font family(%s) font id (%u) \n", fontDescription.family.c_str(), validatedFontId );
 
-      return true;
+        return true;
+      }
     }
   }
 
@@ -1364,29 +1590,36 @@ bool FontClient::Plugin::FindValidatedFont( const FontDescription& fontDescripti
 }
 
 bool FontClient::Plugin::FindFallbackFontList( const FontDescription& fontDescription,
-                                               FontList*& fontList )
+                                               FontList*& fontList,
+                                               CharacterCoverage*& coverage )
 {
   DALI_LOG_INFO( gLogFilter, Debug::Verbose, "FontClient::Plugin::FindFallbackFontList fontDescription family(%s)\n", fontDescription.family.c_str() );
 
   fontList = NULL;
+  coverage = NULL;
 
-  for( std::vector<FallbackCacheItem>::const_iterator it = mFallbackCache.begin(), endIt = mFallbackCache.end();
-       it != endIt;
-       ++it )
+  uint32_t familyId = 0u;
+  if( !fontDescription.family.empty() &&
+      mInternedStrings.Find( fontDescription.family, familyId ) )
   {
-    const FallbackCacheItem& item = *it;
-
-    if( !fontDescription.family.empty() &&
-        ( fontDescription.family == item.fontDescription.family ) &&
-        ( fontDescription.width == item.fontDescription.width ) &&
-        ( fontDescription.weight == item.fontDescription.weight ) &&
-        ( fontDescription.slant == item.fontDescription.slant ) )
+    uint32_t slot = HashIndex::START;
+    uint32_t index = 0u;
+    while( mFallbackCacheIndex.Find( HashFontDescription( familyId, fontDescription ), slot, index ) )
     {
-      fontList = item.fallbackFonts;
+      const FallbackCacheItem& item = mFallbackCache[index];
 
-      DALI_LOG_INFO( gLogFilter, Debug::Verbose, "FontClient::Plugin::FindFallbackFontList font family(%s) font-list (%p) \n", fontDescription.family.c_str(), fontList );
+      if( ( familyId == item.familyId ) &&
+          ( fontDescription.width == item.fontDescription.width ) &&
+          ( fontDescription.weight == item.fontDescription.weight ) &&
+          ( fontDescription.slant == item.fontDescription.slant ) )
+      {
+        fontList = item.fallbackFonts;
+        coverage = item.coverage;
 
-      return true;
+        DALI_LOG_INFO( gLogFilter, Debug::Verbose, "FontClient::Plugin::FindFallbackFontList font family(%s) font-list (%p) \n", fontDescription.family.c_str(), fontList );
+
+        return true;
+      }
     }
   }
 
@@ -1401,12 +1634,11 @@ bool FontClient::Plugin::FindFont( FontDescriptionId validatedFontId,
 {
   fontId = 0u;
 
-  for( std::vector<FontIdCacheItem>::const_iterator it = mFontIdCache.begin(),
-         endIt = mFontIdCache.end();
-       it != endIt;
-       ++it )
+  uint32_t slot = HashIndex::START;
+  uint32_t index = 0u;
+  while( mFontIdCacheIndex.Find( HashFontId( validatedFontId, requestedPointSize ), slot, index ) )
   {
-    const FontIdCacheItem& item = *it;
+    const FontIdCacheItem& item = mFontIdCache[index];
 
     if( ( validatedFontId == item.validatedFontId ) &&
         ( requestedPointSize == item.requestedPointSize ) )
@@ -1552,13 +1784,71 @@ void FontClient::Plugin::CacheFontPath( FT_Face ftFace, FontId id, PointSize26Do
     FontDescriptionCacheItem item( description,
                                    validatedFontId );
 
-    mValidatedFontCache.push_back( item );
+    CacheValidatedFont( item );
 
     // Cache the pair 'validatedFontId, requestedPointSize' to improve the following queries.
-    mFontIdCache.push_back( FontIdCacheItem( validatedFontId,
-                                             requestedPointSize,
-                                             id ) );
+    CacheFontId( FontIdCacheItem( validatedFontId,
+                                  requestedPointSize,
+                                  id ) );
+  }
+}
+
+FontId FontClient::Plugin::CacheFont( const CacheItem& item )
+{
+  mFontCache.push_back( item );
+  CacheItem& cacheItem = mFontCache.back();
+  cacheItem.mPathId = mInternedStrings.Intern( cacheItem.mPath );
+
+  const FontId index = mFontCache.size() - 1u;
+  mFontCacheIndex.Add( HashFont( cacheItem.mPathId, cacheItem.mRequestedPointSize, cacheItem.mFaceIndex ), index );
+
+  return index + 1u;
+}
+
+void FontClient::Plugin::CacheValidatedFont( const FontDescriptionCacheItem& item )
+{
+  // A description may be cached more than once; only the first one is found, as when the cache was searched in order.
+  FontDescriptionId validatedFontId = 0u;
+  const bool found = FindValidatedFont( item.fontDescription, validatedFontId );
+
+  mValidatedFontCache.push_back( item );
+  FontDescriptionCacheItem& cacheItem = mValidatedFontCache.back();
+  cacheItem.familyId = mInternedStrings.Intern( cacheItem.fontDescription.family );
+
+  if( !found )
+  {
+    mValidatedFontCacheIndex.Add( HashFontDescription( cacheItem.familyId, cacheItem.fontDescription ), mValidatedFontCache.size() - 1u );
+  }
+}
+
+void FontClient::Plugin::CacheFallbackFontList( const FallbackCacheItem& item )
+{
+  mFallbackCache.push_back( item );
+  FallbackCacheItem& cacheItem = mFallbackCache.back();
+  cacheItem.familyId = mInternedStrings.Intern( cacheItem.fontDescription.family );
+
+  mFallbackCacheIndex.Add( HashFontDescription( cacheItem.familyId, cacheItem.fontDescription ), mFallbackCache.size() - 1u );
+}
+
+void FontClient::Plugin::CacheFontId( const FontIdCacheItem& item )
+{
+  mFontIdCache.push_back( item );
+
+  const uint32_t index = mFontIdCache.size() - 1u;
+  mFontIdCacheIndex.Add( HashFontId( item.validatedFontId, item.requestedPointSize ), index );
+
+  // Several validated fonts may have the same font id; only the first one gives its description, as when the cache was searched in order.
+  const uint32_t fontIdHash = HashIndex::Combine( 0u, item.fontId );
+  uint32_t slot = HashIndex::START;
+  uint32_t foundIndex = 0u;
+  while( mFontIdDescriptionIndex.Find( fontIdHash, slot, foundIndex ) )
+  {
+    if( mFontIdCache[foundIndex].fontId == item.fontId )
+    {
+      return;
+    }
   }
+  mFontIdDescriptionIndex.Add( fontIdHash, index );
 }
 
 } // namespace Internal
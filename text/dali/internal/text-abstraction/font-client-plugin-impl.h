@@ -22,6 +22,9 @@
 #include <dali/devel-api/text-abstraction/font-metrics.h>
 #include <dali/devel-api/text-abstraction/glyph-info.h>
 #include <dali/internal/text-abstraction/font-client-impl.h>
+#include <dali/internal/text-abstraction/glyph-metrics-cache.h>
+#include <dali/internal/text-abstraction/hash-index.h>
+#include <dali/internal/text-abstraction/interned-strings.h>
 
 #ifdef ENABLE_VECTOR_BASED_TEXT_RENDERING
 #include <dali/internal/glyphy/vector-font-cache.h>
@@ -30,11 +33,13 @@ class VectorFontCache;
 #endif
 
 // EXTERNAL INCLUDES
+#include <map>
 #include <ft2build.h>
 #include FT_FREETYPE_H
 #include FT_GLYPH_H
 
 // forward declarations of font config types.
+struct _FcCharSet;
 struct _FcFontSet;
 struct _FcPattern;
 
@@ -57,15 +62,40 @@ typedef uint32_t FontDescriptionId;
  */
 struct FontClient::Plugin
 {
+  /**
+   * @brief Caches which characters the fonts of a font list support, and the font found in the list for each character.
+   */
+  struct CharacterCoverage
+  {
+    CharacterCoverage();
+
+    /**
+     * Destroys the character sets.
+     */
+    ~CharacterCoverage();
+
+    std::vector<_FcCharSet*>   characterSets; ///< The character set of each font in the list, or NULL if the font hasn't been matched yet.
+    std::map<uint64_t, FontId>   fontIds;       ///< The font found for each character, requested point size and color preference.
+
+  private:
+
+    // Declared private and left undefined to avoid copies.
+    CharacterCoverage( const CharacterCoverage& );
+    // Declared private and left undefined to avoid copies.
+    CharacterCoverage& operator=( const CharacterCoverage& );
+  };
+
   /**
    * @brief Caches an list of fallback fonts for a given font-description
    */
   struct FallbackCacheItem
   {
-    FallbackCacheItem( const FontDescription& fontDescription, FontList* fallbackFonts );
+    FallbackCacheItem( const FontDescription& fontDescription, FontList* fallbackFonts, CharacterCoverage* coverage );
 
     FontDescription fontDescription; ///< The font description.
     FontList* fallbackFonts;         ///< The list of fallback fonts for the given font-description.
+    CharacterCoverage* coverage;     ///< The characters supported by the fallback fonts.
+    uint32_t familyId;               ///< The interned font family.
   };
 
   /**
@@ -78,6 +108,7 @@ struct FontClient::Plugin
 
     FontDescription fontDescription; ///< The font description.
     FontDescriptionId index;         ///< Index to the vector of font descriptions.
+    uint32_t familyId;               ///< The interned font family.
   };
 
   /**
@@ -122,6 +153,9 @@ struct FontClient::Plugin
     FT_Short mFixedHeightPixels;         ///< The height in pixels (fixed size bitmaps only)
     unsigned int mVectorFontId;          ///< The ID of the equivalent vector-based font
     bool mIsFixedSizeBitmap;             ///< Whether the font has fixed size bitmaps.
+    uint32_t mPathId;                    ///< The interned path to the font file name.
+    bool mIsColorChecked;                ///< Whether a glyph has rendered to check whether the font has color glyphs.
+    bool mHasColor;                      ///< Whether the font has color glyphs; only valid once mIsColorChecked is set.
   };
 
   struct EllipsisItem
@@ -398,7 +432,45 @@ private:
    * @param[out] A valid pointer to a font list, or NULL if not found.
    */
   bool FindFallbackFontList( const FontDescription& fontDescription,
-                             FontList*& fontList );
+                             FontList*& fontList,
+                             CharacterCoverage*& coverage );
+
+  /**
+   * @brief Finds the first font in a list which supports a character, using and filling the list's character coverage.
+   *
+   * @param[in] fontList A list of fonts.
+   * @param[in,out] coverage The characters supported by the fonts of the list.
+   * @param[in] charcode The character.
+   * @param[in] requestedPointSize The point size in 26.6 fractional points.
+   * @param[in] preferColor True if a color font is preferred.
+   *
+   * @return A valid font ID, or zero if none of the fonts support the character.
+   */
+  FontId FindFontForCharacter( const FontList& fontList,
+                               CharacterCoverage& coverage,
+                               Character charcode,
+                               PointSize26Dot6 requestedPointSize,
+                               bool preferColor );
+
+  /**
+   * @brief Retrieves the character set of the font matched for a font description.
+   *
+   * @param[in] description The font description.
+   *
+   * @return The character set, owned by the caller. It's empty if no font is matched.
+   */
+  _FcCharSet* CreateCharacterSet( const FontDescription& description );
+
+  /**
+   * @brief Whether a font has color glyphs. A glyph is rendered to check it, until one renders.
+   *
+   * @param[in] fontId The font id.
+   * @param[in] glyphIndex A glyph of the font to render.
+   * @param[out] isChecked Whether the font has been checked; if not, the result is @e false but not known.
+   *
+   * @return @e true if the font has color glyphs.
+   */
+  bool HasColor( FontId fontId, GlyphIndex glyphIndex, bool& isChecked );
 
   /**
    * @brief Finds in the cache a pair 'validated font id and font point size'.
@@ -441,6 +513,47 @@ private:
    */
   void CacheFontPath( FT_Face ftFace, FontId id, PointSize26Dot6 requestedPointSize,  const FontPath& path );
 
+  /**
+   * @brief Adds a font to the cache of fonts and indexes it by its path, point size and face index.
+   *
+   * @param[in] item The font.
+   *
+   * @return The font id.
+   */
+  FontId CacheFont( const CacheItem& item );
+
+  /**
+   * @brief Adds a validated font description to the cache and indexes it by its family, width, weight and slant.
+   *
+   * @param[in] item The validated font description.
+   */
+  void CacheValidatedFont( const FontDescriptionCacheItem& item );
+
+  /**
+   * @brief Adds a fallback font list to the cache and indexes it by its family, width, weight and slant.
+   *
+   * @param[in] item The fallback font list.
+   */
+  void CacheFallbackFontList( const FallbackCacheItem& item );
+
+  /**
+   * @brief Adds a font id to the cache and indexes it by its validated font id and point size, and by the font id.
+   *
+   * @param[in] item The font id.
+   */
+  void CacheFontId( const FontIdCacheItem& item );
+
+  /**
+   * @brief Loads a glyph to retrieve its metrics.
+   *
+   * @param[in] font The font of the glyph.
+   * @param[in] glyphIndex The index of the glyph in the font.
+   * @param[out] metrics The metrics of the glyph.
+   *
+   * @return @e true if the glyph is loaded.
+   */
+  bool LoadGlyphMetrics( const CacheItem& font, GlyphIndex glyphIndex, GlyphMetricsCache::Metrics& metrics ) const;
+
 private:
 
   // Declared private and left undefined to avoid copies.
@@ -459,6 +572,7 @@ private:
 
   FontList mSystemFonts;       ///< Cached system fonts.
   FontList mDefaultFonts;      ///< Cached default fonts.
+  CharacterCoverage mDefaultFontsCoverage; ///< The characters supported by the default fonts.
 
   std::vector<FallbackCacheItem> mFallbackCache; ///< Cached fallback font lists.
 
@@ -467,6 +581,15 @@ private:
   FontList                              mFontDescriptionCache; ///< Caches font descriptions for the validated font.
   std::vector<FontIdCacheItem>          mFontIdCache;          ///< Caches font ids for the pairs of font point size and the index to the vector with font descriptions of the validated fonts.
 
+  InternedStrings mInternedStrings;         ///< The families and paths of the cached fonts.
+  HashIndex       mFontCacheIndex;          ///< Indexes mFontCache by path, point size and face index.
+  HashIndex       mValidatedFontCacheIndex; ///< Indexes mValidatedFontCache by family, width, weight and slant.
+  HashIndex       mFallbackCacheIndex;      ///< Indexes mFallbackCache by family, width, weight and slant.
+  HashIndex       mFontIdCacheIndex;        ///< Indexes mFontIdCache by validated font id and point size.
+  HashIndex       mFontIdDescriptionIndex;  ///< Indexes mFontIdCache by font id, to get the descriptions of fonts.
+
+  GlyphMetricsCache mGlyphMetricsCache; ///< Caches the metrics of the glyphs loaded by GetBitmapMetrics().
+
   VectorFontCache* mVectorFontCache; ///< Separate cache for vector data blobs etc.
 
   Vector<EllipsisItem> mEllipsisCache;      ///< Caches ellipsis glyphs for a particular point size.
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include "glyph-metrics-cache.h"
+
+namespace Dali
+{
+
+namespace TextAbstraction
+{
+
+namespace Internal
+{
+
+namespace
+{
+
+/**
+ * Hashes the key of a glyph: its font id and glyph index.
+ */
+uint32_t HashGlyph( FontId fontId, GlyphIndex glyphIndex )
+{
+  return HashIndex::Combine( HashIndex::Combine( 0u, fontId ), glyphIndex );
+}
+
+} // unnamed namespace
+
+GlyphMetricsCache::GlyphMetricsCache()
+: mFontIds(),
+  mGlyphIndices(),
+  mWidths(),
+  mHeights(),
+  mHorizontalXBearings(),
+  mHorizontalYBearings(),
+  mVerticalXBearings(),
+  mVerticalYBearings(),
+  mAdvances(),
+  mScaleFactors(),
+  mIndex()
+{
+}
+
+GlyphMetricsCache::~GlyphMetricsCache()
+{
+}
+
+bool GlyphMetricsCache::Find( FontId fontId, GlyphIndex glyphIndex, Metrics& metrics ) const
+{
+  uint32_t slot = HashIndex::START;
+  uint32_t index = 0u;
+  while( mIndex.Find( HashGlyph( fontId, glyphIndex ), slot, index ) )
+  {
+    if( ( mFontIds[index] == fontId ) &&
+        ( mGlyphIndices[index] == glyphIndex ) )
+    {
+      metrics.width = mWidths[index];
+      metrics.height = mHeights[index];
+      metrics.horizontalXBearing = mHorizontalXBearings[index];
+      metrics.horizontalYBearing = mHorizontalYBearings[index];
+      metrics.verticalXBearing = mVerticalXBearings[index];
+      metrics.verticalYBearing = mVerticalYBearings[index];
+      metrics.advance = mAdvances[index];
+      metrics.scaleFactor = mScaleFactors[index];
+      return true;
+    }
+  }
+
+  return false;
+}
+
+void GlyphMetricsCache::Add( FontId fontId, GlyphIndex glyphIndex, const Metrics& metrics )
+{
+  mIndex.Add( HashGlyph( fontId, glyphIndex ), mFontIds.size() );
+
+  mFontIds.push_back( fontId );
+  mGlyphIndices.push_back( glyphIndex );
+  mWidths.push_back( metrics.width );
+  mHeights.push_back( metrics.height );
+  mHorizontalXBearings.push_back( metrics.horizontalXBearing );
+  mHorizontalYBearings.push_back( metrics.horizontalYBearing );
+  mVerticalXBearings.push_back( metrics.verticalXBearing );
+  mVerticalYBearings.push_back( metrics.verticalYBearing );
+  mAdvances.push_back( metrics.advance );
+  mScaleFactors.push_back( metrics.scaleFactor );
+}
+
+void GlyphMetricsCache::Clear()
+{
+  mFontIds.clear();
+  mGlyphIndices.clear();
+  mWidths.clear();
+  mHeights.clear();
+  mHorizontalXBearings.clear();
+  mHorizontalYBearings.clear();
+  mVerticalXBearings.clear();
+  mVerticalYBearings.clear();
+  mAdvances.clear();
+  mScaleFactors.clear();
+  mIndex.Clear();
+}
+
+uint32_t GlyphMetricsCache::GetCount() const
+{
+  return mFontIds.size();
+}
+
+} // namespace Internal
+
+} // namespace TextAbstraction
+
+} // namespace Dali
@@ -0,0 +1,133 @@
+#ifndef __DALI_INTERNAL_TEXT_ABSTRACTION_GLYPH_METRICS_CACHE_H__
+#define __DALI_INTERNAL_TEXT_ABSTRACTION_GLYPH_METRICS_CACHE_H__
+
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <stdint.h>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include <dali/devel-api/text-abstraction/text-abstraction-definitions.h>
+#include <dali/internal/text-abstraction/hash-index.h>
+
+namespace Dali
+{
+
+namespace TextAbstraction
+{
+
+namespace Internal
+{
+
+/**
+ * A cache of the metrics of the glyphs loaded by the font client, so the metrics of a glyph are only
+ * loaded from FreeType the first time they are queried. The layout of a text queries the same glyphs
+ * again every time it's relaid out.
+ *
+ * The metrics are stored as one array per field, and found through a hash index of the font id and glyph index.
+ */
+class GlyphMetricsCache
+{
+public:
+
+  /**
+   * The metrics of a glyph, in pixels.
+   */
+  struct Metrics
+  {
+    float width;               ///< The width of the glyph.
+    float height;              ///< The height of the glyph.
+    float horizontalXBearing;  ///< The distance from the pen to the left of the glyph, in horizontal layouts.
+    float horizontalYBearing;  ///< The distance from the baseline to the top of the glyph, in horizontal layouts.
+    float verticalXBearing;    ///< The distance from the pen to the left of the glyph, in vertical layouts.
+    float verticalYBearing;    ///< The distance from the pen to the top of the glyph, in vertical layouts.
+    float advance;             ///< The advance of the glyph.
+    float scaleFactor;         ///< The factor the glyph's bitmap is scaled by, or zero if it's not scaled.
+  };
+
+  /**
+   * Constructor.
+   */
+  GlyphMetricsCache();
+
+  /**
+   * Non-virtual destructor; not intended as a base class.
+   */
+  ~GlyphMetricsCache();
+
+  /**
+   * Finds the metrics of a glyph.
+   *
+   * @param[in] fontId The font of the glyph.
+   * @param[in] glyphIndex The index of the glyph in the font.
+   * @param[out] metrics The metrics of the glyph.
+   *
+   * @return @e true if the metrics are cached.
+   */
+  bool Find( FontId fontId, GlyphIndex glyphIndex, Metrics& metrics ) const;
+
+  /**
+   * Adds the metrics of a glyph which is not cached.
+   *
+   * @param[in] fontId The font of the glyph.
+   * @param[in] glyphIndex The index of the glyph in the font.
+   * @param[in] metrics The metrics of the glyph.
+   */
+  void Add( FontId fontId, GlyphIndex glyphIndex, const Metrics& metrics );
+
+  /**
+   * Removes the metrics of all the glyphs, e.g. when the dpi changes.
+   */
+  void Clear();
+
+  /**
+   * @return The number of glyphs cached.
+   */
+  uint32_t GetCount() const;
+
+private:
+
+  // Undefined
+  GlyphMetricsCache( const GlyphMetricsCache& );
+
+  // Undefined
+  GlyphMetricsCache& operator=( const GlyphMetricsCache& );
+
+private:
+
+  std::vector<FontId> mFontIds;             ///< The font of each glyph.
+  std::vector<GlyphIndex> mGlyphIndices;    ///< The index of each glyph in its font.
+  std::vector<float> mWidths;               ///< The width of each glyph.
+  std::vector<float> mHeights;              ///< The height of each glyph.
+  std::vector<float> mHorizontalXBearings;  ///< The x bearing of each glyph in horizontal layouts.
+  std::vector<float> mHorizontalYBearings;  ///< The y bearing of each glyph in horizontal layouts.
+  std::vector<float> mVerticalXBearings;    ///< The x bearing of each glyph in vertical layouts.
+  std::vector<float> mVerticalYBearings;    ///< The y bearing of each glyph in vertical layouts.
+  std::vector<float> mAdvances;             ///< The advance of each glyph.
+  std::vector<float> mScaleFactors;         ///< The scale factor of each glyph.
+  HashIndex mIndex;                         ///< The glyphs by the hash of their font id and glyph index.
+};
+
+} // namespace Internal
+
+} // namespace TextAbstraction
+
+} // namespace Dali
+
+#endif // __DALI_INTERNAL_TEXT_ABSTRACTION_GLYPH_METRICS_CACHE_H__
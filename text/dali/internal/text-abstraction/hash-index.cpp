@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include "hash-index.h"
+
+namespace Dali
+{
+
+namespace TextAbstraction
+{
+
+namespace Internal
+{
+
+namespace
+{
+
+const uint32_t INITIAL_SIZE = 16u;
+const uint32_t FNV_OFFSET_BASIS = 2166136261u;
+const uint32_t FNV_PRIME = 16777619u;
+
+/**
+ * Mixes the bits of a hash, so keys differing only in their high bits use different slots.
+ */
+uint32_t Mix( uint32_t hash )
+{
+  hash ^= hash >> 16u;
+  hash *= 0x85ebca6bu;
+  hash ^= hash >> 13u;
+  return hash;
+}
+
+} // unnamed namespace
+
+const uint32_t HashIndex::START;
+
+HashIndex::HashIndex()
+: mSlots(),
+  mCount( 0u )
+{
+}
+
+HashIndex::~HashIndex()
+{
+}
+
+void HashIndex::Add( uint32_t hash, uint32_t index )
+{
+  if( 2u * ( mCount + 1u ) > mSlots.size() )
+  {
+    Resize( mSlots.empty() ? INITIAL_SIZE : 2u * mSlots.size() );
+  }
+
+  Insert( hash, index + 1u );
+  ++mCount;
+}
+
+bool HashIndex::Find( uint32_t hash, uint32_t& slot, uint32_t& index ) const
+{
+  if( mSlots.empty() )
+  {
+    return false;
+  }
+
+  const uint32_t mask = mSlots.size() - 1u;
+
+  // Probe linearly from the slot of the hash, until an empty slot ends its run.
+  slot = ( START == slot ) ? ( Mix( hash ) & mask ) : ( ( slot + 1u ) & mask );
+  for( ; 0u != mSlots[slot].index; slot = ( slot + 1u ) & mask )
+  {
+    if( mSlots[slot].hash == hash )
+    {
+      index = mSlots[slot].index - 1u;
+      return true;
+    }
+  }
+
+  return false;
+}
+
+void HashIndex::Clear()
+{
+  mSlots.clear();
+  mCount = 0u;
+}
+
+uint32_t HashIndex::GetCount() const
+{
+  return mCount;
+}
+
+uint32_t HashIndex::Hash( const std::string& string )
+{
+  // FNV-1a
+  uint32_t hash = FNV_OFFSET_BASIS;
+  for( std::string::const_iterator it = string.begin(), endIt = string.end(); it != endIt; ++it )
+  {
+    hash = ( hash ^ static_cast<unsigned char>( *it ) ) * FNV_PRIME;
+  }
+  return hash;
+}
+
+uint32_t HashIndex::Combine( uint32_t hash, uint32_t value )
+{
+  return ( hash ^ value ) * FNV_PRIME;
+}
+
+void HashIndex::Resize( uint32_t size )
+{
+  std::vector<Slot> slots( size );
+  for( std::vector<Slot>::iterator it = slots.begin(), endIt = slots.end(); it != endIt; ++it )
+  {
+    it->hash = 0u;
+    it->index = 0u;
+  }
+  mSlots.swap( slots );
+
+  for( std::vector<Slot>::const_iterator it = slots.begin(), endIt = slots.end(); it != endIt; ++it )
+  {
+    if( 0u != it->index )
+    {
+      Insert( it->hash, it->index );
+    }
+  }
+}
+
+void HashIndex::Insert( uint32_t hash, uint32_t storedIndex )
+{
+  const uint32_t mask = mSlots.size() - 1u;
+
+  uint32_t slot = Mix( hash ) & mask;
+  while( 0u != mSlots[slot].index )
+  {
+    slot = ( slot + 1u ) & mask;
+  }
+
+  mSlots[slot].hash = hash;
+  mSlots[slot].index = storedIndex;
+}
+
+} // namespace Internal
+
+} // namespace TextAbstraction
+
+} // namespace Dali
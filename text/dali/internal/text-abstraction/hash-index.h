@@ -0,0 +1,153 @@
+#ifndef __DALI_INTERNAL_TEXT_ABSTRACTION_HASH_INDEX_H__
+#define __DALI_INTERNAL_TEXT_ABSTRACTION_HASH_INDEX_H__
+
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace Dali
+{
+
+namespace TextAbstraction
+{
+
+namespace Internal
+{
+
+/**
+ * An open addressing hash table of indices into a vector, used to find the items of the font client's caches
+ * without comparing every item.
+ *
+ * It only stores the hash of each item's key, so different keys may have the same hash: the caller
+ * compares the key of each item found with the one it is looking for.
+ *
+ * @code
+ * uint32_t slot = HashIndex::START;
+ * uint32_t index = 0u;
+ * while( hashIndex.Find( hash, slot, index ) )
+ * {
+ *   if( items[index] matches the key )
+ *   {
+ *     return index;
+ *   }
+ * }
+ * @endcode
+ */
+class HashIndex
+{
+public:
+
+  static const uint32_t START = 0xffffffffu; ///< The slot to start finding the indices of a hash from.
+
+  /**
+   * Constructor.
+   */
+  HashIndex();
+
+  /**
+   * Non-virtual destructor; not intended as a base class.
+   */
+  ~HashIndex();
+
+  /**
+   * Adds the index of an item. The table grows so it's never more than half full.
+   *
+   * @param[in] hash The hash of the item's key.
+   * @param[in] index The index of the item.
+   */
+  void Add( uint32_t hash, uint32_t index );
+
+  /**
+   * Finds the next index added with a hash.
+   *
+   * @param[in] hash The hash of the key.
+   * @param[in,out] slot START to find the first index, then the slot returned to find the next one.
+   * @param[out] index The index found.
+   *
+   * @return @e true if an index is found, @e false if there are no more.
+   */
+  bool Find( uint32_t hash, uint32_t& slot, uint32_t& index ) const;
+
+  /**
+   * Removes all the indices.
+   */
+  void Clear();
+
+  /**
+   * @return The number of indices added.
+   */
+  uint32_t GetCount() const;
+
+  /**
+   * Hashes a string.
+   *
+   * @param[in] string The string.
+   *
+   * @return The hash.
+   */
+  static uint32_t Hash( const std::string& string );
+
+  /**
+   * Combines a value into a hash, for keys made of several values.
+   *
+   * @param[in] hash The hash of the values before.
+   * @param[in] value The value.
+   *
+   * @return The hash.
+   */
+  static uint32_t Combine( uint32_t hash, uint32_t value );
+
+private:
+
+  /**
+   * A slot of the table.
+   */
+  struct Slot
+  {
+    uint32_t hash;  ///< The hash of the item's key.
+    uint32_t index; ///< The index of the item plus one, or zero if the slot is empty.
+  };
+
+  /**
+   * Resizes the table and adds the indices again.
+   *
+   * @param[in] size The number of slots; a power of two.
+   */
+  void Resize( uint32_t size );
+
+  /**
+   * Adds an index to a slot, knowing the table isn't full.
+   */
+  void Insert( uint32_t hash, uint32_t storedIndex );
+
+private:
+
+  std::vector<Slot> mSlots; ///< The table; its size is zero or a power of two.
+  uint32_t mCount;          ///< The number of indices added.
+};
+
+} // namespace Internal
+
+} // namespace TextAbstraction
+
+} // namespace Dali
+
+#endif // __DALI_INTERNAL_TEXT_ABSTRACTION_HASH_INDEX_H__
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include "interned-strings.h"
+
+namespace Dali
+{
+
+namespace TextAbstraction
+{
+
+namespace Internal
+{
+
+InternedStrings::InternedStrings()
+: mStrings(),
+  mIndex()
+{
+}
+
+InternedStrings::~InternedStrings()
+{
+}
+
+uint32_t InternedStrings::Intern( const std::string& string )
+{
+  const uint32_t hash = HashIndex::Hash( string );
+
+  uint32_t id = 0u;
+  if( !Find( string, hash, id ) )
+  {
+    id = mStrings.size();
+    mStrings.push_back( string );
+    mIndex.Add( hash, id );
+  }
+
+  return id;
+}
+
+bool InternedStrings::Find( const std::string& string, uint32_t& id ) const
+{
+  return Find( string, HashIndex::Hash( string ), id );
+}
+
+const std::string& InternedStrings::Get( uint32_t id ) const
+{
+  return mStrings[id];
+}
+
+uint32_t InternedStrings::GetCount() const
+{
+  return mStrings.size();
+}
+
+bool InternedStrings::Find( const std::string& string, uint32_t hash, uint32_t& id ) const
+{
+  uint32_t slot = HashIndex::START;
+  while( mIndex.Find( hash, slot, id ) )
+  {
+    if( mStrings[id] == string )
+    {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+} // namespace Internal
+
+} // namespace TextAbstraction
+
+} // namespace Dali
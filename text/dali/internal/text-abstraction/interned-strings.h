@@ -0,0 +1,112 @@
+#ifndef __DALI_INTERNAL_TEXT_ABSTRACTION_INTERNED_STRINGS_H__
+#define __DALI_INTERNAL_TEXT_ABSTRACTION_INTERNED_STRINGS_H__
+
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include <dali/internal/text-abstraction/hash-index.h>
+
+namespace Dali
+{
+
+namespace TextAbstraction
+{
+
+namespace Internal
+{
+
+/**
+ * Gives each different string, e.g. a font family or a font file's path, an id, so the keys of the
+ * font client's caches are compared as integers rather than as strings.
+ */
+class InternedStrings
+{
+public:
+
+  /**
+   * Constructor.
+   */
+  InternedStrings();
+
+  /**
+   * Non-virtual destructor; not intended as a base class.
+   */
+  ~InternedStrings();
+
+  /**
+   * Retrieves the id of a string, adding the string if it hasn't been added before.
+   *
+   * @param[in] string The string.
+   *
+   * @return The id of the string.
+   */
+  uint32_t Intern( const std::string& string );
+
+  /**
+   * Finds the id of a string without adding it, so strings which are only looked up are not kept.
+   *
+   * @param[in] string The string.
+   * @param[out] id The id of the string.
+   *
+   * @return @e true if the string has been added.
+   */
+  bool Find( const std::string& string, uint32_t& id ) const;
+
+  /**
+   * @param[in] id The id of a string.
+   *
+   * @return The string.
+   */
+  const std::string& Get( uint32_t id ) const;
+
+  /**
+   * @return The number of strings added.
+   */
+  uint32_t GetCount() const;
+
+private:
+
+  /**
+   * Finds the id of a string knowing its hash.
+   */
+  bool Find( const std::string& string, uint32_t hash, uint32_t& id ) const;
+
+  // Undefined
+  InternedStrings( const InternedStrings& );
+
+  // Undefined
+  InternedStrings& operator=( const InternedStrings& );
+
+private:
+
+  std::vector<std::string> mStrings; ///< The strings, by id.
+  HashIndex mIndex;                  ///< The ids of the strings by their hash.
+};
+
+} // namespace Internal
+
+} // namespace TextAbstraction
+
+} // namespace Dali
+
+#endif // __DALI_INTERNAL_TEXT_ABSTRACTION_INTERNED_STRINGS_H__
@@ -0,0 +1,224 @@
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include "shaped-run-cache.h"
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+
+namespace Dali
+{
+
+namespace TextAbstraction
+{
+
+namespace Internal
+{
+
+namespace
+{
+
+const uint32_t FNV_OFFSET_BASIS = 2166136261u;
+const uint32_t FNV_PRIME = 16777619u;
+
+/**
+ * The bytes used by a run besides its characters and glyphs: the list and map nodes and the vectors.
+ */
+const std::size_t ITEM_OVERHEAD = 128u;
+
+} // unnamed namespace
+
+bool ShapedRunCache::Key::operator<( const Key& key ) const
+{
+  if( hash != key.hash )
+  {
+    return hash < key.hash;
+  }
+  if( numberOfCharacters != key.numberOfCharacters )
+  {
+    return numberOfCharacters < key.numberOfCharacters;
+  }
+  if( fontId != key.fontId )
+  {
+    return fontId < key.fontId;
+  }
+  if( script != key.script )
+  {
+    return script < key.script;
+  }
+  return rightToLeft < key.rightToLeft;
+}
+
+ShapedRunCache::ShapedRunCache( std::size_t maximumSize )
+: mItems(),
+  mItemMap(),
+  mSize( 0u ),
+  mMaximumSize( maximumSize ),
+  mHitCount( 0u ),
+  mMissCount( 0u ),
+  mEvictionCount( 0u )
+{
+}
+
+ShapedRunCache::~ShapedRunCache()
+{
+}
+
+const ShapedRunCache::Run* ShapedRunCache::Find( const Character* const text,
+                                                 Length numberOfCharacters,
+                                                 FontId fontId,
+                                                 Script script,
+                                                 bool rightToLeft )
+{
+  ItemMap::iterator it = mItemMap.find( MakeKey( text, numberOfCharacters, fontId, script, rightToLeft ) );
+  if( ( it == mItemMap.end() ) ||
+      !std::equal( text, text + numberOfCharacters, it->second->text.begin() ) )
+  {
+    ++mMissCount;
+    return NULL;
+  }
+
+  ++mHitCount;
+
+  // Make it the most recently used.
+  mItems.splice( mItems.begin(), mItems, it->second );
+
+  return &it->second->run;
+}
+
+void ShapedRunCache::Add( const Character* const text,
+                          Length numberOfCharacters,
+                          FontId fontId,
+                          Script script,
+                          bool rightToLeft,
+                          Length numberOfGlyphs,
+                          const GlyphIndex* const indices,
+                          const float* const advance,
+                          const float* const offset,
+                          const CharacterIndex* const characterMap )
+{
+  const std::size_t size = ITEM_OVERHEAD +
+                           numberOfCharacters * sizeof( Character ) +
+                           numberOfGlyphs * ( sizeof( GlyphIndex ) + 3u * sizeof( float ) + sizeof( CharacterIndex ) );
+  if( size > mMaximumSize )
+  {
+    return;
+  }
+
+  const Key key = MakeKey( text, numberOfCharacters, fontId, script, rightToLeft );
+
+  // Replaces a run with the same key, which is a different text with the same hash if it's been found before.
+  ItemMap::iterator it = mItemMap.find( key );
+  if( it != mItemMap.end() )
+  {
+    Remove( it->second );
+  }
+
+  EvictTo( mMaximumSize - size );
+
+  mItems.push_front( Item() );
+  Item& item = mItems.front();
+  item.key = key;
+  item.text.assign( text, text + numberOfCharacters );
+  item.run.indices.assign( indices, indices + numberOfGlyphs );
+  item.run.advance.assign( advance, advance + numberOfGlyphs );
+  item.run.offset.assign( offset, offset + 2u * numberOfGlyphs );
+  item.run.characterMap.assign( characterMap, characterMap + numberOfGlyphs );
+  item.size = size;
+
+  mItemMap.insert( ItemMap::value_type( key, mItems.begin() ) );
+  mSize += size;
+}
+
+void ShapedRunCache::Clear()
+{
+  mItems.clear();
+  mItemMap.clear();
+  mSize = 0u;
+}
+
+void ShapedRunCache::SetMaximumSize( std::size_t maximumSize )
+{
+  mMaximumSize = maximumSize;
+  EvictTo( maximumSize );
+}
+
+std::size_t ShapedRunCache::GetSize() const
+{
+  return mSize;
+}
+
+std::size_t ShapedRunCache::GetCount() const
+{
+  return mItemMap.size();
+}
+
+unsigned int ShapedRunCache::GetHitCount() const
+{
+  return mHitCount;
+}
+
+unsigned int ShapedRunCache::GetMissCount() const
+{
+  return mMissCount;
+}
+
+unsigned int ShapedRunCache::GetEvictionCount() const
+{
+  return mEvictionCount;
+}
+
+ShapedRunCache::Key ShapedRunCache::MakeKey( const Character* const text, Length numberOfCharacters, FontId fontId, Script script, bool rightToLeft )
+{
+  // FNV-1a of the characters.
+  uint32_t hash = FNV_OFFSET_BASIS;
+  for( Length index = 0u; index < numberOfCharacters; ++index )
+  {
+    hash = ( hash ^ *( text + index ) ) * FNV_PRIME;
+  }
+
+  Key key;
+  key.hash = hash;
+  key.numberOfCharacters = numberOfCharacters;
+  key.fontId = fontId;
+  key.script = script;
+  key.rightToLeft = rightToLeft;
+  return key;
+}
+
+void ShapedRunCache::EvictTo( std::size_t size )
+{
+  while( mSize > size )
+  {
+    Remove( --mItems.end() );
+    ++mEvictionCount;
+  }
+}
+
+void ShapedRunCache::Remove( ItemList::iterator item )
+{
+  mSize -= item->size;
+  mItemMap.erase( item->key );
+  mItems.erase( item );
+}
+
+} // namespace Internal
+
+} // namespace TextAbstraction
+
+} // namespace Dali
@@ -0,0 +1,226 @@
+#ifndef __DALI_INTERNAL_TEXT_ABSTRACTION_SHAPED_RUN_CACHE_H__
+#define __DALI_INTERNAL_TEXT_ABSTRACTION_SHAPED_RUN_CACHE_H__
+
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <cstddef>
+#include <list>
+#include <map>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include <dali/devel-api/text-abstraction/script.h>
+#include <dali/devel-api/text-abstraction/text-abstraction-definitions.h>
+
+namespace Dali
+{
+
+namespace TextAbstraction
+{
+
+namespace Internal
+{
+
+/**
+ * A cache of the output of the shaper, so a run of text shaped again with the same font, script and
+ * direction doesn't go through HarfBuzz again. Views recycling their items shape the same labels over and over.
+ *
+ * The runs are found by a hash of their characters, and are evicted least recently used first when
+ * the memory they use exceeds a maximum.
+ */
+class ShapedRunCache
+{
+public:
+
+  /**
+   * The glyphs of a shaped run.
+   */
+  struct Run
+  {
+    std::vector<GlyphIndex>     indices;      ///< The glyph indices.
+    std::vector<float>          advance;      ///< The advance of each glyph.
+    std::vector<float>          offset;       ///< The x and y offsets of each glyph.
+    std::vector<CharacterIndex> characterMap; ///< The first character of each glyph.
+  };
+
+  /**
+   * Constructor.
+   *
+   * @param[in] maximumSize The maximum number of bytes used by the runs cached.
+   */
+  ShapedRunCache( std::size_t maximumSize );
+
+  /**
+   * Non-virtual destructor; not intended as a base class.
+   */
+  ~ShapedRunCache();
+
+  /**
+   * Finds the glyphs a run of text was shaped to, and makes it the most recently used.
+   *
+   * @param[in] text The characters of the run.
+   * @param[in] numberOfCharacters The number of characters.
+   * @param[in] fontId The font the run was shaped with.
+   * @param[in] script The script the run was shaped with.
+   * @param[in] rightToLeft Whether the run was shaped right to left.
+   *
+   * @return The glyphs, or NULL if the run is not cached. Valid until the cache is next changed.
+   */
+  const Run* Find( const Character* const text,
+                   Length numberOfCharacters,
+                   FontId fontId,
+                   Script script,
+                   bool rightToLeft );
+
+  /**
+   * Adds the glyphs a run of text was shaped to, evicting the least recently used runs to make room.
+   * Nothing is added if the run alone would use more than the maximum size.
+   *
+   * @param[in] text The characters of the run.
+   * @param[in] numberOfCharacters The number of characters.
+   * @param[in] fontId The font the run was shaped with.
+   * @param[in] script The script the run was shaped with.
+   * @param[in] rightToLeft Whether the run was shaped right to left.
+   * @param[in] numberOfGlyphs The number of glyphs.
+   * @param[in] indices The glyph indices.
+   * @param[in] advance The advance of each glyph.
+   * @param[in] offset The x and y offsets of each glyph; twice the number of glyphs.
+   * @param[in] characterMap The first character of each glyph.
+   */
+  void Add( const Character* const text,
+            Length numberOfCharacters,
+            FontId fontId,
+            Script script,
+            bool rightToLeft,
+            Length numberOfGlyphs,
+            const GlyphIndex* const indices,
+            const float* const advance,
+            const float* const offset,
+            const CharacterIndex* const characterMap );
+
+  /**
+   * Removes all the runs, e.g. when the size the fonts are rendered at changes. The counters are kept.
+   */
+  void Clear();
+
+  /**
+   * Sets the maximum number of bytes used by the runs cached, evicting runs if they now use more.
+   *
+   * @param[in] maximumSize The maximum size in bytes; zero disables the cache.
+   */
+  void SetMaximumSize( std::size_t maximumSize );
+
+  /**
+   * @return The number of bytes used by the runs cached.
+   */
+  std::size_t GetSize() const;
+
+  /**
+   * @return The number of runs cached.
+   */
+  std::size_t GetCount() const;
+
+  /**
+   * @return The number of times Find() found a run.
+   */
+  unsigned int GetHitCount() const;
+
+  /**
+   * @return The number of times Find() didn't find a run.
+   */
+  unsigned int GetMissCount() const;
+
+  /**
+   * @return The number of runs evicted to keep within the maximum size.
+   */
+  unsigned int GetEvictionCount() const;
+
+private:
+
+  /**
+   * What a run is found by. The hash is of the characters, which are compared too, as different texts may have the same hash.
+   */
+  struct Key
+  {
+    bool operator<( const Key& key ) const;
+
+    uint32_t hash;               ///< The hash of the characters.
+    Length   numberOfCharacters; ///< The number of characters.
+    FontId   fontId;             ///< The font.
+    Script   script;             ///< The script.
+    bool     rightToLeft;        ///< The direction.
+  };
+
+  /**
+   * A cached run, kept in a list in the order it was used.
+   */
+  struct Item
+  {
+    Key                    key;  ///< What the run is found by.
+    std::vector<Character> text; ///< The characters of the run.
+    Run                    run;  ///< The glyphs.
+    std::size_t            size; ///< The number of bytes used.
+  };
+
+  typedef std::list<Item> ItemList;
+  typedef std::map<Key, ItemList::iterator> ItemMap;
+
+  /**
+   * Builds the key of a run.
+   */
+  static Key MakeKey( const Character* const text, Length numberOfCharacters, FontId fontId, Script script, bool rightToLeft );
+
+  /**
+   * Evicts the least recently used runs until the runs use no more than a size.
+   *
+   * @param[in] size The size in bytes.
+   */
+  void EvictTo( std::size_t size );
+
+  /**
+   * Removes a run.
+   *
+   * @param[in] item The run.
+   */
+  void Remove( ItemList::iterator item );
+
+  // Undefined
+  ShapedRunCache( const ShapedRunCache& );
+
+  // Undefined
+  ShapedRunCache& operator=( const ShapedRunCache& );
+
+private:
+
+  ItemList     mItems;         ///< The runs, most recently used first.
+  ItemMap      mItemMap;       ///< The runs by key.
+  std::size_t  mSize;          ///< The number of bytes used by the runs.
+  std::size_t  mMaximumSize;   ///< The maximum number of bytes used by the runs.
+  unsigned int mHitCount;      ///< The number of times a run was found.
+  unsigned int mMissCount;     ///< The number of times a run wasn't found.
+  unsigned int mEvictionCount; ///< The number of runs evicted.
+};
+
+} // namespace Internal
+
+} // namespace TextAbstraction
+
+} // namespace Dali
+
+#endif // __DALI_INTERNAL_TEXT_ABSTRACTION_SHAPED_RUN_CACHE_H__
@@ -19,16 +19,20 @@
 #include "shaping-impl.h"
 
 // INTERNAL INCLUDES
+#include <dali/internal/text-abstraction/shaped-run-cache.h>
 #include <singleton-service-impl.h>
 #include <dali/devel-api/text-abstraction/font-client.h>
 #include <dali/devel-api/text-abstraction/glyph-info.h>
 #include <dali/integration-api/debug.h>
+#include <portable/scoped-trace.h>
 
 // EXTERNAL INCLUDES
 #include <harfbuzz/hb.h>
 #include <harfbuzz/hb-ft.h>
 
 #include <ft2build.h>
+#include <algorithm>
+#include <vector>
 
 namespace Dali
 {
@@ -39,6 +43,16 @@ namespace TextAbstraction
 namespace Internal
 {
 
+namespace
+{
+
+#if defined(DEBUG_ENABLED)
+Dali::Integration::Log::Filter* gLogFilter = Dali::Integration::Log::Filter::New(Debug::NoLogging, false, "LOG_SHAPING");
+#endif
+
+} // unnamed namespace
+
+const std::size_t  SHAPED_RUN_CACHE_SIZE = 256u * 1024u; ///< The maximum number of bytes used by the cached shaped runs.
 const char*        DEFAULT_LANGUAGE = "en";
 const unsigned int DEFAULT_LANGUAGE_LENGTH = 2u;
 const float        FROM_266 = 1.0f / 64.0f;
@@ -85,8 +99,31 @@ const hb_script_t SCRIPT_TO_HARFBUZZ[] =
 
 struct Shaping::Plugin
 {
+  /**
+   * Caches the FreeType face and the HarfBuzz font of a font id, so the font file is only opened and parsed
+   * the first time a text is shaped with it. Mirrors the FontClient::Plugin's cache, which is indexed by the font id too.
+   */
+  struct FontCacheItem
+  {
+    FontCacheItem()
+    : mFreeTypeFace( NULL ),
+      mHarfBuzzFont( NULL ),
+      mHorizontalDpi( 0u ),
+      mVerticalDpi( 0u )
+    {
+    }
+
+    FT_Face      mFreeTypeFace;  ///< The FreeType face, or NULL if it has not been created.
+    hb_font_t*   mHarfBuzzFont;  ///< The HarfBuzz font created from the face at its current size.
+    unsigned int mHorizontalDpi; ///< The horizontal dpi the face's size was set with.
+    unsigned int mVerticalDpi;   ///< The vertical dpi the face's size was set with.
+  };
+
   Plugin()
   : mFreeTypeLibrary( NULL ),
+    mHarfBuzzBuffer( NULL ),
+    mFontCache(),
+    mShapedRunCache( SHAPED_RUN_CACHE_SIZE ),
     mIndices(),
     mAdvance(),
     mCharacterMap(),
@@ -96,6 +133,30 @@ struct Shaping::Plugin
 
   ~Plugin()
   {
+    DALI_LOG_INFO( gLogFilter, Debug::General, "Shaped run cache: %u hits, %u misses, %u evictions\n",
+                   mShapedRunCache.GetHitCount(), mShapedRunCache.GetMissCount(), mShapedRunCache.GetEvictionCount() );
+
+    for( std::vector<FontCacheItem>::iterator it = mFontCache.begin(),
+           endIt = mFontCache.end();
+         it != endIt;
+         ++it )
+    {
+      FontCacheItem& item = *it;
+      if( NULL != item.mHarfBuzzFont )
+      {
+        hb_font_destroy( item.mHarfBuzzFont );
+      }
+      if( NULL != item.mFreeTypeFace )
+      {
+        FT_Done_Face( item.mFreeTypeFace );
+      }
+    }
+
+    if( NULL != mHarfBuzzBuffer )
+    {
+      hb_buffer_destroy( mHarfBuzzBuffer );
+    }
+
     FT_Done_FreeType( mFreeTypeLibrary );
   }
 
@@ -106,6 +167,78 @@ struct Shaping::Plugin
     {
       DALI_LOG_ERROR( "FreeType Init error: %d\n", error );
     }
+
+    // The buffer is reset and reused for every text shaped.
+    mHarfBuzzBuffer = hb_buffer_create();
+  }
+
+  /**
+   * Retrieves the HarfBuzz font for a font id, creating the FreeType face and the HarfBuzz font the first time
+   * the font id is used, or again if the dpi has changed since.
+   *
+   * @param[in] fontId The font id.
+   *
+   * @return The HarfBuzz font, or NULL if the font file can't be opened.
+   */
+  hb_font_t* GetHarfBuzzFont( FontId fontId )
+  {
+    if( 0u == fontId )
+    {
+      return NULL;
+    }
+
+    if( fontId > mFontCache.size() )
+    {
+      mFontCache.resize( fontId );
+    }
+    FontCacheItem& item = mFontCache[fontId - 1u];
+
+    TextAbstraction::FontClient fontClient = TextAbstraction::FontClient::Get();
+
+    if( NULL == item.mFreeTypeFace )
+    {
+      // Get the font's path file name from the font Id.
+      FontDescription fontDescription;
+      fontClient.GetDescription( fontId, fontDescription );
+
+      // Create a FreeType font's face.
+      FT_Error retVal = FT_New_Face( mFreeTypeLibrary, fontDescription.path.c_str(), 0u, &item.mFreeTypeFace );
+      if( FT_Err_Ok != retVal )
+      {
+        DALI_LOG_ERROR( "Failed to open face: %s\n", fontDescription.path.c_str() );
+        item.mFreeTypeFace = NULL;
+        return NULL;
+      }
+    }
+
+    unsigned int horizontalDpi = 0u;
+    unsigned int verticalDpi = 0u;
+    fontClient.GetDpi( horizontalDpi, verticalDpi );
+
+    if( ( NULL == item.mHarfBuzzFont ) ||
+        ( horizontalDpi != item.mHorizontalDpi ) ||
+        ( verticalDpi != item.mVerticalDpi ) )
+    {
+      FT_Set_Char_Size( item.mFreeTypeFace,
+                        0u,
+                        fontClient.GetPointSize( fontId ),
+                        horizontalDpi,
+                        verticalDpi );
+
+      // The HarfBuzz font takes the face's scale when it's created.
+      if( NULL != item.mHarfBuzzFont )
+      {
+        hb_font_destroy( item.mHarfBuzzFont );
+
+        // The runs shaped at the previous dpi have different advances.
+        mShapedRunCache.Clear();
+      }
+      item.mHarfBuzzFont = hb_ft_font_create( item.mFreeTypeFace, NULL );
+      item.mHorizontalDpi = horizontalDpi;
+      item.mVerticalDpi = verticalDpi;
+    }
+
+    return item.mHarfBuzzFont;
   }
 
   Length Shape( const Character* const text,
@@ -113,6 +246,8 @@ struct Shaping::Plugin
                 FontId fontId,
                 Script script )
   {
+    DALI_TRACE_SCOPE( Trace::TEXT, "ShapeText" );
+
     // Clear previoursly shaped texts.
     mIndices.Clear();
     mAdvance.Clear();
@@ -127,39 +262,37 @@ struct Shaping::Plugin
     mCharacterMap.Reserve( numberOfGlyphs );
     mOffset.Reserve( 2u * numberOfGlyphs );
 
-    TextAbstraction::FontClient fontClient = TextAbstraction::FontClient::Get();
-
-    // Get the font's path file name from the font Id.
-    FontDescription fontDescription;
-    fontClient.GetDescription( fontId, fontDescription );
-
-    // Create a FreeType font's face.
-    FT_Face face;
-    FT_Error retVal = FT_New_Face( mFreeTypeLibrary, fontDescription.path.c_str(), 0u, &face );
-    if( FT_Err_Ok != retVal )
+    /* Get our harfbuzz font struct */
+    hb_font_t* harfBuzzFont = GetHarfBuzzFont( fontId );
+    if( NULL == harfBuzzFont )
     {
-      DALI_LOG_ERROR( "Failed to open face: %s\n", fontDescription.path.c_str() );
       return 0u;
     }
 
-    unsigned int horizontalDpi = 0u;
-    unsigned int verticalDpi = 0u;
-    fontClient.GetDpi( horizontalDpi, verticalDpi );
-
-    FT_Set_Char_Size( face,
-                      0u,
-                      fontClient.GetPointSize( fontId ),
-                      horizontalDpi,
-                      verticalDpi );
+    const bool rtlDirection = IsRightToLeftScript( script );
 
-    /* Get our harfbuzz font struct */
-    hb_font_t* harfBuzzFont;
-    harfBuzzFont = hb_ft_font_create( face, NULL );
+    // Repeated texts, e.g. the labels of recycled list items, take the glyphs they were shaped to before.
+    const ShapedRunCache::Run* const shapedRun = mShapedRunCache.Find( text, numberOfCharacters, fontId, script, rtlDirection );
+    if( NULL != shapedRun )
+    {
+      const Length shapedNumberOfGlyphs = shapedRun->indices.size();
+      mIndices.Resize( shapedNumberOfGlyphs );
+      mAdvance.Resize( shapedNumberOfGlyphs );
+      mCharacterMap.Resize( shapedNumberOfGlyphs );
+      mOffset.Resize( 2u * shapedNumberOfGlyphs );
+
+      std::copy( shapedRun->indices.begin(), shapedRun->indices.end(), mIndices.Begin() );
+      std::copy( shapedRun->advance.begin(), shapedRun->advance.end(), mAdvance.Begin() );
+      std::copy( shapedRun->characterMap.begin(), shapedRun->characterMap.end(), mCharacterMap.Begin() );
+      std::copy( shapedRun->offset.begin(), shapedRun->offset.end(), mOffset.Begin() );
+
+      return shapedNumberOfGlyphs;
+    }
 
-    /* Create a buffer for harfbuzz to use */
-    hb_buffer_t* harfBuzzBuffer = hb_buffer_create();
+    /* Reuse the buffer harfbuzz uses */
+    hb_buffer_t* harfBuzzBuffer = mHarfBuzzBuffer;
+    hb_buffer_reset( harfBuzzBuffer );
 
-    const bool rtlDirection = IsRightToLeftScript( script );
     hb_buffer_set_direction( harfBuzzBuffer,
                              rtlDirection ? HB_DIRECTION_RTL : HB_DIRECTION_LTR ); /* or LTR */
 
@@ -237,10 +370,8 @@ struct Shaping::Plugin
       }
     }
 
-    /* Cleanup */
-    hb_buffer_destroy( harfBuzzBuffer );
-    hb_font_destroy( harfBuzzFont );
-    FT_Done_Face( face );
+    mShapedRunCache.Add( text, numberOfCharacters, fontId, script, rtlDirection,
+                         mIndices.Count(), mIndices.Begin(), mAdvance.Begin(), mOffset.Begin(), mCharacterMap.Begin() );
 
     return mIndices.Count();
   }
@@ -270,13 +401,16 @@ struct Shaping::Plugin
     }
   }
 
-  FT_Library             mFreeTypeLibrary;
+  FT_Library                 mFreeTypeLibrary;
+  hb_buffer_t*               mHarfBuzzBuffer; ///< Reused to shape every text.
+  std::vector<FontCacheItem> mFontCache;      ///< The faces and HarfBuzz fonts, indexed by font id - 1.
+  ShapedRunCache             mShapedRunCache; ///< The glyphs of the runs shaped most recently.
 
-  Vector<CharacterIndex> mIndices;
-  Vector<float>          mAdvance;
-  Vector<float>          mOffset;
-  Vector<CharacterIndex> mCharacterMap;
-  FontId                 mFontId;
+  Vector<CharacterIndex>     mIndices;
+  Vector<float>              mAdvance;
+  Vector<float>              mOffset;
+  Vector<CharacterIndex>     mCharacterMap;
+  FontId                     mFontId;
 };
 
 Shaping::Shaping()